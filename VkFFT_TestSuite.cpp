@@ -79,6 +79,19 @@
 #include "sample_19_precision_VkFFT_quadDoubleDouble_nonPow2.h"
 #endif
 #endif
+#include "sample_20_benchmark_VkFFT_LUT.h"
+#include "sample_21_benchmark_VkFFT_append.h"
+#include "sample_22_calibrate_VkFFT_Bluestein_padding.h"
+#include "sample_23_benchmark_VkFFT_dryRun.h"
+#include "sample_24_precision_VkFFT_reference_DFT.h"
+#include "sample_25_precision_VkFFT_shared_LUT.h"
+#include "sample_26_precision_VkFFT_plan_cache.h"
+#include "sample_27_precision_VkFFT_execution_contexts.h"
+#include "sample_28_precision_VkFFT_descriptor_cache.h"
+#include "sample_29_precision_VkFFT_kernel_dependencies.h"
+#include "sample_30_precision_VkFFT_batches_at_launch.h"
+#include "sample_31_precision_VkFFT_update_configuration.h"
+#include "sample_32_precision_VkFFT_workspace.h"
 #include "sample_50_convolution_VkFFT_single_1d_matrix.h"
 #include "sample_51_convolution_VkFFT_single_3d_matrix_zeropadding_r2c.h"
 #include "sample_52_convolution_VkFFT_single_2d_batched_r2c.h"
@@ -409,6 +422,71 @@ VkFFTResult launchVkFFT(VkGPU* vkGPU, uint64_t sample_id, bool file_output, FILE
     }
 #endif
 #endif
+    case 20:
+    {
+        resFFT = sample_20_benchmark_VkFFT_LUT(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 21:
+    {
+        resFFT = sample_21_benchmark_VkFFT_append(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 22:
+    {
+        resFFT = sample_22_calibrate_VkFFT_Bluestein_padding(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 23:
+    {
+        resFFT = sample_23_benchmark_VkFFT_dryRun(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 24:
+    {
+        resFFT = sample_24_precision_VkFFT_reference_DFT(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 25:
+    {
+        resFFT = sample_25_precision_VkFFT_shared_LUT(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 26:
+    {
+        resFFT = sample_26_precision_VkFFT_plan_cache(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 27:
+    {
+        resFFT = sample_27_precision_VkFFT_execution_contexts(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 28:
+    {
+        resFFT = sample_28_precision_VkFFT_descriptor_cache(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 29:
+    {
+        resFFT = sample_29_precision_VkFFT_kernel_dependencies(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 30:
+    {
+        resFFT = sample_30_precision_VkFFT_batches_at_launch(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 31:
+    {
+        resFFT = sample_31_precision_VkFFT_update_configuration(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
+    case 32:
+    {
+        resFFT = sample_32_precision_VkFFT_workspace(vkGPU, file_output, output, isCompilerInitialized);
+        break;
+    }
     case 50:
     {
         resFFT = sample_50_convolution_VkFFT_single_1d_matrix(vkGPU, file_output, output, isCompilerInitialized);
@@ -575,6 +653,8 @@ int main(int argc, char* argv[])
 		printf("Level Zero backend\n");
 #elif (VKFFT_BACKEND==5)
         printf("Metal backend\n");
+#elif (VKFFT_BACKEND==6)
+		printf("CPU backend\n");
 #endif
 		printf("	-h: print help\n");
 		printf("	-devices: print the list of available device ids, used as -d argument\n");
@@ -635,6 +715,19 @@ int main(int argc, char* argv[])
 #endif
 #endif
 #endif
+		printf("		20 - VkFFT 4-step LUT computation on the host: time and precision of per-value sin/cos and split roots computation\n");
+		printf("		21 - VkFFT FFT + iFFT VkFFTAppend host latency with and without dispatch lists recorded at plan creation\n");
+		printf("		22 - VkFFT Bluestein padding calibration: writes the fastest padding pattern of this device to VkFFT_Bluestein_padding.txt (use it with bluesteinPaddingFile)\n");
+		printf("		23 - VkFFT plan creation time on the device vs device-less dry run (dryRun with a device profile), writes the plan description of the last system to VkFFT_plan_description.txt\n");
+		printf("		24 - VkFFT C2C FFT + iFFT precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		25 - VkFFT LUT and Bluestein buffer sharing between applications (shareLUT), precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		26 - VkFFT in-process plan cache (usePlanCache): an application with a cached configuration has to skip compilation, precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		27 - VkFFT execution contexts (VkFFTCreateExecutionContext) launched from several threads, precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		28 - VkFFT launches with alternating buffers (descriptorSetCacheSize, usePushDescriptors on Vulkan), precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		29 - VkFFT multi-kernel transforms, in-place and out-of-place, with consecutive launches in one submit, precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		30 - VkFFT number of batches and batch stride selected at launch (specifyBatchesAtLaunch), precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		31 - VkFFT plan updates of one application (VkFFTUpdateConfiguration), precision test against a naive long double DFT, does not require FFTW\n");
+		printf("		32 - VkFFT temp and Bluestein buffers in user workspace (VkFFTGetWorkspaceSize), precision test against a naive long double DFT, does not require FFTW\n");
 		printf("		50 - convolution example with identity kernel\n");
 		printf("		51 - zeropadding convolution example with identity kernel\n");
 		printf("		52 - batched convolution example with identity kernel\n");
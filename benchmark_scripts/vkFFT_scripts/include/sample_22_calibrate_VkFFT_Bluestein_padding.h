@@ -0,0 +1,4 @@
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_22_calibrate_VkFFT_Bluestein_padding(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized);
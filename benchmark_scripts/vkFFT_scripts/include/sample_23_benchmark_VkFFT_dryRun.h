@@ -0,0 +1,4 @@
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_23_benchmark_VkFFT_dryRun(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized);
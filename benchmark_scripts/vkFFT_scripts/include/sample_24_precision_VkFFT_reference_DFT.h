@@ -0,0 +1,4 @@
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_24_precision_VkFFT_reference_DFT(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized);
@@ -0,0 +1,4 @@
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_25_precision_VkFFT_shared_LUT(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized);
@@ -0,0 +1,4 @@
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_31_precision_VkFFT_update_configuration(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized);
@@ -56,6 +56,20 @@ typedef struct {
 	uint64_t loadApplicationFromString;
 } VkFFTUserSystemParameters;//an example structure used to pass user-defined system for benchmarking
 
+typedef struct {
+#if(VKFFT_BACKEND==0)
+	VkBuffer buffer;
+	VkDeviceMemory bufferDeviceMemory;
+#elif(VKFFT_BACKEND==3)
+	cl_mem buffer;
+#elif(VKFFT_BACKEND==5)
+	MTL::Buffer* buffer;
+#else
+	void* buffer;
+#endif
+	uint64_t bufferSize;
+} VkFFTTestBuffer;//device buffer of the reference DFT tests, allocated with allocateTestBuffer
+
 #if(VKFFT_BACKEND==0)
 VkResult CreateDebugUtilsMessengerEXT(VkGPU* vkGPU, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pDebugMessenger);
 void DestroyDebugUtilsMessengerEXT(VkGPU* vkGPU, const VkAllocationCallbacks* pAllocator);
@@ -77,4 +91,9 @@ VkFFTResult transferDataFromCPU(VkGPU* vkGPU, void* cpu_arr, void* input_buffer,
 VkFFTResult devices_list();
 VkFFTResult performVulkanFFT(VkGPU* vkGPU, VkFFTApplication* app, VkFFTLaunchParams* launchParams, int inverse, uint64_t num_iter);
 VkFFTResult performVulkanFFTiFFT(VkGPU* vkGPU, VkFFTApplication* app, VkFFTLaunchParams* launchParams, uint64_t num_iter, double* time_result);
+double referenceDFTError(void* cpu_arr, void* input, uint64_t precision, uint64_t FFTdim, uint64_t* size, uint64_t numberBatches, int inverse);
+void setTestDeviceConfiguration(VkGPU* vkGPU, VkFFTConfiguration* configuration, uint64_t isCompilerInitialized);
+VkFFTResult allocateTestBuffer(VkGPU* vkGPU, VkFFTTestBuffer* buffer, uint64_t bufferSize);
+void freeTestBuffer(VkGPU* vkGPU, VkFFTTestBuffer* buffer);
+VkFFTResult referenceTestVkFFT(VkGPU* vkGPU, VkFFTApplication* app, VkFFTLaunchParams* launchParams, VkFFTTestBuffer* inputBuffer, VkFFTTestBuffer* outputBuffer, uint64_t FFTdim, uint64_t* size, uint64_t numberBatches, double* error_forward, double* error_inverse);
 #endif
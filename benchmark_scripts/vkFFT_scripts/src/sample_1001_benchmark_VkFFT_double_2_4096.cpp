@@ -108,7 +108,7 @@ VkFFTResult sample_1001_benchmark_VkFFT_double_2_4096(VkGPU* vkGPU, uint64_t fil
 			//After this, configuration file contains pointers to Vulkan objects needed to work with the GPU: VkDevice* device - created device, [uint64_t *bufferSize, VkBuffer *buffer, VkDeviceMemory* bufferDeviceMemory] - allocated GPU memory FFT is performed on. [uint64_t *kernelSize, VkBuffer *kernel, VkDeviceMemory* kernelDeviceMemory] - allocated GPU memory, where kernel for convolution is stored.
 #if(VKFFT_BACKEND==5)
             configuration.device = vkGPU->device;
-#else
+#elif(VKFFT_BACKEND!=6)
             configuration.device = &vkGPU->device;
 #endif
 #if(VKFFT_BACKEND==0)
@@ -161,6 +161,11 @@ VkFFTResult sample_1001_benchmark_VkFFT_double_2_4096(VkGPU* vkGPU, uint64_t fil
             MTL::Buffer* buffer = 0;
             buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
             configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+			void* buffer = 0;
+			buffer = malloc(bufferSize);
+			if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
+			configuration.buffer = &buffer;
 #endif
 
 			configuration.bufferSize = &bufferSize;
@@ -273,6 +278,8 @@ VkFFTResult sample_1001_benchmark_VkFFT_double_2_4096(VkGPU* vkGPU, uint64_t fil
 			zeMemFree(vkGPU->context, buffer);
 #elif(VKFFT_BACKEND==5)
             buffer->release();
+#elif(VKFFT_BACKEND==6)
+			free(buffer);
 #endif
 			deleteVkFFT(&app);
 
@@ -156,7 +156,7 @@ VkFFTResult sample_11_precision_VkFFT_single(VkGPU* vkGPU, uint64_t file_output,
 			//After this, configuration file contains pointers to Vulkan objects needed to work with the GPU: VkDevice* device - created device, [uint64_t *bufferSize, VkBuffer *buffer, VkDeviceMemory* bufferDeviceMemory] - allocated GPU memory FFT is performed on. [uint64_t *kernelSize, VkBuffer *kernel, VkDeviceMemory* kernelDeviceMemory] - allocated GPU memory, where kernel for convolution is stored.
 #if(VKFFT_BACKEND==5)
             configuration.device = vkGPU->device;
-#else
+#elif(VKFFT_BACKEND!=6)
             configuration.device = &vkGPU->device;
 #endif
 #if(VKFFT_BACKEND==0)
@@ -199,6 +199,8 @@ VkFFTResult sample_11_precision_VkFFT_single(VkGPU* vkGPU, uint64_t file_output,
 			void* buffer = 0;
 #elif(VKFFT_BACKEND==5)
             MTL::Buffer* buffer = 0;
+#elif(VKFFT_BACKEND==6)
+			void* buffer = 0;
 #endif
 			for (uint64_t i = 0; i < numBuf; i++) {
 #if(VKFFT_BACKEND==0)
@@ -222,6 +224,9 @@ VkFFTResult sample_11_precision_VkFFT_single(VkGPU* vkGPU, uint64_t file_output,
 				if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
 #elif(VKFFT_BACKEND==5)
                 buffer = vkGPU->device->newBuffer(bufferSize[i], MTL::ResourceStorageModePrivate);
+#elif(VKFFT_BACKEND==6)
+				buffer = malloc(bufferSize[i]);
+				if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
 #endif
 			}
 
@@ -269,6 +274,8 @@ VkFFTResult sample_11_precision_VkFFT_single(VkGPU* vkGPU, uint64_t file_output,
 			launchParams.buffer = (void**)&buffer;
 #elif(VKFFT_BACKEND==5)
             launchParams.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+			launchParams.buffer = &buffer;
 #endif
 			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, -1, num_iter);
 			if (resFFT != VKFFT_SUCCESS) return resFFT;
@@ -357,6 +364,8 @@ VkFFTResult sample_11_precision_VkFFT_single(VkGPU* vkGPU, uint64_t file_output,
 				zeMemFree(vkGPU->context, buffer);
 #elif(VKFFT_BACKEND==5)
                 buffer->release();
+#elif(VKFFT_BACKEND==6)
+				free(buffer);
 #endif
 			}
 #if(VKFFT_BACKEND==0)
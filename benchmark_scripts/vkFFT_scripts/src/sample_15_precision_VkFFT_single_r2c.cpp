@@ -245,7 +245,7 @@ VkFFTResult sample_15_precision_VkFFT_single_r2c(VkGPU* vkGPU, uint64_t file_out
 			//After this, configuration file contains pointers to Vulkan objects needed to work with the GPU: VkDevice* device - created device, [uint64_t *bufferSize, VkBuffer *buffer, VkDeviceMemory* bufferDeviceMemory] - allocated GPU memory FFT is performed on. [uint64_t *kernelSize, VkBuffer *kernel, VkDeviceMemory* kernelDeviceMemory] - allocated GPU memory, where kernel for convolution is stored.
 #if(VKFFT_BACKEND==5)
             configuration.device = vkGPU->device;
-#else
+#elif(VKFFT_BACKEND!=6)
             configuration.device = &vkGPU->device;
 #endif
 #if(VKFFT_BACKEND==0)
@@ -302,6 +302,9 @@ VkFFTResult sample_15_precision_VkFFT_single_r2c(VkGPU* vkGPU, uint64_t file_out
 #elif(VKFFT_BACKEND==5)
             MTL::Buffer* ibuffer = 0;
             MTL::Buffer* buffer = 0;
+#elif(VKFFT_BACKEND==6)
+			void* ibuffer = 0;
+			void* buffer = 0;
 #endif
 			for (uint64_t i = 0; i < numBuf; i++) {
 #if(VKFFT_BACKEND==0)
@@ -338,6 +341,11 @@ VkFFTResult sample_15_precision_VkFFT_single_r2c(VkGPU* vkGPU, uint64_t file_out
 #elif(VKFFT_BACKEND==5)
                 ibuffer = vkGPU->device->newBuffer(inputBufferSize[i], MTL::ResourceStorageModePrivate);
                 buffer = vkGPU->device->newBuffer(bufferSize[i], MTL::ResourceStorageModePrivate);
+#elif(VKFFT_BACKEND==6)
+				ibuffer = malloc(inputBufferSize[i]);
+				if (!ibuffer) return VKFFT_ERROR_MALLOC_FAILED;
+				buffer = malloc(bufferSize[i]);
+				if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
 #endif
 			}
 			configuration.inputBufferNum = numBuf;
@@ -389,6 +397,9 @@ VkFFTResult sample_15_precision_VkFFT_single_r2c(VkGPU* vkGPU, uint64_t file_out
 #elif(VKFFT_BACKEND==5)
             launchParams.inputBuffer = &ibuffer;
             launchParams.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+			launchParams.inputBuffer = &ibuffer;
+			launchParams.buffer = &buffer;
 #endif
 			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, -1, num_iter);
 			if (resFFT != VKFFT_SUCCESS) return resFFT;
@@ -411,6 +422,9 @@ VkFFTResult sample_15_precision_VkFFT_single_r2c(VkGPU* vkGPU, uint64_t file_out
 #elif(VKFFT_BACKEND==5)
             launchParams2.inputBuffer = &ibuffer;
             launchParams2.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+			launchParams2.inputBuffer = &ibuffer;
+			launchParams2.buffer = &buffer;
 #endif
 			resFFT = performVulkanFFT(vkGPU, &app, &launchParams2, 1, num_iter);
 			if (resFFT != VKFFT_SUCCESS) return resFFT;
@@ -515,6 +529,9 @@ VkFFTResult sample_15_precision_VkFFT_single_r2c(VkGPU* vkGPU, uint64_t file_out
 #elif(VKFFT_BACKEND==5)
                 ibuffer->release();
                 buffer->release();
+#elif(VKFFT_BACKEND==6)
+				free(ibuffer);
+				free(buffer);
 #endif
 
 			}
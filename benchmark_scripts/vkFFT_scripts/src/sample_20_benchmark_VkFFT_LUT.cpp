@@ -0,0 +1,154 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+static double sample_20_LUT_error(void* LUT, uint64_t precision, uint64_t stageStartSize, uint64_t fftDim) {
+	//max absolute error of 4-step twiddles exp(2 * pi * i * (i * j) / N), stored at i + j * stageStartSize, checked on a subset of values against long double
+	long double PI = 3.14159265358979323846264338327950288419716939937510L;
+	uint64_t N = stageStartSize * fftDim;
+	double maxError = 0;
+	for (uint64_t id = 0; id < N; id += 127) {
+		uint64_t i = id % stageStartSize;
+		uint64_t j = id / stageStartSize;
+		long double angle = 2 * PI * ((long double)(i * j) / (long double)N);
+		long double value[2];
+		if (precision == 0) {
+			value[0] = ((float*)LUT)[2 * id];
+			value[1] = ((float*)LUT)[2 * id + 1];
+		}
+		else {
+			value[0] = ((double*)LUT)[2 * id];
+			value[1] = ((double*)LUT)[2 * id + 1];
+		}
+		double error = (double)fabsl(value[0] - cosl(angle));
+		if (error > maxError) maxError = error;
+		error = (double)fabsl(value[1] - sinl(angle));
+		if (error > maxError) maxError = error;
+	}
+	return maxError;
+}
+
+VkFFTResult sample_20_benchmark_VkFFT_LUT(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "20 - VkFFT 4-step LUT computation on the host: per-value sin/cos loop vs split roots (time and max error)\n");
+	printf("20 - VkFFT 4-step LUT computation on the host: per-value sin/cos loop vs split roots (time and max error)\n");
+	const int num_benchmark_samples = 4;
+	const uint64_t fftDim = 4096;
+	uint64_t numThreads = std::thread::hardware_concurrency();
+	if (numThreads == 0) numThreads = 1;
+
+	for (uint64_t precision = 0; precision < 2; precision++) {
+		for (int n = 0; n < num_benchmark_samples; n++) {
+			uint64_t N = (uint64_t)1 << (24 + n);
+			uint64_t stageStartSize = N / fftDim;
+			uint64_t elementSize = (precision == 0) ? sizeof(float) : sizeof(double);
+			void* LUT = malloc(2 * N * elementSize);
+			if (!LUT) {
+				if (file_output)
+					fprintf(output, "VkFFT LUT System: %" PRIu64 " %s - skipped, not enough memory\n", (uint64_t)log2(N), (precision == 0) ? "single" : "double");
+				printf("VkFFT LUT System: %" PRIu64 " %s - skipped, not enough memory\n", (uint64_t)log2(N), (precision == 0) ? "single" : "double");
+				continue;
+			}
+			//loop used before the split roots computation
+			auto timeStart = std::chrono::steady_clock::now();
+			if (precision == 0) {
+				float* tempLUT = (float*)LUT;
+				double double_PI = 3.14159265358979323846264338327950288419716939937510;
+				for (uint64_t i = 0; i < stageStartSize; i++) {
+					for (uint64_t j = 0; j < fftDim; j++) {
+						double angle = 2 * double_PI * ((i * j) / (double)(stageStartSize * fftDim));
+						tempLUT[2 * (i + j * stageStartSize)] = (float)pfcos(angle);
+						tempLUT[2 * (i + j * stageStartSize) + 1] = (float)pfsin(angle);
+					}
+				}
+			}
+			else {
+				double* tempLUT = (double*)LUT;
+				pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
+				for (uint64_t i = 0; i < stageStartSize; i++) {
+					for (uint64_t j = 0; j < fftDim; j++) {
+						pfLD angle = 2 * double_PI * ((i * j) / (pfLD)(stageStartSize * fftDim));
+						tempLUT[2 * (i + j * stageStartSize)] = (double)pfcos(angle);
+						tempLUT[2 * (i + j * stageStartSize) + 1] = (double)pfsin(angle);
+					}
+				}
+			}
+			double time_loop = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeStart).count();
+			double error_loop = sample_20_LUT_error(LUT, precision, stageStartSize, fftDim);
+
+			VkFFTConfiguration configuration = {};
+			configuration.numCompileThreads = 1;
+			timeStart = std::chrono::steady_clock::now();
+			resFFT = VkFFT_ComputeLUTTable(&configuration, LUT, precision, 0, N, fftDim, stageStartSize, 1, 0, 0, 1);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(LUT);
+				return resFFT;
+			}
+			double time_split = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeStart).count();
+			double error_split = sample_20_LUT_error(LUT, precision, stageStartSize, fftDim);
+
+			configuration.numCompileThreads = numThreads;
+			timeStart = std::chrono::steady_clock::now();
+			resFFT = VkFFT_ComputeLUTTable(&configuration, LUT, precision, 0, N, fftDim, stageStartSize, 1, 0, 0, 1);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(LUT);
+				return resFFT;
+			}
+			double time_split_threads = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeStart).count();
+			double error_split_threads = sample_20_LUT_error(LUT, precision, stageStartSize, fftDim);
+			free(LUT);
+
+			if (file_output)
+				fprintf(output, "VkFFT LUT System: %" PRIu64 " %" PRIu64 "x%" PRIu64 " %s loop: %0.1f ms max_error: %0.3e split roots 1 thread: %0.1f ms max_error: %0.3e split roots %" PRIu64 " threads: %0.1f ms max_error: %0.3e\n", (uint64_t)log2(N), stageStartSize, fftDim, (precision == 0) ? "single" : "double", time_loop, error_loop, time_split, error_split, numThreads, time_split_threads, error_split_threads);
+			printf("VkFFT LUT System: %" PRIu64 " %" PRIu64 "x%" PRIu64 " %s loop: %0.1f ms max_error: %0.3e split roots 1 thread: %0.1f ms max_error: %0.3e split roots %" PRIu64 " threads: %0.1f ms max_error: %0.3e\n", (uint64_t)log2(N), stageStartSize, fftDim, (precision == 0) ? "single" : "double", time_loop, error_loop, time_split, error_split, numThreads, time_split_threads, error_split_threads);
+		}
+	}
+	return resFFT;
+}
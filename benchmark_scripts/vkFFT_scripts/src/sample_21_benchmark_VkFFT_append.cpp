@@ -0,0 +1,250 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+static VkFFTResult sample_21_append_time(VkGPU* vkGPU, VkFFTApplication* app, uint64_t num_iter, double* time_result) {
+	//host time of num_iter forward + inverse VkFFTAppend calls. Recorded commands are not submitted on the APIs with command buffers/lists
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTLaunchParams launchParams = {};
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	VkCommandBufferAllocateInfo commandBufferAllocateInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+	commandBufferAllocateInfo.commandPool = vkGPU->commandPool;
+	commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	commandBufferAllocateInfo.commandBufferCount = 1;
+	VkCommandBuffer commandBuffer = {};
+	res = vkAllocateCommandBuffers(vkGPU->device, &commandBufferAllocateInfo, &commandBuffer);
+	if (res != 0) return VKFFT_ERROR_FAILED_TO_ALLOCATE_COMMAND_BUFFERS;
+	VkCommandBufferBeginInfo commandBufferBeginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+	commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	res = vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+	if (res != 0) return VKFFT_ERROR_FAILED_TO_BEGIN_COMMAND_BUFFER;
+	launchParams.commandBuffer = &commandBuffer;
+#elif(VKFFT_BACKEND==3)
+	launchParams.commandQueue = &vkGPU->commandQueue;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+	ze_command_list_desc_t commandListDescription = {};
+	commandListDescription.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+	ze_command_list_handle_t commandList = {};
+	res = zeCommandListCreate(vkGPU->context, vkGPU->device, &commandListDescription, &commandList);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	launchParams.commandList = &commandList;
+#elif(VKFFT_BACKEND==5)
+	MTL::CommandBuffer* commandBuffer = vkGPU->queue->commandBuffer();
+	if (commandBuffer == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	launchParams.commandBuffer = commandBuffer;
+	MTL::ComputeCommandEncoder* commandEncoder = commandBuffer->computeCommandEncoder();
+	if (commandEncoder == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	launchParams.commandEncoder = commandEncoder;
+#endif
+	std::chrono::steady_clock::time_point timeStart = std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < num_iter; i++) {
+		resFFT = VkFFTAppend(app, -1, &launchParams);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		resFFT = VkFFTAppend(app, 1, &launchParams);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	time_result[0] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - timeStart).count();
+#if(VKFFT_BACKEND==0)
+	res = vkEndCommandBuffer(commandBuffer);
+	if (res != 0) return VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	vkFreeCommandBuffers(vkGPU->device, vkGPU->commandPool, 1, &commandBuffer);
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaDeviceSynchronize();
+	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipDeviceSynchronize();
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = clFinish(vkGPU->commandQueue);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==4)
+	res = zeCommandListDestroy(commandList);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_DESTROY_COMMAND_LIST;
+#elif(VKFFT_BACKEND==5)
+	commandEncoder->endEncoding();
+	commandEncoder->release();
+	commandBuffer->release();
+#endif
+	return resFFT;
+}
+
+VkFFTResult sample_21_benchmark_VkFFT_append(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+#elif(VKFFT_BACKEND==5)
+#endif
+	if (file_output)
+		fprintf(output, "21 - VkFFT FFT + iFFT VkFFTAppend host latency: grids recomputed on every call vs dispatch lists recorded at plan creation\n");
+	printf("21 - VkFFT FFT + iFFT VkFFTAppend host latency: grids recomputed on every call vs dispatch lists recorded at plan creation\n");
+	//small systems, so that the GPU doesn't limit the launch rate on the APIs that submit kernels on append
+	const int num_systems = 6;
+	const uint64_t systems[num_systems][5] = { {1, 4096, 1, 1, 0}, {1, 1031, 1, 1, 0}, {1, 1048576, 1, 1, 0}, {2, 512, 512, 1, 1}, {3, 64, 64, 64, 0}, {3, 17, 19, 23, 0} };//FFTdim, size[0], size[1], size[2], performR2C
+	const int num_runs = 3;
+	const uint64_t num_iter = 200;
+	for (int n = 0; n < num_systems; n++) {
+		double append_time[2] = { 0, 0 };
+		uint64_t numKernels[2] = { 0, 0 };
+		for (uint64_t disableDispatchList = 0; disableDispatchList < 2; disableDispatchList++) {
+			VkFFTConfiguration configuration = {};
+			VkFFTApplication app = {};
+			configuration.FFTdim = systems[n][0];
+			configuration.size[0] = systems[n][1];
+			configuration.size[1] = systems[n][2];
+			configuration.size[2] = systems[n][3];
+			configuration.performR2C = systems[n][4];
+			configuration.disableDispatchList = disableDispatchList;
+#if(VKFFT_BACKEND==5)
+			configuration.device = vkGPU->device;
+#elif(VKFFT_BACKEND!=6)
+			configuration.device = &vkGPU->device;
+#endif
+#if(VKFFT_BACKEND==0)
+			configuration.queue = &vkGPU->queue;
+			configuration.fence = &vkGPU->fence;
+			configuration.commandPool = &vkGPU->commandPool;
+			configuration.physicalDevice = &vkGPU->physicalDevice;
+			configuration.isCompilerInitialized = isCompilerInitialized;
+#elif(VKFFT_BACKEND==3)
+			configuration.context = &vkGPU->context;
+#elif(VKFFT_BACKEND==4)
+			configuration.context = &vkGPU->context;
+			configuration.commandQueue = &vkGPU->commandQueue;
+			configuration.commandQueueID = vkGPU->commandQueueID;
+#elif(VKFFT_BACKEND==5)
+			configuration.queue = vkGPU->queue;
+#endif
+			uint64_t bufferSize = (uint64_t)sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2];
+#if(VKFFT_BACKEND==0)
+			VkBuffer buffer = {};
+			VkDeviceMemory bufferDeviceMemory = {};
+			resFFT = allocateBuffer(vkGPU, &buffer, &bufferDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==1)
+			cuFloatComplex* buffer = 0;
+			res = cudaMalloc((void**)&buffer, bufferSize);
+			if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = (void**)&buffer;
+#elif(VKFFT_BACKEND==2)
+			hipFloatComplex* buffer = 0;
+			res = hipMalloc((void**)&buffer, bufferSize);
+			if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = (void**)&buffer;
+#elif(VKFFT_BACKEND==3)
+			cl_mem buffer = 0;
+			buffer = clCreateBuffer(vkGPU->context, CL_MEM_READ_WRITE, bufferSize, 0, &res);
+			if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==4)
+			void* buffer = 0;
+			ze_device_mem_alloc_desc_t device_desc = {};
+			device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+			res = zeMemAllocDevice(vkGPU->context, &device_desc, bufferSize, sizeof(float), vkGPU->device, &buffer);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==5)
+			MTL::Buffer* buffer = 0;
+			buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+			void* buffer = 0;
+			buffer = malloc(bufferSize);
+			if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
+			configuration.buffer = &buffer;
+#endif
+			configuration.bufferSize = &bufferSize;
+
+			resFFT = initializeVkFFT(&app, configuration);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			if (!disableDispatchList)
+				numKernels[0] = app.dispatchList[0].numEntries + app.dispatchList[1].numEntries;
+			//warm up, then keep the fastest run
+			double run_time = 0;
+			resFFT = sample_21_append_time(vkGPU, &app, 10, &run_time);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			for (int r = 0; r < num_runs; r++) {
+				resFFT = sample_21_append_time(vkGPU, &app, num_iter, &run_time);
+				if (resFFT != VKFFT_SUCCESS) return resFFT;
+				run_time /= num_iter;
+				if ((r == 0) || (run_time < append_time[disableDispatchList])) append_time[disableDispatchList] = run_time;
+			}
+#if(VKFFT_BACKEND==0)
+			vkDestroyBuffer(vkGPU->device, buffer, NULL);
+			vkFreeMemory(vkGPU->device, bufferDeviceMemory, NULL);
+#elif(VKFFT_BACKEND==1)
+			cudaFree(buffer);
+#elif(VKFFT_BACKEND==2)
+			hipFree(buffer);
+#elif(VKFFT_BACKEND==3)
+			clReleaseMemObject(buffer);
+#elif(VKFFT_BACKEND==4)
+			zeMemFree(vkGPU->context, buffer);
+#elif(VKFFT_BACKEND==5)
+			buffer->release();
+#elif(VKFFT_BACKEND==6)
+			free(buffer);
+#endif
+			deleteVkFFT(&app);
+		}
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "D %" PRIu64 "x%" PRIu64 "x%" PRIu64 " %s kernels: %" PRIu64 " FFT + iFFT append time recomputed: %0.2f us dispatch list: %0.2f us\n", systems[n][0], systems[n][1], systems[n][2], systems[n][3], (systems[n][4]) ? "R2C" : "C2C", numKernels[0], append_time[1], append_time[0]);
+		printf("VkFFT System: %" PRIu64 "D %" PRIu64 "x%" PRIu64 "x%" PRIu64 " %s kernels: %" PRIu64 " FFT + iFFT append time recomputed: %0.2f us dispatch list: %0.2f us\n", systems[n][0], systems[n][1], systems[n][2], systems[n][3], (systems[n][4]) ? "R2C" : "C2C", numKernels[0], append_time[1], append_time[0]);
+	}
+	return resFFT;
+}
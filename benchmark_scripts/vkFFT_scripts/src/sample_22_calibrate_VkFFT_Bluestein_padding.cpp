@@ -0,0 +1,264 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+static VkFFTResult sample_22_time_Bluestein_sequence(VkGPU* vkGPU, uint64_t precision, uint64_t sequenceSize, void* buffer_input, uint64_t isCompilerInitialized, double* time_result) {
+	//time of one forward + inverse Bluestein FFT padded to sequenceSize. The system size is the largest prime that fits in sequenceSize, so all of the padding is used
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+#elif(VKFFT_BACKEND==5)
+#endif
+	uint64_t size = (sequenceSize + 1) / 2;
+	while (size > 17) {
+		uint64_t isPrime = 1;
+		for (uint64_t i = 2; i * i <= size; i++) {
+			if (size % i == 0) {
+				isPrime = 0;
+				break;
+			}
+		}
+		if (isPrime) break;
+		size--;
+	}
+	//Configuration + FFT application.
+	VkFFTConfiguration configuration = {};
+	VkFFTApplication app = {};
+	configuration.FFTdim = 1;
+	configuration.size[0] = size;
+	//batch enough systems to keep the GPU busy, the same amount of work for every sequence size
+	configuration.numberBatches = ((uint64_t)1 << 22) / sequenceSize;
+	if (configuration.numberBatches == 0) configuration.numberBatches = 1;
+	configuration.doublePrecision = precision;
+	configuration.forceBluesteinSequenceSize = sequenceSize;
+	//disable Rader's algorithm, so primes are done with Bluestein's algorithm
+	configuration.fixMinRaderPrimeFFT = 17;
+	configuration.fixMaxRaderPrimeFFT = 17;
+	configuration.fixMinRaderPrimeMult = 17;
+	configuration.fixMaxRaderPrimeMult = 17;
+#if(VKFFT_BACKEND==5)
+	configuration.device = vkGPU->device;
+#elif(VKFFT_BACKEND!=6)
+	configuration.device = &vkGPU->device;
+#endif
+#if(VKFFT_BACKEND==0)
+	configuration.queue = &vkGPU->queue;
+	configuration.fence = &vkGPU->fence;
+	configuration.commandPool = &vkGPU->commandPool;
+	configuration.physicalDevice = &vkGPU->physicalDevice;
+	configuration.isCompilerInitialized = isCompilerInitialized;
+#elif(VKFFT_BACKEND==3)
+	configuration.context = &vkGPU->context;
+#elif(VKFFT_BACKEND==4)
+	configuration.context = &vkGPU->context;
+	configuration.commandQueue = &vkGPU->commandQueue;
+	configuration.commandQueueID = vkGPU->commandQueueID;
+#elif(VKFFT_BACKEND==5)
+	configuration.queue = vkGPU->queue;
+#endif
+	uint64_t bufferSize = (uint64_t)((precision) ? sizeof(double) : sizeof(float)) * 2 * configuration.size[0] * configuration.numberBatches;
+#if(VKFFT_BACKEND==0)
+	VkBuffer buffer = {};
+	VkDeviceMemory bufferDeviceMemory = {};
+	resFFT = allocateBuffer(vkGPU, &buffer, &bufferDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==1)
+	cuFloatComplex* buffer = 0;
+	res = cudaMalloc((void**)&buffer, bufferSize);
+	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	configuration.buffer = (void**)&buffer;
+#elif(VKFFT_BACKEND==2)
+	hipFloatComplex* buffer = 0;
+	res = hipMalloc((void**)&buffer, bufferSize);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	configuration.buffer = (void**)&buffer;
+#elif(VKFFT_BACKEND==3)
+	cl_mem buffer = 0;
+	buffer = clCreateBuffer(vkGPU->context, CL_MEM_READ_WRITE, bufferSize, 0, &res);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==4)
+	void* buffer = 0;
+	ze_device_mem_alloc_desc_t device_desc = {};
+	device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+	res = zeMemAllocDevice(vkGPU->context, &device_desc, bufferSize, sizeof(float), vkGPU->device, &buffer);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==5)
+	MTL::Buffer* buffer = 0;
+	buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+	configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+	void* buffer = 0;
+	buffer = malloc(bufferSize);
+	if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
+	configuration.buffer = &buffer;
+#endif
+	configuration.bufferSize = &bufferSize;
+	resFFT = transferDataFromCPU(vkGPU, buffer_input, &buffer, bufferSize);
+	if (resFFT == VKFFT_SUCCESS) resFFT = initializeVkFFT(&app, configuration);
+	if (resFFT == VKFFT_SUCCESS) {
+		uint64_t num_iter = (((uint64_t)4096 * 1024.0 * 1024.0) / bufferSize > 100) ? 100 : (uint64_t)((uint64_t)4096 * 1024.0 * 1024.0) / bufferSize;
+		if (num_iter == 0) num_iter = 1;
+		VkFFTLaunchParams launchParams = {};
+		//the fastest of three runs, the first one also warms up the GPU
+		time_result[0] = 0;
+		for (uint64_t r = 0; r < 3; r++) {
+			double totTime = 0;
+			resFFT = performVulkanFFTiFFT(vkGPU, &app, &launchParams, num_iter, &totTime);
+			if (resFFT != VKFFT_SUCCESS) break;
+			if ((r == 0) || (totTime < time_result[0])) time_result[0] = totTime;
+		}
+		time_result[0] /= configuration.numberBatches;
+	}
+#if(VKFFT_BACKEND==0)
+	vkDestroyBuffer(vkGPU->device, buffer, NULL);
+	vkFreeMemory(vkGPU->device, bufferDeviceMemory, NULL);
+#elif(VKFFT_BACKEND==1)
+	cudaFree(buffer);
+#elif(VKFFT_BACKEND==2)
+	hipFree(buffer);
+#elif(VKFFT_BACKEND==3)
+	clReleaseMemObject(buffer);
+#elif(VKFFT_BACKEND==4)
+	zeMemFree(vkGPU->context, buffer);
+#elif(VKFFT_BACKEND==5)
+	buffer->release();
+#elif(VKFFT_BACKEND==6)
+	free(buffer);
+#endif
+	deleteVkFFT(&app);
+	return resFFT;
+}
+
+VkFFTResult sample_22_calibrate_VkFFT_Bluestein_padding(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "22 - VkFFT Bluestein padding calibration: measures padded sequence sizes and writes the fastest padding pattern to VkFFT_Bluestein_padding.txt\n");
+	printf("22 - VkFFT Bluestein padding calibration: measures padded sequence sizes and writes the fastest padding pattern to VkFFT_Bluestein_padding.txt\n");
+	//candidate padded sizes are all sequences decomposable with primes 2-13 from the first Bluestein sequence (2*17-1) to maxSequenceSize
+	const uint64_t maxSequenceSize = 8192;
+	std::vector<uint64_t> sequenceSizes;
+	for (uint64_t i = 33; i <= maxSequenceSize; i++) {
+		uint64_t temp = i;
+		for (uint64_t j = 2; j < 14; j++) {
+			while (temp % j == 0) temp /= j;
+		}
+		if (temp == 1) sequenceSizes.push_back(i);
+	}
+	//memory allocated on the CPU once, enough for the largest buffer of the double precision run.
+	uint64_t inputSize = 2 * ((uint64_t)1 << 22);
+	double* buffer_input = (double*)malloc(sizeof(double) * inputSize);
+	if (!buffer_input) return VKFFT_ERROR_MALLOC_FAILED;
+	for (uint64_t i = 0; i < inputSize; i++) {
+		buffer_input[i] = (double)(2 * ((double)rand()) / RAND_MAX - 1.0);
+	}
+	FILE* paddingFile = fopen("VkFFT_Bluestein_padding.txt", "w");
+	if (!paddingFile) {
+		free(buffer_input);
+		return VKFFT_ERROR_EMPTY_FILE;
+	}
+	fprintf(paddingFile, "# VkFFT Bluestein padding pattern, pass it to VkFFT with bluesteinPaddingFile\n");
+#if(VKFFT_BACKEND==0)
+	fprintf(paddingFile, "# Device name: %s\n", vkGPU->physicalDeviceProperties.deviceName);
+#endif
+	fprintf(paddingFile, "# primeSize paddedSize: sequences from primeSize to the next primeSize are padded to paddedSize\n");
+	for (uint64_t precision = 0; precision < 2; precision++) {
+		std::vector<double> sequenceTimes(sequenceSizes.size());
+		for (uint64_t n = 0; n < sequenceSizes.size(); n++) {
+			resFFT = sample_22_time_Bluestein_sequence(vkGPU, precision, sequenceSizes[n], buffer_input, isCompilerInitialized, &sequenceTimes[n]);
+			if (resFFT != VKFFT_SUCCESS) {
+				//sizes that can not be made on this device are not used for padding
+				printf("Sequence: %" PRIu64 " %s skipped: %s\n", sequenceSizes[n], (precision) ? "double" : "single", getVkFFTErrorString(resFFT));
+				sequenceTimes[n] = -1;
+				resFFT = VKFFT_SUCCESS;
+				continue;
+			}
+			if (file_output)
+				fprintf(output, "Sequence: %" PRIu64 " %s time_per_system: %0.6f us\n", sequenceSizes[n], (precision) ? "double" : "single", sequenceTimes[n] * 1000);
+			printf("Sequence: %" PRIu64 " %s time_per_system: %0.6f us\n", sequenceSizes[n], (precision) ? "double" : "single", sequenceTimes[n] * 1000);
+		}
+		//the best padding for a system of size N is the fastest sequence of size at least 2*N-1. A new range starts each time it changes
+		fprintf(paddingFile, "precision %s\n", (precision) ? "double" : "single");
+		printf("precision %s\n", (precision) ? "double" : "single");
+		uint64_t previousPaddedSize = 0;
+		for (uint64_t size = 17; 2 * size - 1 <= maxSequenceSize; size++) {
+			uint64_t paddedSize = 0;
+			double paddedTime = 0;
+			for (uint64_t n = 0; n < sequenceSizes.size(); n++) {
+				if ((sequenceSizes[n] < 2 * size - 1) || (sequenceTimes[n] < 0)) continue;
+				if ((paddedSize == 0) || (sequenceTimes[n] < paddedTime)) {
+					paddedSize = sequenceSizes[n];
+					paddedTime = sequenceTimes[n];
+				}
+			}
+			if (paddedSize == 0) break;
+			if (paddedSize != previousPaddedSize) {
+				fprintf(paddingFile, "%" PRIu64 " %" PRIu64 "\n", size, paddedSize);
+				printf("%" PRIu64 " %" PRIu64 "\n", size, paddedSize);
+				previousPaddedSize = paddedSize;
+			}
+		}
+	}
+	fclose(paddingFile);
+	free(buffer_input);
+#if(VKFFT_BACKEND==0)
+	printf("Device name: %s API:%d.%d.%d\n", vkGPU->physicalDeviceProperties.deviceName, (vkGPU->physicalDeviceProperties.apiVersion >> 22), ((vkGPU->physicalDeviceProperties.apiVersion >> 12) & 0x3ff), (vkGPU->physicalDeviceProperties.apiVersion & 0xfff));
+#endif
+	return resFFT;
+}
@@ -0,0 +1,124 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+static VkFFTResult sample_23_initialize_system(VkGPU* vkGPU, const uint64_t* system, VkFFTDeviceProfile* deviceProfile, uint64_t isCompilerInitialized, VkFFTApplication* app, double* time_result) {
+	//host time of initializeVkFFT on the device, or in dryRun mode if deviceProfile is provided. Buffers are not accessed during plan creation, so none are allocated
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTConfiguration configuration = {};
+	configuration.FFTdim = system[0];
+	configuration.size[0] = system[1];
+	configuration.size[1] = system[2];
+	configuration.size[2] = system[3];
+	configuration.performR2C = system[4];
+	if (deviceProfile) {
+		configuration.dryRun = 1;
+		configuration.deviceProfile = deviceProfile;
+	}
+	else {
+#if(VKFFT_BACKEND==5)
+		configuration.device = vkGPU->device;
+#elif(VKFFT_BACKEND!=6)
+		configuration.device = &vkGPU->device;
+#endif
+#if(VKFFT_BACKEND==0)
+		configuration.queue = &vkGPU->queue;
+		configuration.fence = &vkGPU->fence;
+		configuration.commandPool = &vkGPU->commandPool;
+		configuration.physicalDevice = &vkGPU->physicalDevice;
+		configuration.isCompilerInitialized = isCompilerInitialized;
+#elif(VKFFT_BACKEND==3)
+		configuration.context = &vkGPU->context;
+#elif(VKFFT_BACKEND==4)
+		configuration.context = &vkGPU->context;
+		configuration.commandQueue = &vkGPU->commandQueue;
+		configuration.commandQueueID = vkGPU->commandQueueID;
+#elif(VKFFT_BACKEND==5)
+		configuration.queue = vkGPU->queue;
+#endif
+	}
+	uint64_t bufferSize = (uint64_t)sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2];
+	configuration.bufferSize = &bufferSize;
+	std::chrono::steady_clock::time_point timeStart = std::chrono::steady_clock::now();
+	resFFT = initializeVkFFT(app, configuration);
+	time_result[0] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeStart).count();
+	return resFFT;
+}
+
+VkFFTResult sample_23_benchmark_VkFFT_dryRun(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "23 - VkFFT plan creation time on the device vs device-less dry run, plan description of the last system is written to VkFFT_plan_description.txt\n");
+	printf("23 - VkFFT plan creation time on the device vs device-less dry run, plan description of the last system is written to VkFFT_plan_description.txt\n");
+	const int num_systems = 6;
+	const uint64_t systems[num_systems][5] = { {1, 4096, 1, 1, 0}, {1, 1031, 1, 1, 0}, {1, 1048576, 1, 1, 0}, {2, 512, 512, 1, 1}, {3, 64, 64, 64, 0}, {3, 17, 19, 23, 0} };//FFTdim, size[0], size[1], size[2], performR2C
+	//the profile of the device is taken from a device application, so that both modes generate the same kernels
+	VkFFTDeviceProfile deviceProfile = {};
+	for (int n = 0; n < num_systems; n++) {
+		double init_time[2] = { 0, 0 };
+		uint64_t numKernels = 0;
+		for (uint64_t dryRun = 0; dryRun < 2; dryRun++) {
+			VkFFTApplication app = {};
+			resFFT = sample_23_initialize_system(vkGPU, systems[n], (dryRun) ? &deviceProfile : 0, isCompilerInitialized, &app, &init_time[dryRun]);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			if (!dryRun) {
+				deviceProfile = app.deviceProfile;
+				numKernels = app.dispatchList[0].numEntries + app.dispatchList[1].numEntries;
+			}
+			else if (n == num_systems - 1) {
+				resFFT = VkFFTSavePlanDescription(&app, "VkFFT_plan_description.txt");
+				if (resFFT != VKFFT_SUCCESS) return resFFT;
+			}
+			deleteVkFFT(&app);
+		}
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "D %" PRIu64 "x%" PRIu64 "x%" PRIu64 " %s kernels: %" PRIu64 " plan creation time device: %0.2f ms dry run: %0.2f ms\n", systems[n][0], systems[n][1], systems[n][2], systems[n][3], (systems[n][4]) ? "R2C" : "C2C", numKernels, init_time[0], init_time[1]);
+		printf("VkFFT System: %" PRIu64 "D %" PRIu64 "x%" PRIu64 "x%" PRIu64 " %s kernels: %" PRIu64 " plan creation time device: %0.2f ms dry run: %0.2f ms\n", systems[n][0], systems[n][1], systems[n][2], systems[n][3], (systems[n][4]) ? "R2C" : "C2C", numKernels, init_time[0], init_time[1]);
+	}
+	return resFFT;
+}
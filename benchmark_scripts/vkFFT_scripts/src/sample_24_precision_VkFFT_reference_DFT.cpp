@@ -0,0 +1,206 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_24_precision_VkFFT_reference_DFT(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+#elif(VKFFT_BACKEND==5)
+#endif
+	if (file_output)
+		fprintf(output, "24 - VkFFT C2C FFT + iFFT precision test against a naive long double DFT\n");
+	printf("24 - VkFFT C2C FFT + iFFT precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. Covers radix 2 - 13 kernels, multiple uploads, Rader's and Bluestein's algorithms and multidimensional systems
+	const int num_systems = 9;
+	uint64_t systems[num_systems][5] = { {1, 8, 1, 1, 3}, {1, 1024, 1, 1, 2}, {1, 315, 1, 1, 2}, {1, 143, 1, 1, 2}, {1, 8192, 1, 1, 1}, {1, 131, 1, 1, 2}, {1, 4099, 1, 1, 1}, {2, 64, 60, 1, 2}, {3, 16, 12, 10, 1} };
+	double maxError[2] = { 1e-5, 1e-12 };
+	bool failed = false;
+	for (uint64_t precision = 0; precision < 2; precision++) {
+		for (int n = 0; n < num_systems; n++) {
+			VkFFTConfiguration configuration = {};
+			VkFFTApplication app = {};
+			configuration.FFTdim = systems[n][0];
+			configuration.size[0] = systems[n][1];
+			configuration.size[1] = systems[n][2];
+			configuration.size[2] = systems[n][3];
+			configuration.numberBatches = systems[n][4];
+			configuration.doublePrecision = precision;
+#if(VKFFT_BACKEND==5)
+			configuration.device = vkGPU->device;
+#elif(VKFFT_BACKEND!=6)
+			configuration.device = &vkGPU->device;
+#endif
+#if(VKFFT_BACKEND==0)
+			configuration.queue = &vkGPU->queue;
+			configuration.fence = &vkGPU->fence;
+			configuration.commandPool = &vkGPU->commandPool;
+			configuration.physicalDevice = &vkGPU->physicalDevice;
+			configuration.isCompilerInitialized = isCompilerInitialized;
+#elif(VKFFT_BACKEND==3)
+			configuration.context = &vkGPU->context;
+#elif(VKFFT_BACKEND==4)
+			configuration.context = &vkGPU->context;
+			configuration.commandQueue = &vkGPU->commandQueue;
+			configuration.commandQueueID = vkGPU->commandQueueID;
+#elif(VKFFT_BACKEND==5)
+			configuration.queue = vkGPU->queue;
+#endif
+			uint64_t elementSize = (precision == 0) ? sizeof(float) : sizeof(double);
+			uint64_t numElements = configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches;
+			uint64_t bufferSize = elementSize * 2 * numElements;
+			void* buffer_input = malloc(bufferSize);
+			if (!buffer_input) return VKFFT_ERROR_MALLOC_FAILED;
+			void* buffer_forward = malloc(bufferSize);
+			if (!buffer_forward) return VKFFT_ERROR_MALLOC_FAILED;
+			void* buffer_inverse = malloc(bufferSize);
+			if (!buffer_inverse) return VKFFT_ERROR_MALLOC_FAILED;
+			for (uint64_t i = 0; i < 2 * numElements; i++) {
+				if (precision == 0)
+					((float*)buffer_input)[i] = (float)(2 * ((float)rand()) / RAND_MAX - 1.0);
+				else
+					((double*)buffer_input)[i] = 2 * ((double)rand()) / RAND_MAX - 1.0;
+			}
+#if(VKFFT_BACKEND==0)
+			VkBuffer buffer = {};
+			VkDeviceMemory bufferDeviceMemory = {};
+			resFFT = allocateBuffer(vkGPU, &buffer, &bufferDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==1)
+			void* buffer = 0;
+			res = cudaMalloc(&buffer, bufferSize);
+			if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==2)
+			void* buffer = 0;
+			res = hipMalloc(&buffer, bufferSize);
+			if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==3)
+			cl_mem buffer = 0;
+			buffer = clCreateBuffer(vkGPU->context, CL_MEM_READ_WRITE, bufferSize, 0, &res);
+			if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==4)
+			void* buffer = 0;
+			ze_device_mem_alloc_desc_t device_desc = {};
+			device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+			res = zeMemAllocDevice(vkGPU->context, &device_desc, bufferSize, elementSize, vkGPU->device, &buffer);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==5)
+			MTL::Buffer* buffer = 0;
+			buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+			configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+			void* buffer = 0;
+			buffer = malloc(bufferSize);
+			if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
+			configuration.buffer = &buffer;
+#endif
+			configuration.bufferSize = &bufferSize;
+
+			resFFT = transferDataFromCPU(vkGPU, buffer_input, &buffer, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = initializeVkFFT(&app, configuration);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+
+			VkFFTLaunchParams launchParams = {};
+			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, -1, 1);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_forward, &buffer, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, 1, 1);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_inverse, &buffer, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+
+			double error_forward = referenceDFTError(buffer_forward, buffer_input, precision, configuration.FFTdim, configuration.size, configuration.numberBatches, -1);
+			double error_inverse = referenceDFTError(buffer_inverse, buffer_forward, precision, configuration.FFTdim, configuration.size, configuration.numberBatches, 1);
+			if ((error_forward < 0) || (error_inverse < 0)) return VKFFT_ERROR_MALLOC_FAILED;
+			bool passed = (error_forward < maxError[precision]) && (error_inverse < maxError[precision]);
+			if (!passed) failed = true;
+			if (file_output)
+				fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (precision == 0) ? "single" : "double", error_forward, error_inverse, passed ? "passed" : "FAILED");
+			printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (precision == 0) ? "single" : "double", error_forward, error_inverse, passed ? "passed" : "FAILED");
+
+#if(VKFFT_BACKEND==0)
+			vkDestroyBuffer(vkGPU->device, buffer, NULL);
+			vkFreeMemory(vkGPU->device, bufferDeviceMemory, NULL);
+#elif(VKFFT_BACKEND==1)
+			cudaFree(buffer);
+#elif(VKFFT_BACKEND==2)
+			hipFree(buffer);
+#elif(VKFFT_BACKEND==3)
+			clReleaseMemObject(buffer);
+#elif(VKFFT_BACKEND==4)
+			zeMemFree(vkGPU->context, buffer);
+#elif(VKFFT_BACKEND==5)
+			buffer->release();
+#elif(VKFFT_BACKEND==6)
+			free(buffer);
+#endif
+			deleteVkFFT(&app);
+			free(buffer_input);
+			free(buffer_forward);
+			free(buffer_inverse);
+		}
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
@@ -0,0 +1,106 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_25_precision_VkFFT_shared_LUT(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "25 - VkFFT LUT and Bluestein buffer sharing between applications (shareLUT) precision test against a naive long double DFT\n");
+	printf("25 - VkFFT LUT and Bluestein buffer sharing between applications (shareLUT) precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. Covers LUTs of single and multiple uploads, Rader's and Bluestein's algorithms
+	const int num_systems = 5;
+	uint64_t systems[num_systems][5] = { {1, 1024, 1, 1, 2}, {1, 8192, 1, 1, 1}, {1, 131, 1, 1, 2}, {1, 4099, 1, 1, 1}, {2, 64, 60, 1, 2} };
+	double maxError = 1e-5;
+	bool failed = false;
+	for (int n = 0; n < num_systems; n++) {
+		VkFFTConfiguration configuration = {};
+		configuration.FFTdim = systems[n][0];
+		configuration.size[0] = systems[n][1];
+		configuration.size[1] = systems[n][2];
+		configuration.size[2] = systems[n][3];
+		configuration.numberBatches = systems[n][4];
+		configuration.useLUT = 1;
+		configuration.shareLUT = 1;
+		setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+		VkFFTTestBuffer buffer = {};
+		resFFT = allocateTestBuffer(vkGPU, &buffer, sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		configuration.buffer = &buffer.buffer;
+		configuration.bufferSize = &buffer.bufferSize;
+
+		//two applications with the same configuration, the second one takes LUT and Bluestein buffers of the first one from the registry
+		VkFFTApplication app_first = {};
+		VkFFTApplication app_second = {};
+		resFFT = initializeVkFFT(&app_first, configuration);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		resFFT = initializeVkFFT(&app_second, configuration);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		bool shared = (app_first.localFFTPlan->axes[0][0].bufferLUT == app_second.localFFTPlan->axes[0][0].bufferLUT);
+		for (uint64_t i = 0; i < configuration.FFTdim; i++) {
+			if (app_first.useBluesteinFFT[i] && (app_first.bufferBluestein[i] != app_second.bufferBluestein[i])) shared = false;
+		}
+		//shared buffers have to outlive the application that created them
+		deleteVkFFT(&app_first);
+		double error_forward = 0;
+		double error_inverse = 0;
+		VkFFTLaunchParams launchParams = {};
+		resFFT = referenceTestVkFFT(vkGPU, &app_second, &launchParams, &buffer, &buffer, configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward, &error_inverse);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		bool passed = shared && (error_forward < maxError) && (error_inverse < maxError);
+		if (!passed) failed = true;
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " buffers shared: %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, shared ? "yes" : "no", error_forward, error_inverse, passed ? "passed" : "FAILED");
+		printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " buffers shared: %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, shared ? "yes" : "no", error_forward, error_inverse, passed ? "passed" : "FAILED");
+
+		deleteVkFFT(&app_second);
+		freeTestBuffer(vkGPU, &buffer);
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
@@ -0,0 +1,116 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_26_precision_VkFFT_plan_cache(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "26 - VkFFT in-process plan cache (usePlanCache) precision test against a naive long double DFT\n");
+	printf("26 - VkFFT in-process plan cache (usePlanCache) precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. Covers single and multiple uploads, Rader's and Bluestein's algorithms
+	const int num_systems = 4;
+	uint64_t systems[num_systems][5] = { {1, 1024, 1, 1, 2}, {1, 131, 1, 1, 2}, {1, 4099, 1, 1, 1}, {2, 64, 60, 1, 2} };
+	double maxError = 1e-5;
+	bool failed = false;
+	//entries of previous runs would turn the first application into a cache hit
+	VkFFTClearPlanCache();
+	for (int n = 0; n < num_systems; n++) {
+		VkFFTConfiguration configuration = {};
+		configuration.FFTdim = systems[n][0];
+		configuration.size[0] = systems[n][1];
+		configuration.size[1] = systems[n][2];
+		configuration.size[2] = systems[n][3];
+		configuration.numberBatches = systems[n][4];
+		configuration.usePlanCache = 1;
+		setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+		uint64_t bufferSize = sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches;
+		//buffer sizes are compiled into the kernels, so the third application only differs from the first two in bufferSize
+		uint64_t largerBufferSize = 2 * bufferSize;
+		VkFFTTestBuffer buffer = {};
+		resFFT = allocateTestBuffer(vkGPU, &buffer, largerBufferSize);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		configuration.buffer = &buffer.buffer;
+
+		//the first application stores its binaries in the cache, the second one loads them, the third one has to miss
+		const int num_apps = 3;
+		VkFFTApplication app[num_apps] = {};
+		bool cached = true;
+		double error_forward = 0;
+		double error_inverse = 0;
+		for (int a = 0; a < num_apps; a++) {
+			configuration.bufferSize = (a < 2) ? &bufferSize : &largerBufferSize;
+			resFFT = initializeVkFFT(&app[a], configuration);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			double error_forward_app = 0;
+			double error_inverse_app = 0;
+			VkFFTLaunchParams launchParams = {};
+			resFFT = referenceTestVkFFT(vkGPU, &app[a], &launchParams, &buffer, &buffer, configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward_app, &error_inverse_app);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			if (error_forward_app > error_forward) error_forward = error_forward_app;
+			if (error_inverse_app > error_inverse) error_inverse = error_inverse_app;
+		}
+#if(VKFFT_BACKEND!=5)
+		//applications with the key of an entry stored before load their binaries from it. Plan cache is disabled in Metal backend
+		cached = (app[1].planCacheKey == app[0].planCacheKey) && (app[2].planCacheKey != app[0].planCacheKey);
+#endif
+		bool passed = cached && (error_forward < maxError) && (error_inverse < maxError);
+		if (!passed) failed = true;
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " cache miss, hit, miss on changed bufferSize: %s max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, cached ? "yes" : "no", error_forward, error_inverse, passed ? "passed" : "FAILED");
+		printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " cache miss, hit, miss on changed bufferSize: %s max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, cached ? "yes" : "no", error_forward, error_inverse, passed ? "passed" : "FAILED");
+
+		for (int a = 0; a < num_apps; a++) {
+			deleteVkFFT(&app[a]);
+		}
+		freeTestBuffer(vkGPU, &buffer);
+	}
+	VkFFTClearPlanCache();
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
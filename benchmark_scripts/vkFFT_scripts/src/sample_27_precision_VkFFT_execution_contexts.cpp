@@ -0,0 +1,135 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+static void sample_27_test_context(VkGPU* vkGPU, VkFFTExecutionContext* context, VkFFTTestBuffer* buffer, VkFFTConfiguration* configuration, double* error_forward, double* error_inverse, VkFFTResult* result) {
+	//VkFFTAppendContext records launches with the application copy held by the context
+	VkFFTLaunchParams launchParams = {};
+	launchParams.buffer = &buffer->buffer;
+	result[0] = referenceTestVkFFT(vkGPU, &context->app, &launchParams, buffer, buffer, configuration->FFTdim, configuration->size, configuration->numberBatches, error_forward, error_inverse);
+}
+VkFFTResult sample_27_precision_VkFFT_execution_contexts(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "27 - VkFFT execution contexts precision test against a naive long double DFT\n");
+	printf("27 - VkFFT execution contexts precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. Covers single and multiple uploads, Rader's and Bluestein's algorithms
+	const int num_systems = 5;
+	uint64_t systems[num_systems][5] = { {1, 1024, 1, 1, 2}, {1, 8192, 1, 1, 1}, {1, 131, 1, 1, 2}, {1, 4099, 1, 1, 1}, {2, 64, 60, 1, 2} };
+	const int num_contexts = 4;
+	double maxError = 1e-5;
+	bool failed = false;
+	for (int n = 0; n < num_systems; n++) {
+		VkFFTConfiguration configuration = {};
+		configuration.FFTdim = systems[n][0];
+		configuration.size[0] = systems[n][1];
+		configuration.size[1] = systems[n][2];
+		configuration.size[2] = systems[n][3];
+		configuration.numberBatches = systems[n][4];
+		setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+		//every context transforms its own data in its own buffer
+		VkFFTTestBuffer buffer[num_contexts] = {};
+		for (int t = 0; t < num_contexts; t++) {
+			resFFT = allocateTestBuffer(vkGPU, &buffer[t], sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
+		configuration.buffer = &buffer[0].buffer;
+		configuration.bufferSize = &buffer[0].bufferSize;
+
+		VkFFTApplication app = {};
+		resFFT = initializeVkFFT(&app, configuration);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		VkFFTExecutionContext contexts[num_contexts] = {};
+		for (int t = 0; t < num_contexts; t++) {
+			resFFT = VkFFTCreateExecutionContext(&app, &contexts[t]);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
+		double error_forward[num_contexts] = {};
+		double error_inverse[num_contexts] = {};
+		VkFFTResult results[num_contexts] = {};
+#if((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==3) || (VKFFT_BACKEND==6))
+		//each context is launched from its own thread
+		std::vector<std::thread> threads;
+		for (int t = 0; t < num_contexts; t++) {
+			threads.push_back(std::thread(sample_27_test_context, vkGPU, &contexts[t], &buffer[t], &configuration, &error_forward[t], &error_inverse[t], &results[t]));
+		}
+		for (int t = 0; t < num_contexts; t++) {
+			threads[t].join();
+		}
+#else
+		//command pool and fence of the test device can not be shared between threads, so contexts are launched one after another
+		for (int t = 0; t < num_contexts; t++) {
+			sample_27_test_context(vkGPU, &contexts[t], &buffer[t], &configuration, &error_forward[t], &error_inverse[t], &results[t]);
+		}
+#endif
+		double max_error_forward = 0;
+		double max_error_inverse = 0;
+		for (int t = 0; t < num_contexts; t++) {
+			if (results[t] != VKFFT_SUCCESS) return results[t];
+			if (error_forward[t] > max_error_forward) max_error_forward = error_forward[t];
+			if (error_inverse[t] > max_error_inverse) max_error_inverse = error_inverse[t];
+		}
+		bool passed = (max_error_forward < maxError) && (max_error_inverse < maxError);
+		if (!passed) failed = true;
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " Contexts: %d max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, num_contexts, max_error_forward, max_error_inverse, passed ? "passed" : "FAILED");
+		printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " Contexts: %d max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, num_contexts, max_error_forward, max_error_inverse, passed ? "passed" : "FAILED");
+
+		//contexts have to be deleted before the application they were created from
+		for (int t = 0; t < num_contexts; t++) {
+			VkFFTDeleteExecutionContext(&contexts[t]);
+		}
+		deleteVkFFT(&app);
+		for (int t = 0; t < num_contexts; t++) {
+			freeTestBuffer(vkGPU, &buffer[t]);
+		}
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
@@ -0,0 +1,123 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_28_precision_VkFFT_descriptor_cache(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "28 - VkFFT launches with alternating buffers precision test against a naive long double DFT\n");
+	printf("28 - VkFFT launches with alternating buffers precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. Covers single and multiple uploads, Rader's and Bluestein's algorithms
+	const int num_systems = 5;
+	uint64_t systems[num_systems][5] = { {1, 1024, 1, 1, 2}, {1, 8192, 1, 1, 1}, {1, 131, 1, 1, 2}, {1, 4099, 1, 1, 1}, {2, 64, 60, 1, 2} };
+	//one buffer more than descriptor sets in the cache, so that cached sets are also replaced
+	const int num_buffers = 3;
+	const int num_rounds = 2;
+	double maxError = 1e-5;
+	bool failed = false;
+	uint64_t usePushDescriptors = 0;
+#if(VKFFT_BACKEND==0)
+	for (uint64_t i = 0; i < vkGPU->enabledDeviceExtensions.size(); i++) {
+		if (!strcmp(vkGPU->enabledDeviceExtensions[i], VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)) usePushDescriptors = 1;
+	}
+#endif
+	for (uint64_t p = 0; p <= usePushDescriptors; p++) {
+		for (int n = 0; n < num_systems; n++) {
+			VkFFTConfiguration configuration = {};
+			configuration.FFTdim = systems[n][0];
+			configuration.size[0] = systems[n][1];
+			configuration.size[1] = systems[n][2];
+			configuration.size[2] = systems[n][3];
+			configuration.numberBatches = systems[n][4];
+#if(VKFFT_BACKEND==0)
+			configuration.descriptorSetCacheSize = num_buffers - 1;
+			configuration.usePushDescriptors = p;
+#endif
+			setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+			VkFFTTestBuffer buffer[num_buffers] = {};
+			for (int t = 0; t < num_buffers; t++) {
+				resFFT = allocateTestBuffer(vkGPU, &buffer[t], sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches);
+				if (resFFT != VKFFT_SUCCESS) return resFFT;
+			}
+			configuration.buffer = &buffer[0].buffer;
+			configuration.bufferSize = &buffer[0].bufferSize;
+
+			VkFFTApplication app = {};
+			resFFT = initializeVkFFT(&app, configuration);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			//every transform binds a different buffer than the previous one. The second round only uses buffers that were bound before
+			double max_error_forward = 0;
+			double max_error_inverse = 0;
+			for (int r = 0; r < num_rounds; r++) {
+				for (int t = 0; t < num_buffers; t++) {
+					double error_forward = 0;
+					double error_inverse = 0;
+					VkFFTLaunchParams launchParams = {};
+					launchParams.buffer = &buffer[t].buffer;
+					resFFT = referenceTestVkFFT(vkGPU, &app, &launchParams, &buffer[t], &buffer[t], configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward, &error_inverse);
+					if (resFFT != VKFFT_SUCCESS) return resFFT;
+					if (error_forward > max_error_forward) max_error_forward = error_forward;
+					if (error_inverse > max_error_inverse) max_error_inverse = error_inverse;
+				}
+			}
+			bool passed = (max_error_forward < maxError) && (max_error_inverse < maxError);
+			if (!passed) failed = true;
+			if (file_output)
+				fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " Buffers: %d push descriptors: %" PRIu64 " max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, num_buffers, p, max_error_forward, max_error_inverse, passed ? "passed" : "FAILED");
+			printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " Buffers: %d push descriptors: %" PRIu64 " max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, num_buffers, p, max_error_forward, max_error_inverse, passed ? "passed" : "FAILED");
+
+			deleteVkFFT(&app);
+			for (int t = 0; t < num_buffers; t++) {
+				freeTestBuffer(vkGPU, &buffer[t]);
+			}
+		}
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
@@ -0,0 +1,142 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_29_precision_VkFFT_kernel_dependencies(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "29 - VkFFT dependencies between kernels and consecutive launches precision test against a naive long double DFT\n");
+	printf("29 - VkFFT dependencies between kernels and consecutive launches precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. All systems are executed with more than one kernel: multiple uploads, Bluestein's algorithm, multidimensional systems
+	const int num_systems = 5;
+	uint64_t systems[num_systems][5] = { {1, 4096, 1, 1, 2}, {1, 16384, 1, 1, 1}, {1, 4099, 1, 1, 1}, {2, 256, 250, 1, 1}, {3, 32, 30, 28, 1} };
+	double maxError = 1e-5;
+	bool failed = false;
+	for (int n = 0; n < num_systems; n++) {
+		//0 - in-place, 1 - out-of-place: forward transform reads inputBuffer and writes buffer, inverse transform reads buffer and writes inputBuffer
+		for (int outOfPlace = 0; outOfPlace < 2; outOfPlace++) {
+			VkFFTConfiguration configuration = {};
+			configuration.FFTdim = systems[n][0];
+			configuration.size[0] = systems[n][1];
+			configuration.size[1] = systems[n][2];
+			configuration.size[2] = systems[n][3];
+			configuration.numberBatches = systems[n][4];
+			setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+			uint64_t numElements = configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches;
+			VkFFTTestBuffer buffer = {};
+			VkFFTTestBuffer inputBuffer = {};
+			resFFT = allocateTestBuffer(vkGPU, &buffer, sizeof(float) * 2 * numElements);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			configuration.buffer = &buffer.buffer;
+			configuration.bufferSize = &buffer.bufferSize;
+			if (outOfPlace) {
+				resFFT = allocateTestBuffer(vkGPU, &inputBuffer, sizeof(float) * 2 * numElements);
+				if (resFFT != VKFFT_SUCCESS) return resFFT;
+				configuration.isInputFormatted = 1;
+				configuration.inverseReturnToInputBuffer = 1;
+				configuration.inputBuffer = &inputBuffer.buffer;
+				configuration.inputBufferSize = &inputBuffer.bufferSize;
+			}
+			//buffer that holds the input of the forward transform and the result of the inverse transform
+			VkFFTTestBuffer* dataBuffer = (outOfPlace) ? &inputBuffer : &buffer;
+
+			VkFFTApplication app = {};
+			resFFT = initializeVkFFT(&app, configuration);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			//FFT and iFFT submitted separately
+			double error_forward = 0;
+			double error_inverse = 0;
+			VkFFTLaunchParams launchParams = {};
+			resFFT = referenceTestVkFFT(vkGPU, &app, &launchParams, dataBuffer, &buffer, configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward, &error_inverse);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			//FFT+iFFT and FFT+FFT recorded in one submit: kernels of the second transform depend on the last kernel of the first one.
+			//In-place the second FFT transforms the result of the first one, out-of-place it overwrites it with the same result
+			std::vector<float> buffer_input(2 * numElements);
+			std::vector<float> buffer_forward(2 * numElements);
+			std::vector<float> buffer_roundtrip(2 * numElements);
+			std::vector<float> buffer_forward_twice(2 * numElements);
+			for (uint64_t i = 0; i < 2 * numElements; i++) {
+				buffer_input[i] = (float)(2 * ((float)rand()) / RAND_MAX - 1.0);
+			}
+			resFFT = transferDataFromCPU(vkGPU, buffer_input.data(), &dataBuffer->buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, -1, 1);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_forward.data(), &buffer.buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			double time_roundtrip = 0;
+			resFFT = transferDataFromCPU(vkGPU, buffer_input.data(), &dataBuffer->buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = performVulkanFFTiFFT(vkGPU, &app, &launchParams, 1, &time_roundtrip);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_roundtrip.data(), &dataBuffer->buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataFromCPU(vkGPU, buffer_input.data(), &dataBuffer->buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, -1, 2);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_forward_twice.data(), &buffer.buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			double error_roundtrip = referenceDFTError(buffer_roundtrip.data(), buffer_forward.data(), 0, configuration.FFTdim, configuration.size, configuration.numberBatches, 1);
+			double error_forward_twice = referenceDFTError(buffer_forward_twice.data(), (outOfPlace) ? buffer_input.data() : buffer_forward.data(), 0, configuration.FFTdim, configuration.size, configuration.numberBatches, -1);
+			if ((error_roundtrip < 0) || (error_forward_twice < 0)) return VKFFT_ERROR_MALLOC_FAILED;
+			bool passed = (error_forward < maxError) && (error_inverse < maxError) && (error_roundtrip < maxError) && (error_forward_twice < maxError);
+			if (!passed) failed = true;
+			if (file_output)
+				fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e FFT+iFFT rel_L2_error: %.3e FFT+FFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (outOfPlace) ? "out-of-place" : "in-place", error_forward, error_inverse, error_roundtrip, error_forward_twice, passed ? "passed" : "FAILED");
+			printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e FFT+iFFT rel_L2_error: %.3e FFT+FFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (outOfPlace) ? "out-of-place" : "in-place", error_forward, error_inverse, error_roundtrip, error_forward_twice, passed ? "passed" : "FAILED");
+
+			deleteVkFFT(&app);
+			freeTestBuffer(vkGPU, &buffer);
+			if (outOfPlace) freeTestBuffer(vkGPU, &inputBuffer);
+		}
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
@@ -0,0 +1,147 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_30_precision_VkFFT_batches_at_launch(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "30 - VkFFT number of batches and batch stride selected at launch (specifyBatchesAtLaunch) precision test against a naive long double DFT\n");
+	printf("30 - VkFFT number of batches and batch stride selected at launch (specifyBatchesAtLaunch) precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches of the plan. Covers single and multiple uploads, Rader's and Bluestein's algorithms
+	const int num_systems = 5;
+	uint64_t systems[num_systems][5] = { {1, 1024, 1, 1, 4}, {1, 8192, 1, 1, 4}, {1, 131, 1, 1, 4}, {1, 4099, 1, 1, 4}, {2, 64, 60, 1, 4} };
+	//numberBatches and bufferBatchStride of the launch, bufferBatchStride in systems. 0 - value of the plan
+	const int num_launches = 2;
+	uint64_t launches[num_launches][2] = { {2, 0}, {2, 2} };
+	double maxError = 1e-5;
+	bool failed = false;
+	for (int n = 0; n < num_systems; n++) {
+		VkFFTConfiguration configuration = {};
+		configuration.FFTdim = systems[n][0];
+		configuration.size[0] = systems[n][1];
+		configuration.size[1] = systems[n][2];
+		configuration.size[2] = systems[n][3];
+		configuration.numberBatches = systems[n][4];
+		configuration.specifyBatchesAtLaunch = 1;
+		setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+		uint64_t systemSize = configuration.size[0] * configuration.size[1] * configuration.size[2];
+		uint64_t numElements = systemSize * configuration.numberBatches;
+		VkFFTTestBuffer buffer = {};
+		resFFT = allocateTestBuffer(vkGPU, &buffer, sizeof(float) * 2 * numElements);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		configuration.buffer = &buffer.buffer;
+		configuration.bufferSize = &buffer.bufferSize;
+
+		VkFFTApplication app = {};
+		resFFT = initializeVkFFT(&app, configuration);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		std::vector<float> buffer_input(2 * numElements);
+		std::vector<float> buffer_forward(2 * numElements);
+		std::vector<float> buffer_inverse(2 * numElements);
+		for (int l = 0; l < num_launches; l++) {
+			//launch transforms fewer batches than planned, the ones in between or after them have to stay untouched
+			VkFFTLaunchParams launchParams = {};
+			launchParams.numberBatches = launches[l][0];
+			launchParams.bufferBatchStride = launches[l][1] * systemSize;
+			uint64_t batchStride = (launches[l][1]) ? launches[l][1] : 1;
+			for (uint64_t i = 0; i < 2 * numElements; i++) {
+				buffer_input[i] = (float)(2 * ((float)rand()) / RAND_MAX - 1.0);
+			}
+			resFFT = transferDataFromCPU(vkGPU, buffer_input.data(), &buffer.buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, -1, 1);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_forward.data(), &buffer.buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = performVulkanFFT(vkGPU, &app, &launchParams, 1, 1);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			resFFT = transferDataToCPU(vkGPU, buffer_inverse.data(), &buffer.buffer, buffer.bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			double error_forward = 0;
+			double error_inverse = 0;
+			bool untouched = true;
+			for (uint64_t b = 0; b < configuration.numberBatches; b++) {
+				uint64_t offset = 2 * systemSize * b;
+				if ((b % batchStride == 0) && (b / batchStride < launches[l][0])) {
+					double error_forward_batch = referenceDFTError(&buffer_forward[offset], &buffer_input[offset], 0, configuration.FFTdim, configuration.size, 1, -1);
+					double error_inverse_batch = referenceDFTError(&buffer_inverse[offset], &buffer_forward[offset], 0, configuration.FFTdim, configuration.size, 1, 1);
+					if ((error_forward_batch < 0) || (error_inverse_batch < 0)) return VKFFT_ERROR_MALLOC_FAILED;
+					if (error_forward_batch > error_forward) error_forward = error_forward_batch;
+					if (error_inverse_batch > error_inverse) error_inverse = error_inverse_batch;
+				}
+				else {
+					if (memcmp(&buffer_inverse[offset], &buffer_input[offset], sizeof(float) * 2 * systemSize)) untouched = false;
+				}
+			}
+			bool passed = untouched && (error_forward < maxError) && (error_inverse < maxError);
+			if (!passed) failed = true;
+			if (file_output)
+				fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " launch Batch: %" PRIu64 " launch batch stride: %" PRIu64 " max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e other batches %s %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, launches[l][0], batchStride * systemSize, error_forward, error_inverse, untouched ? "untouched" : "MODIFIED", passed ? "passed" : "FAILED");
+			printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " launch Batch: %" PRIu64 " launch batch stride: %" PRIu64 " max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e other batches %s %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, launches[l][0], batchStride * systemSize, error_forward, error_inverse, untouched ? "untouched" : "MODIFIED", passed ? "passed" : "FAILED");
+		}
+		//batches that don't fit in the buffer extent of the plan have to be rejected
+		VkFFTLaunchParams launchParams = {};
+		launchParams.numberBatches = configuration.numberBatches + 1;
+		VkFFTResult resLaunch = performVulkanFFT(vkGPU, &app, &launchParams, -1, 1);
+		bool rejected = (resLaunch == VKFFT_ERROR_INVALID_numberBatches);
+		launchParams.numberBatches = 2;
+		launchParams.bufferBatchStride = configuration.numberBatches * systemSize;
+		resLaunch = performVulkanFFT(vkGPU, &app, &launchParams, -1, 1);
+		rejected = rejected && (resLaunch == VKFFT_ERROR_INVALID_numberBatches);
+		if (!rejected) failed = true;
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " launches outside of the plan extent %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, rejected ? "rejected" : "NOT REJECTED");
+		printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " launches outside of the plan extent %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, rejected ? "rejected" : "NOT REJECTED");
+
+		deleteVkFFT(&app);
+		freeTestBuffer(vkGPU, &buffer);
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
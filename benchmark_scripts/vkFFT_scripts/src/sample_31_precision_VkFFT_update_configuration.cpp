@@ -0,0 +1,115 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_31_precision_VkFFT_update_configuration(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "31 - VkFFT plan updates (VkFFTUpdateConfiguration) precision test against a naive long double DFT\n");
+	printf("31 - VkFFT plan updates (VkFFTUpdateConfiguration) precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. The first system is created with initializeVkFFT, each following one replaces the plan of
+	//the same application: the size changes, then only the number of batches changes
+	const int num_systems = 6;
+	uint64_t systems[num_systems][5] = { {1, 1024, 1, 1, 2}, {1, 4099, 1, 1, 1}, {1, 4099, 1, 1, 3}, {2, 64, 60, 1, 2}, {2, 64, 60, 1, 1}, {1, 1024, 1, 1, 2} };
+	double maxError = 1e-5;
+	bool failed = false;
+	//all systems fit in one buffer
+	uint64_t bufferSize = 0;
+	for (int n = 0; n < num_systems; n++) {
+		uint64_t systemBufferSize = sizeof(float) * 2 * systems[n][1] * systems[n][2] * systems[n][3] * systems[n][4];
+		if (systemBufferSize > bufferSize) bufferSize = systemBufferSize;
+	}
+	VkFFTTestBuffer buffer = {};
+	resFFT = allocateTestBuffer(vkGPU, &buffer, bufferSize);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	VkFFTApplication app = {};
+	VkFFTConfiguration configuration = {};
+	VkFFTLaunchParams launchParams = {};
+	double error_forward = 0;
+	double error_inverse = 0;
+	for (int n = 0; n < num_systems; n++) {
+		configuration = {};
+		configuration.FFTdim = systems[n][0];
+		configuration.size[0] = systems[n][1];
+		configuration.size[1] = systems[n][2];
+		configuration.size[2] = systems[n][3];
+		configuration.numberBatches = systems[n][4];
+		setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+		configuration.buffer = &buffer.buffer;
+		configuration.bufferSize = &buffer.bufferSize;
+		if (n == 0)
+			resFFT = initializeVkFFT(&app, configuration);
+		else
+			resFFT = VkFFTUpdateConfiguration(&app, configuration);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		resFFT = referenceTestVkFFT(vkGPU, &app, &launchParams, &buffer, &buffer, configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward, &error_inverse);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		bool passed = (error_forward < maxError) && (error_inverse < maxError);
+		if (!passed) failed = true;
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (n == 0) ? "initialized" : "updated", error_forward, error_inverse, passed ? "passed" : "FAILED");
+		printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " %s FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (n == 0) ? "initialized" : "updated", error_forward, error_inverse, passed ? "passed" : "FAILED");
+	}
+	//failed update has to leave the last plan usable
+	VkFFTConfiguration invalidConfiguration = configuration;
+	invalidConfiguration.FFTdim = 0;
+	VkFFTResult resUpdate = VkFFTUpdateConfiguration(&app, invalidConfiguration);
+	resFFT = referenceTestVkFFT(vkGPU, &app, &launchParams, &buffer, &buffer, configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward, &error_inverse);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	bool passed = (resUpdate == VKFFT_ERROR_EMPTY_FFTdim) && (error_forward < maxError) && (error_inverse < maxError);
+	if (!passed) failed = true;
+	if (file_output)
+		fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " after failed update FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, error_forward, error_inverse, passed ? "passed" : "FAILED");
+	printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " after failed update FFT rel_L2_error: %.3e iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, error_forward, error_inverse, passed ? "passed" : "FAILED");
+
+	deleteVkFFT(&app);
+	freeTestBuffer(vkGPU, &buffer);
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
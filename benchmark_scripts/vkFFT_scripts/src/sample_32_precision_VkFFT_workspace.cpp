@@ -0,0 +1,157 @@
+//general parts
+#include <stdio.h>
+#include <vector>
+#include <memory>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <iostream>
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#if(VKFFT_BACKEND==0)
+#include "vulkan/vulkan.h"
+#include "glslang_c_interface.h"
+#elif(VKFFT_BACKEND==1)
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+#include <cuda_runtime_api.h>
+#include <cuComplex.h>
+#elif(VKFFT_BACKEND==2)
+#ifndef __HIP_PLATFORM_HCC__
+#define __HIP_PLATFORM_HCC__
+#endif
+#include <hip/hip_runtime.h>
+#include <hip/hiprtc.h>
+#include <hip/hip_runtime_api.h>
+#include <hip/hip_complex.h>
+#elif(VKFFT_BACKEND==3)
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif 
+#elif(VKFFT_BACKEND==4)
+#include <ze_api.h>
+#elif(VKFFT_BACKEND==5)
+#include "Foundation/Foundation.hpp"
+#include "QuartzCore/QuartzCore.hpp"
+#include "Metal/Metal.hpp"
+#endif
+#include "vkFFT.h"
+#include "utils_VkFFT.h"
+
+VkFFTResult sample_32_precision_VkFFT_workspace(VkGPU* vkGPU, uint64_t file_output, FILE* output, uint64_t isCompilerInitialized)
+{
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (file_output)
+		fprintf(output, "32 - VkFFT temp and Bluestein buffers in user workspace (VkFFTGetWorkspaceSize) precision test against a naive long double DFT\n");
+	printf("32 - VkFFT temp and Bluestein buffers in user workspace (VkFFTGetWorkspaceSize) precision test against a naive long double DFT\n");
+	//FFTdim, size[0], size[1], size[2], numberBatches. All systems use Bluestein's algorithm
+	const int num_systems = 3;
+	uint64_t systems[num_systems][5] = { {1, 4099, 1, 1, 1}, {1, 4099, 1, 1, 2}, {2, 4099, 16, 1, 1} };
+	const int num_apps = 2;
+	double maxError = 1e-5;
+	bool failed = false;
+	for (int n = 0; n < num_systems; n++) {
+		VkFFTConfiguration configuration = {};
+		configuration.FFTdim = systems[n][0];
+		configuration.size[0] = systems[n][1];
+		configuration.size[1] = systems[n][2];
+		configuration.size[2] = systems[n][3];
+		configuration.numberBatches = systems[n][4];
+		setTestDeviceConfiguration(vkGPU, &configuration, isCompilerInitialized);
+		VkFFTTestBuffer buffer = {};
+		resFFT = allocateTestBuffer(vkGPU, &buffer, sizeof(float) * 2 * configuration.size[0] * configuration.size[1] * configuration.size[2] * configuration.numberBatches);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		configuration.buffer = &buffer.buffer;
+		configuration.bufferSize = &buffer.bufferSize;
+
+		VkFFTWorkspaceSize workspaceSize = {};
+		resFFT = VkFFTGetWorkspaceSize(configuration, &workspaceSize);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		//applications never run concurrently, so both alias the temp buffer region at the start of one workspace. Each one gets its own Bluestein region after it
+		uint64_t workspaceBufferSize = workspaceSize.workspaceTempSize + num_apps * workspaceSize.workspaceBluesteinSize;
+#if(VKFFT_BACKEND==0)
+		//device memory of a storage buffer is used as workspace
+		VkFFTTestBuffer workspaceBuffer = {};
+		resFFT = allocateTestBuffer(vkGPU, &workspaceBuffer, workspaceBufferSize);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		VkDeviceMemory workspace = workspaceBuffer.bufferDeviceMemory;
+#elif(VKFFT_BACKEND==5)
+		MTL::HeapDescriptor* workspaceDescriptor = MTL::HeapDescriptor::alloc()->init();
+		workspaceDescriptor->setType(MTL::HeapTypePlacement);
+		workspaceDescriptor->setStorageMode(MTL::StorageModePrivate);
+		workspaceDescriptor->setSize(workspaceBufferSize);
+		MTL::Heap* workspace = vkGPU->device->newHeap(workspaceDescriptor);
+		workspaceDescriptor->release();
+		if (!workspace) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#else
+		VkFFTTestBuffer workspaceBuffer = {};
+		resFFT = allocateTestBuffer(vkGPU, &workspaceBuffer, workspaceBufferSize);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+#endif
+#if(VKFFT_BACKEND==0)
+		configuration.workspace = &workspace;
+#elif(VKFFT_BACKEND==5)
+		configuration.workspace = &workspace;
+#else
+		configuration.workspace = &workspaceBuffer.buffer;
+#endif
+		configuration.workspaceSize = workspaceBufferSize;
+		configuration.workspaceTempOffset = 0;
+
+		VkFFTApplication app[num_apps] = {};
+		for (int a = 0; a < num_apps; a++) {
+			configuration.workspaceBluesteinOffset = workspaceSize.workspaceTempSize + a * workspaceSize.workspaceBluesteinSize;
+			resFFT = initializeVkFFT(&app[a], configuration);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
+		bool inWorkspace = (workspaceSize.workspaceBluesteinSize > 0);
+#if((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4) || (VKFFT_BACKEND==6))
+		//Bluestein buffers have to be sub-allocated from the region of their application
+		for (int a = 0; a < num_apps; a++) {
+			char* region = (char*)workspaceBuffer.buffer + workspaceSize.workspaceTempSize + a * workspaceSize.workspaceBluesteinSize;
+			for (uint64_t i = 0; i < configuration.FFTdim; i++) {
+				if (!app[a].useBluesteinFFT[i]) continue;
+				if (((char*)app[a].bufferBluestein[i] < region) || ((char*)app[a].bufferBluestein[i] >= region + workspaceSize.workspaceBluesteinSize)) inWorkspace = false;
+			}
+		}
+#endif
+		//the second application is initialized after the first one, so launches of the first one also check that its Bluestein region was not overwritten
+		double max_error_forward = 0;
+		double max_error_inverse = 0;
+		for (int a = 0; a < num_apps; a++) {
+			double error_forward = 0;
+			double error_inverse = 0;
+			VkFFTLaunchParams launchParams = {};
+			resFFT = referenceTestVkFFT(vkGPU, &app[a], &launchParams, &buffer, &buffer, configuration.FFTdim, configuration.size, configuration.numberBatches, &error_forward, &error_inverse);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			if (error_forward > max_error_forward) max_error_forward = error_forward;
+			if (error_inverse > max_error_inverse) max_error_inverse = error_inverse;
+		}
+		bool passed = inWorkspace && (max_error_forward < maxError) && (max_error_inverse < maxError);
+		if (!passed) failed = true;
+		if (file_output)
+			fprintf(output, "VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " workspace temp: %" PRIu64 " bytes Bluestein: %" PRIu64 " bytes x %d apps %s max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (uint64_t)workspaceSize.workspaceTempSize, (uint64_t)workspaceSize.workspaceBluesteinSize, num_apps, inWorkspace ? "used" : "NOT USED", max_error_forward, max_error_inverse, passed ? "passed" : "FAILED");
+		printf("VkFFT System: %" PRIu64 "x%" PRIu64 "x%" PRIu64 " Batch: %" PRIu64 " workspace temp: %" PRIu64 " bytes Bluestein: %" PRIu64 " bytes x %d apps %s max FFT rel_L2_error: %.3e max iFFT rel_L2_error: %.3e %s\n", configuration.size[0], configuration.size[1], configuration.size[2], configuration.numberBatches, (uint64_t)workspaceSize.workspaceTempSize, (uint64_t)workspaceSize.workspaceBluesteinSize, num_apps, inWorkspace ? "used" : "NOT USED", max_error_forward, max_error_inverse, passed ? "passed" : "FAILED");
+
+		for (int a = 0; a < num_apps; a++) {
+			deleteVkFFT(&app[a]);
+		}
+#if(VKFFT_BACKEND==5)
+		workspace->release();
+#else
+		freeTestBuffer(vkGPU, &workspaceBuffer);
+#endif
+		freeTestBuffer(vkGPU, &buffer);
+	}
+	if (failed) resFFT = VKFFT_ERROR_MATH_FAILED;
+	return resFFT;
+}
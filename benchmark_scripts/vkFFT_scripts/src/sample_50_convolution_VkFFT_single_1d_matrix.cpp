@@ -87,7 +87,7 @@ VkFFTResult sample_50_convolution_VkFFT_single_1d_matrix(VkGPU* vkGPU, uint64_t
 	//After this, configuration file contains pointers to Vulkan objects needed to work with the GPU: VkDevice* device - created device, [uint64_t *bufferSize, VkBuffer *buffer, VkDeviceMemory* bufferDeviceMemory] - allocated GPU memory FFT is performed on. [uint64_t *kernelSize, VkBuffer *kernel, VkDeviceMemory* kernelDeviceMemory] - allocated GPU memory, where kernel for convolution is stored.
 #if(VKFFT_BACKEND==5)
 	configuration.device = vkGPU->device;
-#else
+#elif(VKFFT_BACKEND!=6)
 	configuration.device = &vkGPU->device;
 #endif
 #if(VKFFT_BACKEND==0)
@@ -141,6 +141,11 @@ VkFFTResult sample_50_convolution_VkFFT_single_1d_matrix(VkGPU* vkGPU, uint64_t
 	MTL::Buffer* kernel = 0;
 	kernel = vkGPU->device->newBuffer(kernelSize, MTL::ResourceStorageModePrivate);
 	configuration.buffer = &kernel;
+#elif(VKFFT_BACKEND==6)
+	void* kernel = 0;
+	kernel = malloc(kernelSize);
+	if (!kernel) return VKFFT_ERROR_MALLOC_FAILED;
+	configuration.buffer = &kernel;
 #endif
 
 	configuration.bufferSize = &kernelSize;
@@ -207,6 +212,8 @@ VkFFTResult sample_50_convolution_VkFFT_single_1d_matrix(VkGPU* vkGPU, uint64_t
 	convolution_configuration.kernel = (void**)&kernel;
 #elif(VKFFT_BACKEND==5)
 	convolution_configuration.kernel = &kernel;
+#elif(VKFFT_BACKEND==6)
+	convolution_configuration.kernel = &kernel;
 #endif	
 
 	//Allocate separate buffer for the input data.
@@ -241,6 +248,11 @@ VkFFTResult sample_50_convolution_VkFFT_single_1d_matrix(VkGPU* vkGPU, uint64_t
 	MTL::Buffer* buffer = 0;
 	buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
 	configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+	void* buffer = 0;
+	buffer = malloc(bufferSize);
+	if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
+	configuration.buffer = &buffer;
 #endif
 
 	convolution_configuration.bufferSize = &bufferSize;
@@ -319,6 +331,9 @@ VkFFTResult sample_50_convolution_VkFFT_single_1d_matrix(VkGPU* vkGPU, uint64_t
 #elif(VKFFT_BACKEND==5)
 	buffer->release();
 	kernel->release();
+#elif(VKFFT_BACKEND==6)
+	free(buffer);
+	free(kernel);
 #endif	
 	deleteVkFFT(&app_kernel);
 	deleteVkFFT(&app_convolution);
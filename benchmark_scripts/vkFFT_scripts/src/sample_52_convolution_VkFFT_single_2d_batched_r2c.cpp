@@ -88,7 +88,7 @@ VkFFTResult sample_52_convolution_VkFFT_single_2d_batched_r2c(VkGPU* vkGPU, uint
 	//After this, configuration file contains pointers to Vulkan objects needed to work with the GPU: VkDevice* device - created device, [uint64_t *bufferSize, VkBuffer *buffer, VkDeviceMemory* bufferDeviceMemory] - allocated GPU memory FFT is performed on. [uint64_t *kernelSize, VkBuffer *kernel, VkDeviceMemory* kernelDeviceMemory] - allocated GPU memory, where kernel for convolution is stored.
 #if(VKFFT_BACKEND==5)
     configuration.device = vkGPU->device;
-#else
+#elif(VKFFT_BACKEND!=6)
     configuration.device = &vkGPU->device;
 #endif
 #if(VKFFT_BACKEND==0)
@@ -142,6 +142,11 @@ VkFFTResult sample_52_convolution_VkFFT_single_2d_batched_r2c(VkGPU* vkGPU, uint
 	MTL::Buffer* kernel = 0;
 	kernel = vkGPU->device->newBuffer(kernelSize, MTL::ResourceStorageModePrivate);
 	configuration.buffer = &kernel;
+#elif(VKFFT_BACKEND==6)
+	void* kernel = 0;
+	kernel = malloc(kernelSize);
+	if (!kernel) return VKFFT_ERROR_MALLOC_FAILED;
+	configuration.buffer = &kernel;
 #endif
 
 	configuration.bufferSize = &kernelSize;
@@ -202,6 +207,8 @@ VkFFTResult sample_52_convolution_VkFFT_single_2d_batched_r2c(VkGPU* vkGPU, uint
 	convolution_configuration.kernel = (void**)&kernel;
 #elif(VKFFT_BACKEND==5)
 	convolution_configuration.kernel = &kernel;
+#elif(VKFFT_BACKEND==6)
+	convolution_configuration.kernel = &kernel;
 #endif	
 
 	convolution_configuration.kernelSize = &kernelSize;
@@ -266,6 +273,15 @@ VkFFTResult sample_52_convolution_VkFFT_single_2d_batched_r2c(VkGPU* vkGPU, uint
 	buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
 	convolution_configuration.inputBuffer = &inputBuffer;
     convolution_configuration.buffer = &buffer;
+#elif(VKFFT_BACKEND==6)
+	void* inputBuffer = 0;
+	void* buffer = 0;
+	inputBuffer = malloc(inputBufferSize);
+	if (!inputBuffer) return VKFFT_ERROR_MALLOC_FAILED;
+	buffer = malloc(bufferSize);
+	if (!buffer) return VKFFT_ERROR_MALLOC_FAILED;
+	convolution_configuration.inputBuffer = &inputBuffer;
+	convolution_configuration.buffer = &buffer;
 #endif
 
 	convolution_configuration.inputBufferSize = &inputBufferSize;
@@ -358,6 +374,10 @@ VkFFTResult sample_52_convolution_VkFFT_single_2d_batched_r2c(VkGPU* vkGPU, uint
 	inputBuffer->release();
 	buffer->release();
 	kernel->release();
+#elif(VKFFT_BACKEND==6)
+	free(inputBuffer);
+	free(buffer);
+	free(kernel);
 #endif	
 	deleteVkFFT(&app_kernel);
 	deleteVkFFT(&app_convolution);
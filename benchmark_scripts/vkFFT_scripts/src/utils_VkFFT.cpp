@@ -244,7 +244,7 @@ VkResult createDevice(VkGPU* vkGPU, uint64_t sample_id) {
 	VkDeviceCreateInfo deviceCreateInfo = { VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO };
 	VkPhysicalDeviceFeatures deviceFeatures = {};
 	switch (sample_id) {
-	case 1: case 9: case 12: case 17: case 18: case 19: case 101: case 201: case 203: case 1001: case 1004: {
+	case 1: case 9: case 12: case 17: case 18: case 19: case 24: case 101: case 201: case 203: case 1001: case 1004: {
 		deviceFeatures.shaderFloat64 = true;
 		deviceCreateInfo.enabledExtensionCount = (uint32_t)vkGPU->enabledDeviceExtensions.size();
 		deviceCreateInfo.ppEnabledExtensionNames = vkGPU->enabledDeviceExtensions.data();
@@ -283,6 +283,30 @@ VkResult createDevice(VkGPU* vkGPU, uint64_t sample_id) {
 		break;
 	}
 #endif
+	case 28: {
+		//push descriptors are tested only if the device supports them
+		uint32_t extensionCount = 0;
+		res = vkEnumerateDeviceExtensionProperties(vkGPU->physicalDevice, NULL, &extensionCount, NULL);
+		if (res != VK_SUCCESS) return res;
+		std::vector<VkExtensionProperties> extensions(extensionCount);
+		res = vkEnumerateDeviceExtensionProperties(vkGPU->physicalDevice, NULL, &extensionCount, extensions.data());
+		if (res != VK_SUCCESS) return res;
+		for (uint32_t i = 0; i < extensionCount; i++) {
+			if (!strcmp(extensions[i].extensionName, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)) {
+				vkGPU->enabledDeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+				break;
+			}
+		}
+		deviceCreateInfo.enabledExtensionCount = (uint32_t)vkGPU->enabledDeviceExtensions.size();
+		deviceCreateInfo.ppEnabledExtensionNames = vkGPU->enabledDeviceExtensions.data();
+		deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+		deviceCreateInfo.queueCreateInfoCount = 1;
+		deviceCreateInfo.pEnabledFeatures = &deviceFeatures;
+		res = vkCreateDevice(vkGPU->physicalDevice, &deviceCreateInfo, NULL, &vkGPU->device);
+		if (res != VK_SUCCESS) return res;
+		vkGetDeviceQueue(vkGPU->device, (uint32_t)vkGPU->queueFamilyIndex, 0, &vkGPU->queue);
+		break;
+	}
 	default: {
 		deviceCreateInfo.enabledExtensionCount = (uint32_t)vkGPU->enabledDeviceExtensions.size();
 		deviceCreateInfo.ppEnabledExtensionNames = vkGPU->enabledDeviceExtensions.data();
@@ -479,6 +503,9 @@ VkFFTResult transferDataToCPU(VkGPU* vkGPU, void* cpu_arr, void* output_buffer,
 	copyCommandBuffer->release();
 	memcpy(cpu_arr, stagingBuffer->contents(), transferSize);
 	stagingBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	void* buffer = ((void**)output_buffer)[0];
+	memcpy(cpu_arr, buffer, transferSize);
 #endif
 	return resFFT;
 }
@@ -603,6 +630,9 @@ VkFFTResult transferDataFromCPU(VkGPU* vkGPU, void* cpu_arr, void* input_buffer,
 	blitCommandEncoder->release();
 	copyCommandBuffer->release();
 	stagingBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	void* buffer = ((void**)input_buffer)[0];
+	memcpy(buffer, cpu_arr, transferSize);
 #endif
 	return resFFT;
 }
@@ -739,6 +769,8 @@ VkFFTResult devices_list() {
 		MTL::Device* loc_device = (MTL::Device*)devices->object(i);
 		printf("Device id: %" PRIu64 " name: %s\n", i, loc_device->name()->cString(NS::UTF8StringEncoding));
 	}
+#elif(VKFFT_BACKEND==6)
+	printf("Device id: 0 name: host CPU\n");
 #endif
 	return VKFFT_SUCCESS;
 }
@@ -862,6 +894,15 @@ VkFFTResult performVulkanFFT(VkGPU* vkGPU, VkFFTApplication* app, VkFFTLaunchPar
 
 	commandEncoder->release();
 	commandBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	//CPU kernels are executed during VkFFTAppend, so the transforms are complete when it returns
+	std::chrono::steady_clock::time_point timeSubmit = std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < num_iter; i++) {
+		resFFT = VkFFTAppend(app, inverse, launchParams);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	std::chrono::steady_clock::time_point timeEnd = std::chrono::steady_clock::now();
+	double totTime = std::chrono::duration_cast<std::chrono::microseconds>(timeEnd - timeSubmit).count() * 0.001;
 #endif
 	return resFFT;
 }
@@ -998,6 +1039,172 @@ VkFFTResult performVulkanFFTiFFT(VkGPU* vkGPU, VkFFTApplication* app, VkFFTLaunc
 	time_result[0] = totTime / num_iter;
 	commandEncoder->release();
 	commandBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	std::chrono::steady_clock::time_point timeSubmit = std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < num_iter; i++) {
+		resFFT = VkFFTAppend(app, -1, launchParams);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		resFFT = VkFFTAppend(app, 1, launchParams);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	std::chrono::steady_clock::time_point timeEnd = std::chrono::steady_clock::now();
+	double totTime = std::chrono::duration_cast<std::chrono::microseconds>(timeEnd - timeSubmit).count() * 0.001;
+	time_result[0] = totTime / num_iter;
 #endif
 	return resFFT;
 }
+double referenceDFTError(void* cpu_arr, void* input, uint64_t precision, uint64_t FFTdim, uint64_t* size, uint64_t numberBatches, int inverse) {
+	//naive long double DFT along each axis of a contiguous C2C system, used to check transforms without an external FFT library. Returns relative L2 error of cpu_arr or -1 if memory can't be allocated
+	uint64_t systemSize = 1;
+	for (uint64_t i = 0; i < FFTdim; i++) systemSize *= size[i];
+	uint64_t totalSize = systemSize * numberBatches;
+	long double* reference = (long double*)malloc(sizeof(long double) * 2 * totalSize);
+	if (!reference) return -1;
+	uint64_t maxSize = 1;
+	for (uint64_t i = 0; i < FFTdim; i++) if (size[i] > maxSize) maxSize = size[i];
+	long double* line = (long double*)malloc(sizeof(long double) * 4 * maxSize);
+	if (!line) {
+		free(reference);
+		return -1;
+	}
+	for (uint64_t i = 0; i < 2 * totalSize; i++)
+		reference[i] = (precision == 0) ? (long double)((float*)input)[i] : (long double)((double*)input)[i];
+	long double PI = 3.14159265358979323846264338327950288419716939937510L;
+	uint64_t stride = 1;
+	for (uint64_t axis = 0; axis < FFTdim; axis++) {
+		uint64_t N = size[axis];
+		long double* twiddles = line + 2 * maxSize;
+		for (uint64_t k = 0; k < N; k++) {
+			twiddles[2 * k] = cosl(2 * PI * k / N);
+			twiddles[2 * k + 1] = (inverse == -1) ? -sinl(2 * PI * k / N) : sinl(2 * PI * k / N);
+		}
+		for (uint64_t l = 0; l < totalSize / N; l++) {
+			uint64_t offset = (l % stride) + (l / stride) * stride * N;
+			for (uint64_t k = 0; k < N; k++) {
+				long double sum[2] = { 0, 0 };
+				for (uint64_t j = 0; j < N; j++) {
+					long double* w = twiddles + 2 * ((j * k) % N);
+					long double* x = reference + 2 * (offset + j * stride);
+					sum[0] += x[0] * w[0] - x[1] * w[1];
+					sum[1] += x[0] * w[1] + x[1] * w[0];
+				}
+				line[2 * k] = sum[0];
+				line[2 * k + 1] = sum[1];
+			}
+			for (uint64_t k = 0; k < N; k++) {
+				reference[2 * (offset + k * stride)] = line[2 * k];
+				reference[2 * (offset + k * stride) + 1] = line[2 * k + 1];
+			}
+		}
+		stride *= N;
+	}
+	long double errorNorm = 0;
+	long double referenceNorm = 0;
+	for (uint64_t i = 0; i < 2 * totalSize; i++) {
+		long double value = (precision == 0) ? (long double)((float*)cpu_arr)[i] : (long double)((double*)cpu_arr)[i];
+		errorNorm += (value - reference[i]) * (value - reference[i]);
+		referenceNorm += reference[i] * reference[i];
+	}
+	free(line);
+	free(reference);
+	if (referenceNorm == 0) return (double)sqrtl(errorNorm);
+	return (double)sqrtl(errorNorm / referenceNorm);
+}
+void setTestDeviceConfiguration(VkGPU* vkGPU, VkFFTConfiguration* configuration, uint64_t isCompilerInitialized) {
+	//device handles of the test GPU, shared by the reference DFT tests
+#if(VKFFT_BACKEND==5)
+	configuration->device = vkGPU->device;
+#elif(VKFFT_BACKEND!=6)
+	configuration->device = &vkGPU->device;
+#endif
+#if(VKFFT_BACKEND==0)
+	configuration->queue = &vkGPU->queue;
+	configuration->fence = &vkGPU->fence;
+	configuration->commandPool = &vkGPU->commandPool;
+	configuration->physicalDevice = &vkGPU->physicalDevice;
+	configuration->isCompilerInitialized = isCompilerInitialized;
+#elif(VKFFT_BACKEND==3)
+	configuration->context = &vkGPU->context;
+#elif(VKFFT_BACKEND==4)
+	configuration->context = &vkGPU->context;
+	configuration->commandQueue = &vkGPU->commandQueue;
+	configuration->commandQueueID = vkGPU->commandQueueID;
+#elif(VKFFT_BACKEND==5)
+	configuration->queue = vkGPU->queue;
+#endif
+}
+VkFFTResult allocateTestBuffer(VkGPU* vkGPU, VkFFTTestBuffer* buffer, uint64_t bufferSize) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	buffer->bufferSize = bufferSize;
+#if(VKFFT_BACKEND==0)
+	resFFT = allocateBuffer(vkGPU, &buffer->buffer, &buffer->bufferDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaMalloc(&buffer->buffer, bufferSize);
+	if (res != cudaSuccess) resFFT = VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipMalloc(&buffer->buffer, bufferSize);
+	if (res != hipSuccess) resFFT = VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	buffer->buffer = clCreateBuffer(vkGPU->context, CL_MEM_READ_WRITE, bufferSize, 0, &res);
+	if (res != CL_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==4)
+	ze_device_mem_alloc_desc_t device_desc = {};
+	device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+	ze_result_t res = zeMemAllocDevice(vkGPU->context, &device_desc, bufferSize, sizeof(float), vkGPU->device, &buffer->buffer);
+	if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==5)
+	buffer->buffer = vkGPU->device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+	if (!buffer->buffer) resFFT = VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==6)
+	buffer->buffer = malloc(bufferSize);
+	if (!buffer->buffer) resFFT = VKFFT_ERROR_MALLOC_FAILED;
+#endif
+	return resFFT;
+}
+void freeTestBuffer(VkGPU* vkGPU, VkFFTTestBuffer* buffer) {
+#if(VKFFT_BACKEND==0)
+	vkDestroyBuffer(vkGPU->device, buffer->buffer, NULL);
+	vkFreeMemory(vkGPU->device, buffer->bufferDeviceMemory, NULL);
+#elif(VKFFT_BACKEND==1)
+	cudaFree(buffer->buffer);
+#elif(VKFFT_BACKEND==2)
+	hipFree(buffer->buffer);
+#elif(VKFFT_BACKEND==3)
+	clReleaseMemObject(buffer->buffer);
+#elif(VKFFT_BACKEND==4)
+	zeMemFree(vkGPU->context, buffer->buffer);
+#elif(VKFFT_BACKEND==5)
+	buffer->buffer->release();
+#elif(VKFFT_BACKEND==6)
+	free(buffer->buffer);
+#endif
+	buffer->buffer = 0;
+}
+VkFFTResult referenceTestVkFFT(VkGPU* vkGPU, VkFFTApplication* app, VkFFTLaunchParams* launchParams, VkFFTTestBuffer* inputBuffer, VkFFTTestBuffer* outputBuffer, uint64_t FFTdim, uint64_t* size, uint64_t numberBatches, double* error_forward, double* error_inverse) {
+	//single precision C2C FFT of random data from inputBuffer to outputBuffer and iFFT back, compared against referenceDFTError. Both buffers are the same for in-place transforms
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	uint64_t numElements = numberBatches;
+	for (uint64_t i = 0; i < FFTdim; i++) numElements *= size[i];
+	uint64_t bufferSize = sizeof(float) * 2 * numElements;
+	std::vector<float> buffer_input(2 * numElements);
+	std::vector<float> buffer_forward(2 * numElements);
+	std::vector<float> buffer_inverse(2 * numElements);
+	for (uint64_t i = 0; i < 2 * numElements; i++) {
+		buffer_input[i] = (float)(2 * ((float)rand()) / RAND_MAX - 1.0);
+	}
+	resFFT = transferDataFromCPU(vkGPU, buffer_input.data(), &inputBuffer->buffer, bufferSize);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	resFFT = performVulkanFFT(vkGPU, app, launchParams, -1, 1);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	resFFT = transferDataToCPU(vkGPU, buffer_forward.data(), &outputBuffer->buffer, bufferSize);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	resFFT = performVulkanFFT(vkGPU, app, launchParams, 1, 1);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	resFFT = transferDataToCPU(vkGPU, buffer_inverse.data(), &inputBuffer->buffer, bufferSize);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	error_forward[0] = referenceDFTError(buffer_forward.data(), buffer_input.data(), 0, FFTdim, size, numberBatches, -1);
+	error_inverse[0] = referenceDFTError(buffer_inverse.data(), buffer_forward.data(), 0, FFTdim, size, numberBatches, 1);
+	if ((error_forward[0] < 0) || (error_inverse[0] < 0)) return VKFFT_ERROR_MALLOC_FAILED;
+	return resFFT;
+}
@@ -26,6 +26,7 @@
 #include <locale.h>
 #include <memory.h>
 #include <math.h>
+#include <float.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -67,6 +68,8 @@
 #define VKFFT_ZERO_INIT {0}
 #endif
 
+#define VKFFT_VERSION 10304 //X.XX.XX format
+
 #ifndef VKFFT_MAX_FFT_DIMENSIONS
 #define VKFFT_MAX_FFT_DIMENSIONS 4
 #endif
@@ -85,7 +88,7 @@
 #define pffloor floorq
 #define pfsqrt sqrtq
 
-#define pfFPinit(x) strtoflt128(x, 0)
+#define pfStringToFP(x) strtoflt128(x, 0)
 
 #else
 #define pfLD long double
@@ -97,16 +100,48 @@
 #define pffloor floor
 #define pfsqrt sqrt
 
-#define pfFPinit(x) strtold(x, 0)
+#define pfStringToFP(x) strtold(x, 0)
 
 #endif
 
+static inline pfLD pfFPinitString(const char* str) {
+	//locale-independent replacement of strtold: the decimal point is removed and the exponent is shifted by the number of fractional digits, so only digits, sign and exponent are parsed
+	char buffer[128];
+	size_t pos = 0;
+	pfINT exponent = 0;
+	int fraction = 0;
+	const char* c = str;
+	if ((*c == '-') || (*c == '+')) {
+		buffer[pos] = *c;
+		pos++;
+		c++;
+	}
+	for (; *c; c++) {
+		if (*c == '.') {
+			fraction = 1;
+		}
+		else if ((*c >= '0') && (*c <= '9')) {
+			if (pos + 32 >= 128) return pfStringToFP(str);
+			buffer[pos] = *c;
+			pos++;
+			exponent -= fraction;
+		}
+		else break;
+	}
+	if ((pos == 0) || ((pos == 1) && ((buffer[0] == '-') || (buffer[0] == '+')))) return pfStringToFP(str);
+	if ((*c == 'e') || (*c == 'E')) exponent += (pfINT)strtoll(c + 1, 0, 10);
+	snprintf(buffer + pos, 128 - pos, "e%" PRIi64, exponent);
+	return pfStringToFP(buffer);
+}
+#define pfFPinit(x) pfFPinitString(x)
+
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_RunApp.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_InitializeApp.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
+#include "vkFFT/vkFFT_AppManagement/vkFFT_ExecutionContext.h"
 
 static inline int VkFFTGetVersion() {
-	return 10304; //X.XX.XX format
+	return VKFFT_VERSION;
 }
 #endif
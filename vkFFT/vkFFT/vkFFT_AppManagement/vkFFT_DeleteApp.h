@@ -24,8 +24,117 @@
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_DeletePlan.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_UpdateBuffers.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CompileJobs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanCache.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_HostFFT.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_DispatchProfile.h"
+
+static inline void VkFFT_FreeUploadBatch(VkFFTApplication* app) {
+	//frees the staging area and the recorded copies without submitting them
+	VkFFTUploadBatch* batch = &app->uploadBatch;
+#if(VKFFT_BACKEND==0)
+	if (batch->commandBuffer) vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &batch->commandBuffer);
+	if (batch->stagingBuffer) vkDestroyBuffer(app->configuration.device[0], batch->stagingBuffer, 0);
+	if (batch->stagingBufferMemory) {
+		if (batch->stagingData) vkUnmapMemory(app->configuration.device[0], batch->stagingBufferMemory);
+		vkFreeMemory(app->configuration.device[0], batch->stagingBufferMemory, 0);
+	}
+#elif(VKFFT_BACKEND==3)
+	if (batch->commandQueue) clReleaseCommandQueue(batch->commandQueue);
+	if (batch->stagingData) free(batch->stagingData);
+#elif(VKFFT_BACKEND==4)
+	if (batch->commandList) zeCommandListDestroy(batch->commandList);
+	if (batch->stagingData) free(batch->stagingData);
+#elif(VKFFT_BACKEND==5)
+	if (batch->blitCommandEncoder) {
+		batch->blitCommandEncoder->endEncoding();
+		batch->blitCommandEncoder->release();
+	}
+	if (batch->commandBuffer) batch->commandBuffer->release();
+	if (batch->stagingBuffer) batch->stagingBuffer->release();
+#endif
+	memset(batch, 0, sizeof(VkFFTUploadBatch));
+}
+
+static inline void VkFFT_FreeDispatchLists(VkFFTApplication* app) {
+	for (pfUINT i = 0; i < 2; i++) {
+		if (app->dispatchList[i].entries) free(app->dispatchList[i].entries);
+		if (app->dispatchList[i].blocks) free(app->dispatchList[i].blocks);
+		memset(&app->dispatchList[i], 0, sizeof(VkFFTDispatchList));
+	}
+}
+
+static inline void VkFFT_FreeTempBuffer(VkFFTApplication* app) {
+	//frees the temp buffer allocated by VkFFT_AllocateTempBuffer or VkFFT_AllocateWorkspaceTempBuffer
+#if((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4) || (VKFFT_BACKEND==6))
+	//a temp buffer in workspace is a pointer into it
+	if ((app->configuration.workspace) && (app->configuration.tempBuffer != 0)) app->configuration.tempBuffer[0] = 0;
+#endif
+#if(VKFFT_BACKEND==0)
+	if (app->configuration.tempBuffer[0] != 0) {
+		vkDestroyBuffer(app->configuration.device[0], app->configuration.tempBuffer[0], 0);
+		app->configuration.tempBuffer[0] = 0;
+	}
+	if (app->configuration.tempBufferDeviceMemory != 0) {
+		vkFreeMemory(app->configuration.device[0], app->configuration.tempBufferDeviceMemory, 0);
+		app->configuration.tempBufferDeviceMemory = 0;
+	}
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res_t = cudaSuccess;
+	if (app->configuration.tempBuffer[0] != 0) {
+		res_t = cudaFree(app->configuration.tempBuffer[0]);
+		if (res_t == cudaSuccess) app->configuration.tempBuffer[0] = 0;
+	}
+#elif(VKFFT_BACKEND==2)
+	hipError_t res_t = hipSuccess;
+	if (app->configuration.tempBuffer[0] != 0) {
+		res_t = hipFree(app->configuration.tempBuffer[0]);
+		if (res_t == hipSuccess) app->configuration.tempBuffer[0] = 0;
+	}
+#elif(VKFFT_BACKEND==3)
+	cl_int res = 0;
+	if (app->configuration.tempBuffer[0] != 0) {
+		res = clReleaseMemObject(app->configuration.tempBuffer[0]);
+		if (res == 0) app->configuration.tempBuffer[0] = 0;
+	}
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+	if (app->configuration.tempBuffer[0] != 0) {
+		res = zeMemFree(app->configuration.context[0], app->configuration.tempBuffer[0]);
+		if (res == ZE_RESULT_SUCCESS) app->configuration.tempBuffer[0] = 0;
+	}
+#elif(VKFFT_BACKEND==5)
+	if (app->configuration.tempBuffer[0] != 0) {
+		((MTL::Buffer*)app->configuration.tempBuffer[0])->release();
+	}
+#elif(VKFFT_BACKEND==6)
+	if (app->configuration.tempBuffer[0] != 0) {
+		free(app->configuration.tempBuffer[0]);
+		app->configuration.tempBuffer[0] = 0;
+	}
+#endif
+	if (app->configuration.tempBuffer != 0) {
+		free(app->configuration.tempBuffer);
+		app->configuration.tempBuffer = 0;
+	}
+}
 
 static inline void deleteVkFFT(VkFFTApplication* app) {
+	VkFFT_ReleaseCompileJobs(app);
+	VkFFT_FreeUploadBatch(app);
+	VkFFT_FreeDispatchLists(app);
+	VkFFT_ReleasePlanCacheEntry(app);
+	VkFFT_DeleteHostFFT(app);
+	VkFFT_DeleteDispatchProfiler(app);
+	if (app->planProfile) {
+		free(app->planProfile);
+		app->planProfile = 0;
+	}
+	if (app->codeBuffer) {
+		free(app->codeBuffer);
+		app->codeBuffer = 0;
+		app->codeBufferLength = 0;
+	}
 #if(VKFFT_BACKEND==0)
 	if (app->configuration.isCompilerInitialized) {
 		glslang_finalize_process();
@@ -45,6 +154,21 @@ static inline void deleteVkFFT(VkFFTApplication* app) {
 			app->configuration.stream_event = 0;
 		}
 	}
+	for (pfUINT i = 0; i < 2; i++) {
+		if (app->graphExec[i]) {
+			cudaGraphExecDestroy(app->graphExec[i]);
+			app->graphExec[i] = 0;
+		}
+		if (app->graphBuffers[i]) {
+			free(app->graphBuffers[i]);
+			app->graphBuffers[i] = 0;
+		}
+		app->graphBufferNum[i] = 0;
+	}
+	if (app->graphCaptureStream) {
+		cudaStreamDestroy(app->graphCaptureStream);
+		app->graphCaptureStream = 0;
+	}
 #elif(VKFFT_BACKEND==2)
 	if (app->configuration.num_streams > 1) {
 		hipError_t res_t = hipSuccess;
@@ -59,6 +183,23 @@ static inline void deleteVkFFT(VkFFTApplication* app) {
 			app->configuration.stream_event = 0;
 		}
 	}
+	for (pfUINT i = 0; i < 2; i++) {
+		if (app->graphExec[i]) {
+			hipGraphExecDestroy(app->graphExec[i]);
+			app->graphExec[i] = 0;
+		}
+		if (app->graphBuffers[i]) {
+			free(app->graphBuffers[i]);
+			app->graphBuffers[i] = 0;
+		}
+		app->graphBufferNum[i] = 0;
+	}
+	if (app->graphCaptureStream) {
+		hipStreamDestroy(app->graphCaptureStream);
+		app->graphCaptureStream = 0;
+	}
+#elif(VKFFT_BACKEND==6)
+	VkFFT_DestroyCPUThreadPool(app);
 #endif
 	if (app->numRaderFFTPrimes) {
 		for (pfUINT i = 0; i < app->numRaderFFTPrimes; i++) {
@@ -69,48 +210,7 @@ static inline void deleteVkFFT(VkFFTApplication* app) {
 	if (!app->configuration.userTempBuffer) {
 		if (app->configuration.allocateTempBuffer && (app->configuration.tempBuffer != 0)) {
 			app->configuration.allocateTempBuffer = 0;
-#if(VKFFT_BACKEND==0)
-			if (app->configuration.tempBuffer[0] != 0) {
-				vkDestroyBuffer(app->configuration.device[0], app->configuration.tempBuffer[0], 0);
-				app->configuration.tempBuffer[0] = 0;
-			}
-			if (app->configuration.tempBufferDeviceMemory != 0) {
-				vkFreeMemory(app->configuration.device[0], app->configuration.tempBufferDeviceMemory, 0);
-				app->configuration.tempBufferDeviceMemory = 0;
-			}
-#elif(VKFFT_BACKEND==1)
-			cudaError_t res_t = cudaSuccess;
-			if (app->configuration.tempBuffer[0] != 0) {
-				res_t = cudaFree(app->configuration.tempBuffer[0]);
-				if (res_t == cudaSuccess) app->configuration.tempBuffer[0] = 0;
-			}
-#elif(VKFFT_BACKEND==2)
-			hipError_t res_t = hipSuccess;
-			if (app->configuration.tempBuffer[0] != 0) {
-				res_t = hipFree(app->configuration.tempBuffer[0]);
-				if (res_t == hipSuccess) app->configuration.tempBuffer[0] = 0;
-			}
-#elif(VKFFT_BACKEND==3)
-			cl_int res = 0;
-			if (app->configuration.tempBuffer[0] != 0) {
-				res = clReleaseMemObject(app->configuration.tempBuffer[0]);
-				if (res == 0) app->configuration.tempBuffer[0] = 0;
-			}
-#elif(VKFFT_BACKEND==4)
-			ze_result_t res = ZE_RESULT_SUCCESS;
-			if (app->configuration.tempBuffer[0] != 0) {
-				res = zeMemFree(app->configuration.context[0], app->configuration.tempBuffer[0]);
-				if (res == ZE_RESULT_SUCCESS) app->configuration.tempBuffer[0] = 0;
-			}
-#elif(VKFFT_BACKEND==5)
-			if (app->configuration.tempBuffer[0] != 0) {
-				((MTL::Buffer*)app->configuration.tempBuffer[0])->release();
-			}
-#endif
-			if (app->configuration.tempBuffer != 0) {
-				free(app->configuration.tempBuffer);
-				app->configuration.tempBuffer = 0;
-			}
+			VkFFT_FreeTempBuffer(app);
 		}
 		if (app->configuration.tempBufferSize != 0) {
 			free(app->configuration.tempBufferSize);
@@ -148,11 +248,23 @@ static inline void deleteVkFFT(VkFFTApplication* app) {
 						//free(app->bufferRaderUintLUT[i][j]);
 						app->bufferRaderUintLUT[i][j] = 0;
 					}
+#elif(VKFFT_BACKEND==6)
+					free(app->bufferRaderUintLUT[i][j]);
+					app->bufferRaderUintLUT[i][j] = 0;
 #endif
 				}
 			}
 		}
 		if (app->useBluesteinFFT[i]) {
+			if (app->sharedBluestein[i]) VkFFT_ReleaseSharedBluestein(app, i);
+#if((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4) || (VKFFT_BACKEND==6))
+			if (app->configuration.workspace) {
+				//pointers into workspace
+				app->bufferBluestein[i] = 0;
+				app->bufferBluesteinFFT[i] = 0;
+				app->bufferBluesteinIFFT[i] = 0;
+			}
+#endif
 #if(VKFFT_BACKEND==0)
 			if (app->bufferBluestein[i] != 0) {
 				vkDestroyBuffer(app->configuration.device[0], app->bufferBluestein[i], 0);
@@ -250,6 +362,19 @@ static inline void deleteVkFFT(VkFFTApplication* app) {
 				//free(app->bufferBluesteinIFFT[i]);
 				app->bufferBluesteinIFFT[i] = 0;
 			}
+#elif(VKFFT_BACKEND==6)
+			if (app->bufferBluestein[i] != 0) {
+				free(app->bufferBluestein[i]);
+				app->bufferBluestein[i] = 0;
+			}
+			if (app->bufferBluesteinFFT[i] != 0) {
+				free(app->bufferBluesteinFFT[i]);
+				app->bufferBluesteinFFT[i] = 0;
+			}
+			if (app->bufferBluesteinIFFT[i] != 0) {
+				free(app->bufferBluesteinIFFT[i]);
+				app->bufferBluesteinIFFT[i] = 0;
+			}
 #endif
 		}
 	}
@@ -0,0 +1,401 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_EXECUTIONCONTEXT_H
+#define VKFFT_EXECUTIONCONTEXT_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_AppManagement/vkFFT_RunApp.h"
+#include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_ManageMemory.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_DispatchProfile.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_HostFFT.h"
+
+// Execution contexts. VkFFTAppend stores buffers, offsets, push constants and bound descriptors or kernel arguments in the application it is called on,
+// so one application can't record transforms from multiple threads. A context is a copy of the application with its own plans, in which only objects
+// written at launch are recreated: descriptor sets (Vulkan), kernel objects (OpenCL, Level Zero - kernel arguments are stored in them), push constant
+// buffers (Metal), stream events (CUDA, HIP), temp buffer allocated by VkFFT and CPU workers. Modules, pipelines, LUTs, Bluestein buffers and dispatch
+// blocks stay owned by the parent application and are only read.
+
+static inline VkFFTResult VkFFT_ManageContextAxis(VkFFTApplication* app, VkFFTAxis* axis, pfUINT stage) {
+	//stage 0 - detaches launch objects copied from the parent, 1 - creates them for the context, 2 - releases them
+	if (stage == 0) {
+#if(VKFFT_BACKEND==0)
+		axis->descriptorPool = 0;
+		axis->descriptorSet = 0;
+		axis->descriptorBufferInfo = 0;
+		axis->cachedDescriptorSets = 0;
+		axis->cachedDescriptorBufferInfo = 0;
+		axis->numCachedDescriptorSets = 0;
+		axis->nextCachedDescriptorSet = 0;
+#elif(VKFFT_BACKEND==3)
+		axis->kernel = 0;
+#elif(VKFFT_BACKEND==4)
+		axis->VkFFTKernel = 0;
+#elif(VKFFT_BACKEND==5)
+		axis->pushConstants.dataUintBuffer = 0;
+#endif
+		//bindings and push constants of the context are written on its first launch
+		axis->specializationConstants.performBufferSetUpdate = 1;
+		axis->specializationConstants.performOffsetUpdate = 1;
+		axis->updatePushConstants = 1;
+		return VKFFT_SUCCESS;
+	}
+	if (stage == 1) {
+#if(VKFFT_BACKEND==0)
+		//layout is shared with the parent
+		VkFFTResult resFFT = VkFFT_AllocateDescriptorSets(app, axis);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+#elif(VKFFT_BACKEND==3)
+		cl_int res = CL_SUCCESS;
+		axis->kernel = clCreateKernel(axis->program, axis->VkFFTFunctionName, &res);
+		if (res != CL_SUCCESS) {
+			axis->kernel = 0;
+			return VKFFT_ERROR_FAILED_TO_CREATE_SHADER_MODULE;
+		}
+#elif(VKFFT_BACKEND==4)
+		ze_kernel_desc_t kernelDesc = {
+			ZE_STRUCTURE_TYPE_KERNEL_DESC,
+			0,
+			0, // flags
+			axis->VkFFTFunctionName
+		};
+		ze_result_t res = zeKernelCreate(axis->VkFFTModule, &kernelDesc, &axis->VkFFTKernel);
+		if (res != ZE_RESULT_SUCCESS) {
+			axis->VkFFTKernel = 0;
+			return VKFFT_ERROR_FAILED_TO_CREATE_SHADER_MODULE;
+		}
+#endif
+		return VKFFT_SUCCESS;
+	}
+#if(VKFFT_BACKEND==0)
+	VkFFT_FreeDescriptorSets(app, axis);
+#elif(VKFFT_BACKEND==3)
+	if (axis->kernel != 0) {
+		clReleaseKernel(axis->kernel);
+		axis->kernel = 0;
+	}
+#elif(VKFFT_BACKEND==4)
+	if (axis->VkFFTKernel != 0) {
+		zeKernelDestroy(axis->VkFFTKernel);
+		axis->VkFFTKernel = 0;
+	}
+#elif(VKFFT_BACKEND==5)
+	if (axis->pushConstants.dataUintBuffer) {
+		axis->pushConstants.dataUintBuffer->release();
+		axis->pushConstants.dataUintBuffer = 0;
+	}
+#endif
+	return VKFFT_SUCCESS;
+}
+static inline VkFFTResult VkFFT_ManageContextPlan(VkFFTApplication* app, VkFFTPlan* FFTPlan, pfUINT stage) {
+	//visits the same axes as deleteVkFFT
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (FFTPlan == 0) return resFFT;
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		for (pfUINT j = 0; j < FFTPlan->numAxisUploads[i]; j++) {
+			resFFT = VkFFT_ManageContextAxis(app, &FFTPlan->axes[i][j], stage);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
+		if (app->useBluesteinFFT[i] && (FFTPlan->numAxisUploads[i] > 1)) {
+			for (pfUINT j = 1; j < FFTPlan->numAxisUploads[i]; j++) {
+				resFFT = VkFFT_ManageContextAxis(app, &FFTPlan->inverseBluesteinAxes[i][j], stage);
+				if (resFFT != VKFFT_SUCCESS) return resFFT;
+			}
+		}
+	}
+	if (FFTPlan->bigSequenceEvenR2C) {
+		resFFT = VkFFT_ManageContextAxis(app, &FFTPlan->R2Cdecomposition, stage);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	return resFFT;
+}
+static inline VkFFTResult VkFFT_CopyContextPlan(VkFFTApplication* app, VkFFTPlan* parentPlan, VkFFTPlan** plan) {
+	if (parentPlan == 0) return VKFFT_SUCCESS;
+	plan[0] = (VkFFTPlan*)malloc(sizeof(VkFFTPlan));
+	if (!plan[0]) return VKFFT_ERROR_MALLOC_FAILED;
+	memcpy(plan[0], parentPlan, sizeof(VkFFTPlan));
+	return VkFFT_ManageContextPlan(app, plan[0], 0);
+}
+static inline VkFFTResult VkFFT_CopyContextDispatchList(VkFFTExecutionContext* context, pfUINT id) {
+	//entries point to axes of the parent plans and are rebased to the plans of the context. Blocks are not changed by replays and stay shared
+	VkFFTDispatchList* parentList = &context->parent->dispatchList[id];
+	VkFFTDispatchList* list = &context->app.dispatchList[id];
+	list->entries = 0;
+	list->allocatedEntries = 0;
+	if (parentList->entries == 0) return VKFFT_SUCCESS;
+	list->entries = (VkFFTDispatchListEntry*)malloc(parentList->numEntries * sizeof(VkFFTDispatchListEntry));
+	if (!list->entries) return VKFFT_ERROR_MALLOC_FAILED;
+	list->allocatedEntries = parentList->numEntries;
+	for (pfUINT e = 0; e < parentList->numEntries; e++) {
+		VkFFTDispatchListEntry* entry = &list->entries[e];
+		entry[0] = parentList->entries[e];
+		VkFFTPlan* plan = (entry->FFTPlan == context->parent->localFFTPlan) ? context->app.localFFTPlan : context->app.localFFTPlan_inverse;
+		entry->axis = (VkFFTAxis*)((char*)plan + ((char*)entry->axis - (char*)entry->FFTPlan));
+		entry->FFTPlan = plan;
+	}
+	return VKFFT_SUCCESS;
+}
+
+static inline void VkFFTDeleteExecutionContext(VkFFTExecutionContext* context) {
+	//releases objects owned by the context. The parent application is not changed
+	if (context->parent == 0) return;
+	VkFFTApplication* app = &context->app;
+	VkFFT_DeleteHostFFT(app);
+	VkFFT_DeleteDispatchProfiler(app);
+#if(VKFFT_BACKEND==1)
+	if (app->configuration.stream_event != 0) {
+		for (pfUINT i = 0; i < app->configuration.num_streams; i++) {
+			if (app->configuration.stream_event[i] != 0) cudaEventDestroy(app->configuration.stream_event[i]);
+		}
+		free(app->configuration.stream_event);
+		app->configuration.stream_event = 0;
+	}
+	for (pfUINT i = 0; i < 2; i++) {
+		if (app->graphExec[i]) {
+			cudaGraphExecDestroy(app->graphExec[i]);
+			app->graphExec[i] = 0;
+		}
+		if (app->graphBuffers[i]) {
+			free(app->graphBuffers[i]);
+			app->graphBuffers[i] = 0;
+		}
+		app->graphBufferNum[i] = 0;
+	}
+	if (app->graphCaptureStream) {
+		cudaStreamDestroy(app->graphCaptureStream);
+		app->graphCaptureStream = 0;
+	}
+#elif(VKFFT_BACKEND==2)
+	if (app->configuration.stream_event != 0) {
+		for (pfUINT i = 0; i < app->configuration.num_streams; i++) {
+			if (app->configuration.stream_event[i] != 0) hipEventDestroy(app->configuration.stream_event[i]);
+		}
+		free(app->configuration.stream_event);
+		app->configuration.stream_event = 0;
+	}
+	for (pfUINT i = 0; i < 2; i++) {
+		if (app->graphExec[i]) {
+			hipGraphExecDestroy(app->graphExec[i]);
+			app->graphExec[i] = 0;
+		}
+		if (app->graphBuffers[i]) {
+			free(app->graphBuffers[i]);
+			app->graphBuffers[i] = 0;
+		}
+		app->graphBufferNum[i] = 0;
+	}
+	if (app->graphCaptureStream) {
+		hipStreamDestroy(app->graphCaptureStream);
+		app->graphCaptureStream = 0;
+	}
+#elif(VKFFT_BACKEND==6)
+	VkFFT_DestroyCPUThreadPool(app);
+#endif
+	if ((context->ownsTempBuffer) && (app->configuration.tempBuffer != 0)) {
+		VkFFT_FreeTempBuffer(app);
+	}
+	context->ownsTempBuffer = 0;
+	for (pfUINT i = 0; i < 2; i++) {
+		if (app->dispatchList[i].entries) free(app->dispatchList[i].entries);
+	}
+	if (app->localFFTPlan) {
+		VkFFT_ManageContextPlan(app, app->localFFTPlan, 2);
+		free(app->localFFTPlan);
+	}
+	if (app->localFFTPlan_inverse) {
+		VkFFT_ManageContextPlan(app, app->localFFTPlan_inverse, 2);
+		free(app->localFFTPlan_inverse);
+	}
+	memset(app, 0, sizeof(VkFFTApplication));
+	context->parent = 0;
+}
+
+static inline VkFFTResult VkFFTCreateExecutionContext(VkFFTApplication* parent, VkFFTExecutionContext* context) {
+	//creates launch state for parent, which has to be initialized by initializeVkFFT. Contexts of one application can record transforms concurrently;
+	//buffers passed at launch and the default streams or temp buffer provided by the user are not duplicated, so concurrent transforms have to use different ones
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (parent->configuration.dryRun) return VKFFT_ERROR_ENABLED_dryRun;
+	if ((parent->localFFTPlan == 0) && (parent->localFFTPlan_inverse == 0)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+	memcpy(&context->app, parent, sizeof(VkFFTApplication));
+	context->parent = parent;
+	context->ownsTempBuffer = 0;
+	VkFFTApplication* app = &context->app;
+	//objects owned by the parent are detached from the copy before anything can fail, so VkFFTDeleteExecutionContext never releases them
+	app->localFFTPlan = 0;
+	app->localFFTPlan_inverse = 0;
+	for (pfUINT i = 0; i < 2; i++) {
+		app->dispatchList[i].entries = 0;
+		app->dispatchList[i].allocatedEntries = 0;
+		app->dispatchList[i].allocatedBlocks = 0;
+	}
+	memset(&app->uploadBatch, 0, sizeof(VkFFTUploadBatch));
+	app->numCompileJobs = 0;
+	app->codeBuffer = 0;
+	app->codeBufferLength = 0;
+	app->planProfile = 0;
+	app->hostFFT = 0;
+	app->dispatchProfiler = 0;
+	app->planCacheState = 0;
+	app->applicationStringSize = 0;
+	app->saveApplicationString = 0;
+#if(VKFFT_BACKEND==1)
+	app->configuration.stream_event = 0;
+	app->configuration.streamCounter = 0;
+	app->configuration.streamID = 0;
+	app->graphCaptureStream = 0;
+	app->graphExec[0] = 0;
+	app->graphExec[1] = 0;
+	app->graphBuffers[0] = 0;
+	app->graphBuffers[1] = 0;
+	app->graphBufferNum[0] = 0;
+	app->graphBufferNum[1] = 0;
+	app->graphCapture = 0;
+	if (context->stream != 0) {
+		app->configuration.stream = context->stream;
+		app->configuration.num_streams = (context->num_streams != 0) ? context->num_streams : 1;
+	}
+#elif(VKFFT_BACKEND==2)
+	app->configuration.stream_event = 0;
+	app->configuration.streamCounter = 0;
+	app->configuration.streamID = 0;
+	app->graphCaptureStream = 0;
+	app->graphExec[0] = 0;
+	app->graphExec[1] = 0;
+	app->graphBuffers[0] = 0;
+	app->graphBuffers[1] = 0;
+	app->graphBufferNum[0] = 0;
+	app->graphBufferNum[1] = 0;
+	app->graphCapture = 0;
+	if (context->stream != 0) {
+		app->configuration.stream = context->stream;
+		app->configuration.num_streams = (context->num_streams != 0) ? context->num_streams : 1;
+	}
+#elif(VKFFT_BACKEND==6)
+	app->cpuThreadPool = 0;
+#endif
+	if ((parent->configuration.allocateTempBuffer) && (parent->configuration.tempBuffer != 0)) {
+		app->configuration.tempBuffer = 0;
+#if(VKFFT_BACKEND==0)
+		app->configuration.tempBufferDeviceMemory = 0;
+#endif
+	}
+
+	resFFT = VkFFT_CopyContextPlan(app, parent->localFFTPlan, &app->localFFTPlan);
+	if (resFFT != VKFFT_SUCCESS) {
+		VkFFTDeleteExecutionContext(context);
+		return resFFT;
+	}
+	resFFT = VkFFT_CopyContextPlan(app, parent->localFFTPlan_inverse, &app->localFFTPlan_inverse);
+	if (resFFT != VKFFT_SUCCESS) {
+		VkFFTDeleteExecutionContext(context);
+		return resFFT;
+	}
+	resFFT = VkFFT_ManageContextPlan(app, app->localFFTPlan, 1);
+	if (resFFT != VKFFT_SUCCESS) {
+		VkFFTDeleteExecutionContext(context);
+		return resFFT;
+	}
+	resFFT = VkFFT_ManageContextPlan(app, app->localFFTPlan_inverse, 1);
+	if (resFFT != VKFFT_SUCCESS) {
+		VkFFTDeleteExecutionContext(context);
+		return resFFT;
+	}
+	for (pfUINT i = 0; i < 2; i++) {
+		resFFT = VkFFT_CopyContextDispatchList(context, i);
+		if (resFFT != VKFFT_SUCCESS) {
+			VkFFTDeleteExecutionContext(context);
+			return resFFT;
+		}
+	}
+
+	if ((parent->configuration.allocateTempBuffer) && (parent->configuration.tempBuffer != 0)) {
+		context->ownsTempBuffer = 1;
+		//the context can run concurrently with the parent, so its temp buffer is never placed in workspace
+		app->configuration.workspace = 0;
+		resFFT = VkFFT_AllocateTempBuffer(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			VkFFTDeleteExecutionContext(context);
+			return resFFT;
+		}
+	}
+#if(VKFFT_BACKEND==1)
+	if (app->configuration.num_streams > 1) {
+		app->configuration.stream_event = (cudaEvent_t*)calloc(app->configuration.num_streams, sizeof(cudaEvent_t));
+		if (!app->configuration.stream_event) {
+			VkFFTDeleteExecutionContext(context);
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		for (pfUINT i = 0; i < app->configuration.num_streams; i++) {
+			cudaError_t res_t = cudaEventCreate(&app->configuration.stream_event[i]);
+			if (res_t != cudaSuccess) {
+				app->configuration.stream_event[i] = 0;
+				VkFFTDeleteExecutionContext(context);
+				return VKFFT_ERROR_FAILED_TO_CREATE_EVENT;
+			}
+		}
+	}
+#elif(VKFFT_BACKEND==2)
+	if (app->configuration.num_streams > 1) {
+		app->configuration.stream_event = (hipEvent_t*)calloc(app->configuration.num_streams, sizeof(hipEvent_t));
+		if (!app->configuration.stream_event) {
+			VkFFTDeleteExecutionContext(context);
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		for (pfUINT i = 0; i < app->configuration.num_streams; i++) {
+			hipError_t res_t = hipEventCreate(&app->configuration.stream_event[i]);
+			if (res_t != hipSuccess) {
+				app->configuration.stream_event[i] = 0;
+				VkFFTDeleteExecutionContext(context);
+				return VKFFT_ERROR_FAILED_TO_CREATE_EVENT;
+			}
+		}
+	}
+#elif(VKFFT_BACKEND==6)
+	resFFT = VkFFT_CreateCPUThreadPool(app);
+	if (resFFT != VKFFT_SUCCESS) {
+		VkFFTDeleteExecutionContext(context);
+		return resFFT;
+	}
+#endif
+	if (parent->hostFFT) {
+		resFFT = VkFFT_InitHostFFT(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			VkFFTDeleteExecutionContext(context);
+			return resFFT;
+		}
+	}
+	if (parent->dispatchProfiler) {
+		resFFT = VkFFT_InitDispatchProfiler(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			VkFFTDeleteExecutionContext(context);
+			return resFFT;
+		}
+	}
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFTAppendContext(VkFFTExecutionContext* context, int inverse, VkFFTLaunchParams* launchParams) {
+	//same as VkFFTAppend, launch state is written to the context and the parent application is only read
+	if (context->parent == 0) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+	return VkFFTAppend(&context->app, inverse, launchParams);
+}
+
+#endif
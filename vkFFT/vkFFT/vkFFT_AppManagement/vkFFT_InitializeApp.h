@@ -27,10 +27,106 @@
 
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
+#include "vkFFT/vkFFT_AppManagement/vkFFT_RunApp.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_Plans/vkFFT_Plan_FFT.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_Plans/vkFFT_Plan_R2C.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanCache.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Autotune.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_DeviceProfile.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanDescription.h"
+static inline pfUINT VkFFT_CheckBluesteinPaddingPattern(pfUINT numPaddingSizes, pfUINT* primeSizes, pfUINT* paddedSizes) {
+	//sizes are not checked in Scheduler, so the first sequence of each range must fit in its padded size and padded sizes must be decomposable with primes 2-13.
+	//Like in the built-in tables, the rest of the range is expected to only contain sizes that are not done with Bluestein's algorithm
+	for (pfUINT i = 0; i < numPaddingSizes; i++) {
+		pfUINT paddedSize = paddedSizes[i];
+		if (primeSizes[i] < 2) return 0;
+		if ((i != (numPaddingSizes - 1)) && (primeSizes[i + 1] <= primeSizes[i])) return 0;
+		if (paddedSize < 2 * primeSizes[i] - 1) return 0;
+		for (pfUINT j = 2; j < 14; j++) {
+			while ((paddedSize % j) == 0) paddedSize /= j;
+		}
+		if (paddedSize != 1) return 0;
+	}
+	return 1;
+}
+static inline VkFFTResult VkFFT_ReadBluesteinPaddingSection(VkFFTApplication* app, FILE* paddingFile, const char* precision) {
+	//reads "primeSize paddedSize" lines that follow the "precision <precision>" line of bluesteinPaddingFile. Lines starting with # are skipped
+	char line[256];
+	char name[64];
+	pfUINT maxEntries = 0;
+	int inSection = 0;
+	rewind(paddingFile);
+	while (fgets(line, sizeof(line), paddingFile)) {
+		unsigned long long primeSize = 0;
+		unsigned long long paddedSize = 0;
+		if (line[0] == '#') continue;
+		if (sscanf(line, " precision %63s", name) == 1) {
+			if (inSection) break;
+			inSection = (strcmp(name, precision) == 0);
+			continue;
+		}
+		if (!inSection) continue;
+		if (sscanf(line, "%llu %llu", &primeSize, &paddedSize) != 2) continue;
+		if (app->configuration.autoCustomBluesteinPaddingPattern == maxEntries) {
+			maxEntries = (maxEntries) ? 2 * maxEntries : 64;
+			pfUINT* primeSizes = (pfUINT*)realloc(app->configuration.primeSizes, maxEntries * sizeof(pfUINT));
+			if (!primeSizes) return VKFFT_ERROR_MALLOC_FAILED;
+			app->configuration.primeSizes = primeSizes;
+			pfUINT* paddedSizes = (pfUINT*)realloc(app->configuration.paddedSizes, maxEntries * sizeof(pfUINT));
+			if (!paddedSizes) {
+				if (!app->configuration.autoCustomBluesteinPaddingPattern) {
+					//deleteVkFFT only frees arrays of non-empty patterns
+					free(app->configuration.primeSizes);
+					app->configuration.primeSizes = 0;
+				}
+				return VKFFT_ERROR_MALLOC_FAILED;
+			}
+			app->configuration.paddedSizes = paddedSizes;
+		}
+		app->configuration.primeSizes[app->configuration.autoCustomBluesteinPaddingPattern] = (pfUINT)primeSize;
+		app->configuration.paddedSizes[app->configuration.autoCustomBluesteinPaddingPattern] = (pfUINT)paddedSize;
+		app->configuration.autoCustomBluesteinPaddingPattern++;
+	}
+	return VKFFT_SUCCESS;
+}
+static inline VkFFTResult VkFFT_LoadBluesteinPaddingPattern(VkFFTApplication* app) {
+	//loads the pattern for the precision of the application from bluesteinPaddingFile. If the file has no section for it, autoCustomBluesteinPaddingPattern stays 0 and the vendor-based pattern is used
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	FILE* paddingFile = fopen(app->configuration.bluesteinPaddingFile, "r");
+	if (!paddingFile) return VKFFT_ERROR_EMPTY_FILE;
+	const char* precision;
+	const char* fallbackPrecision;
+	VkFFT_GetPrecisionClass(&app->configuration, &precision, &fallbackPrecision);
+	resFFT = VkFFT_ReadBluesteinPaddingSection(app, paddingFile, precision);
+	if ((resFFT == VKFFT_SUCCESS) && (!app->configuration.autoCustomBluesteinPaddingPattern) && (fallbackPrecision))
+		resFFT = VkFFT_ReadBluesteinPaddingSection(app, paddingFile, fallbackPrecision);
+	fclose(paddingFile);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	if (!VkFFT_CheckBluesteinPaddingPattern(app->configuration.autoCustomBluesteinPaddingPattern, app->configuration.primeSizes, app->configuration.paddedSizes)) return VKFFT_ERROR_INVALID_bluesteinPaddingFile;
+	return resFFT;
+}
 static inline VkFFTResult initializeBluesteinAutoPadding(VkFFTApplication* app) {
 	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if ((!app->configuration.useCustomBluesteinPaddingPattern) && (app->configuration.bluesteinPaddingFile)) {
+		resFFT = VkFFT_LoadBluesteinPaddingPattern(app);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		if (app->configuration.autoCustomBluesteinPaddingPattern) return resFFT;
+	}
+	if ((!app->configuration.useCustomBluesteinPaddingPattern) && (app->deviceProfile.numBluesteinPaddingSizes)) {
+		if (!VkFFT_CheckBluesteinPaddingPattern(app->deviceProfile.numBluesteinPaddingSizes, app->deviceProfile.bluesteinPrimeSizes, app->deviceProfile.bluesteinPaddedSizes)) return VKFFT_ERROR_INVALID_deviceProfile;
+		app->configuration.primeSizes = (pfUINT*)malloc(app->deviceProfile.numBluesteinPaddingSizes * sizeof(pfUINT));
+		if (!app->configuration.primeSizes) return VKFFT_ERROR_MALLOC_FAILED;
+		app->configuration.paddedSizes = (pfUINT*)malloc(app->deviceProfile.numBluesteinPaddingSizes * sizeof(pfUINT));
+		if (!app->configuration.paddedSizes) {
+			free(app->configuration.primeSizes);
+			app->configuration.primeSizes = 0;
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		app->configuration.autoCustomBluesteinPaddingPattern = app->deviceProfile.numBluesteinPaddingSizes;
+		memcpy(app->configuration.primeSizes, app->deviceProfile.bluesteinPrimeSizes, app->configuration.autoCustomBluesteinPaddingPattern * sizeof(pfUINT));
+		memcpy(app->configuration.paddedSizes, app->deviceProfile.bluesteinPaddedSizes, app->configuration.autoCustomBluesteinPaddingPattern * sizeof(pfUINT));
+		return resFFT;
+	}
 	if (!app->configuration.useCustomBluesteinPaddingPattern) {
 		switch (app->configuration.vendorID) {
 		case 0x10DE://NVIDIA
@@ -425,63 +521,45 @@ static inline VkFFTResult initializeBluesteinAutoPadding(VkFFTApplication* app)
 	}
 	return resFFT;
 }
-static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration)  {
-	VkFFTResult resFFT = VKFFT_SUCCESS;
-    //app->configuration = {};// inputLaunchConfiguration;
-	if (inputLaunchConfiguration.doublePrecision != 0)	app->configuration.doublePrecision = inputLaunchConfiguration.doublePrecision;
-	if (inputLaunchConfiguration.doublePrecisionFloatMemory != 0)	app->configuration.doublePrecisionFloatMemory = inputLaunchConfiguration.doublePrecisionFloatMemory;
-
-	if (inputLaunchConfiguration.quadDoubleDoublePrecision != 0)	app->configuration.quadDoubleDoublePrecision = inputLaunchConfiguration.quadDoubleDoublePrecision;
-	if (inputLaunchConfiguration.quadDoubleDoublePrecisionDoubleMemory != 0)	app->configuration.quadDoubleDoublePrecisionDoubleMemory = inputLaunchConfiguration.quadDoubleDoublePrecisionDoubleMemory;
-	
-	if (inputLaunchConfiguration.halfPrecision != 0)	app->configuration.halfPrecision = inputLaunchConfiguration.halfPrecision;
-	if (inputLaunchConfiguration.halfPrecisionMemoryOnly != 0)	app->configuration.halfPrecisionMemoryOnly = inputLaunchConfiguration.halfPrecisionMemoryOnly;
-	if (inputLaunchConfiguration.useCustomBluesteinPaddingPattern != 0) {
-		app->configuration.useCustomBluesteinPaddingPattern = inputLaunchConfiguration.useCustomBluesteinPaddingPattern;
-		app->configuration.primeSizes = inputLaunchConfiguration.primeSizes;
-		if (!app->configuration.primeSizes) return VKFFT_ERROR_EMPTY_useCustomBluesteinPaddingPattern_arrays;
-		app->configuration.paddedSizes = inputLaunchConfiguration.paddedSizes;
-		if (!app->configuration.paddedSizes) return VKFFT_ERROR_EMPTY_useCustomBluesteinPaddingPattern_arrays;
-	}
-	//set device parameters
+static inline VkFFTResult setDeviceParametersVkFFT(VkFFTApplication* app, VkFFTConfiguration* inputLaunchConfiguration) {
+	//queries device limits from the backend and copies device handles. Not called in dryRun mode
 #if(VKFFT_BACKEND==0)
-	if (!inputLaunchConfiguration.isCompilerInitialized) {
+	if (!inputLaunchConfiguration->isCompilerInitialized) {
 		if (!app->configuration.isCompilerInitialized) {
 			int resGlslangInitialize = glslang_initialize_process();
 			if (!resGlslangInitialize) return VKFFT_ERROR_FAILED_TO_INITIALIZE;
 			app->configuration.isCompilerInitialized = 1;
 		}
 	}
-	if (inputLaunchConfiguration.physicalDevice == 0) {
+	if (inputLaunchConfiguration->physicalDevice == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_PHYSICAL_DEVICE;
 	}
-	app->configuration.physicalDevice = inputLaunchConfiguration.physicalDevice;
-	if (inputLaunchConfiguration.device == 0) {
+	app->configuration.physicalDevice = inputLaunchConfiguration->physicalDevice;
+	if (inputLaunchConfiguration->device == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_DEVICE;
 	}
-	app->configuration.device = inputLaunchConfiguration.device;
-	if (inputLaunchConfiguration.queue == 0) {
+	app->configuration.device = inputLaunchConfiguration->device;
+	if (inputLaunchConfiguration->queue == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_QUEUE;
 	}
-	app->configuration.queue = inputLaunchConfiguration.queue;
-	if (inputLaunchConfiguration.commandPool == 0) {
+	app->configuration.queue = inputLaunchConfiguration->queue;
+	if (inputLaunchConfiguration->commandPool == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_COMMAND_POOL;
 	}
-	app->configuration.commandPool = inputLaunchConfiguration.commandPool;
-	if (inputLaunchConfiguration.fence == 0) {
+	app->configuration.commandPool = inputLaunchConfiguration->commandPool;
+	if (inputLaunchConfiguration->fence == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_FENCE;
 	}
-	app->configuration.fence = inputLaunchConfiguration.fence;
+	app->configuration.fence = inputLaunchConfiguration->fence;
 
 	VkPhysicalDeviceProperties physicalDeviceProperties = { 0 };
 	vkGetPhysicalDeviceProperties(app->configuration.physicalDevice[0], &physicalDeviceProperties);
 	app->configuration.maxThreadsNum = physicalDeviceProperties.limits.maxComputeWorkGroupInvocations;
-	if (physicalDeviceProperties.vendorID == 0x8086) app->configuration.maxThreadsNum = 256; //Intel fix
 	app->configuration.maxComputeWorkGroupCount[0] = physicalDeviceProperties.limits.maxComputeWorkGroupCount[0];
 	app->configuration.maxComputeWorkGroupCount[1] = physicalDeviceProperties.limits.maxComputeWorkGroupCount[1];
 	app->configuration.maxComputeWorkGroupCount[2] = physicalDeviceProperties.limits.maxComputeWorkGroupCount[2];
@@ -491,56 +569,28 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	//if ((physicalDeviceProperties.vendorID == 0x8086) && (!app->configuration.doublePrecision) && (!app->configuration.doublePrecisionFloatMemory)) app->configuration.halfThreads = 1;
 	app->configuration.sharedMemorySize = physicalDeviceProperties.limits.maxComputeSharedMemorySize;
 	app->configuration.vendorID = physicalDeviceProperties.vendorID;
-	if (inputLaunchConfiguration.pipelineCache != 0)	app->configuration.pipelineCache = inputLaunchConfiguration.pipelineCache;
-	app->configuration.useRaderUintLUT = 1;
-	switch (physicalDeviceProperties.vendorID) {
-	case 0x10DE://NVIDIA
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 64 : 32;//the coalesced memory is equal to 32 bytes between L2 and VRAM.
-		app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-		app->configuration.warpSize = 32;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = 4;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision) ? 4194305 : 4194305;
-		break;
-	case 0x8086://INTEL
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 128 : 64;
-		app->configuration.useLUT = 1;
-		app->configuration.warpSize = 32;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = (physicalDeviceProperties.limits.maxComputeSharedMemorySize >= 65536) ? 1 : 2;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
-		break;
-	case 0x1002://AMD
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 64 : 32;
-		app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-		app->configuration.warpSize = 64;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = (physicalDeviceProperties.limits.maxComputeSharedMemorySize >= 65536) ? 2 : 4;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
-		break;
-	default:
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 128 : 64;
-		app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-		app->configuration.warpSize = 32;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = 1;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
-		break;
+	if (inputLaunchConfiguration->pipelineCache != 0)	app->configuration.pipelineCache = inputLaunchConfiguration->pipelineCache;
+	if (inputLaunchConfiguration->usePushDescriptors != 0)	app->configuration.usePushDescriptors = inputLaunchConfiguration->usePushDescriptors;
+	if (app->configuration.usePushDescriptors) {
+		//VK_KHR_push_descriptor has to be enabled on the device
+		app->cmdPushDescriptorSet = (PFN_vkCmdPushDescriptorSetKHR)vkGetDeviceProcAddr(app->configuration.device[0], "vkCmdPushDescriptorSetKHR");
+		if (!app->cmdPushDescriptorSet) {
+			deleteVkFFT(app);
+			return VKFFT_ERROR_FAILED_TO_LOAD_FUNCTION;
+		}
 	}
+	if (inputLaunchConfiguration->descriptorSetCacheSize != 0)	app->configuration.descriptorSetCacheSize = inputLaunchConfiguration->descriptorSetCacheSize;
+	app->configuration.useRaderUintLUT = 1;
 #elif(VKFFT_BACKEND==1)
 	CUresult res = CUDA_SUCCESS;
 	cudaError_t res_t = cudaSuccess;
-	if (inputLaunchConfiguration.device == 0) {
+	if (inputLaunchConfiguration->device == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_DEVICE;
 	}
-	app->configuration.device = inputLaunchConfiguration.device;
-	if (inputLaunchConfiguration.num_streams != 0)	app->configuration.num_streams = inputLaunchConfiguration.num_streams;
-	if (inputLaunchConfiguration.stream != 0)	app->configuration.stream = inputLaunchConfiguration.stream;
+	app->configuration.device = inputLaunchConfiguration->device;
+	if (inputLaunchConfiguration->num_streams != 0)	app->configuration.num_streams = inputLaunchConfiguration->num_streams;
+	if (inputLaunchConfiguration->stream != 0)	app->configuration.stream = inputLaunchConfiguration->stream;
 	app->configuration.streamID = 0;
 	int value = 0;
 	res = cuDeviceGetAttribute(&value, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, app->configuration.device[0]);
@@ -641,22 +691,16 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 		}
 	}
 
-	app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 64 : 32;//the coalesced memory is equal to 32 bytes between L2 and VRAM.
-	app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-	app->configuration.registerBoostNonPow2 = 0;
-	app->configuration.registerBoost = 1;
-	app->configuration.registerBoost4Step = 1;
-	app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 4194305 : 4194305;
 	app->configuration.vendorID = 0x10DE;
 #elif(VKFFT_BACKEND==2)
 	hipError_t res = hipSuccess;
-	if (inputLaunchConfiguration.device == 0) {
+	if (inputLaunchConfiguration->device == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_DEVICE;
 	}
-	app->configuration.device = inputLaunchConfiguration.device;
-	if (inputLaunchConfiguration.num_streams != 0)	app->configuration.num_streams = inputLaunchConfiguration.num_streams;
-	if (inputLaunchConfiguration.stream != 0)	app->configuration.stream = inputLaunchConfiguration.stream;
+	app->configuration.device = inputLaunchConfiguration->device;
+	if (inputLaunchConfiguration->num_streams != 0)	app->configuration.num_streams = inputLaunchConfiguration->num_streams;
+	if (inputLaunchConfiguration->stream != 0)	app->configuration.stream = inputLaunchConfiguration->stream;
 	app->configuration.streamID = 0;
 	int value = 0;
 	res = hipDeviceGetAttribute(&value, hipDeviceAttributeComputeCapabilityMajor, app->configuration.device[0]);
@@ -745,26 +789,19 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 			}
 		}
 	}
-	app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 64 : 32;
-	app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-	app->configuration.useLUT_4step = -1;
-	app->configuration.registerBoostNonPow2 = 0;
-	app->configuration.registerBoost = 1;
-	app->configuration.registerBoost4Step = 1;
-	app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1048576 : 2097152;
 	app->configuration.vendorID = 0x1002;
 #elif(VKFFT_BACKEND==3)
 	cl_int res = 0;
-	if (inputLaunchConfiguration.device == 0) {
+	if (inputLaunchConfiguration->device == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_DEVICE;
 	}
-	app->configuration.device = inputLaunchConfiguration.device;
-	if (inputLaunchConfiguration.context == 0) {
+	app->configuration.device = inputLaunchConfiguration->device;
+	if (inputLaunchConfiguration->context == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_CONTEXT;
 	}
-	app->configuration.context = inputLaunchConfiguration.context;
+	app->configuration.context = inputLaunchConfiguration->context;
 	cl_uint vendorID;
 	size_t value_int64;
 	cl_uint value_cl_uint;
@@ -815,63 +852,24 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	app->configuration.sharedMemorySize = sharedMemorySize;
 	app->configuration.vendorID = vendorID;
 	app->configuration.useRaderUintLUT = 1;
-	switch (vendorID) {
-	case 0x10DE://NVIDIA
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 64 : 32;//the coalesced memory is equal to 32 bytes between L2 and VRAM.
-		app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-		app->configuration.warpSize = 32;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = 4;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 4194305 : 4194305;
-		app->configuration.sharedMemorySize -= 0x10;//reserved by system
-		break;
-	case 0x8086://INTEL
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 128 : 64;
-		app->configuration.useLUT = 1;
-		app->configuration.warpSize = 32;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = (sharedMemorySize >= 65536) ? 1 : 2;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
-		break;
-	case 0x1002://AMD
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 64 : 32;
-		app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-		app->configuration.warpSize = 64;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = (sharedMemorySize >= 65536) ? 2 : 4;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
-		break;
-	default:
-		app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 128 : 64;
-		app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-		app->configuration.warpSize = 32;
-		app->configuration.registerBoostNonPow2 = 0;
-		app->configuration.registerBoost = 1;
-		app->configuration.registerBoost4Step = 1;
-		app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
-		break;
-	}
 #elif(VKFFT_BACKEND==4)
 	ze_result_t res = ZE_RESULT_SUCCESS;
-	if (inputLaunchConfiguration.device == 0) {
+	if (inputLaunchConfiguration->device == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_DEVICE;
 	}
-	app->configuration.device = inputLaunchConfiguration.device;
-	if (inputLaunchConfiguration.context == 0) {
+	app->configuration.device = inputLaunchConfiguration->device;
+	if (inputLaunchConfiguration->context == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_CONTEXT;
 	}
-	app->configuration.context = inputLaunchConfiguration.context;
-	if (inputLaunchConfiguration.commandQueue == 0) {
+	app->configuration.context = inputLaunchConfiguration->context;
+	if (inputLaunchConfiguration->commandQueue == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_QUEUE;
 	}
-	app->configuration.commandQueue = inputLaunchConfiguration.commandQueue;
-	app->configuration.commandQueueID = inputLaunchConfiguration.commandQueueID;
+	app->configuration.commandQueue = inputLaunchConfiguration->commandQueue;
+	app->configuration.commandQueueID = inputLaunchConfiguration->commandQueueID;
 	ze_device_properties_t device_properties;
 	ze_device_compute_properties_t compute_properties;
 	res = zeDeviceGetProperties(app->configuration.device[0], &device_properties);
@@ -889,28 +887,21 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	app->configuration.maxComputeWorkGroupCount[2] = compute_properties.maxGroupCountZ;
 	//if ((vendorID == 0x8086) && (!app->configuration.doublePrecision) && (!app->configuration.doublePrecisionFloatMemory)) app->configuration.halfThreads = 1;
 	app->configuration.sharedMemorySize = compute_properties.maxSharedLocalMemory;
-
-	app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 128 : 64;
-	app->configuration.useLUT = 1;
 	app->configuration.warpSize = device_properties.physicalEUSimdWidth;
-	app->configuration.registerBoostNonPow2 = 0;
-	app->configuration.registerBoost = (app->configuration.sharedMemorySize >= 65536) ? 1 : 2;
-	app->configuration.registerBoost4Step = 1;
-	app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
 	app->configuration.vendorID = 0x8086;
 	app->configuration.useRaderUintLUT = 1;
 #elif(VKFFT_BACKEND==5)
-	if (inputLaunchConfiguration.device == 0) {
+	if (inputLaunchConfiguration->device == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_DEVICE;
 	}
-	app->configuration.device = inputLaunchConfiguration.device;
+	app->configuration.device = inputLaunchConfiguration->device;
 
-	if (inputLaunchConfiguration.queue == 0) {
+	if (inputLaunchConfiguration->queue == 0) {
 		deleteVkFFT(app);
 		return VKFFT_ERROR_INVALID_QUEUE;
 	}
-	app->configuration.queue = inputLaunchConfiguration.queue;
+	app->configuration.queue = inputLaunchConfiguration->queue;
 
 	const char dummy_kernel[50] = "kernel void VkFFT_dummy (){}";
 	const char function_name[20] = "VkFFT_dummy";
@@ -949,13 +940,6 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	app->configuration.warpSize = dummy_state->threadExecutionWidth();
 
 	app->configuration.useRaderUintLUT = 1;
-
-	app->configuration.coalescedMemory = (app->configuration.halfPrecision) ? 128 : 64;//the coalesced memory is equal to 64 bytes between L2 and VRAM.
-	app->configuration.useLUT = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 1 : -1;
-	app->configuration.registerBoostNonPow2 = 0;
-	app->configuration.registerBoost = 1;
-	app->configuration.registerBoost4Step = 1;
-	app->configuration.swapTo3Stage4Step = (app->configuration.doublePrecision || app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 262144 : 524288;
 	app->configuration.vendorID = 0x1027f00;
 
 	dummy_state->release();
@@ -964,7 +948,94 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	dummy_library->release();
 	str_code->release();
 	compileOptions->release();
+#elif(VKFFT_BACKEND==6)
+	//there is nothing to query - workgroups are executed by a single thread, so their size only sets how much work is done between barriers
+	app->configuration.maxThreadsNum = 256;
+	app->configuration.maxComputeWorkGroupSize[0] = 256;
+	app->configuration.maxComputeWorkGroupSize[1] = 256;
+	app->configuration.maxComputeWorkGroupSize[2] = 256;
+	//workgroup ids are passed to kernels as unsigned int
+	app->configuration.maxComputeWorkGroupCount[0] = UINT32_MAX;
+	app->configuration.maxComputeWorkGroupCount[1] = UINT32_MAX;
+	app->configuration.maxComputeWorkGroupCount[2] = UINT32_MAX;
+	app->configuration.sharedMemorySizeStatic = 65536;
+	app->configuration.sharedMemorySize = 65536;
+	app->configuration.warpSize = 32;
+	app->configuration.useRaderUintLUT = 1;
+	app->configuration.numCPUThreads = (inputLaunchConfiguration->numCPUThreads) ? inputLaunchConfiguration->numCPUThreads : VkFFT_GetNumCPUThreads();
+	app->configuration.cpuCompilerCommand = inputLaunchConfiguration->cpuCompilerCommand;
+	app->configuration.cpuTemporaryDirectory = inputLaunchConfiguration->cpuTemporaryDirectory;
 #endif
+	return VKFFT_SUCCESS;
+}
+static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration)  {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+    //app->configuration = {};// inputLaunchConfiguration;
+	if (inputLaunchConfiguration.doublePrecision != 0)	app->configuration.doublePrecision = inputLaunchConfiguration.doublePrecision;
+	if (inputLaunchConfiguration.doublePrecisionFloatMemory != 0)	app->configuration.doublePrecisionFloatMemory = inputLaunchConfiguration.doublePrecisionFloatMemory;
+
+	if (inputLaunchConfiguration.quadDoubleDoublePrecision != 0)	app->configuration.quadDoubleDoublePrecision = inputLaunchConfiguration.quadDoubleDoublePrecision;
+	if (inputLaunchConfiguration.quadDoubleDoublePrecisionDoubleMemory != 0)	app->configuration.quadDoubleDoublePrecisionDoubleMemory = inputLaunchConfiguration.quadDoubleDoublePrecisionDoubleMemory;
+	
+	if (inputLaunchConfiguration.halfPrecision != 0)	app->configuration.halfPrecision = inputLaunchConfiguration.halfPrecision;
+	if (inputLaunchConfiguration.halfPrecisionMemoryOnly != 0)	app->configuration.halfPrecisionMemoryOnly = inputLaunchConfiguration.halfPrecisionMemoryOnly;
+	if (inputLaunchConfiguration.useCustomBluesteinPaddingPattern != 0) {
+		app->configuration.useCustomBluesteinPaddingPattern = inputLaunchConfiguration.useCustomBluesteinPaddingPattern;
+		app->configuration.primeSizes = inputLaunchConfiguration.primeSizes;
+		if (!app->configuration.primeSizes) return VKFFT_ERROR_EMPTY_useCustomBluesteinPaddingPattern_arrays;
+		app->configuration.paddedSizes = inputLaunchConfiguration.paddedSizes;
+		if (!app->configuration.paddedSizes) return VKFFT_ERROR_EMPTY_useCustomBluesteinPaddingPattern_arrays;
+	}
+	if (inputLaunchConfiguration.bluesteinPaddingFile != 0) app->configuration.bluesteinPaddingFile = inputLaunchConfiguration.bluesteinPaddingFile;
+	//set device parameters
+	if (inputLaunchConfiguration.dryRun) {
+		//no device - limits are provided by the device profile
+		app->configuration.dryRun = inputLaunchConfiguration.dryRun;
+#if((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2))
+		app->configuration.useRaderUintLUT = 0;
+#else
+		app->configuration.useRaderUintLUT = 1;
+#endif
+#if(VKFFT_BACKEND==1)
+		app->configuration.vendorID = 0x10DE;
+#elif(VKFFT_BACKEND==2)
+		app->configuration.vendorID = 0x1002;
+#elif(VKFFT_BACKEND==4)
+		app->configuration.vendorID = 0x8086;
+#elif(VKFFT_BACKEND==5)
+		app->configuration.vendorID = 0x1027f00;
+#endif
+#if(VKFFT_BACKEND==3)
+		for (int i = 0; i < 3; i++) app->configuration.maxComputeWorkGroupCount[i] = UINT64_MAX;
+#elif(VKFFT_BACKEND==5)
+		for (int i = 0; i < 3; i++) app->configuration.maxComputeWorkGroupCount[i] = -1;
+#elif(VKFFT_BACKEND==6)
+		for (int i = 0; i < 3; i++) app->configuration.maxComputeWorkGroupCount[i] = UINT32_MAX;
+#endif
+	}
+	else {
+		resFFT = setDeviceParametersVkFFT(app, &inputLaunchConfiguration);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	//vendor defaults and user profile
+	resFFT = VkFFT_InitializeDeviceProfile(app, &inputLaunchConfiguration);
+	if (resFFT != VKFFT_SUCCESS) {
+		deleteVkFFT(app);
+		return resFFT;
+	}
+	if (app->configuration.dryRun) {
+		//limits that can not be defaulted have to be in the user profile
+		if ((app->configuration.maxThreadsNum == 0) || (app->configuration.sharedMemorySize == 0)) {
+			deleteVkFFT(app);
+			return VKFFT_ERROR_INVALID_deviceProfile;
+		}
+		for (int i = 0; i < 3; i++) {
+			if ((app->configuration.maxComputeWorkGroupCount[i] == 0) || (app->configuration.maxComputeWorkGroupSize[i] == 0)) {
+				deleteVkFFT(app);
+				return VKFFT_ERROR_INVALID_deviceProfile;
+			}
+		}
+	}
 
 	resFFT = initializeBluesteinAutoPadding(app);
 	if (resFFT != VKFFT_SUCCESS) {
@@ -1092,6 +1163,16 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 		app->configuration.tempBufferSize[0] = 0;
 
 	}
+	if (inputLaunchConfiguration.workspace != 0) {
+		if (inputLaunchConfiguration.workspaceSize == 0) {
+			deleteVkFFT(app);
+			return VKFFT_ERROR_EMPTY_workspaceSize;
+		}
+		app->configuration.workspace = inputLaunchConfiguration.workspace;
+		app->configuration.workspaceSize = inputLaunchConfiguration.workspaceSize;
+		app->configuration.workspaceTempOffset = inputLaunchConfiguration.workspaceTempOffset;
+		app->configuration.workspaceBluesteinOffset = inputLaunchConfiguration.workspaceBluesteinOffset;
+	}
 
 	if (app->configuration.isInputFormatted) {
 		if (inputLaunchConfiguration.inputBufferNum == 0)	app->configuration.inputBufferNum = 1;
@@ -1173,6 +1254,11 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	if (inputLaunchConfiguration.outputBufferOffset != 0)	app->configuration.outputBufferOffset = inputLaunchConfiguration.outputBufferOffset;
 	if (inputLaunchConfiguration.kernelOffset != 0)	app->configuration.kernelOffset = inputLaunchConfiguration.kernelOffset;
 	if (inputLaunchConfiguration.specifyOffsetsAtLaunch != 0)	app->configuration.specifyOffsetsAtLaunch = inputLaunchConfiguration.specifyOffsetsAtLaunch;
+	if (inputLaunchConfiguration.specifyBatchesAtLaunch != 0)	app->configuration.specifyBatchesAtLaunch = inputLaunchConfiguration.specifyBatchesAtLaunch;
+	if ((app->configuration.specifyBatchesAtLaunch) && (app->configuration.performConvolution)) {
+		deleteVkFFT(app);
+		return VKFFT_ERROR_UNSUPPORTED_BATCHES_AT_LAUNCH;
+	}
 	//set optional parameters:
 	pfUINT checkBufferSizeFor64BitAddressing = 0;
 	for (pfUINT i = 0; i < app->configuration.bufferNum; i++) {
@@ -1226,9 +1312,9 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 #endif
 	if (inputLaunchConfiguration.maxThreadsNum != 0)	app->configuration.maxThreadsNum = inputLaunchConfiguration.maxThreadsNum;
 	if (inputLaunchConfiguration.coalescedMemory != 0)	app->configuration.coalescedMemory = inputLaunchConfiguration.coalescedMemory;
-	app->configuration.aimThreads = 128;
+	app->configuration.aimThreads = app->deviceProfile.aimThreads;
 	if (inputLaunchConfiguration.aimThreads != 0)	app->configuration.aimThreads = inputLaunchConfiguration.aimThreads;
-	app->configuration.numSharedBanks = 32;
+	app->configuration.numSharedBanks = app->deviceProfile.numSharedBanks;
 	if (inputLaunchConfiguration.numSharedBanks != 0)	app->configuration.numSharedBanks = inputLaunchConfiguration.numSharedBanks;
 	if (inputLaunchConfiguration.inverseReturnToInputBuffer != 0)	app->configuration.inverseReturnToInputBuffer = inputLaunchConfiguration.inverseReturnToInputBuffer;
 
@@ -1254,40 +1340,12 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	if (inputLaunchConfiguration.fixMaxRadixBluestein != 0) app->configuration.fixMaxRadixBluestein = inputLaunchConfiguration.fixMaxRadixBluestein;
 	if (inputLaunchConfiguration.forceBluesteinSequenceSize != 0) app->configuration.forceBluesteinSequenceSize = inputLaunchConfiguration.forceBluesteinSequenceSize;
 
-	if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory){
-			app->configuration.fixMinRaderPrimeMult = 11;
-			app->configuration.fixMaxRaderPrimeMult = 29;
-	} else{
-			app->configuration.fixMinRaderPrimeMult = 17;
-			switch (app->configuration.vendorID) {
-			case 0x10DE://NVIDIA
-					app->configuration.fixMaxRaderPrimeMult = 89;
-					break;
-			case 0x1002://AMD profile
-					app->configuration.fixMaxRaderPrimeMult = 89;
-					break;
-			default:
-					app->configuration.fixMaxRaderPrimeMult = 17;
-					break;
-			}
-			if (inputLaunchConfiguration.fixMinRaderPrimeMult != 0) app->configuration.fixMinRaderPrimeMult = inputLaunchConfiguration.fixMinRaderPrimeMult;
-	}
+	app->configuration.fixMinRaderPrimeMult = app->deviceProfile.fixMinRaderPrimeMult;
+	if ((!app->configuration.quadDoubleDoublePrecision) && (!app->configuration.quadDoubleDoublePrecisionDoubleMemory) && (inputLaunchConfiguration.fixMinRaderPrimeMult != 0)) app->configuration.fixMinRaderPrimeMult = inputLaunchConfiguration.fixMinRaderPrimeMult;
+	app->configuration.fixMaxRaderPrimeMult = app->deviceProfile.fixMaxRaderPrimeMult;
 	if (inputLaunchConfiguration.fixMaxRaderPrimeMult != 0) app->configuration.fixMaxRaderPrimeMult = inputLaunchConfiguration.fixMaxRaderPrimeMult;
-
-	switch (app->configuration.vendorID) {
-	case 0x1002://AMD profile
-			if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory)
-					app->configuration.fixMinRaderPrimeFFT = 19;
-			else if (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory)
-					app->configuration.fixMinRaderPrimeFFT = 29;
-			else
-					app->configuration.fixMinRaderPrimeFFT = 17;
-			break;
-	default:
-			app->configuration.fixMinRaderPrimeFFT = 17;
-			break;
-	}
-	app->configuration.fixMaxRaderPrimeFFT = 16384;
+	app->configuration.fixMinRaderPrimeFFT = app->deviceProfile.fixMinRaderPrimeFFT;
+	app->configuration.fixMaxRaderPrimeFFT = app->deviceProfile.fixMaxRaderPrimeFFT;
 	if (inputLaunchConfiguration.fixMinRaderPrimeFFT != 0) app->configuration.fixMinRaderPrimeFFT = inputLaunchConfiguration.fixMinRaderPrimeFFT;
 	if (inputLaunchConfiguration.fixMaxRaderPrimeFFT != 0) app->configuration.fixMaxRaderPrimeFFT = inputLaunchConfiguration.fixMaxRaderPrimeFFT;
 	if (inputLaunchConfiguration.performR2C != 0) {
@@ -1347,6 +1405,15 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	app->configuration.numberBatches = 1;
 	if (inputLaunchConfiguration.coordinateFeatures != 0)	app->configuration.coordinateFeatures = inputLaunchConfiguration.coordinateFeatures;
 	if (inputLaunchConfiguration.numberBatches != 0)	app->configuration.numberBatches = inputLaunchConfiguration.numberBatches;
+	if (app->configuration.specifyBatchesAtLaunch) {
+		//kernels are planned for the largest launch, batch strides of the launch are scaled relative to these
+		app->maxNumberBatches = app->configuration.numberBatches;
+		app->initBatchStride[0] = 1;
+		app->initBatchStride[1] = app->configuration.bufferStride[app->configuration.FFTdim - 1] * app->configuration.coordinateFeatures;
+		app->initBatchStride[2] = app->configuration.inputBufferStride[app->configuration.FFTdim - 1] * app->configuration.coordinateFeatures;
+		app->initBatchStride[3] = app->configuration.outputBufferStride[app->configuration.FFTdim - 1] * app->configuration.coordinateFeatures;
+		memcpy(app->batchStride, app->initBatchStride, sizeof(app->batchStride));
+	}
 
 	app->configuration.matrixConvolution = 1;
 	app->configuration.numberKernels = 1;
@@ -1439,9 +1506,28 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	if (inputLaunchConfiguration.considerAllAxesStrided != 0)	app->configuration.considerAllAxesStrided = inputLaunchConfiguration.considerAllAxesStrided;
 #if(VKFFT_BACKEND!=5)
 	if (inputLaunchConfiguration.loadApplicationString != 0)	app->configuration.loadApplicationString = inputLaunchConfiguration.loadApplicationString;
+	if (inputLaunchConfiguration.loadApplicationStringSize != 0)	app->configuration.loadApplicationStringSize = inputLaunchConfiguration.loadApplicationStringSize;
 	if (inputLaunchConfiguration.saveApplicationToString != 0)	app->configuration.saveApplicationToString = inputLaunchConfiguration.saveApplicationToString;
+	if (inputLaunchConfiguration.kernelCacheDirectory != 0)	app->configuration.kernelCacheDirectory = inputLaunchConfiguration.kernelCacheDirectory;
+	if (inputLaunchConfiguration.kernelCacheMaxSize != 0)	app->configuration.kernelCacheMaxSize = inputLaunchConfiguration.kernelCacheMaxSize;
+	if (inputLaunchConfiguration.numCompileThreads != 0)	app->configuration.numCompileThreads = inputLaunchConfiguration.numCompileThreads;
+	if (inputLaunchConfiguration.compileTaskExecutor != 0)	app->configuration.compileTaskExecutor = inputLaunchConfiguration.compileTaskExecutor;
+	if (inputLaunchConfiguration.compileTaskExecutorData != 0)	app->configuration.compileTaskExecutorData = inputLaunchConfiguration.compileTaskExecutorData;
+	if (inputLaunchConfiguration.usePlanCache != 0)	app->configuration.usePlanCache = inputLaunchConfiguration.usePlanCache;
+	if (inputLaunchConfiguration.planCacheMaxSize != 0)	app->configuration.planCacheMaxSize = inputLaunchConfiguration.planCacheMaxSize;
 #endif
+	if (inputLaunchConfiguration.autotune != 0)	app->configuration.autotune = inputLaunchConfiguration.autotune;
+	if (inputLaunchConfiguration.wisdomFile != 0)	app->configuration.wisdomFile = inputLaunchConfiguration.wisdomFile;
 	if (inputLaunchConfiguration.disableSetLocale != 0)	app->configuration.disableSetLocale = inputLaunchConfiguration.disableSetLocale;
+	if (inputLaunchConfiguration.shareLUT != 0)	app->configuration.shareLUT = inputLaunchConfiguration.shareLUT;
+	if (inputLaunchConfiguration.generateLUTOnDevice != 0)	app->configuration.generateLUTOnDevice = inputLaunchConfiguration.generateLUTOnDevice;
+	if (inputLaunchConfiguration.disableDispatchList != 0)	app->configuration.disableDispatchList = inputLaunchConfiguration.disableDispatchList;
+	//dispatch grids depend on the number of batches of the launch
+	if (app->configuration.specifyBatchesAtLaunch) app->configuration.disableDispatchList = 1;
+	if (inputLaunchConfiguration.hostExecutionThreshold != 0)	app->configuration.hostExecutionThreshold = inputLaunchConfiguration.hostExecutionThreshold;
+	if (inputLaunchConfiguration.calibrateHostExecution != 0)	app->configuration.calibrateHostExecution = inputLaunchConfiguration.calibrateHostExecution;
+	if (inputLaunchConfiguration.profilePlanCreation != 0)	app->configuration.profilePlanCreation = inputLaunchConfiguration.profilePlanCreation;
+	if (inputLaunchConfiguration.profileDispatches != 0)	app->configuration.profileDispatches = inputLaunchConfiguration.profileDispatches;
 
 	if (inputLaunchConfiguration.loadApplicationFromString != 0) {
 		app->configuration.loadApplicationFromString = inputLaunchConfiguration.loadApplicationFromString;
@@ -1453,9 +1539,23 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 			deleteVkFFT(app);
 			return VKFFT_ERROR_EMPTY_applicationString;
 		}
-		memcpy(&app->applicationStringSize, app->configuration.loadApplicationString, sizeof(pfUINT));
-		memcpy(&app->applicationStringOffsetRader, (char*)app->configuration.loadApplicationString + 2 * sizeof(pfUINT), sizeof(pfUINT));
-		app->currentApplicationStringPos = 5 * sizeof(pfUINT);
+	}
+	//VkFFTGetWorkspaceSize plans with the limits of the device, but doesn't allocate or compile anything
+	if (app->workspaceQuery) app->configuration.dryRun = 1;
+	if (app->configuration.dryRun) {
+		//everything that needs a device or binaries
+		app->configuration.workspace = 0;
+		app->configuration.generateLUTOnDevice = 0;
+		app->configuration.shareLUT = 0;
+		app->configuration.usePlanCache = 0;
+		app->configuration.kernelCacheDirectory = 0;
+		app->configuration.saveApplicationToString = 0;
+		app->configuration.loadApplicationFromString = 0;
+		app->configuration.autotune = 0;
+		app->configuration.disableDispatchList = 0;
+		app->configuration.hostExecutionThreshold = 0;
+		app->configuration.calibrateHostExecution = 0;
+		app->configuration.profileDispatches = 0;
 	}
 	//temporary set:
 	app->configuration.registerBoost4Step = 1;
@@ -1463,27 +1563,70 @@ static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConf
 	app->configuration.useUint64 = 0; //No physical addressing mode in Vulkan shaders. Use multiple-buffer support to achieve emulation of physical addressing.
 #endif
 	//pfUINT initSharedMemory = app->configuration.sharedMemorySize;
+	if ((app->configuration.usePlanCache) && (!app->configuration.loadApplicationFromString) && (!app->configuration.saveApplicationToString)) {
+		app->configurationHash = VkFFT_GetConfigurationHash(app);
+		resFFT = VkFFT_AcquirePlanCacheEntry(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
+		}
+	}
+	if ((app->configuration.loadApplicationFromString) || (app->configuration.saveApplicationToString)) {
+		app->configurationHash = VkFFT_GetConfigurationHash(app);
+		if (app->configuration.loadApplicationFromString) {
+			resFFT = VkFFTCheckApplicationString(app);
+			if (resFFT != VKFFT_SUCCESS) {
+				deleteVkFFT(app);
+				return resFFT;
+			}
+		}
+	}
 	return resFFT;
 }
-static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration) {
-	
+static inline VkFFTResult VkFFT_InitializeApplication(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration) {
+	//app has to be zero-initialized, except for previousApplication
 	VkFFTResult resFFT = VKFFT_SUCCESS;
-    unsigned char *test = (unsigned char*)app;
-    if (app == 0){
-    	return VKFFT_ERROR_EMPTY_app;
-    }
-	if (memcmp(test, test + 1, sizeof(VkFFTApplication) - 1) != 0){
-		return VKFFT_ERROR_NONZERO_APP_INITIALIZATION;
+	if (inputLaunchConfiguration.profilePlanCreation) {
+		app->planProfile = (VkFFTPlanProfile*)calloc(1, sizeof(VkFFTPlanProfile));
+		if (!app->planProfile) return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	double initStart = VkFFT_ProfileStart(app);
+	double phaseStart = initStart;
+	//VkFFTGetWorkspaceSize doesn't time candidate plans, it only applies parameters already stored in wisdomFile
+	if (app->workspaceQuery) inputLaunchConfiguration.autotune = 0;
+	if (((inputLaunchConfiguration.autotune) || (inputLaunchConfiguration.wisdomFile)) && (!inputLaunchConfiguration.dryRun)) {
+		//fills kernel shape parameters from the wisdom file or by timing candidate plans
+		resFFT = VkFFT_TuneConfiguration(&inputLaunchConfiguration);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
+		}
+		VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_TUNING, phaseStart);
 	}
+	phaseStart = VkFFT_ProfileStart(app);
 	resFFT = setConfigurationVkFFT(app, inputLaunchConfiguration);
 	if (resFFT != VKFFT_SUCCESS) {
 		deleteVkFFT(app);
 		return resFFT;
 	}
+#if(VKFFT_BACKEND==6)
+	if (!app->configuration.dryRun) {
+		//started after the device profile has been applied, as workers allocate shared memory of the final size
+		resFFT = VkFFT_CreateCPUThreadPool(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
+		}
+	}
+#endif
+	VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_CONFIGURATION, phaseStart);
+	//LUT, Rader and Bluestein buffers are uploaded with a single submission
+	VkFFT_BeginUploadBatch(app);
 
 	if (!app->configuration.makeForwardPlanOnly) {
 		app->localFFTPlan_inverse = (VkFFTPlan*)calloc(1, sizeof(VkFFTPlan));
 		if (app->localFFTPlan_inverse) {
+			phaseStart = VkFFT_ProfileStart(app);
 			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
 				//app->configuration.sharedMemorySize = ((app->configuration.size[i] & (app->configuration.size[i] - 1)) == 0) ? app->configuration.sharedMemorySizePow2 : initSharedMemory;
 				resFFT = VkFFTScheduler(app, app->localFFTPlan_inverse, (int)i);
@@ -1508,6 +1651,7 @@ static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfigurat
 					}
 				}
 			}
+			VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_SCHEDULING, phaseStart);
 			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
 				//app->configuration.sharedMemorySize = ((app->configuration.size[i] & (app->configuration.size[i] - 1)) == 0) ? app->configuration.sharedMemorySizePow2 : initSharedMemory;
 				for (pfUINT j = 0; j < app->localFFTPlan_inverse->numAxisUploads[i]; j++) {
@@ -1543,6 +1687,7 @@ static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfigurat
 	if (!app->configuration.makeInversePlanOnly) {
 		app->localFFTPlan = (VkFFTPlan*)calloc(1, sizeof(VkFFTPlan));
 		if (app->localFFTPlan) {
+			phaseStart = VkFFT_ProfileStart(app);
 			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
 				//app->configuration.sharedMemorySize = ((app->configuration.size[i] & (app->configuration.size[i] - 1)) == 0) ? app->configuration.sharedMemorySizePow2 : initSharedMemory;
 				resFFT = VkFFTScheduler(app, app->localFFTPlan, (int)i);
@@ -1567,6 +1712,7 @@ static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfigurat
 					}
 				}
 			}
+			VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_SCHEDULING, phaseStart);
 			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
 				//app->configuration.sharedMemorySize = ((app->configuration.size[i] & (app->configuration.size[i] - 1)) == 0) ? app->configuration.sharedMemorySizePow2 : initSharedMemory;
 				for (pfUINT j = 0; j < app->localFFTPlan->numAxisUploads[i]; j++) {
@@ -1599,85 +1745,24 @@ static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfigurat
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 	}
+	phaseStart = VkFFT_ProfileStart(app);
+	resFFT = VkFFTRunCompileJobs(app);
+	if (resFFT != VKFFT_SUCCESS) {
+		deleteVkFFT(app);
+		return resFFT;
+	}
+	VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_COMPILE_JOBS, phaseStart);
 
-	if (app->configuration.allocateTempBuffer && (app->configuration.tempBuffer == 0)) {
-#if(VKFFT_BACKEND==0)
-		VkResult res = VK_SUCCESS;
-#elif(VKFFT_BACKEND==1)
-		cudaError_t res = cudaSuccess;
-#elif(VKFFT_BACKEND==2)
-		hipError_t res = hipSuccess;
-#elif(VKFFT_BACKEND==3)
-		cl_int res = CL_SUCCESS;
-#elif(VKFFT_BACKEND==4)
-		ze_result_t res = ZE_RESULT_SUCCESS;
-#elif(VKFFT_BACKEND==5)
-#endif
-#if(VKFFT_BACKEND==0)
-		app->configuration.tempBuffer = (VkBuffer*)malloc(sizeof(VkBuffer));
-		if (!app->configuration.tempBuffer) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		resFFT = allocateBufferVulkan(app, app->configuration.tempBuffer, &app->configuration.tempBufferDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, app->configuration.tempBufferSize[0]);
+	if (app->configuration.allocateTempBuffer && (app->configuration.tempBuffer == 0) && (!app->configuration.dryRun)) {
+		phaseStart = VkFFT_ProfileStart(app);
+		if (app->configuration.workspace)
+			resFFT = VkFFT_AllocateWorkspaceTempBuffer(app);
+		else
+			resFFT = VkFFT_AllocateTempBuffer(app);
 		if (resFFT != VKFFT_SUCCESS) {
 			deleteVkFFT(app);
 			return resFFT;
 		}
-#elif(VKFFT_BACKEND==1)
-		app->configuration.tempBuffer = (void**)malloc(sizeof(void*));
-		if (!app->configuration.tempBuffer) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		res = cudaMalloc(app->configuration.tempBuffer, app->configuration.tempBufferSize[0]);
-		if (res != cudaSuccess) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-		}
-#elif(VKFFT_BACKEND==2)
-		app->configuration.tempBuffer = (void**)malloc(sizeof(void*));
-		if (!app->configuration.tempBuffer) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		res = hipMalloc(app->configuration.tempBuffer, app->configuration.tempBufferSize[0]);
-		if (res != hipSuccess) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-		}
-#elif(VKFFT_BACKEND==3)
-		app->configuration.tempBuffer = (cl_mem*)malloc(sizeof(cl_mem));
-		if (!app->configuration.tempBuffer) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		app->configuration.tempBuffer[0] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, app->configuration.tempBufferSize[0], 0, &res);
-		if (res != CL_SUCCESS) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-		}
-#elif(VKFFT_BACKEND==4)
-		app->configuration.tempBuffer = (void**)malloc(sizeof(void*));
-		if (!app->configuration.tempBuffer) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
-		device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-		res = zeMemAllocDevice(app->configuration.context[0], &device_desc, app->configuration.tempBufferSize[0], sizeof(float), app->configuration.device[0], app->configuration.tempBuffer);
-		if (res != ZE_RESULT_SUCCESS) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-		}
-#elif(VKFFT_BACKEND==5)
-		app->configuration.tempBuffer = (MTL::Buffer**)malloc(sizeof(MTL::Buffer*));
-		if (!app->configuration.tempBuffer) {
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		app->configuration.tempBuffer[0] = app->configuration.device->newBuffer(app->configuration.tempBufferSize[0], MTL::ResourceStorageModePrivate);
-#endif
 
 		if (!app->configuration.makeInversePlanOnly) {
 			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
@@ -1709,7 +1794,10 @@ static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfigurat
 				app->localFFTPlan_inverse->R2Cdecomposition.specializationConstants.performBufferSetUpdate = 1;
 			}
 		}
+		VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_TEMP_BUFFER, phaseStart);
+		if (app->planProfile) app->planProfile->phases[VKFFT_PLAN_PROFILE_TEMP_BUFFER].allocatedSize = app->configuration.tempBufferSize[0];
 	}
+	phaseStart = VkFFT_ProfileStart(app);
 	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
 		if (app->useBluesteinFFT[i]) {
 			if (!app->configuration.makeInversePlanOnly)
@@ -1722,133 +1810,157 @@ static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfigurat
 			}
 		}
 	}
-
-	if (inputLaunchConfiguration.saveApplicationToString != 0) {
-		pfUINT totalBinarySize = 5 * sizeof(pfUINT);
-		if (!app->configuration.makeForwardPlanOnly) {
-			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-				for (pfUINT j = 0; j < app->localFFTPlan_inverse->numAxisUploads[i]; j++) {
-					totalBinarySize += app->localFFTPlan_inverse->axes[i][j].binarySize + sizeof(pfUINT);
-				}
-				if (app->useBluesteinFFT[i] && (app->localFFTPlan_inverse->numAxisUploads[i] > 1)) {
-					for (pfUINT j = 1; j < app->localFFTPlan_inverse->numAxisUploads[i]; j++) {
-						totalBinarySize += app->localFFTPlan_inverse->inverseBluesteinAxes[i][j].binarySize + sizeof(pfUINT);
-					}
-				}
-				if ((app->localFFTPlan_inverse->bigSequenceEvenR2C) && (i == 0)) {
-					totalBinarySize += app->localFFTPlan_inverse->R2Cdecomposition.binarySize + sizeof(pfUINT);
-				}
-			}
-		}
-		if (!app->configuration.makeInversePlanOnly) {
-			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-				for (pfUINT j = 0; j < app->localFFTPlan->numAxisUploads[i]; j++) {
-					totalBinarySize += app->localFFTPlan->axes[i][j].binarySize + sizeof(pfUINT);
-				}
-				if (app->useBluesteinFFT[i] && (app->localFFTPlan->numAxisUploads[i] > 1)) {
-					for (pfUINT j = 1; j < app->localFFTPlan->numAxisUploads[i]; j++) {
-						totalBinarySize += app->localFFTPlan->inverseBluesteinAxes[i][j].binarySize + sizeof(pfUINT);
-					}
-				}
-				if ((app->localFFTPlan->bigSequenceEvenR2C) && (i == 0)) {
-					totalBinarySize += app->localFFTPlan->R2Cdecomposition.binarySize + sizeof(pfUINT);
-				}
-			}
-		}
-		for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-			if (app->useBluesteinFFT[i]) {
-				totalBinarySize += app->applicationBluesteinStringSize[i];
-			}
-		}
-		if (app->numRaderFFTPrimes > 0) {
-			app->applicationStringOffsetRader = totalBinarySize;
-			for (pfUINT i = 0; i < app->numRaderFFTPrimes; i++) {
-				totalBinarySize += app->rader_buffer_size[i];
-			}
-		}
-		app->saveApplicationString = calloc(totalBinarySize, 1);
-		if (!app->saveApplicationString) {
+	VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_BLUESTEIN, phaseStart);
+	phaseStart = VkFFT_ProfileStart(app);
+	resFFT = VkFFT_EndUploadBatch(app);
+	if (resFFT != VKFFT_SUCCESS) {
+		deleteVkFFT(app);
+		return resFFT;
+	}
+	VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_UPLOAD, phaseStart);
+	if (!app->configuration.disableDispatchList) {
+		phaseStart = VkFFT_ProfileStart(app);
+		resFFT = VkFFT_RecordDispatchLists(app);
+		if (resFFT != VKFFT_SUCCESS) {
 			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
-		}
-		app->applicationStringSize = totalBinarySize;
-		char* localApplicationStringCast = (char*)app->saveApplicationString;
-		memcpy(localApplicationStringCast, &totalBinarySize, sizeof(pfUINT));
-		memcpy(localApplicationStringCast + 2 * sizeof(pfUINT), &app->applicationStringOffsetRader, sizeof(pfUINT));
-		pfUINT currentPos = 5 * sizeof(pfUINT);
-		if (!app->configuration.makeForwardPlanOnly) {
-			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-				for (pfUINT j = 0; j < app->localFFTPlan_inverse->numAxisUploads[i]; j++) {
-					memcpy(localApplicationStringCast + currentPos, &app->localFFTPlan_inverse->axes[i][j].binarySize, sizeof(pfUINT));
-					currentPos += sizeof(pfUINT);
-					memcpy(localApplicationStringCast + currentPos, app->localFFTPlan_inverse->axes[i][j].binary, app->localFFTPlan_inverse->axes[i][j].binarySize);
-					currentPos += app->localFFTPlan_inverse->axes[i][j].binarySize;
-				}
-				if (app->useBluesteinFFT[i] && (app->localFFTPlan_inverse->numAxisUploads[i] > 1)) {
-					for (pfUINT j = 1; j < app->localFFTPlan_inverse->numAxisUploads[i]; j++) {
-						memcpy(localApplicationStringCast + currentPos, &app->localFFTPlan_inverse->inverseBluesteinAxes[i][j].binarySize, sizeof(pfUINT));
-						currentPos += sizeof(pfUINT);
-						memcpy(localApplicationStringCast + currentPos, app->localFFTPlan_inverse->inverseBluesteinAxes[i][j].binary, app->localFFTPlan_inverse->inverseBluesteinAxes[i][j].binarySize);
-						currentPos += app->localFFTPlan_inverse->inverseBluesteinAxes[i][j].binarySize;
-					}
-				}
-				if ((app->localFFTPlan_inverse->bigSequenceEvenR2C) && (i == 0)) {
-					memcpy(localApplicationStringCast + currentPos, &app->localFFTPlan_inverse->R2Cdecomposition.binarySize, sizeof(pfUINT));
-					currentPos += sizeof(pfUINT);
-					memcpy(localApplicationStringCast + currentPos, app->localFFTPlan_inverse->R2Cdecomposition.binary, app->localFFTPlan_inverse->R2Cdecomposition.binarySize);
-					currentPos += app->localFFTPlan_inverse->R2Cdecomposition.binarySize;
-				}
-			}
+			return resFFT;
 		}
-		if (!app->configuration.makeInversePlanOnly) {
-			for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-				for (pfUINT j = 0; j < app->localFFTPlan->numAxisUploads[i]; j++) {
-					memcpy(localApplicationStringCast + currentPos, &app->localFFTPlan->axes[i][j].binarySize, sizeof(pfUINT));
-					currentPos += sizeof(pfUINT);
-					memcpy(localApplicationStringCast + currentPos, app->localFFTPlan->axes[i][j].binary, app->localFFTPlan->axes[i][j].binarySize);
-					currentPos += app->localFFTPlan->axes[i][j].binarySize;
-				}
-				if (app->useBluesteinFFT[i] && (app->localFFTPlan->numAxisUploads[i] > 1)) {
-					for (pfUINT j = 1; j < app->localFFTPlan->numAxisUploads[i]; j++) {
-						memcpy(localApplicationStringCast + currentPos, &app->localFFTPlan->inverseBluesteinAxes[i][j].binarySize, sizeof(pfUINT));
-						currentPos += sizeof(pfUINT);
-						memcpy(localApplicationStringCast + currentPos, app->localFFTPlan->inverseBluesteinAxes[i][j].binary, app->localFFTPlan->inverseBluesteinAxes[i][j].binarySize);
-						currentPos += app->localFFTPlan->inverseBluesteinAxes[i][j].binarySize;
-					}
-				}
-				if ((app->localFFTPlan->bigSequenceEvenR2C) && (i == 0)) {
-					memcpy(localApplicationStringCast + currentPos, &app->localFFTPlan->R2Cdecomposition.binarySize, sizeof(pfUINT));
-					currentPos += sizeof(pfUINT);
-					memcpy(localApplicationStringCast + currentPos, app->localFFTPlan->R2Cdecomposition.binary, app->localFFTPlan->R2Cdecomposition.binarySize);
-					currentPos += app->localFFTPlan->R2Cdecomposition.binarySize;
-				}
-			}
+		VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_DISPATCH_LISTS, phaseStart);
+	}
+	if (((app->configuration.hostExecutionThreshold) || (app->configuration.calibrateHostExecution)) && (VkFFT_CheckHostFFTSupport(app))) {
+		phaseStart = VkFFT_ProfileStart(app);
+		if (app->configuration.calibrateHostExecution)
+			resFFT = VkFFT_CalibrateHostExecution(app);
+		else if (VkFFT_GetHostFFTPoints(app) <= app->configuration.hostExecutionThreshold)
+			resFFT = VkFFT_InitHostFFT(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
 		}
-		for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-			if (app->useBluesteinFFT[i]) {
-				memcpy(localApplicationStringCast + currentPos, app->applicationBluesteinString[i], app->applicationBluesteinStringSize[i]);
-				currentPos += app->applicationBluesteinStringSize[i];
-			}
+		VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_HOST_EXECUTION, phaseStart);
+	}
+	if (app->configuration.profileDispatches) {
+		resFFT = VkFFT_InitDispatchProfiler(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
 		}
-		if (app->numRaderFFTPrimes > 0) {
-			for (pfUINT i = 0; i < app->numRaderFFTPrimes; i++) {
-				memcpy(localApplicationStringCast + currentPos, app->raderFFTkernel[i], app->rader_buffer_size[i]);
-				currentPos += app->rader_buffer_size[i];
-			}
+	}
+	phaseStart = VkFFT_ProfileStart(app);
+
+	if (app->configuration.saveApplicationToString != 0) {
+		resFFT = VkFFTSaveApplicationString(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
 		}
-		for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
-			if (app->applicationBluesteinString[i] != 0) {
-				free(app->applicationBluesteinString[i]);
-				app->applicationBluesteinString[i] = 0;
-			}
+	}
+	if (app->configuration.usePlanCache) {
+		VkFFT_ReleasePlanCacheEntry(app);
+		resFFT = VkFFT_StorePlanCacheEntry(app);
+		if (resFFT != VKFFT_SUCCESS) {
+			deleteVkFFT(app);
+			return resFFT;
 		}
 	}
+	VkFFT_ProfilePhase(app, VKFFT_PLAN_PROFILE_SAVE, phaseStart);
 #if(VKFFT_BACKEND==0)
 	if (app->configuration.isCompilerInitialized) {
 		glslang_finalize_process();
 		app->configuration.isCompilerInitialized = 0;
 	}
 #endif
+	VkFFT_FinalizePlanProfile(app, initStart);
+	return resFFT;
+}
+
+static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration) {
+	
+    unsigned char *test = (unsigned char*)app;
+    if (app == 0){
+    	return VKFFT_ERROR_EMPTY_app;
+    }
+	if (memcmp(test, test + 1, sizeof(VkFFTApplication) - 1) != 0){
+		return VKFFT_ERROR_NONZERO_APP_INITIALIZATION;
+	}
+	return VkFFT_InitializeApplication(app, inputLaunchConfiguration);
+}
+
+static inline VkFFTResult VkFFTUpdateConfiguration(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration) {
+	//replaces the plan of an application created by initializeVkFFT with a plan for inputLaunchConfiguration. The plan is created anew, but kernels
+	//whose generated code didn't change are taken from the previous plan instead of being compiled, and Bluestein buffers and LUTs are acquired
+	//through the shared buffer registry (shareLUT is enabled for the new plan; LUTs are only reused if the previous plan was also created with shareLUT).
+	//Execution contexts of app have to be deleted before the call. If the update fails, app is left unchanged and can still be used. Bluestein buffers
+	//in workspace are not shared: they are computed anew while the previous plan still exists, so its Bluestein region can't be reused by the new plan
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (app == 0) return VKFFT_ERROR_EMPTY_app;
+	if ((app->localFFTPlan == 0) && (app->localFFTPlan_inverse == 0)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+	VkFFTApplication* previousApp = (VkFFTApplication*)malloc(sizeof(VkFFTApplication));
+	if (!previousApp) return VKFFT_ERROR_MALLOC_FAILED;
+	memcpy(previousApp, app, sizeof(VkFFTApplication));
+	if (!previousApp->configuration.dryRun) {
+		resFFT = VkFFT_ShareApplicationBluestein(previousApp);
+		if (resFFT != VKFFT_SUCCESS) {
+			memcpy(app, previousApp, sizeof(VkFFTApplication));
+			free(previousApp);
+			return resFFT;
+		}
+	}
+	inputLaunchConfiguration.shareLUT = 1;
+	//the new plan is created in place, so pointers to app stored by the previous plan stay valid if it has to be restored
+	memset(app, 0, sizeof(VkFFTApplication));
+	if ((!previousApp->configuration.dryRun) && (!inputLaunchConfiguration.dryRun) && (VkFFT_CanReuseKernels(&inputLaunchConfiguration, &previousApp->configuration)))
+		app->previousApplication = previousApp;
+	resFFT = VkFFT_InitializeApplication(app, inputLaunchConfiguration);
+	VkFFT_FinishKernelReuse(app, previousApp, (resFFT == VKFFT_SUCCESS));
+	if (resFFT != VKFFT_SUCCESS) {
+		deleteVkFFT(app);
+		memcpy(app, previousApp, sizeof(VkFFTApplication));
+		free(previousApp);
+		return resFFT;
+	}
+	app->previousApplication = 0;
+	deleteVkFFT(previousApp);
+	free(previousApp);
+	return resFFT;
+}
+
+static inline void VkFFT_GetApplicationWorkspaceSize(VkFFTApplication* app, VkFFTWorkspaceSize* workspaceSize) {
+	//sizes of the buffers initializeVkFFT allocates for the plan of app. Bluestein buffers are laid out in workspace in the order of VkFFT_AllocateWorkspaceBluestein
+	memset(workspaceSize, 0, sizeof(VkFFTWorkspaceSize));
+	workspaceSize->alignment = VkFFT_GetWorkspaceAlignment(app);
+	if ((app->configuration.allocateTempBuffer) && (!app->configuration.userTempBuffer)) {
+		workspaceSize->tempBufferSize = app->configuration.tempBufferSize[0];
+		workspaceSize->workspaceTempSize = VkFFT_AlignWorkspaceSize(workspaceSize->tempBufferSize, workspaceSize->alignment);
+	}
+	VkFFTAxis* axes[2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1)];
+	pfUINT numAxes = VkFFT_GetApplicationAxes(app, axes);
+	for (pfUINT i = 0; i < numAxes; i++) {
+		if (!axes[i]->referenceLUT) workspaceSize->LUTSize += axes[i]->bufferLUTSize;
+	}
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		for (pfUINT j = 0; j < 4; j++)
+			workspaceSize->raderLUTSize += app->bufferRaderUintLUTSize[i][j];
+		if (!app->useBluesteinFFT[i]) continue;
+		pfUINT numBuffers = 1 + ((app->configuration.makeInversePlanOnly) ? 0 : 1) + ((app->configuration.makeForwardPlanOnly) ? 0 : 1);
+		workspaceSize->bluesteinSize += numBuffers * app->bufferBluesteinSize[i];
+		workspaceSize->workspaceBluesteinSize += numBuffers * VkFFT_AlignWorkspaceSize(app->bufferBluesteinSize[i], workspaceSize->alignment);
+	}
+	workspaceSize->totalSize = workspaceSize->tempBufferSize + workspaceSize->LUTSize + workspaceSize->raderLUTSize + workspaceSize->bluesteinSize;
+}
+
+static inline VkFFTResult VkFFTGetWorkspaceSize(VkFFTConfiguration inputLaunchConfiguration, VkFFTWorkspaceSize* workspaceSize) {
+	//plans inputLaunchConfiguration without allocating buffers or compiling kernels and returns the memory initializeVkFFT would need for it. Limits are
+	//queried from the device of the configuration, as in initializeVkFFT, or taken from the device profile in dryRun mode. Autotuning is skipped - tuned parameters are
+	//only taken from wisdomFile, so with autotune enabled the query matches initializeVkFFT once the configuration has been tuned and stored in wisdomFile
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTApplication* app = (VkFFTApplication*)calloc(1, sizeof(VkFFTApplication));
+	if (!app) return VKFFT_ERROR_MALLOC_FAILED;
+	app->workspaceQuery = 1;
+	resFFT = VkFFT_InitializeApplication(app, inputLaunchConfiguration);
+	if (resFFT == VKFFT_SUCCESS) VkFFT_GetApplicationWorkspaceSize(app, workspaceSize);
+	deleteVkFFT(app);
+	free(app);
 	return resFFT;
 }
 
@@ -24,12 +24,13 @@
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_DispatchPlan.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_UpdateBuffers.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_HostFFT.h"
 
 static inline VkFFTResult VkFFTSync(VkFFTApplication* app) {
 #if(VKFFT_BACKEND==0)
     vkCmdPipelineBarrier(app->configuration.commandBuffer[0], VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, app->configuration.memory_barrier, 0, 0, 0, 0);
 #elif(VKFFT_BACKEND==1)
-    if (app->configuration.num_streams > 1) {
+    if ((app->configuration.num_streams > 1) && (!app->graphCapture)) {
         cudaError_t res = cudaSuccess;
         for (pfUINT s = 0; s < app->configuration.num_streams; s++) {
             res = cudaEventSynchronize(app->configuration.stream_event[s]);
@@ -38,7 +39,7 @@ static inline VkFFTResult VkFFTSync(VkFFTApplication* app) {
         app->configuration.streamCounter = 0;
     }
 #elif(VKFFT_BACKEND==2)
-    if (app->configuration.num_streams > 1) {
+    if ((app->configuration.num_streams > 1) && (!app->graphCapture)) {
         hipError_t res = hipSuccess;
         for (pfUINT s = 0; s < app->configuration.num_streams; s++) {
             res = hipEventSynchronize(app->configuration.stream_event[s]);
@@ -52,9 +53,142 @@ static inline VkFFTResult VkFFTSync(VkFFTApplication* app) {
     res = zeCommandListAppendBarrier(app->configuration.commandList[0], nullptr, 0, nullptr);
     if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_SUBMIT_BARRIER;
 #elif(VKFFT_BACKEND==5)
+#elif(VKFFT_BACKEND==6)
 #endif
     return VKFFT_SUCCESS;
 }
+// Barriers between kernels. Vulkan and Level Zero kernels recorded one after another may overlap unless separated by a barrier. Instead of a global
+// barrier after every kernel, VkFFTAppend keeps the buffer ranges read and written since the last barrier and inserts one before a kernel only if
+// it reads or writes a range written since then, or writes a range read since then. The barrier is scoped to the written ranges. Other backends
+// launch kernels in order and keep calling VkFFTSync between them.
+static inline pfUINT VkFFT_GetAxisSyncRanges(VkFFTAxis* axis, pfUINT binding, VkFFTSyncRange* ranges) {
+    //ranges accessed through the input (binding 0, read) or output (binding 1, written) buffers. Other bindings hold LUTs, Bluestein and convolution kernels that are not written at launch
+    pfUINT numRanges = (pfUINT)axis->specializationConstants.numBuffersBound[binding];
+    if (numRanges > VKFFT_MAX_SYNC_RANGES) return numRanges;
+#if(VKFFT_BACKEND==0)
+    pfUINT firstDescriptor = (binding) ? (pfUINT)axis->specializationConstants.numBuffersBound[0] : 0;
+    for (pfUINT i = 0; i < numRanges; i++) {
+        ranges[i].buffer = axis->descriptorBufferInfo[firstDescriptor + i].buffer;
+        ranges[i].offset = (pfUINT)axis->descriptorBufferInfo[firstDescriptor + i].offset;
+        ranges[i].size = (pfUINT)axis->descriptorBufferInfo[firstDescriptor + i].range;
+    }
+#elif(VKFFT_BACKEND==4)
+    //kernels get the first buffer, the other blocks follow it in memory
+    void** buffer = (binding) ? axis->outputBuffer : axis->inputBuffer;
+    pfUINT blockSize = (binding) ? axis->specializationConstants.outputBufferBlockSize : axis->specializationConstants.inputBufferBlockSize;
+    numRanges = 1;
+    ranges[0].offset = (pfUINT)buffer[0];
+    ranges[0].size = (axis->specializationConstants.numBuffersBound[binding] == 1) ? blockSize : (pfUINT)-1;
+#endif
+    return numRanges;
+}
+static inline pfUINT VkFFT_SyncRangesOverlap(VkFFTSyncRange* a, VkFFTSyncRange* b) {
+#if(VKFFT_BACKEND==0)
+    if (a->buffer != b->buffer) return 0;
+#endif
+    pfUINT endA = (a->size > ((pfUINT)-1) - a->offset) ? (pfUINT)-1 : a->offset + a->size;
+    pfUINT endB = (b->size > ((pfUINT)-1) - b->offset) ? (pfUINT)-1 : b->offset + b->size;
+    return ((a->offset < endB) && (b->offset < endA)) ? 1 : 0;
+}
+static inline pfUINT VkFFT_SyncRangesConflict(VkFFTSyncRange* ranges, pfUINT numRanges, VkFFTSyncRange* pendingRanges, pfUINT numPendingRanges) {
+    for (pfUINT i = 0; i < numRanges; i++) {
+        for (pfUINT j = 0; j < numPendingRanges; j++) {
+            if (VkFFT_SyncRangesOverlap(&ranges[i], &pendingRanges[j])) return 1;
+        }
+    }
+    return 0;
+}
+static inline VkFFTResult VkFFT_SubmitSyncBarrier(VkFFTApplication* app) {
+    //makes writes of all kernels recorded since the last barrier visible to the following ones
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    VkFFTSyncState* state = &app->syncState;
+#if(VKFFT_BACKEND==0)
+    if (state->untracked) {
+        resFFT = VkFFTSync(app);
+    }
+    else {
+        //no writes - only the execution dependency is needed
+        VkBufferMemoryBarrier bufferBarriers[VKFFT_MAX_SYNC_RANGES];
+        for (pfUINT i = 0; i < state->numWrites; i++) {
+            VkBufferMemoryBarrier bufferBarrier = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+            bufferBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            bufferBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+            bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            bufferBarrier.buffer = state->writes[i].buffer;
+            bufferBarrier.offset = (VkDeviceSize)state->writes[i].offset;
+            bufferBarrier.size = (VkDeviceSize)state->writes[i].size;
+            bufferBarriers[i] = bufferBarrier;
+        }
+        vkCmdPipelineBarrier(app->configuration.commandBuffer[0], VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, 0, (uint32_t)state->numWrites, bufferBarriers, 0, 0);
+    }
+#elif(VKFFT_BACKEND==4)
+    pfUINT rangesBarrier = ((!state->untracked) && (state->numWrites > 0)) ? 1 : 0;
+    for (pfUINT i = 0; i < state->numWrites; i++) {
+        if (state->writes[i].size == (pfUINT)-1) rangesBarrier = 0;
+    }
+    if (rangesBarrier) {
+        size_t rangeSizes[VKFFT_MAX_SYNC_RANGES];
+        const void* ranges[VKFFT_MAX_SYNC_RANGES];
+        for (pfUINT i = 0; i < state->numWrites; i++) {
+            rangeSizes[i] = (size_t)state->writes[i].size;
+            ranges[i] = (const void*)state->writes[i].offset;
+        }
+        ze_result_t res = zeCommandListAppendMemoryRangesBarrier(app->configuration.commandList[0], (uint32_t)state->numWrites, rangeSizes, ranges, nullptr, 0, nullptr);
+        if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_SUBMIT_BARRIER;
+    }
+    else {
+        resFFT = VkFFTSync(app);
+    }
+#else
+    resFFT = VkFFTSync(app);
+#endif
+    memset(state, 0, sizeof(VkFFTSyncState));
+    return resFFT;
+}
+static inline VkFFTResult VkFFT_SyncDependencies(VkFFTApplication* app, VkFFTAxis* axis) {
+    //called before a kernel is recorded, after its buffers are updated
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    VkFFTSyncState* state = &app->syncState;
+#if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==4))
+    VkFFTSyncRange reads[VKFFT_MAX_SYNC_RANGES];
+    VkFFTSyncRange writes[VKFFT_MAX_SYNC_RANGES];
+    pfUINT numReads = VkFFT_GetAxisSyncRanges(axis, 0, reads);
+    pfUINT numWrites = VkFFT_GetAxisSyncRanges(axis, 1, writes);
+    pfUINT untracked = ((numReads > VKFFT_MAX_SYNC_RANGES) || (numWrites > VKFFT_MAX_SYNC_RANGES)) ? 1 : 0;
+    if (state->numDispatches) {
+        pfUINT dependency = (state->untracked || untracked) ? 1 : 0;
+        if (!dependency) dependency = VkFFT_SyncRangesConflict(reads, numReads, state->writes, state->numWrites);
+        if (!dependency) dependency = VkFFT_SyncRangesConflict(writes, numWrites, state->writes, state->numWrites);
+        if (!dependency) dependency = VkFFT_SyncRangesConflict(writes, numWrites, state->reads, state->numReads);
+        if (dependency) {
+            resFFT = VkFFT_SubmitSyncBarrier(app);
+            if (resFFT != VKFFT_SUCCESS) return resFFT;
+        }
+    }
+    if (untracked || (state->numReads + numReads > VKFFT_MAX_SYNC_RANGES) || (state->numWrites + numWrites > VKFFT_MAX_SYNC_RANGES)) {
+        state->untracked = 1;
+    }
+    else {
+        memcpy(&state->reads[state->numReads], reads, numReads * sizeof(VkFFTSyncRange));
+        memcpy(&state->writes[state->numWrites], writes, numWrites * sizeof(VkFFTSyncRange));
+        state->numReads += numReads;
+        state->numWrites += numWrites;
+    }
+#else
+    if (state->numDispatches) {
+        resFFT = VkFFT_SubmitSyncBarrier(app);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+    }
+#endif
+    state->numDispatches++;
+    return resFFT;
+}
+static inline VkFFTResult VkFFT_FlushSync(VkFFTApplication* app) {
+    //results of VkFFTAppend are visible to the commands recorded after it
+    if (!app->syncState.numDispatches) return VKFFT_SUCCESS;
+    return VkFFT_SubmitSyncBarrier(app);
+}
 static inline void printDebugInformation(VkFFTApplication* app, VkFFTAxis* axis) {
     if (app->configuration.keepShaderCode) printf("%s\n", axis->specializationConstants.code0);
     if (app->configuration.printMemoryLayout) {
@@ -76,50 +210,140 @@ static inline void printDebugInformation(VkFFTApplication* app, VkFFTAxis* axis)
             printf("write: outputBuffer\n");
     }
 }
-static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTLaunchParams* launchParams) {
+static inline VkFFTResult VkFFT_AppendDispatch(VkFFTApplication* app, VkFFTDispatchList* dispatchList, VkFFTPlan* FFTPlan, VkFFTAxis* axis, pfUINT axis_id, pfUINT axis_upload_id, pfUINT inverse, pfUINT isR2Cdecomposition, pfUINT* dispatchBlock) {
+    //launches the kernel if dispatchList is 0, otherwise splits its grid and records it at the end of dispatchList
     VkFFTResult resFFT = VKFFT_SUCCESS;
+    if (!dispatchList) {
+        if (isR2Cdecomposition)
+            resFFT = VkFFTUpdateBufferSetR2CMultiUploadDecomposition(app, FFTPlan, axis, axis_id, axis_upload_id, inverse);
+        else
+            resFFT = VkFFTUpdateBufferSet(app, FFTPlan, axis, axis_id, axis_upload_id, inverse);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+        resFFT = VkFFT_SyncDependencies(app, axis);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
 #if(VKFFT_BACKEND==0)
-    app->configuration.commandBuffer = launchParams->commandBuffer;
-    VkMemoryBarrier memory_barrier = {
-            VK_STRUCTURE_TYPE_MEMORY_BARRIER,
-            0,
-            VK_ACCESS_SHADER_WRITE_BIT,
-            VK_ACCESS_SHADER_READ_BIT,
-    };
-    app->configuration.memory_barrier = &memory_barrier;
-#elif(VKFFT_BACKEND==1)
-    app->configuration.streamCounter = 0;
-#elif(VKFFT_BACKEND==2)
-    app->configuration.streamCounter = 0;
-#elif(VKFFT_BACKEND==3)
-    app->configuration.commandQueue = launchParams->commandQueue;
-#elif(VKFFT_BACKEND==4)
-    app->configuration.commandList = launchParams->commandList;
-#elif(VKFFT_BACKEND==5)
-    app->configuration.commandBuffer = launchParams->commandBuffer;
-    app->configuration.commandEncoder = launchParams->commandEncoder;
+        vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
+        VkFFT_BindDescriptors(app, axis);
 #endif
-    if ((inverse != 1) && (app->configuration.makeInversePlanOnly)) return VKFFT_ERROR_ONLY_INVERSE_FFT_INITIALIZED;
-    if ((inverse == 1) && (app->configuration.makeForwardPlanOnly)) return VKFFT_ERROR_ONLY_FORWARD_FFT_INITIALIZED;
-    if ((inverse != 1) && (!app->configuration.makeInversePlanOnly) && (!app->localFFTPlan)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
-    if ((inverse == 1) && (!app->configuration.makeForwardPlanOnly) && (!app->localFFTPlan_inverse)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
-    
-    resFFT = VkFFTCheckUpdateBufferSet(app, 0, 0, launchParams);
-    if (resFFT != VKFFT_SUCCESS) {
+        if (app->dispatchProfiler) {
+            pfUINT splitBlock[3] = { dispatchBlock[0], dispatchBlock[1], dispatchBlock[2] };
+            pfUINT blockNumber[3];
+            pfUINT blockSize[3];
+            pfUINT lastBlockSize[3];
+            VkFFT_SplitDispatch(app, axis, splitBlock, blockNumber, blockSize, lastBlockSize);
+            resFFT = VkFFT_BeginDispatchRecord(app, FFTPlan, axis, axis_id, axis_upload_id, inverse, isR2Cdecomposition, dispatchBlock, blockNumber[0] * blockNumber[1] * blockNumber[2]);
+            if (resFFT != VKFFT_SUCCESS) return resFFT;
+        }
+        resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+        resFFT = VkFFT_EndDispatchRecord(app);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+        printDebugInformation(app, axis);
         return resFFT;
     }
+    pfUINT splitBlock[3] = { dispatchBlock[0], dispatchBlock[1], dispatchBlock[2] };
+    pfUINT blockNumber[3];
+    pfUINT blockSize[3];
+    pfUINT lastBlockSize[3];
+    VkFFT_SplitDispatch(app, axis, splitBlock, blockNumber, blockSize, lastBlockSize);
+    pfUINT numBlocks = blockNumber[0] * blockNumber[1] * blockNumber[2];
+    if (dispatchList->numEntries == dispatchList->allocatedEntries) {
+        pfUINT allocatedEntries = (dispatchList->allocatedEntries) ? 2 * dispatchList->allocatedEntries : 16;
+        VkFFTDispatchListEntry* entries = (VkFFTDispatchListEntry*)realloc(dispatchList->entries, allocatedEntries * sizeof(VkFFTDispatchListEntry));
+        if (!entries) return VKFFT_ERROR_MALLOC_FAILED;
+        dispatchList->entries = entries;
+        dispatchList->allocatedEntries = allocatedEntries;
+    }
+    if (dispatchList->numBlocks + numBlocks > dispatchList->allocatedBlocks) {
+        pfUINT allocatedBlocks = (dispatchList->allocatedBlocks) ? 2 * dispatchList->allocatedBlocks : 16;
+        while (allocatedBlocks < dispatchList->numBlocks + numBlocks) allocatedBlocks *= 2;
+        VkFFTDispatchBlock* blocks = (VkFFTDispatchBlock*)realloc(dispatchList->blocks, allocatedBlocks * sizeof(VkFFTDispatchBlock));
+        if (!blocks) return VKFFT_ERROR_MALLOC_FAILED;
+        dispatchList->blocks = blocks;
+        dispatchList->allocatedBlocks = allocatedBlocks;
+    }
+    VkFFTDispatchListEntry* entry = &dispatchList->entries[dispatchList->numEntries];
+    entry->FFTPlan = FFTPlan;
+    entry->axis = axis;
+    entry->axis_id = axis_id;
+    entry->axis_upload_id = axis_upload_id;
+    entry->inverse = inverse;
+    entry->isR2Cdecomposition = isR2Cdecomposition;
+    entry->dispatchBlock[0] = dispatchBlock[0];
+    entry->dispatchBlock[1] = dispatchBlock[1];
+    entry->dispatchBlock[2] = dispatchBlock[2];
+    entry->firstBlock = dispatchList->numBlocks;
+    entry->numBlocks = numBlocks;
+    dispatchList->numEntries++;
+    for (pfUINT i = 0; i < blockNumber[0]; i++) {
+        for (pfUINT j = 0; j < blockNumber[1]; j++) {
+            for (pfUINT k = 0; k < blockNumber[2]; k++) {
+                VkFFTDispatchBlock* block = &dispatchList->blocks[dispatchList->numBlocks];
+                block->workGroupShift[0] = i * blockSize[0];
+                block->workGroupShift[1] = j * blockSize[1];
+                block->workGroupShift[2] = k * blockSize[2];
+                block->dispatchSize[0] = (i == blockNumber[0] - 1) ? lastBlockSize[0] : blockSize[0];
+                block->dispatchSize[1] = (j == blockNumber[1] - 1) ? lastBlockSize[1] : blockSize[1];
+                block->dispatchSize[2] = (k == blockNumber[2] - 1) ? lastBlockSize[2] : blockSize[2];
+                memset(block->pushConstants, 0, sizeof(block->pushConstants));
+                //offsets specified at launch are packed during the replay
+                if (!app->configuration.specifyOffsetsAtLaunch)
+                    VkFFT_PackPushConstants(app, axis, block->workGroupShift, block->pushConstants);
+                dispatchList->numBlocks++;
+            }
+        }
+    }
+    return resFFT;
+}
+static inline VkFFTResult VkFFT_ReplayDispatchList(VkFFTApplication* app, VkFFTDispatchList* dispatchList) {
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    for (pfUINT e = 0; e < dispatchList->numEntries; e++) {
+        VkFFTDispatchListEntry* entry = &dispatchList->entries[e];
+        VkFFTAxis* axis = entry->axis;
+        if (entry->isR2Cdecomposition)
+            resFFT = VkFFTUpdateBufferSetR2CMultiUploadDecomposition(app, entry->FFTPlan, axis, entry->axis_id, entry->axis_upload_id, entry->inverse);
+        else
+            resFFT = VkFFTUpdateBufferSet(app, entry->FFTPlan, axis, entry->axis_id, entry->axis_upload_id, entry->inverse);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+        resFFT = VkFFT_SyncDependencies(app, axis);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+#if(VKFFT_BACKEND==0)
+        vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
+        VkFFT_BindDescriptors(app, axis);
+#endif
+        resFFT = VkFFT_BeginDispatchRecord(app, entry->FFTPlan, axis, entry->axis_id, entry->axis_upload_id, entry->inverse, entry->isR2Cdecomposition, entry->dispatchBlock, entry->numBlocks);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+        for (pfUINT b = entry->firstBlock; b < entry->firstBlock + entry->numBlocks; b++) {
+            VkFFTDispatchBlock* block = &dispatchList->blocks[b];
+            axis->pushConstants.workGroupShift[0] = block->workGroupShift[0];
+            axis->pushConstants.workGroupShift[1] = block->workGroupShift[1];
+            axis->pushConstants.workGroupShift[2] = block->workGroupShift[2];
+            if (app->configuration.specifyOffsetsAtLaunch) {
+                VkFFT_PackPushConstants(app, axis, block->workGroupShift, axis->pushConstants.data);
+                axis->updatePushConstants = 1;
+            }
+            else if ((axis->pushConstants.structSize > 0) && (memcmp(axis->pushConstants.data, block->pushConstants, axis->pushConstants.structSize) != 0)) {
+                memcpy(axis->pushConstants.data, block->pushConstants, axis->pushConstants.structSize);
+                axis->updatePushConstants = 1;
+            }
+            resFFT = VkFFT_LaunchDispatch(app, axis, block->dispatchSize);
+            if (resFFT != VKFFT_SUCCESS) return resFFT;
+        }
+        resFFT = VkFFT_EndDispatchRecord(app);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+        printDebugInformation(app, axis);
+    }
+    return resFFT;
+}
+static inline VkFFTResult VkFFT_AppendDispatches(VkFFTApplication* app, int inverse, VkFFTDispatchList* dispatchList) {
+    //walks all kernels of the transform in launch order. They are launched immediately if dispatchList is 0, otherwise recorded in dispatchList
+    VkFFTResult resFFT = VKFFT_SUCCESS;
     if (inverse != 1) {
         //FFT axis 0
         if (!app->configuration.omitDimension[0]) {
             for (pfINT l = (pfINT)app->localFFTPlan->numAxisUploads[0] - 1; l >= 0; l--) {
                 VkFFTAxis* axis = &app->localFFTPlan->axes[0][l];
-                resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan, axis, 0, l, 0);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
                 pfUINT maxCoordinate = ((app->configuration.matrixConvolution > 1) && (app->configuration.performConvolution) && (app->configuration.FFTdim == 1) && (l == 0)) ? 1 : app->configuration.coordinateFeatures;
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
                 if (l == 0) {
                     if (app->localFFTPlan->numAxisUploads[0] > 2) {
@@ -149,22 +373,13 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 if (axis->specializationConstants.mergeSequencesR2C == 1) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                 //if (app->configuration.performZeropadding[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                 //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
-                resFFT = VkFFTSync(app);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan, axis, 0, l, 0, 0, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
             }
             if (app->useBluesteinFFT[0] && (app->localFFTPlan->numAxisUploads[0] > 1)) {
                 for (pfINT l = 1; l < (pfINT)app->localFFTPlan->numAxisUploads[0]; l++) {
                     VkFFTAxis* axis = &app->localFFTPlan->inverseBluesteinAxes[0][l];
-                    resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan, axis, 0, l, 0);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
                     pfUINT maxCoordinate = ((app->configuration.matrixConvolution > 1) && (app->configuration.performConvolution) && (app->configuration.FFTdim == 1)) ? 1 : app->configuration.coordinateFeatures;
-#if(VKFFT_BACKEND==0)
-                    vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                    vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                     pfUINT dispatchBlock[3];
                     if (l == 0) {
                         if (app->localFFTPlan->numAxisUploads[0] > 2) {
@@ -195,23 +410,14 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                     if (axis->specializationConstants.mergeSequencesR2C == 1) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                     //if (app->configuration.performZeropadding[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                     //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                    resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-                    printDebugInformation(app, axis);
-                    resFFT = VkFFTSync(app);
+                    resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan, axis, 0, l, 0, 0, dispatchBlock);
                     if (resFFT != VKFFT_SUCCESS) return resFFT;
                 }
             }
             if (app->localFFTPlan->bigSequenceEvenR2C) {
                 VkFFTAxis* axis = &app->localFFTPlan->R2Cdecomposition;
-                resFFT = VkFFTUpdateBufferSetR2CMultiUploadDecomposition(app, app->localFFTPlan, axis, 0, 0, 0);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
                 pfUINT maxCoordinate = ((app->configuration.matrixConvolution > 1) && (app->configuration.performConvolution) && (app->configuration.FFTdim == 1)) ? 1 : app->configuration.coordinateFeatures;
                 
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
                 
                 dispatchBlock[0] = (app->configuration.size[0] / 2 + 1);
@@ -221,11 +427,8 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / (double)(2 * axis->axisBlock[0]));
                 
                 dispatchBlock[1] = 1;
-                dispatchBlock[2] = maxCoordinate * axis->specializationConstants.numBatches.data.i;
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
-                resFFT = VkFFTSync(app);
+                dispatchBlock[2] = maxCoordinate * ((app->configuration.specifyBatchesAtLaunch) ? app->configuration.numberBatches : axis->specializationConstants.numBatches.data.i);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan, axis, 0, 0, 0, 1, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
                 //app->configuration.size[0] *= 2;
             }
@@ -236,14 +439,8 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                     
                     for (pfINT l = (pfINT)app->localFFTPlan->numAxisUploads[i] - 1; l >= 0; l--) {
                         VkFFTAxis* axis = &app->localFFTPlan->axes[i][l];
-                        resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan, axis, i, l, 0);
-                        if (resFFT != VKFFT_SUCCESS) return resFFT;
                         pfUINT maxCoordinate = ((app->configuration.matrixConvolution > 1) && (l == 0)) ? 1 : app->configuration.coordinateFeatures;
                         
-#if(VKFFT_BACKEND==0)
-                        vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                        vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                         pfUINT dispatchBlock[3];
                         dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan->actualFFTSizePerAxis[i][0] / (double)axis->axisBlock[0] * app->localFFTPlan->actualFFTSizePerAxis[i][i] / (double)axis->specializationConstants.fftDim.data.i);
                         dispatchBlock[1] = 1;
@@ -254,10 +451,7 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                         }
                         //if (app->configuration.mergeSequencesR2C == 1) dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / 2.0);
                         //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                        resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                        if (resFFT != VKFFT_SUCCESS) return resFFT;
-                        printDebugInformation(app, axis);
-                        resFFT = VkFFTSync(app);
+                        resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan, axis, i, l, 0, 0, dispatchBlock);
                         if (resFFT != VKFFT_SUCCESS) return resFFT;
                     }
                 }
@@ -265,13 +459,6 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                     
                     for (pfINT l = (pfINT)app->localFFTPlan->numAxisUploads[i] - 1; l >= 0; l--) {
                         VkFFTAxis* axis = &app->localFFTPlan->axes[i][l];
-                        resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan, axis, i, l, 0);
-                        if (resFFT != VKFFT_SUCCESS) return resFFT;
-                        
-#if(VKFFT_BACKEND==0)
-                        vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                        vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                         pfUINT dispatchBlock[3];
                         
                         dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan->actualFFTSizePerAxis[i][0] / (double)axis->axisBlock[0] * app->localFFTPlan->actualFFTSizePerAxis[i][i] / (double)axis->specializationConstants.fftDim.data.i);
@@ -283,22 +470,12 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                         }
                         //if (app->configuration.mergeSequencesR2C == 1) dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / 2.0);
                         //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                        resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                        if (resFFT != VKFFT_SUCCESS) return resFFT;
-                        printDebugInformation(app, axis);
-                        
-                        resFFT = VkFFTSync(app);
+                        resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan, axis, i, l, 0, 0, dispatchBlock);
                         if (resFFT != VKFFT_SUCCESS) return resFFT;
                     }
                     if (app->useBluesteinFFT[i] && (app->localFFTPlan->numAxisUploads[i] > 1)) {
                         for (pfINT l = 1; l < (pfINT)app->localFFTPlan->numAxisUploads[i]; l++) {
                             VkFFTAxis* axis = &app->localFFTPlan->inverseBluesteinAxes[i][l];
-                            resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan, axis, i, l, 0);
-                            if (resFFT != VKFFT_SUCCESS) return resFFT;
-#if(VKFFT_BACKEND==0)
-                            vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                            vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                             pfUINT dispatchBlock[3];
                             dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan->actualFFTSizePerAxis[i][0] / (double)axis->axisBlock[0] * app->localFFTPlan->actualFFTSizePerAxis[i][i] / (double)axis->specializationConstants.fftDim.data.i);
                             dispatchBlock[1] = 1;
@@ -309,10 +486,7 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                             }
                             //if (app->configuration.performZeropadding[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                             //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                            resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                            if (resFFT != VKFFT_SUCCESS) return resFFT;
-                            printDebugInformation(app, axis);
-                            resFFT = VkFFTSync(app);
+                            resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan, axis, i, l, 0, 0, dispatchBlock);
                             if (resFFT != VKFFT_SUCCESS) return resFFT;
                         }
                     }
@@ -329,13 +503,6 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
 
                 for (pfINT l = (pfINT)1; l < (pfINT)app->localFFTPlan_inverse->numAxisUploads[i]; l++) {
                     VkFFTAxis* axis = &app->localFFTPlan_inverse->axes[i][l];
-                    resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, i, l, 1);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                    vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                    vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                     pfUINT dispatchBlock[3];
                     dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan_inverse->actualFFTSizePerAxis[i][0] / (double)axis->axisBlock[0] * app->localFFTPlan_inverse->actualFFTSizePerAxis[i][i] / (double)axis->specializationConstants.fftDim.data.i);
                     dispatchBlock[1] = 1;
@@ -345,23 +512,13 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                             dispatchBlock[2]*= app->localFFTPlan_inverse->actualFFTSizePerAxis[i][p];
                     }
                     //if (app->configuration.mergeSequencesR2C == 1) dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / 2.0);
-                    resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-                    printDebugInformation(app, axis);
-                    resFFT = VkFFTSync(app);
+                    resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, i, l, 1, 0, dispatchBlock);
                     if (resFFT != VKFFT_SUCCESS) return resFFT;
                 }
             }
             if ((app->localFFTPlan_inverse->bigSequenceEvenR2C)&&(i==1)) {
                 //app->configuration.size[0] /= 2;
                 VkFFTAxis* axis = &app->localFFTPlan_inverse->R2Cdecomposition;
-                resFFT = VkFFTUpdateBufferSetR2CMultiUploadDecomposition(app, app->localFFTPlan_inverse, axis, 0, 0, 1);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
 
                 dispatchBlock[0] = (app->configuration.size[0] / 2 + 1);
@@ -373,23 +530,12 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 
                 dispatchBlock[1] = 1;
                 dispatchBlock[2] = app->configuration.coordinateFeatures * app->configuration.numberKernels;
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
-
-                resFFT = VkFFTSync(app);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, 0, 0, 1, 1, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
             }
             
             for (pfINT l = 0; l < (pfINT)app->localFFTPlan_inverse->numAxisUploads[i-1]; l++) {
                 VkFFTAxis* axis = &app->localFFTPlan_inverse->axes[i-1][l];
-                resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, i-1, l, 1);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
                 if (i==1){
                     if (l == 0) {
@@ -428,10 +574,7 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 }
                 //if (app->configuration.mergeSequencesR2C == 1) dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / 2.0);
                 //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
-                resFFT = VkFFTSync(app);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, i-1, l, 1, 0, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
             }
 
@@ -440,13 +583,6 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
         if (app->configuration.FFTdim == 1) {
             for (pfINT l = (pfINT)1; l < (pfINT)app->localFFTPlan_inverse->numAxisUploads[0]; l++) {
                 VkFFTAxis* axis = &app->localFFTPlan_inverse->axes[0][l];
-                resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, 0, l, 1);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
                 dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan_inverse->actualFFTSizePerAxis[0][0] / (double)axis->axisBlock[0] * app->localFFTPlan_inverse->actualFFTSizePerAxis[0][1] / (double)axis->specializationConstants.fftDim.data.i);
                 dispatchBlock[1] = 1;
@@ -454,10 +590,7 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 
                 //if (app->configuration.mergeSequencesR2C == 1) dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / 2.0);
                 //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
-                resFFT = VkFFTSync(app);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, 0, l, 1, 0, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
             }
         }
@@ -471,13 +604,6 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 for (pfINT l = (pfINT)app->localFFTPlan_inverse->numAxisUploads[i] - 1; l >= 0; l--) {
                     //if ((!app->configuration.reorderFourStep) && (!app->useBluesteinFFT[2])) l = app->localFFTPlan_inverse->numAxisUploads[2] - 1 - l;
                     VkFFTAxis* axis = &app->localFFTPlan_inverse->axes[i][l];
-                    resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, i, l, 1);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                    vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                    vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                     pfUINT dispatchBlock[3];
                     dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan_inverse->actualFFTSizePerAxis[i][0]  / (double)axis->axisBlock[0] * app->localFFTPlan_inverse->actualFFTSizePerAxis[i][i] / (double)axis->specializationConstants.fftDim.data.i);
                     dispatchBlock[1] = 1;
@@ -490,22 +616,13 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                     //if (app->configuration.performZeropaddingInverse[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
 
                     //if (app->configuration.mergeSequencesR2C == 1) dispatchBlock[0] = (pfUINT)pfceil(dispatchBlock[0] / 2.0);
-                    resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-                    printDebugInformation(app, axis);
-                    resFFT = VkFFTSync(app);
+                    resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, i, l, 1, 0, dispatchBlock);
                     if (resFFT != VKFFT_SUCCESS) return resFFT;
                     //if ((!app->configuration.reorderFourStep) && (!app->useBluesteinFFT[2])) l = app->localFFTPlan_inverse->numAxisUploads[2] - 1 - l;
                 }
                 if (app->useBluesteinFFT[i] && (app->localFFTPlan_inverse->numAxisUploads[i] > 1)) {
                     for (pfINT l = 1; l < (pfINT)app->localFFTPlan_inverse->numAxisUploads[i]; l++) {
                         VkFFTAxis* axis = &app->localFFTPlan_inverse->inverseBluesteinAxes[i][l];
-                        resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, i, l, 1);
-                        if (resFFT != VKFFT_SUCCESS) return resFFT;
-#if(VKFFT_BACKEND==0)
-                        vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                        vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                         pfUINT dispatchBlock[3];
                         dispatchBlock[0] = (pfUINT)pfceil(app->localFFTPlan_inverse->actualFFTSizePerAxis[i][0]  / (double)axis->axisBlock[0] * app->localFFTPlan_inverse->actualFFTSizePerAxis[i][i] / (double)axis->specializationConstants.fftDim.data.i);
                         dispatchBlock[1] = 1;
@@ -516,10 +633,7 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                         }
                         //if (app->configuration.performZeropadding[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                         //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                        resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                        if (resFFT != VKFFT_SUCCESS) return resFFT;
-                        printDebugInformation(app, axis);
-                        resFFT = VkFFTSync(app);
+                        resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, i, l, 1, 0, dispatchBlock);
                         if (resFFT != VKFFT_SUCCESS) return resFFT;
                     }
                 }
@@ -529,13 +643,6 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
             if (app->localFFTPlan_inverse->bigSequenceEvenR2C) {
                 //app->configuration.size[0] /= 2;
                 VkFFTAxis* axis = &app->localFFTPlan_inverse->R2Cdecomposition;
-                resFFT = VkFFTUpdateBufferSetR2CMultiUploadDecomposition(app, app->localFFTPlan_inverse, axis, 0, 0, 1);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
 
                 dispatchBlock[0] = (app->configuration.size[0] / 2 + 1);
@@ -546,25 +653,15 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 
                 
                 dispatchBlock[1] = 1;
-                dispatchBlock[2] = app->configuration.coordinateFeatures * axis->specializationConstants.numBatches.data.i;
+                dispatchBlock[2] = app->configuration.coordinateFeatures * ((app->configuration.specifyBatchesAtLaunch) ? app->configuration.numberBatches : axis->specializationConstants.numBatches.data.i);
                 
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
-
-                resFFT = VkFFTSync(app);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, 0, 0, 1, 1, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
             }
             //FFT axis 0
             for (pfINT l = (pfINT)app->localFFTPlan_inverse->numAxisUploads[0] - 1; l >= 0; l--) {
                 //if ((!app->configuration.reorderFourStep) && (!app->useBluesteinFFT[0])) l = app->localFFTPlan_inverse->numAxisUploads[0] - 1 - l;
                 VkFFTAxis* axis = &app->localFFTPlan_inverse->axes[0][l];
-                resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, 0, l, 1);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
-#if(VKFFT_BACKEND==0)
-                vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                 pfUINT dispatchBlock[3];
                 if (l == 0) {
                     if (app->localFFTPlan_inverse->numAxisUploads[0] > 2) {
@@ -593,23 +690,13 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                 if (axis->specializationConstants.mergeSequencesR2C == 1) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                 //if (app->configuration.performZeropadding[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                 //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+                resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, 0, l, 1, 0, dispatchBlock);
                 if (resFFT != VKFFT_SUCCESS) return resFFT;
-                printDebugInformation(app, axis);
                 //if ((!app->configuration.reorderFourStep) && (!app->useBluesteinFFT[0])) l = app->localFFTPlan_inverse->numAxisUploads[0] - 1 - l;
-                resFFT = VkFFTSync(app);
-                if (resFFT != VKFFT_SUCCESS) return resFFT;
             }
             if (app->useBluesteinFFT[0] && (app->localFFTPlan_inverse->numAxisUploads[0] > 1)) {
                 for (pfINT l = 1; l < (pfINT)app->localFFTPlan_inverse->numAxisUploads[0]; l++) {
                     VkFFTAxis* axis = &app->localFFTPlan_inverse->inverseBluesteinAxes[0][l];
-                    resFFT = VkFFTUpdateBufferSet(app, app->localFFTPlan_inverse, axis, 0, l, 1);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-
-#if(VKFFT_BACKEND==0)
-                    vkCmdBindPipeline(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
-                    vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
-#endif
                     pfUINT dispatchBlock[3];
                     if (l == 0) {
                         if (app->localFFTPlan_inverse->numAxisUploads[0] > 2) {
@@ -638,10 +725,7 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
                     if (axis->specializationConstants.mergeSequencesR2C == 1) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                     //if (app->configuration.performZeropadding[1]) dispatchBlock[1] = (pfUINT)pfceil(dispatchBlock[1] / 2.0);
                     //if (app->configuration.performZeropadding[2]) dispatchBlock[2] = (pfUINT)pfceil(dispatchBlock[2] / 2.0);
-                    resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
-                    if (resFFT != VKFFT_SUCCESS) return resFFT;
-                    printDebugInformation(app, axis);
-                    resFFT = VkFFTSync(app);
+                    resFFT = VkFFT_AppendDispatch(app, dispatchList, app->localFFTPlan_inverse, axis, 0, l, 1, 0, dispatchBlock);
                     if (resFFT != VKFFT_SUCCESS) return resFFT;
                 }
             }
@@ -651,6 +735,296 @@ static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTL
     }
     return resFFT;
 }
-
+static inline VkFFTResult VkFFT_RecordDispatchLists(VkFFTApplication* app) {
+    //dispatch grids and push constants only depend on the configuration, so they are computed once and VkFFTAppend only replays them
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    if ((!app->configuration.makeInversePlanOnly) && (app->localFFTPlan) && ((!app->configuration.performConvolution) || (app->localFFTPlan_inverse))) {
+        app->dispatchList[0].entries = (VkFFTDispatchListEntry*)calloc(16, sizeof(VkFFTDispatchListEntry));
+        if (!app->dispatchList[0].entries) return VKFFT_ERROR_MALLOC_FAILED;
+        app->dispatchList[0].allocatedEntries = 16;
+        resFFT = VkFFT_AppendDispatches(app, -1, &app->dispatchList[0]);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+    }
+    if ((!app->configuration.makeForwardPlanOnly) && (app->localFFTPlan_inverse)) {
+        app->dispatchList[1].entries = (VkFFTDispatchListEntry*)calloc(16, sizeof(VkFFTDispatchListEntry));
+        if (!app->dispatchList[1].entries) return VKFFT_ERROR_MALLOC_FAILED;
+        app->dispatchList[1].allocatedEntries = 16;
+        resFFT = VkFFT_AppendDispatches(app, 1, &app->dispatchList[1]);
+        if (resFFT != VKFFT_SUCCESS) return resFFT;
+    }
+    return resFFT;
+}
+static inline VkFFTResult VkFFTAppend(VkFFTApplication* app, int inverse, VkFFTLaunchParams* launchParams) {
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    if (app->configuration.dryRun) return VKFFT_ERROR_ENABLED_dryRun;
+#if(VKFFT_BACKEND==0)
+    app->configuration.commandBuffer = launchParams->commandBuffer;
+    VkMemoryBarrier memory_barrier = {
+            VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            0,
+            VK_ACCESS_SHADER_WRITE_BIT,
+            VK_ACCESS_SHADER_READ_BIT,
+    };
+    app->configuration.memory_barrier = &memory_barrier;
+#elif(VKFFT_BACKEND==1)
+    app->configuration.streamCounter = 0;
+#elif(VKFFT_BACKEND==2)
+    app->configuration.streamCounter = 0;
+#elif(VKFFT_BACKEND==3)
+    app->configuration.commandQueue = launchParams->commandQueue;
+#elif(VKFFT_BACKEND==4)
+    app->configuration.commandList = launchParams->commandList;
+#elif(VKFFT_BACKEND==5)
+    app->configuration.commandBuffer = launchParams->commandBuffer;
+    app->configuration.commandEncoder = launchParams->commandEncoder;
+#endif
+    if ((inverse != 1) && (app->configuration.makeInversePlanOnly)) return VKFFT_ERROR_ONLY_INVERSE_FFT_INITIALIZED;
+    if ((inverse == 1) && (app->configuration.makeForwardPlanOnly)) return VKFFT_ERROR_ONLY_FORWARD_FFT_INITIALIZED;
+    if ((inverse != 1) && (!app->configuration.makeInversePlanOnly) && (!app->localFFTPlan)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+    if ((inverse == 1) && (!app->configuration.makeForwardPlanOnly) && (!app->localFFTPlan_inverse)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+    int hostExecution = ((app->hostFFT) && (launchParams) && (launchParams->hostBuffer)) ? 1 : 0;
+#if((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2))
+    //graphs replay device kernels only, so captured executions always use the device path
+    if (app->graphCapture) hostExecution = 0;
+#endif
+    if (hostExecution) {
+        //tiny transform, done on the calling thread to avoid launch and synchronization latency
+        pfUINT bufferOffset = (app->configuration.specifyOffsetsAtLaunch) ? launchParams->bufferOffset : app->configuration.bufferOffset;
+        return VkFFT_ExecuteHostFFT(app, inverse, (void*)((char*)launchParams->hostBuffer + bufferOffset));
+    }
+    
+    resFFT = VkFFTCheckUpdateBufferSet(app, 0, 0, launchParams);
+    if (resFFT != VKFFT_SUCCESS) {
+        return resFFT;
+    }
+    resFFT = VkFFT_BeginDispatchProfile(app);
+    if (resFFT != VKFFT_SUCCESS) return resFFT;
+    memset(&app->syncState, 0, sizeof(VkFFTSyncState));
+    VkFFTDispatchList* dispatchList = &app->dispatchList[(inverse == 1) ? 1 : 0];
+    if (dispatchList->entries)
+        resFFT = VkFFT_ReplayDispatchList(app, dispatchList);
+    else
+        resFFT = VkFFT_AppendDispatches(app, inverse, 0);
+    if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_FlushSync(app);
+    VkFFT_EndDispatchProfile(app);
+    return resFFT;
+}
+#if((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2))
+static inline pfUINT VkFFT_GetGraphBufferNum(VkFFTApplication* app) {
+    return app->configuration.bufferNum + app->configuration.tempBufferNum + app->configuration.inputBufferNum + app->configuration.outputBufferNum + app->configuration.kernelNum;
+}
+static inline void VkFFT_GetGraphOffsetState(VkFFTApplication* app, pfUINT* offsetState) {
+    offsetState[0] = app->configuration.bufferOffset;
+    offsetState[1] = app->configuration.tempBufferOffset;
+    offsetState[2] = app->configuration.inputBufferOffset;
+    offsetState[3] = app->configuration.outputBufferOffset;
+    offsetState[4] = app->configuration.kernelOffset;
+    offsetState[5] = app->configuration.numberBatches;
+    offsetState[6] = app->batchStride[1];
+    offsetState[7] = app->batchStride[2];
+    offsetState[8] = app->batchStride[3];
+}
+static inline int VkFFT_UpdateGraphBuffers(void** graphBuffers, pfUINT* id, void** buffer, pfUINT bufferNum, int store) {
+    //graph nodes store kernel arguments by value, so buffers are compared by the addresses they hold and not by the pointers to them
+    int changed = 0;
+    for (pfUINT i = 0; i < bufferNum; i++) {
+        void* address = (buffer) ? buffer[i] : 0;
+        if (store) graphBuffers[id[0]] = address;
+        else if (graphBuffers[id[0]] != address) changed = 1;
+        id[0]++;
+    }
+    return changed;
+}
+static inline int VkFFT_UpdateGraphState(VkFFTApplication* app, pfUINT graphID, int store) {
+    //compares (store = 0) or stores (store = 1) all buffer, tempBuffer, inputBuffer, outputBuffer and kernel addresses, offsets and batching of the launch
+    pfUINT id = 0;
+    int changed = 0;
+    changed |= VkFFT_UpdateGraphBuffers(app->graphBuffers[graphID], &id, app->configuration.buffer, app->configuration.bufferNum, store);
+    changed |= VkFFT_UpdateGraphBuffers(app->graphBuffers[graphID], &id, app->configuration.tempBuffer, app->configuration.tempBufferNum, store);
+    changed |= VkFFT_UpdateGraphBuffers(app->graphBuffers[graphID], &id, app->configuration.inputBuffer, app->configuration.inputBufferNum, store);
+    changed |= VkFFT_UpdateGraphBuffers(app->graphBuffers[graphID], &id, app->configuration.outputBuffer, app->configuration.outputBufferNum, store);
+    changed |= VkFFT_UpdateGraphBuffers(app->graphBuffers[graphID], &id, app->configuration.kernel, app->configuration.kernelNum, store);
+    pfUINT offsetState[9];
+    VkFFT_GetGraphOffsetState(app, offsetState);
+    if (store) memcpy(app->graphBufferOffsets[graphID], offsetState, sizeof(offsetState));
+    else if (memcmp(offsetState, app->graphBufferOffsets[graphID], sizeof(offsetState))) changed = 1;
+    return changed;
+}
+static inline int VkFFT_GraphStateChanged(VkFFTApplication* app, pfUINT graphID) {
+    if ((!app->graphExec[graphID]) || (!app->graphBuffers[graphID]) || (app->graphBufferNum[graphID] != VkFFT_GetGraphBufferNum(app))) return 1;
+    return VkFFT_UpdateGraphState(app, graphID, 0);
+}
+static inline VkFFTResult VkFFT_StoreGraphState(VkFFTApplication* app, pfUINT graphID) {
+    pfUINT bufferNum = VkFFT_GetGraphBufferNum(app);
+    if ((!app->graphBuffers[graphID]) || (app->graphBufferNum[graphID] != bufferNum)) {
+        if (app->graphBuffers[graphID]) free(app->graphBuffers[graphID]);
+        app->graphBufferNum[graphID] = 0;
+        app->graphBuffers[graphID] = (void**)calloc((bufferNum) ? bufferNum : 1, sizeof(void*));
+        if (!app->graphBuffers[graphID]) return VKFFT_ERROR_MALLOC_FAILED;
+        app->graphBufferNum[graphID] = bufferNum;
+    }
+    VkFFT_UpdateGraphState(app, graphID, 1);
+    return VKFFT_SUCCESS;
+}
+#endif
+#if(VKFFT_BACKEND==1)
+static inline VkFFTResult VkFFT_CaptureGraph(VkFFTApplication* app, int inverse, VkFFTLaunchParams* launchParams) {
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    cudaError_t res = cudaSuccess;
+    cudaGraph_t graph = 0;
+    pfUINT graphID = (inverse == 1) ? 1 : 0;
+    if (!app->graphCaptureStream) {
+        res = cudaStreamCreateWithFlags(&app->graphCaptureStream, cudaStreamNonBlocking);
+        if (res != cudaSuccess) {
+            app->graphCaptureStream = 0;
+            return VKFFT_ERROR_FAILED_TO_CREATE_STREAM;
+        }
+    }
+    res = cudaStreamBeginCapture(app->graphCaptureStream, cudaStreamCaptureModeThreadLocal);
+    if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH;
+    app->graphCapture = 1;
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+    app->graphCapture = 0;
+    res = cudaStreamEndCapture(app->graphCaptureStream, &graph);
+    if ((resFFT != VKFFT_SUCCESS) || (res != cudaSuccess)) {
+        if (graph) cudaGraphDestroy(graph);
+        return (resFFT != VKFFT_SUCCESS) ? resFFT : VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH;
+    }
+    if (app->graphExec[graphID]) {
+        //kernel sequence is the same for every capture, so only node parameters of the instantiated graph have to be updated
+#if (CUDA_VERSION >= 12000)
+        cudaGraphExecUpdateResultInfo updateResult;
+        res = cudaGraphExecUpdate(app->graphExec[graphID], graph, &updateResult);
+#else
+        cudaGraphNode_t errorNode;
+        cudaGraphExecUpdateResult updateResult;
+        res = cudaGraphExecUpdate(app->graphExec[graphID], graph, &errorNode, &updateResult);
+#endif
+        if (res != cudaSuccess) {
+            cudaGetLastError();
+            cudaGraphExecDestroy(app->graphExec[graphID]);
+            app->graphExec[graphID] = 0;
+        }
+    }
+    if (!app->graphExec[graphID]) {
+        res = cudaGraphInstantiateWithFlags(&app->graphExec[graphID], graph, 0);
+        if (res != cudaSuccess) {
+            app->graphExec[graphID] = 0;
+            cudaGraphDestroy(graph);
+            return VKFFT_ERROR_FAILED_TO_INSTANTIATE_GRAPH;
+        }
+    }
+    cudaGraphDestroy(graph);
+    return resFFT;
+}
+#elif(VKFFT_BACKEND==2)
+static inline VkFFTResult VkFFT_CaptureGraph(VkFFTApplication* app, int inverse, VkFFTLaunchParams* launchParams) {
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    hipError_t res = hipSuccess;
+    hipGraph_t graph = 0;
+    pfUINT graphID = (inverse == 1) ? 1 : 0;
+    if (!app->graphCaptureStream) {
+        res = hipStreamCreateWithFlags(&app->graphCaptureStream, hipStreamNonBlocking);
+        if (res != hipSuccess) {
+            app->graphCaptureStream = 0;
+            return VKFFT_ERROR_FAILED_TO_CREATE_STREAM;
+        }
+    }
+    res = hipStreamBeginCapture(app->graphCaptureStream, hipStreamCaptureModeThreadLocal);
+    if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH;
+    app->graphCapture = 1;
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+    app->graphCapture = 0;
+    res = hipStreamEndCapture(app->graphCaptureStream, &graph);
+    if ((resFFT != VKFFT_SUCCESS) || (res != hipSuccess)) {
+        if (graph) hipGraphDestroy(graph);
+        return (resFFT != VKFFT_SUCCESS) ? resFFT : VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH;
+    }
+    if (app->graphExec[graphID]) {
+        //kernel sequence is the same for every capture, so only node parameters of the instantiated graph have to be updated
+        hipGraphNode_t errorNode;
+        hipGraphExecUpdateResult updateResult;
+        res = hipGraphExecUpdate(app->graphExec[graphID], graph, &errorNode, &updateResult);
+        if (res != hipSuccess) {
+            hipGetLastError();
+            hipGraphExecDestroy(app->graphExec[graphID]);
+            app->graphExec[graphID] = 0;
+        }
+    }
+    if (!app->graphExec[graphID]) {
+        res = hipGraphInstantiate(&app->graphExec[graphID], graph, 0, 0, 0);
+        if (res != hipSuccess) {
+            app->graphExec[graphID] = 0;
+            hipGraphDestroy(graph);
+            return VKFFT_ERROR_FAILED_TO_INSTANTIATE_GRAPH;
+        }
+    }
+    hipGraphDestroy(graph);
+    return resFFT;
+}
+#endif
+static inline VkFFTResult VkFFTAppendGraph(VkFFTApplication* app, int inverse, VkFFTLaunchParams* launchParams) {
+    //CUDA/HIP: the whole forward or inverse execution (all axes, Bluestein and R2C decomposition stages) is captured into a graph on the first call and
+    //launched as a single graph afterwards. The execution is recaptured and the instantiated graph is updated in place when buffers, offsets or batches of the launch change.
+    //Graphs are launched in the first provided stream (default stream if num_streams is 0). Other backends record into user command buffers/queues already and fall back to VkFFTAppend.
+    VkFFTResult resFFT = VKFFT_SUCCESS;
+    if (app->configuration.dryRun) return VKFFT_ERROR_ENABLED_dryRun;
+#if(VKFFT_BACKEND==0)
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+#elif(VKFFT_BACKEND==1)
+    pfUINT graphID = (inverse == 1) ? 1 : 0;
+    if ((inverse != 1) && (app->configuration.makeInversePlanOnly)) return VKFFT_ERROR_ONLY_INVERSE_FFT_INITIALIZED;
+    if ((inverse == 1) && (app->configuration.makeForwardPlanOnly)) return VKFFT_ERROR_ONLY_FORWARD_FFT_INITIALIZED;
+    if ((inverse != 1) && (!app->configuration.makeInversePlanOnly) && (!app->localFFTPlan)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+    if ((inverse == 1) && (!app->configuration.makeForwardPlanOnly) && (!app->localFFTPlan_inverse)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+    resFFT = VkFFTCheckUpdateBufferSet(app, 0, 0, launchParams);
+    if (resFFT != VKFFT_SUCCESS) {
+        return resFFT;
+    }
+    if (VkFFT_GraphStateChanged(app, graphID)) {
+        resFFT = VkFFT_CaptureGraph(app, inverse, launchParams);
+        if (resFFT != VKFFT_SUCCESS) {
+            return resFFT;
+        }
+        resFFT = VkFFT_StoreGraphState(app, graphID);
+        if (resFFT != VKFFT_SUCCESS) {
+            return resFFT;
+        }
+    }
+    cudaError_t res = cudaGraphLaunch(app->graphExec[graphID], (app->configuration.num_streams >= 1) ? app->configuration.stream[0] : 0);
+    if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_LAUNCH_GRAPH;
+#elif(VKFFT_BACKEND==2)
+    pfUINT graphID = (inverse == 1) ? 1 : 0;
+    if ((inverse != 1) && (app->configuration.makeInversePlanOnly)) return VKFFT_ERROR_ONLY_INVERSE_FFT_INITIALIZED;
+    if ((inverse == 1) && (app->configuration.makeForwardPlanOnly)) return VKFFT_ERROR_ONLY_FORWARD_FFT_INITIALIZED;
+    if ((inverse != 1) && (!app->configuration.makeInversePlanOnly) && (!app->localFFTPlan)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+    if ((inverse == 1) && (!app->configuration.makeForwardPlanOnly) && (!app->localFFTPlan_inverse)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+    resFFT = VkFFTCheckUpdateBufferSet(app, 0, 0, launchParams);
+    if (resFFT != VKFFT_SUCCESS) {
+        return resFFT;
+    }
+    if (VkFFT_GraphStateChanged(app, graphID)) {
+        resFFT = VkFFT_CaptureGraph(app, inverse, launchParams);
+        if (resFFT != VKFFT_SUCCESS) {
+            return resFFT;
+        }
+        resFFT = VkFFT_StoreGraphState(app, graphID);
+        if (resFFT != VKFFT_SUCCESS) {
+            return resFFT;
+        }
+    }
+    hipError_t res = hipGraphLaunch(app->graphExec[graphID], (app->configuration.num_streams >= 1) ? app->configuration.stream[0] : 0);
+    if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_LAUNCH_GRAPH;
+#elif(VKFFT_BACKEND==3)
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+#elif(VKFFT_BACKEND==4)
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+#elif(VKFFT_BACKEND==5)
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+#elif(VKFFT_BACKEND==6)
+    resFFT = VkFFTAppend(app, inverse, launchParams);
+#endif
+    return resFFT;
+}
 
 #endif
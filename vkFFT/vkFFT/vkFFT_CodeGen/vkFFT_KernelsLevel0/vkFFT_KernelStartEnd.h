@@ -44,11 +44,9 @@ static inline void appendKernelStart(VkFFTSpecializationConstantsLayout* sc, int
 	PfGetTypeFromCode(sc, sc->uintType32Code, &uintType32);
 #if(VKFFT_BACKEND==0)
 	appendSharedMemoryVkFFT(sc, (int)locType);
-	sc->tempLen = sprintf(sc->tempStr, "void main() {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "void main() {\n");
 #elif(VKFFT_BACKEND==1)
-	sc->tempLen = sprintf(sc->tempStr, "extern __shared__ float shared[];\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "extern __shared__ float shared[];\n");
 	
 	sc->tempLen = sprintf(sc->tempStr, "extern \"C\" __global__ void __launch_bounds__(%" PRIi64 ") VkFFT_main ", sc->localSize[0].data.i * sc->localSize[1].data.i * sc->localSize[2].data.i);
 	PfAppendLine(sc);
@@ -77,17 +75,14 @@ static inline void appendKernelStart(VkFFTSpecializationConstantsLayout* sc, int
 		PfAppendLine(sc);
 	}
 	if (sc->pushConstantsStructSize > 0) {
-		sc->tempLen = sprintf(sc->tempStr, ", PushConsts consts");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ", PushConsts consts");
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 	
 	appendSharedMemoryVkFFT(sc, (int)locType);
 	
 #elif(VKFFT_BACKEND==2)
-	sc->tempLen = sprintf(sc->tempStr, "extern __shared__ float shared[];\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "extern __shared__ float shared[];\n");
 	if (!sc->useUint64 && sc->useStrict32BitAddress > 0) {
 		// These wrappers help hipcc to generate faster code for load and store operations where
 		// 64-bit scalar + 32-bit vector registers are used instead of 64-bit vector saving a few
@@ -144,11 +139,9 @@ static inline void appendKernelStart(VkFFTSpecializationConstantsLayout* sc, int
 		PfAppendLine(sc);
 	}
 	if (sc->pushConstantsStructSize > 0) {
-		sc->tempLen = sprintf(sc->tempStr, ", PushConsts consts");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ", PushConsts consts");
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 	
 	appendSharedMemoryVkFFT(sc, (int)locType);
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
@@ -184,16 +177,13 @@ static inline void appendKernelStart(VkFFTSpecializationConstantsLayout* sc, int
 		args_id++;
 	}
 	if (sc->pushConstantsStructSize > 0) {
-		sc->tempLen = sprintf(sc->tempStr, ", PushConsts consts");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ", PushConsts consts");
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 	//sc->tempLen = sprintf(sc->tempStr, ", const PushConsts consts) {\n");
 	appendSharedMemoryVkFFT(sc, (int)locType);
 #elif(VKFFT_BACKEND==5)
-	sc->tempLen = sprintf(sc->tempStr, "kernel void VkFFT_main ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "kernel void VkFFT_main ");
 	
 	sc->tempLen = sprintf(sc->tempStr, "(%s3 thread_position_in_grid [[thread_position_in_grid]], ", uintType->name);
 	PfAppendLine(sc);
@@ -245,9 +235,45 @@ static inline void appendKernelStart(VkFFTSpecializationConstantsLayout* sc, int
 		
 		args_id++;
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 	
+	appendSharedMemoryVkFFT(sc, (int)locType);
+#elif(VKFFT_BACKEND==6)
+	//arguments are passed as an array of pointers to values, like in cuLaunchKernel
+	PfAppendLiteral(sc, "VKFFT_CPU_EXPORT void VkFFT_main (VkFFTCPUInvocation* vkfft_inv, void** vkfft_args) {\n");
+	sc->tempLen = sprintf(sc->tempStr, "%s* inputs = *(%s**)vkfft_args[0];\n%s* outputs = *(%s**)vkfft_args[1];\n", inputMemoryType->name, inputMemoryType->name, outputMemoryType->name, outputMemoryType->name);
+	PfAppendLine(sc);
+	int args_id = 2;
+	if (sc->convolutionStep) {
+		sc->tempLen = sprintf(sc->tempStr, "%s* kernel_obj = *(%s**)vkfft_args[%d];\n", vecType->name, vecType->name, args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
+	if (sc->LUT) {
+		sc->tempLen = sprintf(sc->tempStr, "%s* twiddleLUT = *(%s**)vkfft_args[%d];\n", vecType->name, vecType->name, args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
+	if (sc->raderUintLUT) {
+		sc->tempLen = sprintf(sc->tempStr, "%s* g_pow = *(%s**)vkfft_args[%d];\n", uintType32->name, uintType32->name, args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
+	if (sc->BluesteinConvolutionStep) {
+		sc->tempLen = sprintf(sc->tempStr, "%s* BluesteinConvolutionKernel = *(%s**)vkfft_args[%d];\n", vecType->name, vecType->name, args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
+	if (sc->BluesteinPreMultiplication || sc->BluesteinPostMultiplication) {
+		sc->tempLen = sprintf(sc->tempStr, "%s* BluesteinMultiplication = *(%s**)vkfft_args[%d];\n", vecType->name, vecType->name, args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
+	if (sc->pushConstantsStructSize > 0) {
+		sc->tempLen = sprintf(sc->tempStr, "PushConsts consts = *(PushConsts*)vkfft_args[%d];\n", args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
 	appendSharedMemoryVkFFT(sc, (int)locType);
 #endif
 	return;
@@ -271,8 +297,7 @@ static inline void appendKernelStart_R2C(VkFFTSpecializationConstantsLayout* sc,
 	PfContainer* uintType32;
 	PfGetTypeFromCode(sc, sc->uintType32Code, &uintType32);
 #if(VKFFT_BACKEND==0)
-	sc->tempLen = sprintf(sc->tempStr, "void main() {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "void main() {\n");
 	
 #elif(VKFFT_BACKEND==1)
 	
@@ -287,11 +312,9 @@ static inline void appendKernelStart_R2C(VkFFTSpecializationConstantsLayout* sc,
 		PfAppendLine(sc);
 	}
 	if (sc->pushConstantsStructSize > 0) {
-		sc->tempLen = sprintf(sc->tempStr, ", PushConsts consts");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ", PushConsts consts");
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 
 #elif(VKFFT_BACKEND==2)
 	if (!sc->useUint64 && sc->useStrict32BitAddress > 0) {
@@ -335,11 +358,9 @@ static inline void appendKernelStart_R2C(VkFFTSpecializationConstantsLayout* sc,
 		PfAppendLine(sc);
 	}
 	if (sc->pushConstantsStructSize > 0) {
-		sc->tempLen = sprintf(sc->tempStr, ", PushConsts consts");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ", PushConsts consts");
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 	
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
 	sc->tempLen = sprintf(sc->tempStr, "__kernel __attribute__((reqd_work_group_size(%" PRIi64 ", %" PRIi64 ", %" PRIi64 "))) void VkFFT_main_R2C ", sc->localSize[0].data.i, sc->localSize[1].data.i, sc->localSize[2].data.i);
@@ -353,15 +374,12 @@ static inline void appendKernelStart_R2C(VkFFTSpecializationConstantsLayout* sc,
 		args_id++;
 	}
 	if (sc->pushConstantsStructSize > 0) {
-		sc->tempLen = sprintf(sc->tempStr, ", PushConsts consts");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ", PushConsts consts");
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 
 #elif(VKFFT_BACKEND==5)
-	sc->tempLen = sprintf(sc->tempStr, "kernel void VkFFT_main_R2C ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "kernel void VkFFT_main_R2C ");
 
 	sc->tempLen = sprintf(sc->tempStr, "(%s3 thread_position_in_grid [[thread_position_in_grid]], ", uintType->name);
 	PfAppendLine(sc);
@@ -388,16 +406,29 @@ static inline void appendKernelStart_R2C(VkFFTSpecializationConstantsLayout* sc,
 
 		args_id++;
 	}
-	sc->tempLen = sprintf(sc->tempStr, ") {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ") {\n");
 
+#elif(VKFFT_BACKEND==6)
+	PfAppendLiteral(sc, "VKFFT_CPU_EXPORT void VkFFT_main_R2C (VkFFTCPUInvocation* vkfft_inv, void** vkfft_args) {\n");
+	sc->tempLen = sprintf(sc->tempStr, "%s* inputs = *(%s**)vkfft_args[0];\n%s* outputs = *(%s**)vkfft_args[1];\n", inputMemoryType->name, inputMemoryType->name, outputMemoryType->name, outputMemoryType->name);
+	PfAppendLine(sc);
+	int args_id = 2;
+	if (sc->LUT) {
+		sc->tempLen = sprintf(sc->tempStr, "%s* twiddleLUT = *(%s**)vkfft_args[%d];\n", vecType->name, vecType->name, args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
+	if (sc->pushConstantsStructSize > 0) {
+		sc->tempLen = sprintf(sc->tempStr, "PushConsts consts = *(PushConsts*)vkfft_args[%d];\n", args_id);
+		PfAppendLine(sc);
+		args_id++;
+	}
 #endif
 	return;
 }
 static inline void appendKernelEnd(VkFFTSpecializationConstantsLayout* sc) {
 	if (sc->res != VKFFT_SUCCESS) return;
-	sc->tempLen = sprintf(sc->tempStr, "}\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "}\n");
 	return;
 }
 #endif
@@ -56,8 +56,7 @@ static inline void appendLicense(VkFFTSpecializationConstantsLayout* sc) {
 static inline void appendVersion(VkFFTSpecializationConstantsLayout* sc) {
 	if (sc->res != VKFFT_SUCCESS) return;
 #if(VKFFT_BACKEND==0)
-	sc->tempLen = sprintf(sc->tempStr, "#version 450\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "#version 450\n\n");
 #endif
 	return;
 }
@@ -75,8 +74,7 @@ static inline void appendExtensions(VkFFTSpecializationConstantsLayout* sc) {
 		PfAppendLine(sc);
 	}
 	if ((((sc->floatTypeInputMemoryCode / 10) % 10) == 0) || (((sc->floatTypeOutputMemoryCode / 10) % 10) == 0) || (((sc->floatTypeCode / 10) % 10) == 0)) {
-		sc->tempLen = sprintf(sc->tempStr, "#extension GL_EXT_shader_16bit_storage : require\n\n");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, "#extension GL_EXT_shader_16bit_storage : require\n\n");
 	}
 #elif(VKFFT_BACKEND==1)
 	if ((((sc->floatTypeInputMemoryCode / 10) % 10) == 0) || (((sc->floatTypeOutputMemoryCode / 10) % 10) == 0) || (((sc->floatTypeCode / 10) % 10) == 0)) {
@@ -111,6 +109,30 @@ static inline void appendExtensions(VkFFTSpecializationConstantsLayout* sc) {
 #include <metal_math>\n\
 using namespace metal;\n");
 	PfAppendLine(sc);
+#elif(VKFFT_BACKEND==6)
+	//kernels are compiled as C by the host compiler. tgmath.h makes math functions follow the precision of their arguments, like in other backends
+	PfAppendLiteral(sc, "\
+#include <tgmath.h>\n\
+#ifdef _WIN32\n\
+#define VKFFT_CPU_EXPORT __declspec(dllexport)\n\
+#else\n\
+#define VKFFT_CPU_EXPORT __attribute__((visibility(\"default\")))\n\
+#endif\n\
+#define rsqrt(x) (1 / sqrt(x))\n\
+typedef struct { float x; float y; } float2;\n\
+typedef struct { double x; double y; } double2;\n");
+	if ((((sc->floatTypeInputMemoryCode / 10) % 10) == 0) || (((sc->floatTypeOutputMemoryCode / 10) % 10) == 0) || (((sc->floatTypeCode / 10) % 10) == 0)) {
+		PfAppendLiteral(sc, "typedef _Float16 half;\ntypedef struct { half x; half y; } half2;\n");
+	}
+	//has to match the definition in vkFFT_CPURuntime.h
+	PfAppendLiteral(sc, "\
+typedef struct VkFFTCPUInvocation {\n\
+	unsigned int localID[3];\n\
+	unsigned int groupID[3];\n\
+	void* sharedMemory;\n\
+	void (*barrier)(struct VkFFTCPUInvocation* invocation);\n\
+	void* worker;\n\
+} VkFFTCPUInvocation;\n\n");
 #endif
 	return;
 }
@@ -302,20 +324,17 @@ static inline void appendConversion(VkFFTSpecializationConstantsLayout* sc) {
 static inline void appendBarrierVkFFT(VkFFTSpecializationConstantsLayout* sc) {
 	if (sc->res != VKFFT_SUCCESS) return;
 #if(VKFFT_BACKEND==0)
-	sc->tempLen = sprintf(sc->tempStr, "barrier();\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "barrier();\n\n");
 #elif(VKFFT_BACKEND==1)
-	sc->tempLen = sprintf(sc->tempStr, "__syncthreads();\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "__syncthreads();\n\n");
 #elif(VKFFT_BACKEND==2)
-	sc->tempLen = sprintf(sc->tempStr, "__syncthreads();\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "__syncthreads();\n\n");
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
-	sc->tempLen = sprintf(sc->tempStr, "barrier(CLK_LOCAL_MEM_FENCE);\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "barrier(CLK_LOCAL_MEM_FENCE);\n\n");
 #elif(VKFFT_BACKEND==5)
-	sc->tempLen = sprintf(sc->tempStr, "threadgroup_barrier(mem_flags::mem_none);\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "threadgroup_barrier(mem_flags::mem_none);\n\n");
+#elif(VKFFT_BACKEND==6)
+	PfAppendLiteral(sc, "vkfft_inv->barrier(vkfft_inv);\n\n");
 #endif
 	return;
 }
@@ -60,8 +60,7 @@ static inline void appendConstantsVkFFT(VkFFTSpecializationConstantsLayout* sc)
 						PfAppendLine(sc);
 						
 					}
-					sc->tempLen = sprintf(sc->tempStr, "};\n");
-					PfAppendLine(sc);
+					PfAppendLiteral(sc, "};\n");
 					
 				}
 				if (sc->inline_rader_kernel) {
@@ -82,21 +81,18 @@ static inline void appendConstantsVkFFT(VkFFTSpecializationConstantsLayout* sc)
 						for (int j = 0; j < (sc->raderContainer[i].prime - 1); j++) {//fix later
 							if (((sc->floatTypeCode % 100) / 10) == 2) {
 								double* raderFFTKernel = (double*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.17e", raderFFTKernel[2 * j] / (sc->raderContainer[i].prime - 1));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, raderFFTKernel[2 * j] / (sc->raderContainer[i].prime - 1), 17);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->doubleLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (((sc->floatTypeCode % 100) / 10) == 1) {
 								float* raderFFTKernel = (float*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.8e", raderFFTKernel[2 * j] / (sc->raderContainer[i].prime - 1));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, raderFFTKernel[2 * j] / (sc->raderContainer[i].prime - 1), 8);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->floatLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (j < (sc->raderContainer[i].prime - 2)) {
-								sc->tempLen = sprintf(sc->tempStr, ", ");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, ", ");
 							}
 							else {
 								sc->tempLen = sprintf(sc->tempStr, "};\n");
@@ -112,26 +108,22 @@ static inline void appendConstantsVkFFT(VkFFTSpecializationConstantsLayout* sc)
 							}
 							if (((sc->floatTypeCode % 100) / 10) == 2) {
 								double* raderFFTKernel = (double*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.17e", (double)pfcos(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, (double)pfcos(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime), 17);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->doubleLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (((sc->floatTypeCode % 100) / 10) == 1) {
 								float* raderFFTKernel = (float*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.8e", (float)pfcos(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, (float)pfcos(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime), 8);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->floatLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (j < (sc->raderContainer[i].prime - 2)) {
-								sc->tempLen = sprintf(sc->tempStr, ", ");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, ", ");
 								
 							}
 							else {
-								sc->tempLen = sprintf(sc->tempStr, "};\n");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, "};\n");
 								
 							}
 						}
@@ -153,27 +145,23 @@ static inline void appendConstantsVkFFT(VkFFTSpecializationConstantsLayout* sc)
 						for (int j = 0; j < (sc->raderContainer[i].prime - 1); j++) {//fix later
 							if (((sc->floatTypeCode % 100) / 10) == 2) {
 								double* raderFFTKernel = (double*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.17e", raderFFTKernel[2 * j + 1] / (sc->raderContainer[i].prime - 1));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, raderFFTKernel[2 * j + 1] / (sc->raderContainer[i].prime - 1), 17);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->doubleLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (((sc->floatTypeCode % 100) / 10) == 1) {
 								float* raderFFTKernel = (float*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.8e", raderFFTKernel[2 * j + 1] / (sc->raderContainer[i].prime - 1));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, raderFFTKernel[2 * j + 1] / (sc->raderContainer[i].prime - 1), 8);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->floatLiteral.name);
 								PfAppendLine(sc);
 							}
 
 							if (j < (sc->raderContainer[i].prime - 2)) {
-								sc->tempLen = sprintf(sc->tempStr, ", ");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, ", ");
 								
 							}
 							else {
-								sc->tempLen = sprintf(sc->tempStr, "};\n");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, "};\n");
 								
 							}
 						}
@@ -186,26 +174,22 @@ static inline void appendConstantsVkFFT(VkFFTSpecializationConstantsLayout* sc)
 							}
 							if (((sc->floatTypeCode % 100) / 10) == 2) {
 								double* raderFFTKernel = (double*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.17e", (double)(-pfsin(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime)));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, (double)(-pfsin(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime)), 17);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->doubleLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (((sc->floatTypeCode % 100) / 10) == 1) {
 								float* raderFFTKernel = (float*)sc->raderContainer[i].raderFFTkernel;
-								sc->tempLen = sprintf(sc->tempStr, "%.8e", (float)(-pfsin(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime)));
-								PfAppendLine(sc);
+								PfAppendFloat(sc, (float)(-pfsin(2.0 * g_pow * sc->double_PI / sc->raderContainer[i].prime)), 8);
 								sc->tempLen = sprintf(sc->tempStr, "%s ", sc->floatLiteral.name);
 								PfAppendLine(sc);
 							}
 							if (j < (sc->raderContainer[i].prime - 2)) {
-								sc->tempLen = sprintf(sc->tempStr, ", ");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, ", ");
 								
 							}
 							else {
-								sc->tempLen = sprintf(sc->tempStr, "};\n");
-								PfAppendLine(sc);
+								PfAppendLiteral(sc, "};\n");
 								
 							}
 						}
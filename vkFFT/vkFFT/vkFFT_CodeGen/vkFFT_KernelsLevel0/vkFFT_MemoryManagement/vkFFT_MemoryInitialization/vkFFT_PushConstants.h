@@ -43,20 +43,16 @@ static inline void appendPushConstants(VkFFTSpecializationConstantsLayout* sc) {
 	if (sc->pushConstantsStructSize == 0)
 		return;
 #if(VKFFT_BACKEND==0)
-	sc->tempLen = sprintf(sc->tempStr, "layout(push_constant) uniform PushConsts\n{\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "layout(push_constant) uniform PushConsts\n{\n");
 	
 #elif(VKFFT_BACKEND==1)
-	sc->tempLen = sprintf(sc->tempStr, "	typedef struct {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "	typedef struct {\n");
 	
 #elif(VKFFT_BACKEND==2)
-	sc->tempLen = sprintf(sc->tempStr, "	typedef struct {\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "	typedef struct {\n");
 	
-#elif(VKFFT_BACKEND==3)
-	sc->tempLen = sprintf(sc->tempStr, "	typedef struct {\n");
-	PfAppendLine(sc);
+#elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==6))
+	PfAppendLiteral(sc, "	typedef struct {\n");
 	
 #endif
 	char tempCopyStr[60];
@@ -90,25 +86,29 @@ static inline void appendPushConstants(VkFFTSpecializationConstantsLayout* sc) {
 		sprintf(tempCopyStr, "consts.%s", sc->kernelOffset.name);
 		sprintf(sc->kernelOffset.name, "%s", tempCopyStr);
 	}
+	if (sc->performPostCompilationBatchStride) {
+		appendPushConstant(sc, &sc->inputBatchStride);
+		sprintf(tempCopyStr, "consts.%s", sc->inputBatchStride.name);
+		sprintf(sc->inputBatchStride.name, "%s", tempCopyStr);
+		appendPushConstant(sc, &sc->outputBatchStride);
+		sprintf(tempCopyStr, "consts.%s", sc->outputBatchStride.name);
+		sprintf(sc->outputBatchStride.name, "%s", tempCopyStr);
+	}
 #if(VKFFT_BACKEND==0)
-	sc->tempLen = sprintf(sc->tempStr, "} consts;\n\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "} consts;\n\n");
 	
 #elif(VKFFT_BACKEND==1)
-	sc->tempLen = sprintf(sc->tempStr, "	}PushConsts;\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "	}PushConsts;\n");
 	//sc->tempLen = sprintf(sc->tempStr, "	__constant__ PushConsts consts;\n");
 	//PfAppendLine(sc);
 #elif(VKFFT_BACKEND==2)
-	sc->tempLen = sprintf(sc->tempStr, "	}PushConsts;\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, "	}PushConsts;\n");
 	
 	//sc->tempLen = sprintf(sc->tempStr, "	__constant__ PushConsts consts;\n");
 	//PfAppendLine(sc);
 	
-#elif(VKFFT_BACKEND==3)
-	sc->tempLen = sprintf(sc->tempStr, "	}PushConsts;\n");
-	PfAppendLine(sc);
+#elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==6))
+	PfAppendLiteral(sc, "	}PushConsts;\n");
 	
 #endif
 	return;
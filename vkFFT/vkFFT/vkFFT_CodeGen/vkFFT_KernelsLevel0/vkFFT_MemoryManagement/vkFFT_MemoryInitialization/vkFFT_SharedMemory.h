@@ -128,6 +128,9 @@ static inline void appendSharedMemoryVkFFT(VkFFTSpecializationConstantsLayout* s
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
 			sc->tempLen = sprintf(sc->tempStr, "__local %s sdata[%" PRIi64 "];// sharedStride - fft size,  gl_WorkGroupSize.y - grouped consecutive ffts\n\n", floatType->name, (2 * sc->usedSharedMemory.data.i) / sc->complexSize);
 			PfAppendLine(sc);
+#elif(VKFFT_BACKEND==6)
+			sc->tempLen = sprintf(sc->tempStr, "%s* sdata = (%s*)vkfft_inv->sharedMemory;\n\n", floatType->name, floatType->name);
+			PfAppendLine(sc);
 #endif
 		}else{
 			PfContainer* vecType = VKFFT_ZERO_INIT;
@@ -151,6 +154,9 @@ static inline void appendSharedMemoryVkFFT(VkFFTSpecializationConstantsLayout* s
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
 			sc->tempLen = sprintf(sc->tempStr, "__local %s sdata[%" PRIi64 "];// sharedStride - fft size,  gl_WorkGroupSize.y - grouped consecutive ffts\n\n", vecType->name, sc->usedSharedMemory.data.i / sc->complexSize);
 			PfAppendLine(sc);
+#elif(VKFFT_BACKEND==6)
+			sc->tempLen = sprintf(sc->tempStr, "%s* sdata = (%s*)vkfft_inv->sharedMemory;\n\n", vecType->name, vecType->name);
+			PfAppendLine(sc);
 #endif
 		}
 		break;
@@ -199,6 +205,9 @@ static inline void appendSharedMemoryVkFFT(VkFFTSpecializationConstantsLayout* s
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
 			sc->tempLen = sprintf(sc->tempStr, "__local %s sdata[%" PRIi64 "];\n\n", floatType->name, (2 * sc->usedSharedMemory.data.i) / sc->complexSize);
 			PfAppendLine(sc);
+#elif(VKFFT_BACKEND==6)
+			sc->tempLen = sprintf(sc->tempStr, "%s* sdata = (%s*)vkfft_inv->sharedMemory;\n\n", floatType->name, floatType->name);
+			PfAppendLine(sc);
 #endif
 		}else{
 			PfContainer* vecType = VKFFT_ZERO_INIT;
@@ -221,6 +230,9 @@ static inline void appendSharedMemoryVkFFT(VkFFTSpecializationConstantsLayout* s
 #elif((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
 			sc->tempLen = sprintf(sc->tempStr, "__local %s sdata[%" PRIi64 "];\n\n", vecType->name, sc->usedSharedMemory.data.i / sc->complexSize);
 			PfAppendLine(sc);
+#elif(VKFFT_BACKEND==6)
+			sc->tempLen = sprintf(sc->tempStr, "%s* sdata = (%s*)vkfft_inv->sharedMemory;\n\n", vecType->name, vecType->name);
+			PfAppendLine(sc);
 #endif
 		}
 		break;
@@ -200,10 +200,8 @@ static inline void appendConstantToRegisters_y(VkFFTSpecializationConstantsLayou
 static inline void appendGlobalToRegisters(VkFFTSpecializationConstantsLayout* sc, PfContainer* out, PfContainer* bufferName, PfContainer* inoutID)
 {
 	if (sc->res != VKFFT_SUCCESS) return;
-	sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendString(sc, out->name);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, out, bufferName);
 	int dataSize = ((out->type % 10) == 3) ? sc->complexSize : sc->complexSize / 2;
 	if ((!(strcmp(bufferName->name, sc->inputsStruct.name))) && (sc->inputBufferBlockNum != 1)) {
@@ -220,18 +218,15 @@ static inline void appendGlobalToRegisters(VkFFTSpecializationConstantsLayout* s
 	}
 	PfAppendLine(sc);
 	PfAppendConversionEnd(sc, out, bufferName);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	return;
 }
 static inline void appendGlobalToRegisters_x(VkFFTSpecializationConstantsLayout* sc, PfContainer* out, PfContainer* bufferName, PfContainer* inoutID)
 {
 	if (sc->res != VKFFT_SUCCESS) return;
 	
-	sc->tempLen = sprintf(sc->tempStr, "%s", out->data.c[0].name);
-	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendString(sc, out->data.c[0].name);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, &out->data.c[0], bufferName);
 	if ((!(strcmp(bufferName->name, sc->inputsStruct.name))) && (sc->inputBufferBlockNum != 1)) {
 		sc->tempLen = sprintf(sc->tempStr, "inputBlocks[%s / %" PRIu64 "].%s[%s %% %" PRIu64 "]", inoutID->name, sc->inputBufferBlockSize / (sc->complexSize / 2), bufferName->name, inoutID->name, sc->inputBufferBlockSize / (sc->complexSize / 2));
@@ -247,18 +242,15 @@ static inline void appendGlobalToRegisters_x(VkFFTSpecializationConstantsLayout*
 	}
 	PfAppendLine(sc);
 	PfAppendConversionEnd(sc, &out->data.c[0], bufferName);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	return;
 }
 static inline void appendGlobalToRegisters_y(VkFFTSpecializationConstantsLayout* sc, PfContainer* out, PfContainer* bufferName, PfContainer* inoutID)
 {
 	if (sc->res != VKFFT_SUCCESS) return;
 	
-	sc->tempLen = sprintf(sc->tempStr, "%s", out->data.c[1].name);
-	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendString(sc, out->data.c[1].name);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, &out->data.c[1], bufferName);
 	if ((!(strcmp(bufferName->name, sc->inputsStruct.name))) && (sc->inputBufferBlockNum != 1)) {
 		sc->tempLen = sprintf(sc->tempStr, "inputBlocks[%s / %" PRIu64 "].%s[%s %% %" PRIu64 "]", inoutID->name, sc->inputBufferBlockSize / (sc->complexSize / 2), bufferName->name, inoutID->name, sc->inputBufferBlockSize / (sc->complexSize / 2));
@@ -274,8 +266,7 @@ static inline void appendGlobalToRegisters_y(VkFFTSpecializationConstantsLayout*
 	}
 	PfAppendLine(sc);
 	PfAppendConversionEnd(sc, &out->data.c[1], bufferName);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	
 	return;
 }
@@ -297,14 +288,11 @@ static inline void appendRegistersToGlobal(VkFFTSpecializationConstantsLayout* s
 		sc->tempLen = sprintf(sc->tempStr, "%s[%s]", bufferName->name, inoutID->name);
 	}
 	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, bufferName, in);
-	sc->tempLen = sprintf(sc->tempStr, "%s", in->name);
-	PfAppendLine(sc);
+	PfAppendString(sc, in->name);
 	PfAppendConversionEnd(sc, bufferName, in);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	return;
 }
 static inline void appendRegistersToGlobal_x(VkFFTSpecializationConstantsLayout* sc, PfContainer* bufferName, PfContainer* inoutID, PfContainer* in)
@@ -323,14 +311,11 @@ static inline void appendRegistersToGlobal_x(VkFFTSpecializationConstantsLayout*
 		sc->tempLen = sprintf(sc->tempStr, "%s[%s]", bufferName->name, inoutID->name);
 	}
 	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, bufferName, &in->data.c[0]);
-	sc->tempLen = sprintf(sc->tempStr, "%s", in->data.c[0].name);
-	PfAppendLine(sc);
+	PfAppendString(sc, in->data.c[0].name);
 	PfAppendConversionEnd(sc, bufferName, &in->data.c[0]);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	return;
 }
 static inline void appendRegistersToGlobal_y(VkFFTSpecializationConstantsLayout* sc, PfContainer* bufferName, PfContainer* inoutID, PfContainer* in)
@@ -349,14 +334,11 @@ static inline void appendRegistersToGlobal_y(VkFFTSpecializationConstantsLayout*
 		sc->tempLen = sprintf(sc->tempStr, "%s[%s]", bufferName->name, inoutID->name);
 	}
 	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, bufferName, &in->data.c[1]);
-	sc->tempLen = sprintf(sc->tempStr, "%s", in->data.c[1].name);
-	PfAppendLine(sc);
+	PfAppendString(sc, in->data.c[1].name);
 	PfAppendConversionEnd(sc, bufferName, &in->data.c[1]);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	return;
 }
 
@@ -364,14 +346,12 @@ static inline void appendGlobalToShared(VkFFTSpecializationConstantsLayout* sc,
 {
 	if (sc->res != VKFFT_SUCCESS) return;
 	if (sc->storeSharedComplexComponentsSeparately){
-		sc->tempLen = sprintf(sc->tempStr, "%s", sc->temp.name);
-		PfAppendLine(sc);
+		PfAppendString(sc, sc->temp.name);
 	}else{
 		sc->tempLen = sprintf(sc->tempStr, "sdata[%s]", sdataID->name);
 		PfAppendLine(sc);
 	}
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, &sc->sdataStruct, bufferName);
 	if ((!(strcmp(bufferName->name, sc->inputsStruct.name))) && (sc->inputBufferBlockNum != 1)) {
 		sc->tempLen = sprintf(sc->tempStr, "inputBlocks[%s / %" PRIu64 "].%s[%s %% %" PRIu64 "]", inoutID->name, sc->inputBufferBlockSize / sc->complexSize, bufferName->name, inoutID->name, sc->inputBufferBlockSize / sc->complexSize);
@@ -387,8 +367,7 @@ static inline void appendGlobalToShared(VkFFTSpecializationConstantsLayout* sc,
 	}
 	PfAppendLine(sc);
 	PfAppendConversionEnd(sc, &sc->sdataStruct, bufferName);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 
 	if (sc->storeSharedComplexComponentsSeparately){
 		appendRegistersToShared(sc, sdataID, &sc->temp);
@@ -414,19 +393,16 @@ static inline void appendSharedToGlobal(VkFFTSpecializationConstantsLayout* sc,
 		sc->tempLen = sprintf(sc->tempStr, "%s[%s]", bufferName->name, inoutID->name);
 	}
 	PfAppendLine(sc);
-	sc->tempLen = sprintf(sc->tempStr, " = ");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, " = ");
 	PfAppendConversionStart(sc, bufferName, &sc->sdataStruct);
 	if (sc->storeSharedComplexComponentsSeparately){
-		sc->tempLen = sprintf(sc->tempStr, "%s", sc->temp.name);
-		PfAppendLine(sc);
+		PfAppendString(sc, sc->temp.name);
 	}else{
 		sc->tempLen = sprintf(sc->tempStr, "sdata[%s]", sdataID->name);
 		PfAppendLine(sc);
 	}
 	PfAppendConversionEnd(sc, bufferName, &sc->sdataStruct);
-	sc->tempLen = sprintf(sc->tempStr, ";\n");
-	PfAppendLine(sc);
+	PfAppendLiteral(sc, ";\n");
 	return;
 }
 static inline void appendSetSMToZero(VkFFTSpecializationConstantsLayout* sc) {
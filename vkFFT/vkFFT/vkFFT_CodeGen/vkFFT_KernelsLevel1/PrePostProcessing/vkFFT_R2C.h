@@ -435,8 +435,7 @@ static inline void appendC2R_read(VkFFTSpecializationConstantsLayout* sc, int ty
 				}
 				appendRegistersToShared(sc, &sc->sdataID, &sc->regIDs[i + k * used_registers.data.i]);
 				if ((pfINT)(1 + i + k * used_registers.data.i) * localSize.data.i > fftDim.data.i) {
-					sc->tempLen = sprintf(sc->tempStr, "		}\n");
-					PfAppendLine(sc);
+					PfAppendLiteral(sc, "		}\n");
 				}
 			}
 		}
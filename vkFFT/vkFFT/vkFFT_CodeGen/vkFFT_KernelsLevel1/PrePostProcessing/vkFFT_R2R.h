@@ -2479,7 +2479,7 @@ static inline void appendDCTIV_even_read(VkFFTSpecializationConstantsLayout* sc,
 			else {
 				appendRegistersToShared_x_y(sc, &sc->sdataID, &sc->regIDs[i - used_registers.data.i / 2]);
 			}
-#if(!((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)))
+#if(!((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6)))
 			PfIf_else(sc);
 			if (i < (pfUINT)used_registers.data.i / 2) {
 				appendRegistersToShared_y_x(sc, &sc->sdataID, &sc->regIDs[i]);
@@ -2507,7 +2507,7 @@ static inline void appendDCTIV_even_read(VkFFTSpecializationConstantsLayout* sc,
 		if (sc->useDisableThreads) {
 			PfIf_end(sc);
 		}
-#if(((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)))
+#if(((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6)))
 		appendBarrierVkFFT(sc);
 		if (sc->useDisableThreads) {
 			temp_int.data.i = 0;
@@ -2801,7 +2801,7 @@ static inline void appendDCTIV_even_read(VkFFTSpecializationConstantsLayout* sc,
 
 		appendRegistersToShared_x_x(sc, &sc->sdataID, &sc->regIDs[i]);
 
-#if(!((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)))//OpenCL, Level Zero and Metal are  not handling barrier with thread-conditional writes to local memory - so this is a work-around
+#if(!((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6)))//OpenCL, Level Zero and Metal are  not handling barrier with thread-conditional writes to local memory - so this is a work-around
 		if (sc->stridedSharedLayout) {
 			PfSub(sc, &sc->sdataID, &fftDim, &sc->combinedID);
 
@@ -2846,7 +2846,7 @@ static inline void appendDCTIV_even_read(VkFFTSpecializationConstantsLayout* sc,
 	if (sc->useDisableThreads) {
 		PfIf_end(sc);
 	}
-#if(((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)))//OpenCL, Level Zero and Metal are  not handling barrier with thread-conditional writes to local memory - so this is a work-around
+#if(((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6)))//OpenCL, Level Zero and Metal are  not handling barrier with thread-conditional writes to local memory - so this is a work-around
 
 	appendBarrierVkFFT(sc);
 	if (sc->useDisableThreads) {
@@ -91,7 +91,7 @@ static inline void setReadToRegisters(VkFFTSpecializationConstantsLayout* sc, in
 			if (sc->performDST == 4)
 				sc->readToRegisters = 1;
 			else {
-#if(((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)))
+#if(((VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6)))
 				sc->readToRegisters = 1;
 #else
 				sc->readToRegisters = 0;
@@ -236,7 +236,10 @@ static inline void appendOffset(VkFFTSpecializationConstantsLayout* sc, int read
 		else {
 			temp_int.data.i = sc->dispatchZactualFFTSize.data.i * maxCoordinate;
 			PfDiv(sc, &sc->tempInt, &sc->gl_GlobalInvocationID_z, &temp_int);
-			PfMul(sc, &sc->tempInt, &sc->tempInt, &bufferStride[sc->numFFTdims+1], 0);
+			if (sc->performPostCompilationBatchStride)
+				PfMul(sc, &sc->tempInt, &sc->tempInt, (readWrite) ? &sc->outputBatchStride : &sc->inputBatchStride, 0);
+			else
+				PfMul(sc, &sc->tempInt, &sc->tempInt, &bufferStride[sc->numFFTdims+1], 0);
 			PfAdd(sc, &sc->shiftZ, &sc->shiftZ, &sc->tempInt);
 
 		}
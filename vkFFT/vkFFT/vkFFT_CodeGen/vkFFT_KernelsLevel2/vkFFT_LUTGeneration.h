@@ -0,0 +1,261 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_LUTGENERATION_H
+#define VKFFT_LUTGENERATION_H
+
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_StringManagement/vkFFT_StringManager.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel0/vkFFT_MemoryManagement/vkFFT_MemoryInitialization/vkFFT_InputOutputLayout.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel0/vkFFT_MemoryManagement/vkFFT_MemoryTransfers/vkFFT_Transfers.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel0/vkFFT_KernelUtils.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel0/vkFFT_KernelStartEnd.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_MathUtils/vkFFT_MathUtils.h"
+
+// Kernel that fills LUT tables (described by VkFFTLUTTable, same layout as VkFFT_ComputeLUTTable produces on the host) directly in device memory.
+// One thread computes one value. The integer phase m of exp(2 * pi * i * m / N) is reduced exactly to the octant o = 8m / N and the remainder,
+// so sin and cos are only evaluated on [0, pi/4] and the accuracy does not depend on N. Double precision uses PfSinCos of the reduced argument,
+// single precision uses Taylor polynomials, as PfSinCos maps to fast hardware approximations there.
+
+static inline void appendLUTGenerationSinCos(VkFFTSpecializationConstantsLayout* sc, PfContainer* out, PfContainer* m, PfContainer* octant, PfContainer* f, PfContainer* temp, PfContainer* x, PfContainer* x2, PfContainer* s, PfContainer* c, pfUINT N, pfINT sign) {
+	if (sc->res != VKFFT_SUCCESS) return;
+	PfContainer temp_int = VKFFT_ZERO_INIT;
+	temp_int.type = 31;
+	PfContainer temp_N = VKFFT_ZERO_INIT;
+	temp_N.type = 31;
+	temp_N.data.i = (pfINT)N;
+	PfContainer temp_double = VKFFT_ZERO_INIT;
+	temp_double.type = 22;
+	PfContainer* floatType = VKFFT_ZERO_INIT;
+	PfGetTypeFromCode(sc, sc->floatTypeCode, &floatType);
+	if (sc->res != VKFFT_SUCCESS) return;
+
+	temp_int.data.i = 8;
+	PfMul(sc, f, m, &temp_int, 0);
+	PfDiv(sc, octant, f, &temp_N);
+	PfMul(sc, temp, octant, &temp_N, 0);
+	PfSub(sc, f, f, temp);
+	//odd octants are evaluated from the end of the octant
+	temp_int.data.i = 2;
+	PfMod(sc, temp, octant, &temp_int);
+	temp_int.data.i = 0;
+	PfIf_gt_start(sc, temp, &temp_int);
+	PfSub(sc, f, &temp_N, f);
+	PfIf_end(sc);
+#if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==5))
+	sc->tempLen = sprintf(sc->tempStr, "%s = %s(%s);\n", x->name, floatType->name, f->name);
+#else
+	sc->tempLen = sprintf(sc->tempStr, "%s = (%s)%s;\n", x->name, floatType->name, f->name);
+#endif
+	PfAppendLine(sc);
+	temp_double.data.d = sc->double_PI / (4 * (pfLD)N);
+	PfMul(sc, x, x, &temp_double, 0);
+	if (((sc->floatTypeCode / 10) % 10) == 2) {
+		PfSinCos(sc, out, x);
+		PfMov(sc, c, &out->data.c[0]);
+		PfMov(sc, s, &out->data.c[1]);
+	}
+	else {
+		//x <= pi/4, so terms up to x^9 for sin and x^10 for cos are below float epsilon
+		PfMul(sc, x2, x, x, 0);
+		pfLD coefficient = 1;
+		for (int i = 1; i <= 9; i++) coefficient /= i;
+		temp_double.data.d = coefficient;
+		PfMov(sc, s, &temp_double);
+		for (int i = 3; i >= 0; i--) {
+			coefficient *= -(2 * i + 2) * (2 * i + 3);
+			temp_double.data.d = coefficient;
+			PfFMA(sc, s, s, x2, &temp_double);
+		}
+		PfMul(sc, s, s, x, 0);
+		coefficient = 1;
+		for (int i = 1; i <= 10; i++) coefficient /= i;
+		temp_double.data.d = -coefficient;
+		PfMov(sc, c, &temp_double);
+		coefficient = -coefficient;
+		for (int i = 4; i >= 0; i--) {
+			coefficient *= -(2 * i + 1) * (2 * i + 2);
+			temp_double.data.d = coefficient;
+			PfFMA(sc, c, c, x2, &temp_double);
+		}
+	}
+	//octants 1, 2, 5 and 6 swap sin and cos
+	temp_int.data.i = 1;
+	PfAdd(sc, temp, octant, &temp_int);
+	temp_int.data.i = 4;
+	PfMod(sc, temp, temp, &temp_int);
+	temp_int.data.i = 2;
+	PfIf_ge_start(sc, temp, &temp_int);
+	PfMov(sc, &out->data.c[0], s);
+	PfMov(sc, &out->data.c[1], c);
+	PfIf_else(sc);
+	PfMov(sc, &out->data.c[0], c);
+	PfMov(sc, &out->data.c[1], s);
+	PfIf_end(sc);
+	//cos is negative in octants 2 - 5
+	temp_int.data.i = 2;
+	PfAdd(sc, temp, octant, &temp_int);
+	temp_int.data.i = 8;
+	PfMod(sc, temp, temp, &temp_int);
+	temp_int.data.i = 4;
+	PfIf_ge_start(sc, temp, &temp_int);
+	PfMovNeg(sc, &out->data.c[0], &out->data.c[0]);
+	PfIf_end(sc);
+	//sin is negative in octants 4 - 7, sign of the table flips it
+	if (sign > 0)
+		PfIf_ge_start(sc, octant, &temp_int);
+	else
+		PfIf_lt_start(sc, octant, &temp_int);
+	PfMovNeg(sc, &out->data.c[1], &out->data.c[1]);
+	PfIf_end(sc);
+	return;
+}
+
+static inline VkFFTResult shaderGen_LUTGeneration(VkFFTSpecializationConstantsLayout* sc, VkFFTLUTTable* tables, pfUINT numTables, pfUINT numWorkGroupsX) {
+	PfContainer temp_int = VKFFT_ZERO_INIT;
+	temp_int.type = 31;
+	PfContainer temp_int1 = VKFFT_ZERO_INIT;
+	temp_int1.type = 31;
+
+	appendVersion(sc);
+	appendExtensions(sc);
+	appendLayoutVkFFT(sc);
+	if ((((sc->floatTypeCode / 10) % 10) == 2)) {
+		appendSinCos20(sc);
+	}
+	appendInputLayoutVkFFT(sc, 0);
+	appendOutputLayoutVkFFT(sc, 1);
+	appendKernelStart_R2C(sc, 0);
+
+	PfContainer id = VKFFT_ZERO_INIT;
+	PfContainer local = VKFFT_ZERO_INIT;
+	PfContainer row = VKFFT_ZERO_INIT;
+	PfContainer m = VKFFT_ZERO_INIT;
+	PfContainer octant = VKFFT_ZERO_INIT;
+	PfContainer f = VKFFT_ZERO_INIT;
+	PfContainer temp = VKFFT_ZERO_INIT;
+	PfContainer x = VKFFT_ZERO_INIT;
+	PfContainer x2 = VKFFT_ZERO_INIT;
+	PfContainer s = VKFFT_ZERO_INIT;
+	PfContainer c = VKFFT_ZERO_INIT;
+	PfContainer w = VKFFT_ZERO_INIT;
+	PfContainer* intRegisters[7] = { &id, &local, &row, &m, &octant, &f, &temp };
+	const char* intNames[7] = { "id", "localID", "row", "m", "octant", "f", "tempInt" };
+	for (int i = 0; i < 7; i++) {
+		//products of the phase with the column index need 64-bit integers
+		intRegisters[i]->type = 121;
+		PfAllocateContainerFlexible(sc, intRegisters[i], 50);
+		PfDefine(sc, intRegisters[i], intNames[i]);
+	}
+	PfContainer* floatRegisters[4] = { &x, &x2, &s, &c };
+	const char* floatNames[4] = { "x", "x2", "sinX", "cosX" };
+	for (int i = 0; i < 4; i++) {
+		floatRegisters[i]->type = 100 + sc->floatTypeCode;
+		PfAllocateContainerFlexible(sc, floatRegisters[i], 50);
+		PfDefine(sc, floatRegisters[i], floatNames[i]);
+	}
+	w.type = 100 + sc->vecTypeCode;
+	PfAllocateContainerFlexible(sc, &w, 50);
+	PfDefine(sc, &w, "w");
+
+	pfUINT firstValue = tables[0].offset;
+	for (pfUINT t = 1; t < numTables; t++) {
+		if (tables[t].offset < firstValue) firstValue = tables[t].offset;
+	}
+	PfMov(sc, &id, &sc->gl_WorkGroupID_y);
+	temp_int.data.i = (pfINT)numWorkGroupsX;
+	PfMul(sc, &id, &id, &temp_int, 0);
+	PfAdd(sc, &id, &id, &sc->gl_WorkGroupID_x);
+	PfMul(sc, &id, &id, &sc->localSize[0], 0);
+	PfAdd(sc, &id, &id, &sc->gl_LocalInvocationID_x);
+	if (firstValue) {
+		temp_int.data.i = (pfINT)firstValue;
+		PfAdd(sc, &id, &id, &temp_int);
+	}
+	for (pfUINT t = 0; t < numTables; t++) {
+		VkFFTLUTTable* table = &tables[t];
+		pfUINT numValues = table->numRows * table->rowLength;
+		temp_int.data.i = (pfINT)table->offset;
+		PfIf_ge_start(sc, &id, &temp_int);
+		temp_int1.data.i = (pfINT)(table->offset + numValues);
+		PfIf_lt_start(sc, &id, &temp_int1);
+		PfSub(sc, &local, &id, &temp_int);
+		temp_int1.data.i = (pfINT)table->N;
+		if (table->chirpLength) {
+			//chirp exp(i * sign * pi * j^2 / (N / 2)), mirrored around the middle of the sequence and zero between the halves
+			temp_int.data.i = (pfINT)numValues;
+			PfSub(sc, &temp, &temp_int, &local);
+			PfIf_lt_start(sc, &temp, &local);
+			PfMov(sc, &local, &temp);
+			PfIf_end(sc);
+			temp_int.data.i = (pfINT)table->chirpLength;
+			PfIf_lt_start(sc, &local, &temp_int);
+			PfMul(sc, &m, &local, &local, 0);
+			PfMod(sc, &m, &m, &temp_int1);
+			appendLUTGenerationSinCos(sc, &w, &m, &octant, &f, &temp, &x, &x2, &s, &c, table->N, table->sign);
+			PfIf_else(sc);
+			PfSetToZero(sc, &w);
+			PfIf_end(sc);
+		}
+		else {
+			//m = (c * (r * rowStep + colStep) + start) mod N, step is reduced before the multiplication to stay in 64 bits
+			if (table->numRows > 1) {
+				temp_int.data.i = (pfINT)table->rowLength;
+				PfDiv(sc, &row, &local, &temp_int);
+				PfMul(sc, &temp, &row, &temp_int, 0);
+				PfSub(sc, &local, &local, &temp);
+				if ((table->rowStep % table->N) != 1) {
+					temp_int.data.i = (pfINT)(table->rowStep % table->N);
+					PfMul(sc, &row, &row, &temp_int, 0);
+				}
+				if (table->colStep % table->N) {
+					temp_int.data.i = (pfINT)(table->colStep % table->N);
+					PfAdd(sc, &row, &row, &temp_int);
+				}
+				if (((table->rowStep % table->N) * (table->numRows - 1) + (table->colStep % table->N)) >= table->N)
+					PfMod(sc, &row, &row, &temp_int1);
+				PfMul(sc, &m, &local, &row, 0);
+			}
+			else {
+				temp_int.data.i = (pfINT)(table->colStep % table->N);
+				PfMul(sc, &m, &local, &temp_int, 0);
+			}
+			if (table->start % table->N) {
+				temp_int.data.i = (pfINT)(table->start % table->N);
+				PfAdd(sc, &m, &m, &temp_int);
+			}
+			PfMod(sc, &m, &m, &temp_int1);
+			appendLUTGenerationSinCos(sc, &w, &m, &octant, &f, &temp, &x, &x2, &s, &c, table->N, table->sign);
+		}
+		appendRegistersToGlobal(sc, &sc->outputsStruct, &id, &w);
+		PfIf_end(sc);
+		PfIf_end(sc);
+	}
+	appendKernelEnd(sc);
+
+	for (int i = 0; i < 7; i++)
+		PfDeallocateContainer(sc, intRegisters[i]);
+	for (int i = 0; i < 4; i++)
+		PfDeallocateContainer(sc, floatRegisters[i]);
+	PfDeallocateContainer(sc, &w);
+	return sc->res;
+}
+#endif
@@ -299,20 +299,16 @@ static inline void PfAppendNumberLiteral(VkFFTSpecializationConstantsLayout* sc,
 	if (((number->type % 10) == 2) || ((number->type % 10) == 3)) {
 		switch ((number->type % 100) / 10) {
 		case 0:
-			sc->tempLen = sprintf(sc->tempStr, "%s", sc->halfLiteral.name);
-			PfAppendLine(sc);
+			PfAppendString(sc, sc->halfLiteral.name);
 			return;
 		case 1:
-			sc->tempLen = sprintf(sc->tempStr, "%s", sc->floatLiteral.name);
-			PfAppendLine(sc);
+			PfAppendString(sc, sc->floatLiteral.name);
 			return;
 		case 2:
-			sc->tempLen = sprintf(sc->tempStr, "%s", sc->doubleLiteral.name);
-			PfAppendLine(sc);
+			PfAppendString(sc, sc->doubleLiteral.name);
 			return;
 		case 3:
-			sc->tempLen = sprintf(sc->tempStr, "%s", sc->doubleLiteral.name);
-			PfAppendLine(sc);
+			PfAppendString(sc, sc->doubleLiteral.name);
 			return;
 		}
 	}
@@ -331,85 +327,68 @@ static inline void PfAppendConversionStart(VkFFTSpecializationConstantsLayout* s
 		switch ((out->type % 100) / 10) {
 		case 0:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, "float16_t(");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
-			sc->tempLen = sprintf(sc->tempStr, "(half)");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "float16_t(");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, "(half)");
 #elif(VKFFT_BACKEND==5)
-			sc->tempLen = sprintf(sc->tempStr, "half(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "half(");
 #endif
 			return;
 		case 1:
 #if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, "float(");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
-			sc->tempLen = sprintf(sc->tempStr, "(float)");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "float(");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, "(float)");
 #endif
 			return;
 		case 2:
 			switch ((in->type % 100) / 10) {
 			case 0: case 1: case 2:
 #if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==5))
-				sc->tempLen = sprintf(sc->tempStr, "double(");
-				PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
-				sc->tempLen = sprintf(sc->tempStr, "(double)");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "double(");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==6))
+				PfAppendLiteral(sc, "(double)");
 #endif
 				return;
 			case 3:
-				sc->tempLen = sprintf(sc->tempStr, "conv_pf_quad_to_double(");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "conv_pf_quad_to_double(");
 				return;
 			}
 		case 3:
-			sc->tempLen = sprintf(sc->tempStr, "conv_double_to_pf_quad(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "conv_double_to_pf_quad(");
 			return;
 		}
 	case 3:
 		switch ((out->type % 100) / 10) {
 		case 0:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, "f16vec2(");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, "conv_half2(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "f16vec2(");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, "conv_half2(");
 #endif
 			return;
 		case 1:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, "vec2(");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, "conv_float2(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "vec2(");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, "conv_float2(");
 #endif
 			return;
 		case 2:
 			switch ((in->type % 100) / 10) {
 			case 0: case 1: case 2:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, "dvec2(");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, "conv_double2(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "dvec2(");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, "conv_double2(");
 #endif
 			return;
 			case 3:
-				sc->tempLen = sprintf(sc->tempStr, "conv_pf_quad2_to_double2(");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "conv_pf_quad2_to_double2(");
 				return;
 			}
 		case 3:
-			sc->tempLen = sprintf(sc->tempStr, "conv_double2_to_pf_quad2(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "conv_double2_to_pf_quad2(");
 			return;
 		}
 	}
@@ -429,76 +408,63 @@ static inline void PfAppendConversionEnd(VkFFTSpecializationConstantsLayout* sc,
 		switch ((out->type % 100) / 10) {
 		case 0:
 #if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
+			PfAppendLiteral(sc, ")");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==6))
 #endif
 			return;
 		case 1:
 #if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
+			PfAppendLiteral(sc, ")");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==6))
 #endif
 			return;
 		case 2:
 			switch ((in->type % 100) / 10) {
 			case 0: case 1: case 2:
 #if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4))
+			PfAppendLiteral(sc, ")");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==6))
 #endif
 			return;
 			case 3:
-				sc->tempLen = sprintf(sc->tempStr, ")");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, ")");
 				return;
 			}
 		case 3:
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ")");
 			return;
 		}
 	case 3:
 		switch ((out->type % 100) / 10) {
 		case 0:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ")");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, ")");
 #endif
 			return;
 		case 1:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ")");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, ")");
 #endif
 			return;
 		case 2:
 			switch ((in->type % 100) / 10) {
 			case 0: case 1: case 2:
 #if(VKFFT_BACKEND==0)
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
-#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5))
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ")");
+#elif((VKFFT_BACKEND==1)||(VKFFT_BACKEND==2)||(VKFFT_BACKEND==3)||(VKFFT_BACKEND==4)||(VKFFT_BACKEND==5)||(VKFFT_BACKEND==6))
+			PfAppendLiteral(sc, ")");
 #endif
 			return;
 			case 3:
-				sc->tempLen = sprintf(sc->tempStr, ")");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, ")");
 				return;
 			}
 		case 3:
-			sc->tempLen = sprintf(sc->tempStr, ")");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ")");
 			return;
 		}
 	}
@@ -660,16 +626,13 @@ static inline void PfDefineConstant(VkFFTSpecializationConstantsLayout* sc, PfCo
 			break;
 		}
 		if (value->type < 100) {
-			sc->tempLen = sprintf(sc->tempStr, " = ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " = ");
 			switch (value->type % 10) {
 			case 1:
-				sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", value->data.i);
-				PfAppendLine(sc);
+				PfAppendInt(sc, value->data.i);
 				break;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)value->data.d);
-				PfAppendLine(sc);
+				PfAppendFloat(sc, (long double)value->data.d, 17);
 				break;
 			case 3:
 				//fix
@@ -677,8 +640,7 @@ static inline void PfDefineConstant(VkFFTSpecializationConstantsLayout* sc, PfCo
 				break;
 			}
 			PfAppendNumberLiteral(sc, name);
-			sc->tempLen = sprintf(sc->tempStr, ";");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";");
 			return;
 		}
 	}
@@ -701,23 +663,18 @@ static inline void PfSetToZero(VkFFTSpecializationConstantsLayout* sc, PfContain
 	}
 	else{
 		if (out->type > 100) {
-			sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-			PfAppendLine(sc);
-			sc->tempLen = sprintf(sc->tempStr, " = ");
-			PfAppendLine(sc);
+			PfAppendString(sc, out->name);
+			PfAppendLiteral(sc, " = ");
 			switch (out->type % 10) {
 			case 1:
-				sc->tempLen = sprintf(sc->tempStr, "0");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "0");
 				break;
 			case 2: case 3:
-				sc->tempLen = sprintf(sc->tempStr, "0.0");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "0.0");
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 			return;
 		}
 		else {
@@ -848,16 +805,12 @@ static inline void PfMov(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 	if ((out->type % 10) == 3){
 		if ((out->type > 100) && (in->type > 100) && ((out->type % 10) == (in->type % 10))) {
 			//packed instructions workaround if all values are in registers
-			sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-			PfAppendLine(sc);
-			sc->tempLen = sprintf(sc->tempStr, " = ");
-			PfAppendLine(sc);
+			PfAppendString(sc, out->name);
+			PfAppendLiteral(sc, " = ");
 			PfAppendConversionStart(sc, out, in);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in->name);
 			PfAppendConversionEnd(sc, out, in);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 			return;
 		}
 		PfMov(sc, &out->data.c[0], &in->data.c[0]);
@@ -875,43 +828,33 @@ static inline void PfMov(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 	if (out->type > 100) {
 		if ((out->type > 100) && (in->type > 100) && ((out->type % 10) == (in->type % 10))) {
 			//packed instructions workaround if all values are in registers
-			sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-			PfAppendLine(sc);
-			sc->tempLen = sprintf(sc->tempStr, " = ");
-			PfAppendLine(sc);
+			PfAppendString(sc, out->name);
+			PfAppendLiteral(sc, " = ");
 			PfAppendConversionStart(sc, out, in);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in->name);
 			PfAppendConversionEnd(sc, out, in);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 			return;
 		}
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		PfAppendConversionStart(sc, out, in);
 		if (in->type > 100) {
-			sc->tempLen = sprintf(sc->tempStr, "%s", in->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in->name);
 		}
 		else {
 			switch (in->type % 10) {
 			case 1:
-				sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in->data.i);
-				PfAppendLine(sc);
+				PfAppendInt(sc, in->data.i);
 				break;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in->data.d);
-				PfAppendLine(sc);
+				PfAppendFloat(sc, (long double) in->data.d, 17);
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
 		}
 		PfAppendConversionEnd(sc, out, in);
-		sc->tempLen = sprintf(sc->tempStr, ";\n");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ";\n");
 		return;
 	}
 	else {
@@ -961,10 +904,8 @@ static inline void PfMovNeg(VkFFTSpecializationConstantsLayout* sc, PfContainer*
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		PfAppendConversionStart(sc, out, in);
 		if (in->type > 100) {
 			sc->tempLen = sprintf(sc->tempStr, "-%s", in->name);
@@ -973,19 +914,16 @@ static inline void PfMovNeg(VkFFTSpecializationConstantsLayout* sc, PfContainer*
 		else {
 			switch (in->type % 10) {
 			case 1:
-				sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", -in->data.i);
-				PfAppendLine(sc);
+				PfAppendInt(sc, -in->data.i);
 				break;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (-in->data.d));
-				PfAppendLine(sc);
+				PfAppendFloat(sc, (long double) (-in->data.d), 17);
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
 		}
 		PfAppendConversionEnd(sc, out, in);
-		sc->tempLen = sprintf(sc->tempStr, ";\n");
-		PfAppendLine(sc);
+		PfAppendLiteral(sc, ";\n");
 		return;
 	}
 	else {
@@ -1091,22 +1029,16 @@ static inline void PfAdd(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 #if(VKFFT_BACKEND == 2)
 		if ((in_1->type > 100) && (in_2->type > 100) && (((out->type % 100) / 10) != 3)) {
 			//packed instructions workaround if all values are in registers
-			sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-			PfAppendLine(sc);
-			sc->tempLen = sprintf(sc->tempStr, " = ");
-			PfAppendLine(sc);
+			PfAppendString(sc, out->name);
+			PfAppendLiteral(sc, " = ");
 			PfAppendConversionStart(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in_1->name);
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " + ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " + ");
 			PfAppendConversionStart(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in_2->name);
 			PfAppendConversionEnd(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 			return;
 		}
 #endif
@@ -1133,84 +1065,69 @@ static inline void PfAdd(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		if ((in_1->type < 100) && (in_2->type < 100)) {
 			switch (in_1->type % 10) {
 			case 1: 
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i + in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i + in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i + in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)((pfLD)in_1->data.i + in_2->data.d), 17);
 					break;
 				}
 				break;
 			case 2:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d + (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d + (pfLD)in_2->data.i), 17);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d + in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d + in_2->data.d), 17);
 					break;
 				}
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else {
 			PfAppendConversionStart(sc, out, in_1);
 			if (in_1->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 			}
 			else {
 				switch (in_1->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_1->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_1->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " + ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " + ");
 			PfAppendConversionStart(sc, out, in_2);
 			if (in_2->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 			}
 			else {
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_2->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_2->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		return;
 	}
@@ -1369,22 +1286,16 @@ static inline void PfSub(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 #if(VKFFT_BACKEND == 2)
 		if ((in_1->type > 100) && (in_2->type > 100) && (((out->type % 100) / 10) != 3)) {
 			//packed instructions workaround if all values are in registers
-			sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-			PfAppendLine(sc);
-			sc->tempLen = sprintf(sc->tempStr, " = ");
-			PfAppendLine(sc);
+			PfAppendString(sc, out->name);
+			PfAppendLiteral(sc, " = ");
 			PfAppendConversionStart(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in_1->name);
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " - ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " - ");
 			PfAppendConversionStart(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in_2->name);
 			PfAppendConversionEnd(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 			return;
 		}
 #endif
@@ -1411,84 +1322,69 @@ static inline void PfSub(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		if ((in_1->type < 100) && (in_2->type < 100)) {
 			switch (in_1->type % 10) {
 			case 1:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i - in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i - in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i - in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)((pfLD)in_1->data.i - in_2->data.d), 17);
 					break;
 				}
 				break;
 			case 2:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d - (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d - (pfLD)in_2->data.i), 17);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d - in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d - in_2->data.d), 17);
 					break;
 				}
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else {
 			PfAppendConversionStart(sc, out, in_1);
 			if (in_1->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 			}
 			else {
 				switch (in_1->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_1->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_1->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " - ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " - ");
 			PfAppendConversionStart(sc, out, in_2);
 			if (in_2->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 			}
 			else {
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_2->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_2->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		return;
 	}
@@ -1750,28 +1646,20 @@ static inline void PfFMA(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 			
 			//packed instructions workaround if all values are in registers
 			if (((in_1->type % 10) != 3) || ((in_2->type % 10) != 3)) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-				PfAppendLine(sc);
-				sc->tempLen = sprintf(sc->tempStr, " = ");
-				PfAppendLine(sc);
+				PfAppendString(sc, out->name);
+				PfAppendLiteral(sc, " = ");
 				PfAppendConversionStart(sc, out, in_1);
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 				PfAppendConversionEnd(sc, out, in_1);
-				sc->tempLen = sprintf(sc->tempStr, " * ");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, " * ");
 				PfAppendConversionStart(sc, out, in_2);
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 				PfAppendConversionEnd(sc, out, in_2);
-				sc->tempLen = sprintf(sc->tempStr, " + ");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, " + ");
 				PfAppendConversionStart(sc, out, in_1);
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_3->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_3->name);
 				PfAppendConversionEnd(sc, out, in_1);
-				sc->tempLen = sprintf(sc->tempStr, ";\n");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, ";\n");
 				return;
 			}
 		}
@@ -1826,10 +1714,8 @@ static inline void PfFMA(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		if ((in_1->type < 100) && (in_2->type < 100) && (in_3->type < 100)) {
 			switch (in_1->type % 10) {
 			case 1:
@@ -1837,24 +1723,20 @@ static inline void PfFMA(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 				case 1:
 					switch (in_3->type % 10) {
 					case 1:
-						sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i * in_2->data.i + in_3->data.i);
-						PfAppendLine(sc);
+						PfAppendInt(sc, in_1->data.i * in_2->data.i + in_3->data.i);
 						break;
 					case 2:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)(in_1->data.i * in_2->data.i) + in_3->data.d));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double)((pfLD)(in_1->data.i * in_2->data.i) + in_3->data.d), 17);
 						break;
 					}
 					break;
 				case 2:
 					switch (in_3->type % 10) {
 					case 1:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i * in_2->data.d + (pfLD)in_3->data.i));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double)((pfLD)in_1->data.i * in_2->data.d + (pfLD)in_3->data.i), 17);
 						break;
 					case 2:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i * in_2->data.d + in_3->data.d));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double)((pfLD)in_1->data.i * in_2->data.d + in_3->data.d), 17);
 						break;
 					}
 					break;
@@ -1865,24 +1747,20 @@ static inline void PfFMA(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 				case 1:
 					switch (in_3->type % 10) {
 					case 1:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * (pfLD)in_2->data.i + (pfLD)in_3->data.i));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.d * (pfLD)in_2->data.i + (pfLD)in_3->data.i), 17);
 						break;
 					case 2:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * in_2->data.i + in_3->data.d));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.d * in_2->data.i + in_3->data.d), 17);
 						break;
 					}
 					break;
 				case 2:
 					switch (in_3->type % 10) {
 					case 1:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * in_2->data.d + (pfLD)in_3->data.i));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.d * in_2->data.d + (pfLD)in_3->data.i), 17);
 						break;
 					case 2:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * in_2->data.d + in_3->data.d));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.d * in_2->data.d + in_3->data.d), 17);
 						break;
 					}
 					break;
@@ -1893,24 +1771,20 @@ static inline void PfFMA(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 				case 1:
 					switch (in_3->type % 10) {
 					case 1:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.c[0].data.d * (pfLD)in_2->data.i + (pfLD)in_3->data.i));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.c[0].data.d * (pfLD)in_2->data.i + (pfLD)in_3->data.i), 17);
 						break;
 					case 2:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.c[0].data.d * in_2->data.i + in_3->data.d));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.c[0].data.d * in_2->data.i + in_3->data.d), 17);
 						break;
 					}
 					break;
 				case 2:
 					switch (in_3->type % 10) {
 					case 1:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.c[0].data.d * in_2->data.d + (pfLD)in_3->data.i));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.c[0].data.d * in_2->data.d + (pfLD)in_3->data.i), 17);
 						break;
 					case 2:
-						sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.c[0].data.d * in_2->data.d + in_3->data.d));
-						PfAppendLine(sc);
+						PfAppendFloat(sc, (long double) (in_1->data.c[0].data.d * in_2->data.d + in_3->data.d), 17);
 						break;
 					}
 					break;
@@ -1918,112 +1792,91 @@ static inline void PfFMA(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else if ((in_1->type < 100) && (in_2->type < 100) && (in_3->type > 100)) {
 			switch (in_1->type % 10) {
 			case 1:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i * in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i * in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i * in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)((pfLD)in_1->data.i * in_2->data.d), 17);
 					break;
 				}
 				break;
 			case 2:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d * (pfLD)in_2->data.i), 17);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d * in_2->data.d), 17);
 					break;
 				}
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, " + ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " + ");
 			PfAppendConversionStart(sc, out, in_3);
-			sc->tempLen = sprintf(sc->tempStr, "%s", in_3->name);
-			PfAppendLine(sc);
+			PfAppendString(sc, in_3->name);
 			PfAppendConversionEnd(sc, out, in_3);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else {
-			sc->tempLen = sprintf(sc->tempStr, "fma(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "fma(");
 			PfAppendConversionStart(sc, out, in_1);
 			if (in_1->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 			}
 			else {
 				switch (in_1->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_1->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_1->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, ", ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ", ");
 			PfAppendConversionStart(sc, out, in_2);
 			if (in_2->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 			}
 			else {
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_2->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_2->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, ", ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ", ");
 			PfAppendConversionStart(sc, out, in_3);
 			if (in_3->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_3->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_3->name);
 			}
 			else {
 				switch (in_3->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_3->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_3->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_3->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_3->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_3);
-			sc->tempLen = sprintf(sc->tempStr, ");\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ");\n");
 		}
 		return;
 	}
@@ -2204,22 +2057,16 @@ static inline void PfMul(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 		if ((in_1->type > 100) && (in_2->type > 100) && (((out->type % 100) / 10) != 3)) {
 			//packed instructions workaround if all values are in registers
 			if (((in_1->type % 10) != 3) || ((in_2->type % 10) != 3)) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-				PfAppendLine(sc);
-				sc->tempLen = sprintf(sc->tempStr, " = ");
-				PfAppendLine(sc);
+				PfAppendString(sc, out->name);
+				PfAppendLiteral(sc, " = ");
 				PfAppendConversionStart(sc, out, in_1);
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 				PfAppendConversionEnd(sc, out, in_1);
-				sc->tempLen = sprintf(sc->tempStr, " * ");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, " * ");
 				PfAppendConversionStart(sc, out, in_2);
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 				PfAppendConversionEnd(sc, out, in_2);
-				sc->tempLen = sprintf(sc->tempStr, ";\n");
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, ";\n");
 				return;
 			}
 			else {
@@ -2227,68 +2074,40 @@ static inline void PfMul(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 					if ((strcmp(out->name, in_1->name)) && (strcmp(out->name, in_2->name))) {
 						PfMovNeg(sc, &out->data.c[0], &in_1->data.c[1]);
 						PfMov(sc, &out->data.c[1], &in_1->data.c[0]);
-						sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " = ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " * ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", in_2->data.c[1].name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, ";\n");
-						PfAppendLine(sc);
+						PfAppendString(sc, out->name);
+						PfAppendLiteral(sc, " = ");
+						PfAppendString(sc, out->name);
+						PfAppendLiteral(sc, " * ");
+						PfAppendString(sc, in_2->data.c[1].name);
+						PfAppendLiteral(sc, ";\n");
 						
-						sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " = ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " * ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", in_2->data.c[0].name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " + ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, ";\n");
-						PfAppendLine(sc);
+						PfAppendString(sc, out->name);
+						PfAppendLiteral(sc, " = ");
+						PfAppendString(sc, in_1->name);
+						PfAppendLiteral(sc, " * ");
+						PfAppendString(sc, in_2->data.c[0].name);
+						PfAppendLiteral(sc, " + ");
+						PfAppendString(sc, out->name);
+						PfAppendLiteral(sc, ";\n");
 					}
 					else {
 						PfMovNeg(sc, &temp->data.c[0], &in_1->data.c[1]);
 						PfMov(sc, &temp->data.c[1], &in_1->data.c[0]);
-						sc->tempLen = sprintf(sc->tempStr, "%s", temp->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " = ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", temp->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " * ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", in_2->data.c[1].name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, ";\n");
-						PfAppendLine(sc);
-
-						sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " = ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " * ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", in_2->data.c[0].name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, " + ");
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, "%s", temp->name);
-						PfAppendLine(sc);
-						sc->tempLen = sprintf(sc->tempStr, ";\n");
-						PfAppendLine(sc);
+						PfAppendString(sc, temp->name);
+						PfAppendLiteral(sc, " = ");
+						PfAppendString(sc, temp->name);
+						PfAppendLiteral(sc, " * ");
+						PfAppendString(sc, in_2->data.c[1].name);
+						PfAppendLiteral(sc, ";\n");
+
+						PfAppendString(sc, out->name);
+						PfAppendLiteral(sc, " = ");
+						PfAppendString(sc, in_1->name);
+						PfAppendLiteral(sc, " * ");
+						PfAppendString(sc, in_2->data.c[0].name);
+						PfAppendLiteral(sc, " + ");
+						PfAppendString(sc, temp->name);
+						PfAppendLiteral(sc, ";\n");
 					}
 					return;
 				}
@@ -2344,84 +2163,69 @@ static inline void PfMul(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		if ((in_1->type < 100) && (in_2->type < 100)) {
 			switch (in_1->type % 10) {
 			case 1:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i * in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i * in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i * in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)((pfLD)in_1->data.i * in_2->data.d), 17);
 					break;
 				}
 				break;
 			case 2:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d * (pfLD)in_2->data.i), 17);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d * in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d * in_2->data.d), 17);
 					break;
 				}
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else {
 			PfAppendConversionStart(sc, out, in_1);
 			if (in_1->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 			}
 			else {
 				switch (in_1->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_1->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_1->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " * ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " * ");
 			PfAppendConversionStart(sc, out, in_2);
 			if (in_2->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 			}
 			else {
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_2->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_2->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_2);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 
 		return;
@@ -2561,77 +2365,63 @@ static inline void PfDiv(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		if ((in_1->type < 100) && (in_2->type < 100)) {
 			switch (in_1->type % 10) {
 			case 1:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i / in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i / in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)((pfLD)in_1->data.i / in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)((pfLD)in_1->data.i / in_2->data.d), 17);
 					break;
 				}
 				break;
 			case 2:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d / (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d / (pfLD)in_2->data.i), 17);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) (in_1->data.d / in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) (in_1->data.d / in_2->data.d), 17);
 					break;
 				}
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else {
 			PfAppendConversionStart(sc, out, in_1);
 			if (in_1->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 			}
 			else {
 				switch (in_1->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_1->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_1->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " / ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " / ");
 			PfAppendConversionStart(sc, out, in_2);
 			if (in_2->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 			}
 			else {
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_2->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_2->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
@@ -2640,8 +2430,7 @@ static inline void PfDiv(VkFFTSpecializationConstantsLayout* sc, PfContainer* ou
 			if (((in_1->type % 10) == 3) && ((in_2->type % 10) == 3)) {
 				sc->res = VKFFT_ERROR_MATH_FAILED;
 			}
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		return;
 	}
@@ -2737,79 +2526,64 @@ static inline void PfDivCeil(VkFFTSpecializationConstantsLayout* sc, PfContainer
 		return;
 	}
 	if (out->type > 100) {
-		sc->tempLen = sprintf(sc->tempStr, "%s", out->name);
-		PfAppendLine(sc);
-		sc->tempLen = sprintf(sc->tempStr, " = ");
-		PfAppendLine(sc);
+		PfAppendString(sc, out->name);
+		PfAppendLiteral(sc, " = ");
 		if ((in_1->type < 100) && (in_2->type < 100)) {
 			switch (in_1->type % 10) {
 			case 1:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", (pfINT)pfceil(in_1->data.i / (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendInt(sc, (pfINT)pfceil(in_1->data.i / (pfLD)in_2->data.i));
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)pfceil((pfLD)in_1->data.i / in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)pfceil((pfLD)in_1->data.i / in_2->data.d), 17);
 					break;
 				}
 				break;
 			case 2:
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)pfceil(in_1->data.d / (pfLD)in_2->data.i));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)pfceil(in_1->data.d / (pfLD)in_2->data.i), 17);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double)pfceil(in_1->data.d / in_2->data.d));
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double)pfceil(in_1->data.d / in_2->data.d), 17);
 					break;
 				}
 				break;
 			}
 			PfAppendNumberLiteral(sc, out);
-			sc->tempLen = sprintf(sc->tempStr, ";\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ";\n");
 		}
 		else {
-			sc->tempLen = sprintf(sc->tempStr, "ceil(");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, "ceil(");
 			PfAppendConversionStart(sc, out, in_1);
 			if (in_1->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_1->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_1->name);
 			}
 			else {
 				switch (in_1->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_1->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_1->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_1->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_1->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
 			}
 			PfAppendConversionEnd(sc, out, in_1);
-			sc->tempLen = sprintf(sc->tempStr, " / ");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, " / ");
 			PfAppendConversionStart(sc, out, in_2);
 			if (in_2->type > 100) {
-				sc->tempLen = sprintf(sc->tempStr, "%s", in_2->name);
-				PfAppendLine(sc);
+				PfAppendString(sc, in_2->name);
 			}
 			else {
 				switch (in_2->type % 10) {
 				case 1:
-					sc->tempLen = sprintf(sc->tempStr, "%" PRIi64 "", in_2->data.i);
-					PfAppendLine(sc);
+					PfAppendInt(sc, in_2->data.i);
 					break;
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "%.17Le", (long double) in_2->data.d);
-					PfAppendLine(sc);
+					PfAppendFloat(sc, (long double) in_2->data.d, 17);
 					break;
 				}
 				PfAppendNumberLiteral(sc, out);
@@ -2818,8 +2592,7 @@ static inline void PfDivCeil(VkFFTSpecializationConstantsLayout* sc, PfContainer
 			if (((in_1->type % 10) == 3) && ((in_2->type % 10) == 3)) {
 				sc->res = VKFFT_ERROR_MATH_FAILED;
 			}
-			sc->tempLen = sprintf(sc->tempStr, ");\n");
-			PfAppendLine(sc);
+			PfAppendLiteral(sc, ");\n");
 		}
 		return;
 	}
@@ -3284,7 +3057,7 @@ __sincosf(%s, &%s.y, &%s.x);\n", in_1->name, out->name, out->name);
 						sc->tempLen = sprintf(sc->tempStr, "\
 %s.y = native_sin(%s);\n", out->name, in_1->name);
 						PfAppendLine(sc);
-#elif (VKFFT_BACKEND == 5)
+#elif ((VKFFT_BACKEND == 5) || (VKFFT_BACKEND == 6))
 						sc->tempLen = sprintf(sc->tempStr, "\
 %s.x = cos(%s);\n", out->name, in_1->name);
 						PfAppendLine(sc);
@@ -3306,6 +3079,13 @@ sincos(%s, &%s.y, &%s.x);\n", in_1->name, out->name, out->name);
 						sc->tempLen = sprintf(sc->tempStr, "\
 %s.y = sincos(%s, &%s.x);\n", out->name, in_1->name, out->name);
 						PfAppendLine(sc);
+#elif (VKFFT_BACKEND == 6)
+						sc->tempLen = sprintf(sc->tempStr, "\
+%s.x = cos(%s);\n", out->name, in_1->name);
+						PfAppendLine(sc);
+						sc->tempLen = sprintf(sc->tempStr, "\
+%s.y = sin(%s);\n", out->name, in_1->name);
+						PfAppendLine(sc);
 #endif
 						return;
 					}
@@ -3314,12 +3094,14 @@ sincos(%s, &%s.y, &%s.x);\n", in_1->name, out->name, out->name);
 			else {
 				switch (in_1->type % 10) {
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "\
-%s.x = %.17Le;\n", out->name, (long double)pfcos(in_1->data.d));
-					PfAppendLine(sc);
-					sc->tempLen = sprintf(sc->tempStr, "\
-%s.y = %.17Le;\n", out->name, (long double)pfsin(in_1->data.d));
-					PfAppendLine(sc);
+					PfAppendString(sc, out->name);
+					PfAppendLiteral(sc, ".x = ");
+					PfAppendFloat(sc, (long double)pfcos(in_1->data.d), 17);
+					PfAppendLiteral(sc, ";\n");
+					PfAppendString(sc, out->name);
+					PfAppendLiteral(sc, ".y = ");
+					PfAppendFloat(sc, (long double)pfsin(in_1->data.d), 17);
+					PfAppendLiteral(sc, ";\n");
 					return;
 				}
 			}
@@ -3361,9 +3143,10 @@ static inline void PfNorm(VkFFTSpecializationConstantsLayout* sc, PfContainer* o
 			else {
 				switch (in_1->type % 10) {
 				case 3:
-					sc->tempLen = sprintf(sc->tempStr, "\
-%s = %.17Le;\n", out->name, (long double)(in_1->data.c[0].data.d * in_1->data.c[0].data.d + in_1->data.c[1].data.d * in_1->data.c[1].data.d));
-					PfAppendLine(sc);
+					PfAppendString(sc, out->name);
+					PfAppendLiteral(sc, " = ");
+					PfAppendFloat(sc, (long double)(in_1->data.c[0].data.d * in_1->data.c[0].data.d + in_1->data.c[1].data.d * in_1->data.c[1].data.d), 17);
+					PfAppendLiteral(sc, ";\n");
 					return;
 				}
 			}
@@ -3410,9 +3193,10 @@ static inline void PfRsqrt(VkFFTSpecializationConstantsLayout* sc, PfContainer*
 			else {
 				switch (in_1->type % 10) {
 				case 2:
-					sc->tempLen = sprintf(sc->tempStr, "\
-%s = %.17Le;\n", out->name, (long double)(pfFPinit("1.0") / pfsqrt(in_1->data.d)));
-					PfAppendLine(sc);
+					PfAppendString(sc, out->name);
+					PfAppendLiteral(sc, " = ");
+					PfAppendFloat(sc, (long double)(pfFPinit("1.0") / pfsqrt(in_1->data.d)), 17);
+					PfAppendLiteral(sc, ";\n");
 					return;
 				}
 			}
@@ -3479,9 +3263,11 @@ if (%s == %" PRIi64 ") {\n", left->name, right->data.i);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%s == %.17Le) {\n", left->name, (long double)right->data.d);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendString(sc, left->name);
+				PfAppendLiteral(sc, " == ");
+				PfAppendFloat(sc, (long double)right->data.d, 17);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3495,9 +3281,11 @@ if (%" PRIi64 " == %s) {\n", left->data.i, right->name);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%.17Le == %s) {\n", (long double)left->data.d, right->name);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendFloat(sc, (long double)left->data.d, 17);
+				PfAppendLiteral(sc, " == ");
+				PfAppendString(sc, right->name);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3554,9 +3342,11 @@ if (%s != %" PRIi64 ") {\n", left->name, right->data.i);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%s != %.17Le) {\n", left->name, (long double)right->data.d);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendString(sc, left->name);
+				PfAppendLiteral(sc, " != ");
+				PfAppendFloat(sc, (long double)right->data.d, 17);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3570,9 +3360,11 @@ if (%" PRIi64 " != %s) {\n", left->data.i, right->name);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%.17Le != %s) {\n", (long double)left->data.d, right->name);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendFloat(sc, (long double)left->data.d, 17);
+				PfAppendLiteral(sc, " != ");
+				PfAppendString(sc, right->name);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3630,9 +3422,11 @@ if (%s < %" PRIi64 ") {\n", left->name, right->data.i);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%s < %.17Le) {\n", left->name, (long double)right->data.d);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendString(sc, left->name);
+				PfAppendLiteral(sc, " < ");
+				PfAppendFloat(sc, (long double)right->data.d, 17);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3646,9 +3440,11 @@ if (%" PRIi64 " < %s) {\n", left->data.i, right->name);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%.17Le < %s) {\n", (long double)left->data.d, right->name);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendFloat(sc, (long double)left->data.d, 17);
+				PfAppendLiteral(sc, " < ");
+				PfAppendString(sc, right->name);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3706,9 +3502,11 @@ if (%s <= %" PRIi64 ") {\n", left->name, right->data.i);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%s <= %.17Le) {\n", left->name, (long double)right->data.d);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendString(sc, left->name);
+				PfAppendLiteral(sc, " <= ");
+				PfAppendFloat(sc, (long double)right->data.d, 17);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3722,9 +3520,11 @@ if (%" PRIi64 " <= %s) {\n", left->data.i, right->name);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%.17Le <= %s) {\n", (long double)left->data.d, right->name);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendFloat(sc, (long double)left->data.d, 17);
+				PfAppendLiteral(sc, " <= ");
+				PfAppendString(sc, right->name);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3783,9 +3583,11 @@ if (%s > %" PRIi64 ") {\n", left->name, right->data.i);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%s > %.17Le) {\n", left->name, (long double)right->data.d);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendString(sc, left->name);
+				PfAppendLiteral(sc, " > ");
+				PfAppendFloat(sc, (long double)right->data.d, 17);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3799,9 +3601,11 @@ if (%" PRIi64 " > %s) {\n", left->data.i, right->name);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%.17Le > %s) {\n", (long double)left->data.d, right->name);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendFloat(sc, (long double)left->data.d, 17);
+				PfAppendLiteral(sc, " > ");
+				PfAppendString(sc, right->name);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3859,9 +3663,11 @@ if (%s >= %" PRIi64 ") {\n", left->name, right->data.i);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%s >= %.17Le) {\n", left->name, (long double)right->data.d);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendString(sc, left->name);
+				PfAppendLiteral(sc, " >= ");
+				PfAppendFloat(sc, (long double)right->data.d, 17);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -3875,9 +3681,11 @@ if (%" PRIi64 " >= %s) {\n", left->data.i, right->name);
 				PfAppendLine(sc);
 				return;
 			case 2:
-				sc->tempLen = sprintf(sc->tempStr, "\
-if (%.17Le >= %s) {\n", (long double)left->data.d, right->name);
-				PfAppendLine(sc);
+				PfAppendLiteral(sc, "if (");
+				PfAppendFloat(sc, (long double)left->data.d, 17);
+				PfAppendLiteral(sc, " >= ");
+				PfAppendString(sc, right->name);
+				PfAppendLiteral(sc, ") {\n");
 				return;
 			}
 		}
@@ -22,12 +22,91 @@
 #ifndef VKFFT_STRINGMANAGER_H
 #define VKFFT_STRINGMANAGER_H
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+// code0 is a growable buffer of maxCodeLength chars. Appends memcpy strings of known length and double the buffer when it is full,
+// so only the tempStr scratch buffer used for formatted lines has a fixed size.
+static inline void PfReserveCode(VkFFTSpecializationConstantsLayout* sc, pfINT length) {
+	if (sc->currentLen + length + 1 <= sc->maxCodeLength) return;
+	pfINT newLength = (sc->maxCodeLength > 0) ? sc->maxCodeLength : 4096;
+	while (sc->currentLen + length + 1 > newLength) newLength *= 2;
+	char* newCode = (char*)realloc(sc->code0, newLength);
+	if (!newCode) {
+		sc->res = VKFFT_ERROR_MALLOC_FAILED;
+		return;
+	}
+	sc->code0 = newCode;
+	sc->maxCodeLength = newLength;
+	return;
+}
+static inline void PfAppendStringLength(VkFFTSpecializationConstantsLayout* sc, const char* str, pfINT length) {
+	if (sc->res != VKFFT_SUCCESS) return;
+	PfReserveCode(sc, length);
+	if (sc->res != VKFFT_SUCCESS) return;
+	memcpy(sc->code0 + sc->currentLen, str, length);
+	sc->currentLen += length;
+	sc->code0[sc->currentLen] = 0;
+	return;
+}
+static inline void PfAppendString(VkFFTSpecializationConstantsLayout* sc, const char* str) {
+	if (sc->res != VKFFT_SUCCESS) return;
+	if (!str) {
+		sc->res = VKFFT_ERROR_NULL_TEMP_PASSED;
+		return;
+	}
+	PfAppendStringLength(sc, str, (pfINT)strlen(str));
+	return;
+}
+//appends string literal without going through tempStr
+#define PfAppendLiteral(sc, str) PfAppendStringLength(sc, str, (pfINT)(sizeof(str) - 1))
+static inline void PfAppendInt(VkFFTSpecializationConstantsLayout* sc, pfINT value) {
+	if (sc->res != VKFFT_SUCCESS) return;
+	//locale-independent replacement of sprintf("%" PRIi64)
+	char buffer[24];
+	int pos = 24;
+	pfUINT absValue = (value < 0) ? (pfUINT)0 - (pfUINT)value : (pfUINT)value;
+	do {
+		pos--;
+		buffer[pos] = (char)('0' + (absValue % 10));
+		absValue /= 10;
+	} while (absValue);
+	if (value < 0) {
+		pos--;
+		buffer[pos] = '-';
+	}
+	PfAppendStringLength(sc, buffer + pos, 24 - pos);
+	return;
+}
+static inline void PfAppendFloat(VkFFTSpecializationConstantsLayout* sc, long double value, int precision) {
+	if (sc->res != VKFFT_SUCCESS) return;
+	//locale-independent replacement of sprintf("%.*Le"). Digits are produced by the C library, the decimal separator is replaced with a point
+	char buffer[64];
+	int length = snprintf(buffer, 64, "%.*Le", precision, value);
+	if ((length < 0) || (length >= 64)) {
+		sc->res = VKFFT_ERROR_INSUFFICIENT_TEMP_BUFFER;
+		return;
+	}
+	//%e places the decimal separator right after the first digit, so it is found without querying the locale
+	int pos = (buffer[0] == '-') ? 1 : 0;
+	if ((buffer[pos] >= '0') && (buffer[pos] <= '9')) {
+		pos++;
+		int separatorEnd = pos;
+		while (buffer[separatorEnd] && ((buffer[separatorEnd] < '0') || (buffer[separatorEnd] > '9')) && (buffer[separatorEnd] != 'e')) separatorEnd++;
+		if ((separatorEnd > pos + 1) || ((separatorEnd == pos + 1) && (buffer[pos] != '.'))) {
+			buffer[pos] = '.';
+			memmove(buffer + pos + 1, buffer + separatorEnd, length - separatorEnd + 1);
+			length -= separatorEnd - pos - 1;
+		}
+	}
+	PfAppendStringLength(sc, buffer, length);
+	return;
+}
 static inline void PfAppendLine(VkFFTSpecializationConstantsLayout* sc) {
 	if (sc->res != VKFFT_SUCCESS) return;
 	//appends code line stored in tempStr to generated code
-	if (sc->tempLen < 0) sc->res = VKFFT_ERROR_INSUFFICIENT_TEMP_BUFFER;
-	if (sc->currentLen + sc->tempLen > sc->maxCodeLength) sc->res = VKFFT_ERROR_INSUFFICIENT_CODE_BUFFER;
-	sc->currentLen += sprintf(sc->code0 + sc->currentLen, "%s", sc->tempStr);
+	if ((sc->tempLen < 0) || (sc->tempLen >= sc->maxTempLength)) {
+		sc->res = VKFFT_ERROR_INSUFFICIENT_TEMP_BUFFER;
+		return;
+	}
+	PfAppendStringLength(sc, sc->tempStr, sc->tempLen);
 	return;
 };
-#endif
\ No newline at end of file
+#endif
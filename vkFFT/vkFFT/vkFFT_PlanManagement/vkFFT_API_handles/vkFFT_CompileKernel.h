@@ -22,8 +22,13 @@
 #ifndef VKFFT_COMPILEKERNEL_H
 #define VKFFT_COMPILEKERNEL_H
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_KernelCache.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_KernelReuse.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_ApplicationString.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CPURuntime.h"
 
 static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis* axis) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
 #if(VKFFT_BACKEND==0)
 	VkResult res = VK_SUCCESS;
 #elif(VKFFT_BACKEND==1)
@@ -37,21 +42,39 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 #elif(VKFFT_BACKEND==5)
 #endif
 	char* code0 = axis->specializationConstants.code0;
+	VkFFT_GetKernelReuseKey(axis, code0);
+	if (app->previousApplication) {
+		pfUINT kernelBorrowed = 0;
+		resFFT = VkFFT_BorrowKernel(app, axis, &kernelBorrowed);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+		if (kernelBorrowed) return resFFT;
+	}
 #if(VKFFT_BACKEND==0)
-	uint32_t* code;
-	pfUINT codeSize;
+	uint32_t* code = 0;
+	pfUINT codeSize = 0;
+	if ((!app->configuration.loadApplicationFromString) && (app->configuration.kernelCacheDirectory)) {
+		resFFT = VkFFT_LoadKernelFromCache(app, code0, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+	}
 	if (app->configuration.loadApplicationFromString) {
-		char* localStrPointer = (char*)app->configuration.loadApplicationString + app->currentApplicationStringPos;
-		memcpy(&codeSize, localStrPointer, sizeof(pfUINT));
-		code = (uint32_t*)malloc(codeSize);
-		if (!code) {
+		resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
-		memcpy(code, localStrPointer + sizeof(pfUINT), codeSize);
-		app->currentApplicationStringPos += codeSize + sizeof(pfUINT);
+	}
+	else if (code) {
+		axis->binarySize = codeSize;
+		axis->binary = code;
 	}
 	else
 	{
@@ -188,7 +211,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			glslang_shader_delete(shader);
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_SHADER_PREPROCESS;
 
 		}
@@ -201,7 +223,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			glslang_shader_delete(shader);
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_SHADER_PARSE;
 
 		}
@@ -216,7 +237,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			glslang_program_delete(program);
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_SHADER_LINK;
 
 		}
@@ -230,7 +250,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			glslang_program_delete(program);
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_SPIRV_GENERATE;
 		}
 
@@ -243,12 +262,22 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			free(code0);
 			code0 = 0;
 			glslang_program_delete(program);
-			deleteVkFFT(app);
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 		axis->binary = code;
 		memcpy(code, tempCode, codeSize);
 		glslang_program_delete(program);
+		if (app->configuration.kernelCacheDirectory) {
+			resFFT = VkFFT_SaveKernelToCache(app, code0, code, codeSize);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(code);
+				code = 0;
+				axis->binary = 0;
+				free(code0);
+				code0 = 0;
+				return resFFT;
+			}
+		}
 	}
 	VkPipelineShaderStageCreateInfo pipelineShaderStageCreateInfo = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
 	VkComputePipelineCreateInfo computePipelineCreateInfo = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
@@ -260,7 +289,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 	if (res != VK_SUCCESS) {
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_CREATE_SHADER_MODULE;
 	}
 	VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
@@ -276,7 +304,8 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 	}
 	res = vkCreatePipelineLayout(app->configuration.device[0], &pipelineLayoutCreateInfo, 0, &axis->pipelineLayout);
 	if (res != VK_SUCCESS) {
-		deleteVkFFT(app);
+		free(code0);
+		code0 = 0;
 		return VKFFT_ERROR_FAILED_TO_CREATE_PIPELINE_LAYOUT;
 	}
 	pipelineShaderStageCreateInfo.pName = "main";
@@ -288,7 +317,8 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 	else
 		res = vkCreateComputePipelines(app->configuration.device[0], 0, 1, &computePipelineCreateInfo, 0, &axis->pipeline);
 	if (res != VK_SUCCESS) {
-		deleteVkFFT(app);
+		free(code0);
+		code0 = 0;
 		return VKFFT_ERROR_FAILED_TO_CREATE_PIPELINE;
 	}
 	vkDestroyShaderModule(app->configuration.device[0], pipelineShaderStageCreateInfo.module, 0);
@@ -297,20 +327,27 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		code = 0;
 	}
 #elif(VKFFT_BACKEND==1)
-	char* code;
-	pfUINT codeSize;
+	char* code = 0;
+	pfUINT codeSize = 0;
+	if ((!app->configuration.loadApplicationFromString) && (app->configuration.kernelCacheDirectory)) {
+		resFFT = VkFFT_LoadKernelFromCache(app, code0, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+	}
 	if (app->configuration.loadApplicationFromString) {
-		char* localStrPointer = (char*)app->configuration.loadApplicationString + app->currentApplicationStringPos;
-		memcpy(&codeSize, localStrPointer, sizeof(pfUINT));
-		code = (char*)malloc(codeSize);
-		if (!code) {
+		resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
-		memcpy(code, localStrPointer + sizeof(pfUINT), codeSize);
-		app->currentApplicationStringPos += codeSize + sizeof(pfUINT);
+	}
+	else if (code) {
+		axis->binarySize = codeSize;
+		axis->binary = code;
 	}
 	else {
 		nvrtcProgram prog;
@@ -326,7 +363,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("nvrtcCreateProgram error: %s\n", nvrtcGetErrorString(result));
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
 		}
 		int numOpts = 1;
@@ -335,7 +371,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (!opts[0]) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 #if (CUDA_VERSION >= 11030)
@@ -348,7 +383,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			if (!opts[1]) {
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
 			}
 			numOpts++;
@@ -370,7 +404,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			if (!log) {
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 			}
 			else {
@@ -381,7 +414,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 				printf("%s\n", code0);
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 			}
 		}
@@ -398,7 +430,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 #endif
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_GET_CODE_SIZE;
 		}
 		axis->binarySize = codeSize;
@@ -406,7 +437,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (!code) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 		axis->binary = code;
@@ -423,9 +453,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 #endif
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_GET_CODE;
 		}
 		result = nvrtcDestroyProgram(&prog);
@@ -433,11 +463,22 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("nvrtcDestroyProgram error: %s\n", nvrtcGetErrorString(result));
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_DESTROY_PROGRAM;
 		}
+		if (app->configuration.kernelCacheDirectory) {
+			resFFT = VkFFT_SaveKernelToCache(app, code0, code, codeSize);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(code);
+				code = 0;
+				axis->binary = 0;
+				free(code0);
+				code0 = 0;
+				return resFFT;
+			}
+		}
 	}
 	CUresult result2 = cuModuleLoadDataEx(&axis->VkFFTModule, code, 0, 0, 0);
 
@@ -445,9 +486,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		printf("cuModuleLoadDataEx error: %d\n", result2);
 		free(code);
 		code = 0;
+		axis->binary = 0;
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_LOAD_MODULE;
 	}
 	result2 = cuModuleGetFunction(&axis->VkFFTKernel, axis->VkFFTModule, axis->VkFFTFunctionName);
@@ -455,9 +496,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		printf("cuModuleGetFunction error: %d\n", result2);
 		free(code);
 		code = 0;
+		axis->binary = 0;
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_GET_FUNCTION;
 	}
 	if ((pfUINT)axis->specializationConstants.usedSharedMemory.data.i > app->configuration.sharedMemorySizeStatic) {
@@ -466,9 +507,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("cuFuncSetAttribute error: %d\n", result2);
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_SET_DYNAMIC_SHARED_MEMORY;
 		}
 	}
@@ -479,9 +520,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("cuModuleGetGlobal error: %d\n", result2);
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_MODULE_GET_GLOBAL;
 		}
 	}*/
@@ -490,20 +531,27 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		code = 0;
 	}
 #elif(VKFFT_BACKEND==2)
-	uint32_t* code;
-	pfUINT codeSize;
+	uint32_t* code = 0;
+	pfUINT codeSize = 0;
+	if ((!app->configuration.loadApplicationFromString) && (app->configuration.kernelCacheDirectory)) {
+		resFFT = VkFFT_LoadKernelFromCache(app, code0, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+	}
 	if (app->configuration.loadApplicationFromString) {
-		char* localStrPointer = (char*)app->configuration.loadApplicationString + app->currentApplicationStringPos;
-		memcpy(&codeSize, localStrPointer, sizeof(pfUINT));
-		code = (uint32_t*)malloc(codeSize);
-		if (!code) {
+		resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
-		memcpy(code, localStrPointer + sizeof(pfUINT), codeSize);
-		app->currentApplicationStringPos += codeSize + sizeof(pfUINT);
+	}
+	else if (code) {
+		axis->binarySize = codeSize;
+		axis->binary = code;
 	}
 	else
 	{
@@ -518,7 +566,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("hiprtcCreateProgram error: %s\n", hiprtcGetErrorString(result));
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
 		}
 		/*if (axis->pushConstants.structSize) {
@@ -527,7 +574,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 				printf("hiprtcAddNameExpression error: %s\n", hiprtcGetErrorString(result));
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_ADD_NAME_EXPRESSION;
 			}
 		}*/
@@ -538,7 +584,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			if (!opts[0]) {
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
 			}
 			numOpts++;
@@ -557,7 +602,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			if (!log) {
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 			}
 			else {
@@ -568,7 +612,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 				printf("%s\n", code0);
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 			}
 		}
@@ -577,7 +620,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("hiprtcGetCodeSize error: %s\n", hiprtcGetErrorString(result));
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_GET_CODE;
 		}
 		axis->binarySize = codeSize;
@@ -585,7 +627,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (!code) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 		axis->binary = code;
@@ -594,9 +635,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("hiprtcGetCode error: %s\n", hiprtcGetErrorString(result));
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_GET_CODE_SIZE;
 		}
 		//printf("%s\n", code);
@@ -606,11 +647,22 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("hiprtcDestroyProgram error: %s\n", hiprtcGetErrorString(result));
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_DESTROY_PROGRAM;
 		}
+		if (app->configuration.kernelCacheDirectory) {
+			resFFT = VkFFT_SaveKernelToCache(app, code0, code, codeSize);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(code);
+				code = 0;
+				axis->binary = 0;
+				free(code0);
+				code0 = 0;
+				return resFFT;
+			}
+		}
 	}
 	hipError_t result2 = hipModuleLoadDataEx(&axis->VkFFTModule, code, 0, 0, 0);
 
@@ -618,9 +670,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		printf("hipModuleLoadDataEx error: %d\n", result2);
 		free(code);
 		code = 0;
+		axis->binary = 0;
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_LOAD_MODULE;
 	}
 	result2 = hipModuleGetFunction(&axis->VkFFTKernel, axis->VkFFTModule, axis->VkFFTFunctionName);
@@ -628,9 +680,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		printf("hipModuleGetFunction error: %d\n", result2);
 		free(code);
 		code = 0;
+		axis->binary = 0;
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_GET_FUNCTION;
 	}
 	if ((pfUINT)axis->specializationConstants.usedSharedMemory.data.i > app->configuration.sharedMemorySizeStatic) {
@@ -640,9 +692,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("hipFuncSetAttribute error: %d\n", result2);
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_SET_DYNAMIC_SHARED_MEMORY;
 		}
 	}
@@ -653,9 +705,9 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("hipModuleGetGlobal error: %d\n", result2);
 			free(code);
 			code = 0;
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_MODULE_GET_GLOBAL;
 		}
 	}*/
@@ -664,21 +716,27 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		code = 0;
 	}
 #elif(VKFFT_BACKEND==3)
+	char* cachedCode = 0;
+	pfUINT cachedCodeSize = 0;
+	pfUINT kernelCacheHit = 0;
+	if ((!app->configuration.loadApplicationFromString) && (app->configuration.kernelCacheDirectory)) {
+		resFFT = VkFFT_LoadKernelFromCache(app, code0, (void**)&cachedCode, &cachedCodeSize);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+	}
 	if (app->configuration.loadApplicationFromString) {
-		char* code;
-		pfUINT codeSize;
-		char* localStrPointer = (char*)app->configuration.loadApplicationString + app->currentApplicationStringPos;
-		memcpy(&codeSize, localStrPointer, sizeof(pfUINT));
-		size_t codeSize_size_t = (size_t)codeSize;
-		code = (char*)malloc(codeSize);
-		if (!code) {
+		char* code = 0;
+		pfUINT codeSize = 0;
+		resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
-		memcpy(code, localStrPointer + sizeof(pfUINT), codeSize);
-		app->currentApplicationStringPos += codeSize + sizeof(pfUINT);
+		size_t codeSize_size_t = (size_t)codeSize;
 		const unsigned char* temp_code = (const unsigned char*)code;
 		axis->program = clCreateProgramWithBinary(app->configuration.context[0], 1, app->configuration.device, &codeSize_size_t, (const unsigned char**)(&temp_code), 0, &res);
 		if (res != CL_SUCCESS) {
@@ -686,12 +744,31 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			code = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
 		}
 		free(code);
 		code = 0;
 	}
+	else if (cachedCode) {
+		size_t codeSize_size_t = (size_t)cachedCodeSize;
+		const unsigned char* temp_code = (const unsigned char*)cachedCode;
+		axis->program = clCreateProgramWithBinary(app->configuration.context[0], 1, app->configuration.device, &codeSize_size_t, (const unsigned char**)(&temp_code), 0, &res);
+		if (res != CL_SUCCESS) {
+			free(cachedCode);
+			cachedCode = 0;
+			free(code0);
+			code0 = 0;
+			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+		}
+		if (app->configuration.saveApplicationToString) {
+			axis->binarySize = cachedCodeSize;
+			axis->binary = cachedCode;
+		}
+		else
+			free(cachedCode);
+		cachedCode = 0;
+		kernelCacheHit = 1;
+	}
 	else {
 		size_t codelen = strlen(code0);
 		const char* temp_code = (const char*)code0;
@@ -699,7 +776,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (res != CL_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
 		}
 	}
@@ -711,7 +787,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (!log) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 		}
 		else {
@@ -722,17 +797,15 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("%s\n", code0);
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 		}
 	}
-	if (app->configuration.saveApplicationToString) {
+	if ((!kernelCacheHit) && ((app->configuration.saveApplicationToString) || ((app->configuration.kernelCacheDirectory) && (!app->configuration.loadApplicationFromString)))) {
 		size_t codeSize;
 		res = clGetProgramInfo(axis->program, CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &codeSize, NULL);
 		if (res != CL_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 		}
 		axis->binarySize = (pfUINT)codeSize;
@@ -740,20 +813,30 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (!axis->binary) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 		res = clGetProgramInfo(axis->program, CL_PROGRAM_BINARIES, sizeof(unsigned char*), &axis->binary, NULL);
 		if (res != CL_SUCCESS) {
-			if (app->configuration.saveApplicationToString) {
-				free(axis->binary);
-				axis->binary = 0;
-			}
+			free(axis->binary);
+			axis->binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 		}
+		if ((app->configuration.kernelCacheDirectory) && (!app->configuration.loadApplicationFromString)) {
+			resFFT = VkFFT_SaveKernelToCache(app, code0, axis->binary, axis->binarySize);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(axis->binary);
+				axis->binary = 0;
+				free(code0);
+				code0 = 0;
+				return resFFT;
+			}
+		}
+		if (!app->configuration.saveApplicationToString) {
+			free(axis->binary);
+			axis->binary = 0;
+		}
 	}
 	axis->kernel = clCreateKernel(axis->program, axis->VkFFTFunctionName, &res);
 	if (res != CL_SUCCESS) {
@@ -763,24 +846,28 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		}
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_CREATE_SHADER_MODULE;
 	}
 #elif(VKFFT_BACKEND==4)
-	uint32_t* code;
-	pfUINT codeSize;
-	if (app->configuration.loadApplicationFromString) {
-		char* localStrPointer = (char*)app->configuration.loadApplicationString + app->currentApplicationStringPos;
-		memcpy(&codeSize, localStrPointer, sizeof(pfUINT));
-		code = (uint32_t*)malloc(codeSize);
-		if (!code) {
+	uint32_t* code = 0;
+	pfUINT codeSize = 0;
+	if ((!app->configuration.loadApplicationFromString) && (app->configuration.kernelCacheDirectory)) {
+		resFFT = VkFFT_LoadKernelFromCache(app, code0, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
+		}
+	}
+	if ((app->configuration.loadApplicationFromString) || (code)) {
+		if (app->configuration.loadApplicationFromString) {
+			resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(code0);
+				code0 = 0;
+				return resFFT;
+			}
 		}
-		memcpy(code, localStrPointer + sizeof(pfUINT), codeSize);
-		app->currentApplicationStringPos += codeSize + sizeof(pfUINT);
 
 		const char* pBuildFlags = (app->configuration.useUint64) ? "-ze-opt-greater-than-4GB-buffer-required" : 0;
 		ze_module_desc_t moduleDesc = {
@@ -798,10 +885,14 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			code = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
 		}
-		free(code);
+		if ((!app->configuration.loadApplicationFromString) && (app->configuration.saveApplicationToString)) {
+			axis->binarySize = codeSize;
+			axis->binary = code;
+		}
+		else
+			free(code);
 		code = 0;
 	}
 	else {
@@ -842,7 +933,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		if (!spv_binary) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_MALLOC_FAILED;
 		}
 		fread(spv_binary, 1, spv_size, temp);
@@ -867,18 +957,16 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			spv_binary = 0;
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
 		}
 		free(spv_binary);
 		spv_binary = 0;
-		if (app->configuration.saveApplicationToString) {
+		if ((app->configuration.saveApplicationToString) || (app->configuration.kernelCacheDirectory)) {
 			size_t codeSize;
 			res = zeModuleGetNativeBinary(axis->VkFFTModule, &codeSize, 0);
 			if (res != ZE_RESULT_SUCCESS) {
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 			}
 			axis->binarySize = codeSize;
@@ -886,7 +974,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			if (!axis->binary) {
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
 			}
 			res = zeModuleGetNativeBinary(axis->VkFFTModule, &codeSize, (uint8_t*)axis->binary);
@@ -895,9 +982,22 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 				axis->binary = 0;
 				free(code0);
 				code0 = 0;
-				deleteVkFFT(app);
 				return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 			}
+			if (app->configuration.kernelCacheDirectory) {
+				resFFT = VkFFT_SaveKernelToCache(app, code0, axis->binary, axis->binarySize);
+				if (resFFT != VKFFT_SUCCESS) {
+					free(axis->binary);
+					axis->binary = 0;
+					free(code0);
+					code0 = 0;
+					return resFFT;
+				}
+			}
+			if (!app->configuration.saveApplicationToString) {
+				free(axis->binary);
+				axis->binary = 0;
+			}
 		}
 	}
 	ze_kernel_desc_t kernelDesc = {
@@ -914,26 +1014,20 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 		}
 		free(code0);
 		code0 = 0;
-		deleteVkFFT(app);
 		return VKFFT_ERROR_FAILED_TO_CREATE_SHADER_MODULE;
 	}
 #elif(VKFFT_BACKEND==5)
 	NS::Error* error;
 	if (app->configuration.loadApplicationFromString) {
-		char* code;
-		pfUINT codeSize;
-		char* localStrPointer = (char*)app->configuration.loadApplicationString + app->currentApplicationStringPos;
-		memcpy(&codeSize, localStrPointer, sizeof(pfUINT));
-		size_t codeSize_size_t = (size_t)codeSize;
-		code = (char*)malloc(codeSize);
-		if (!code) {
+		char* code = 0;
+		pfUINT codeSize = 0;
+		resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
-		memcpy(code, localStrPointer + sizeof(pfUINT), codeSize);
-		app->currentApplicationStringPos += codeSize + sizeof(pfUINT);
+		size_t codeSize_size_t = (size_t)codeSize;
 		dispatch_data_t data = dispatch_data_create(code, codeSize, 0, 0);
 		axis->library = app->configuration.device->newLibrary(data, &error);
 		free(code);
@@ -949,7 +1043,6 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 			printf("%s\n%s\n", error->debugDescription()->cString(NS::ASCIIStringEncoding), error->localizedDescription()->cString(NS::ASCIIStringEncoding));
 			free(code0);
 			code0 = 0;
-			deleteVkFFT(app);
 			return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
 		}
 		compileOptions->release();
@@ -964,6 +1057,70 @@ static inline VkFFTResult VkFFT_CompileKernel(VkFFTApplication* app, VkFFTAxis*
 	axis->pipeline = app->configuration.device->newComputePipelineState(function, &error);
 	function->release();
 	str->release();
+#elif(VKFFT_BACKEND==6)
+	char* code = 0;
+	pfUINT codeSize = 0;
+	pfUINT kernelCacheHit = 0;
+	//kernels without barriers are executed without fibers
+	axis->useBarriers = (strstr(code0, "vkfft_inv->barrier(") != 0);
+	if ((!app->configuration.loadApplicationFromString) && (app->configuration.kernelCacheDirectory)) {
+		resFFT = VkFFT_LoadKernelFromCache(app, code0, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+		if (code) kernelCacheHit = 1;
+	}
+	if (app->configuration.loadApplicationFromString) {
+		resFFT = VkFFT_LoadKernelFromApplicationString(app, axis, (void**)&code, &codeSize);
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+	}
+	if (code) {
+		resFFT = VkFFT_LoadCPULibrary(app, axis, code, codeSize);
+		if ((kernelCacheHit) && (app->configuration.saveApplicationToString) && (resFFT == VKFFT_SUCCESS)) {
+			axis->binarySize = codeSize;
+			axis->binary = code;
+		}
+		else
+			free(code);
+		code = 0;
+		if (resFFT != VKFFT_SUCCESS) {
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+	}
+	else {
+		pfUINT saveBinary = ((app->configuration.saveApplicationToString) || (app->configuration.kernelCacheDirectory));
+		resFFT = VkFFT_BuildCPULibrary(app, axis, code0, saveBinary);
+		if (resFFT != VKFFT_SUCCESS) {
+			if (resFFT == VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM) printf("%s\n", code0);
+			free(axis->binary);
+			axis->binary = 0;
+			free(code0);
+			code0 = 0;
+			return resFFT;
+		}
+		if (app->configuration.kernelCacheDirectory) {
+			resFFT = VkFFT_SaveKernelToCache(app, code0, axis->binary, axis->binarySize);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(axis->binary);
+				axis->binary = 0;
+				free(code0);
+				code0 = 0;
+				return resFFT;
+			}
+		}
+		if (!app->configuration.saveApplicationToString) {
+			free(axis->binary);
+			axis->binary = 0;
+		}
+	}
 #endif
 	return VKFFT_SUCCESS;
 }
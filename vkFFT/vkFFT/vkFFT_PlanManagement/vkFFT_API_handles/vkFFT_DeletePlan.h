@@ -22,6 +22,10 @@
 #ifndef VKFFT_DELETEPLAN_H
 #define VKFFT_DELETEPLAN_H
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_SharedBuffers.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_KernelReuse.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CPURuntime.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_Descriptors.h"
 
 static inline void deleteAxis(VkFFTApplication* app, VkFFTAxis* axis, int isInverseBluesteinAxes) {
 	if (axis->specializationConstants.numRaderPrimes && (!isInverseBluesteinAxes)) {
@@ -29,6 +33,8 @@ static inline void deleteAxis(VkFFTApplication* app, VkFFTAxis* axis, int isInve
 		axis->specializationConstants.raderContainer = 0;
 		axis->specializationConstants.numRaderPrimes = 0;
 	}
+	if (axis->sharedLUT) VkFFT_ReleaseSharedLUT(app, axis);
+	if (axis->kernelReuse == VKFFT_KERNEL_BORROWED) VkFFT_DetachKernel(axis);
 #if(VKFFT_BACKEND==0)
 	if ((app->configuration.useLUT == 1) && (!axis->referenceLUT)) {
 		if (axis->bufferLUT != 0) {
@@ -40,10 +46,7 @@ static inline void deleteAxis(VkFFTApplication* app, VkFFTAxis* axis, int isInve
 			axis->bufferLUTDeviceMemory = 0;
 		}
 	}
-	if (axis->descriptorPool != 0) {
-		vkDestroyDescriptorPool(app->configuration.device[0], axis->descriptorPool, 0);
-		axis->descriptorPool = 0;
-	}
+	VkFFT_FreeDescriptorSets(app, axis);
 	if (axis->descriptorSetLayout != 0) {
 		vkDestroyDescriptorSetLayout(app->configuration.device[0], axis->descriptorSetLayout, 0);
 		axis->descriptorSetLayout = 0;
@@ -125,6 +128,12 @@ static inline void deleteAxis(VkFFTApplication* app, VkFFTAxis* axis, int isInve
 		//free(axis->library);
 		axis->library = 0;
 	}
+#elif(VKFFT_BACKEND==6)
+	if ((app->configuration.useLUT == 1) && (!axis->referenceLUT) && (axis->bufferLUT != 0)) {
+		free(axis->bufferLUT);
+		axis->bufferLUT = 0;
+	}
+	VkFFT_CloseCPULibrary(axis);
 #endif
 	if (app->configuration.saveApplicationToString) {
 		if (axis->binary != 0) {
@@ -132,6 +141,18 @@ static inline void deleteAxis(VkFFTApplication* app, VkFFTAxis* axis, int isInve
 			axis->binary = 0;
 		}
 	}
+	if ((axis->hostLUT != 0) && (!axis->referenceLUT)) {
+		free(axis->hostLUT);
+	}
+	axis->hostLUT = 0;
+	if (axis->hostRaderUintLUT != 0) {
+		free(axis->hostRaderUintLUT);
+		axis->hostRaderUintLUT = 0;
+	}
+	if (axis->specializationConstants.code0 != 0) {
+		free(axis->specializationConstants.code0);
+		axis->specializationConstants.code0 = 0;
+	}
 }
 
 #endif
@@ -0,0 +1,135 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_DESCRIPTORS_H
+#define VKFFT_DESCRIPTORS_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+
+// Vulkan buffer bindings. VkFFTUpdateBufferSet fills descriptorBufferInfo of the axis when buffers change. With push descriptors it is pushed
+// into the command buffer each time the kernel is bound. Otherwise the axis keeps descriptorSetCacheSize sets, each written once per buffer
+// combination: a combination that is already cached only selects its set, a new one replaces the oldest set with a single vkUpdateDescriptorSets call.
+#if(VKFFT_BACKEND==0)
+static inline VkFFTResult VkFFT_AllocateDescriptorSets(VkFFTApplication* app, VkFFTAxis* axis) {
+	//axis->descriptorSetLayout has to be created. Allocates binding storage and, if bindings are not pushed, the cached sets
+	axis->numDescriptors = 0;
+	for (pfUINT i = 0; i < axis->numBindings; i++)
+		axis->numDescriptors += (pfUINT)axis->specializationConstants.numBuffersBound[i];
+	axis->descriptorBufferInfo = (VkDescriptorBufferInfo*)calloc(axis->numDescriptors, sizeof(VkDescriptorBufferInfo));
+	if (!axis->descriptorBufferInfo) return VKFFT_ERROR_MALLOC_FAILED;
+	if (axis->usePushDescriptors) return VKFFT_SUCCESS;
+	axis->descriptorSetCacheSize = (app->configuration.descriptorSetCacheSize) ? app->configuration.descriptorSetCacheSize : 1;
+	axis->numCachedDescriptorSets = 0;
+	axis->nextCachedDescriptorSet = 0;
+	axis->cachedDescriptorSets = (VkDescriptorSet*)calloc(axis->descriptorSetCacheSize, sizeof(VkDescriptorSet));
+	axis->cachedDescriptorBufferInfo = (VkDescriptorBufferInfo*)calloc(axis->descriptorSetCacheSize * axis->numDescriptors, sizeof(VkDescriptorBufferInfo));
+	if ((!axis->cachedDescriptorSets) || (!axis->cachedDescriptorBufferInfo)) return VKFFT_ERROR_MALLOC_FAILED;
+	VkResult res = VK_SUCCESS;
+	VkDescriptorPoolSize descriptorPoolSize = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER };
+	descriptorPoolSize.descriptorCount = (uint32_t)(axis->numDescriptors * axis->descriptorSetCacheSize);
+	VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+	descriptorPoolCreateInfo.poolSizeCount = 1;
+	descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
+	descriptorPoolCreateInfo.maxSets = (uint32_t)axis->descriptorSetCacheSize;
+	res = vkCreateDescriptorPool(app->configuration.device[0], &descriptorPoolCreateInfo, 0, &axis->descriptorPool);
+	if (res != VK_SUCCESS) {
+		axis->descriptorPool = 0;
+		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_POOL;
+	}
+	VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+	descriptorSetAllocateInfo.descriptorPool = axis->descriptorPool;
+	descriptorSetAllocateInfo.descriptorSetCount = 1;
+	descriptorSetAllocateInfo.pSetLayouts = &axis->descriptorSetLayout;
+	for (pfUINT i = 0; i < axis->descriptorSetCacheSize; i++) {
+		res = vkAllocateDescriptorSets(app->configuration.device[0], &descriptorSetAllocateInfo, &axis->cachedDescriptorSets[i]);
+		if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE_DESCRIPTOR_SETS;
+	}
+	axis->descriptorSet = axis->cachedDescriptorSets[0];
+	return VKFFT_SUCCESS;
+}
+static inline void VkFFT_FreeDescriptorSets(VkFFTApplication* app, VkFFTAxis* axis) {
+	//sets are freed with the pool, the layout is released by deleteAxis
+	if (axis->descriptorPool != 0) {
+		vkDestroyDescriptorPool(app->configuration.device[0], axis->descriptorPool, 0);
+		axis->descriptorPool = 0;
+	}
+	axis->descriptorSet = 0;
+	if (axis->cachedDescriptorSets) {
+		free(axis->cachedDescriptorSets);
+		axis->cachedDescriptorSets = 0;
+	}
+	if (axis->cachedDescriptorBufferInfo) {
+		free(axis->cachedDescriptorBufferInfo);
+		axis->cachedDescriptorBufferInfo = 0;
+	}
+	if (axis->descriptorBufferInfo) {
+		free(axis->descriptorBufferInfo);
+		axis->descriptorBufferInfo = 0;
+	}
+	axis->numCachedDescriptorSets = 0;
+	axis->nextCachedDescriptorSet = 0;
+}
+static inline uint32_t VkFFT_GetDescriptorWrites(VkFFTAxis* axis, VkDescriptorSet descriptorSet, VkWriteDescriptorSet* writeDescriptorSets) {
+	//one write per binding, descriptors of a binding are consecutive in descriptorBufferInfo
+	pfUINT descriptorID = 0;
+	for (pfUINT i = 0; i < axis->numBindings; i++) {
+		VkWriteDescriptorSet writeDescriptorSet = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+		writeDescriptorSet.dstSet = descriptorSet;
+		writeDescriptorSet.dstBinding = (uint32_t)i;
+		writeDescriptorSet.dstArrayElement = 0;
+		writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		writeDescriptorSet.descriptorCount = (uint32_t)axis->specializationConstants.numBuffersBound[i];
+		writeDescriptorSet.pBufferInfo = &axis->descriptorBufferInfo[descriptorID];
+		writeDescriptorSets[i] = writeDescriptorSet;
+		descriptorID += (pfUINT)axis->specializationConstants.numBuffersBound[i];
+	}
+	return (uint32_t)axis->numBindings;
+}
+static inline void VkFFT_UpdateDescriptorSet(VkFFTApplication* app, VkFFTAxis* axis) {
+	//selects the set that holds descriptorBufferInfo, writing it to the oldest cached set if no set does
+	if (axis->usePushDescriptors) return;
+	pfUINT infoSize = axis->numDescriptors * sizeof(VkDescriptorBufferInfo);
+	for (pfUINT i = 0; i < axis->numCachedDescriptorSets; i++) {
+		if (memcmp(&axis->cachedDescriptorBufferInfo[i * axis->numDescriptors], axis->descriptorBufferInfo, infoSize) == 0) {
+			axis->descriptorSet = axis->cachedDescriptorSets[i];
+			return;
+		}
+	}
+	pfUINT setID = axis->nextCachedDescriptorSet;
+	axis->nextCachedDescriptorSet = (axis->nextCachedDescriptorSet + 1) % axis->descriptorSetCacheSize;
+	if (axis->numCachedDescriptorSets < axis->descriptorSetCacheSize) axis->numCachedDescriptorSets++;
+	VkWriteDescriptorSet writeDescriptorSets[10];
+	uint32_t numWrites = VkFFT_GetDescriptorWrites(axis, axis->cachedDescriptorSets[setID], writeDescriptorSets);
+	vkUpdateDescriptorSets(app->configuration.device[0], numWrites, writeDescriptorSets, 0, 0);
+	memcpy(&axis->cachedDescriptorBufferInfo[setID * axis->numDescriptors], axis->descriptorBufferInfo, infoSize);
+	axis->descriptorSet = axis->cachedDescriptorSets[setID];
+}
+static inline void VkFFT_BindDescriptors(VkFFTApplication* app, VkFFTAxis* axis) {
+	if (axis->usePushDescriptors) {
+		VkWriteDescriptorSet writeDescriptorSets[10];
+		uint32_t numWrites = VkFFT_GetDescriptorWrites(axis, 0, writeDescriptorSets);
+		app->cmdPushDescriptorSet(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, numWrites, writeDescriptorSets);
+	}
+	else
+		vkCmdBindDescriptorSets(app->configuration.commandBuffer[0], VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
+}
+#endif
+
+#endif
@@ -0,0 +1,339 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_DISPATCHPROFILE_H
+#define VKFFT_DISPATCHPROFILE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanProfile.h"
+
+// Per-kernel profiling of VkFFTAppend. Each kernel (all launches its grid is split in) is bracketed by two timestamps recorded in the same
+// stream/command buffer as the launches: Vulkan timestamp queries, CUDA/HIP events, OpenCL and Level Zero events of the first and the last launch.
+// Timestamps are only resolved by VkFFTGetDispatchProfile, so profiling does not add synchronization to VkFFTAppend.
+
+#define VKFFT_MAX_PROFILED_DISPATCHES (2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1))
+
+typedef struct VkFFTDispatchProfiler {
+	VkFFTDispatchProfile profile;
+	pfUINT recording;//set during VkFFTAppend, kernels launched outside of it are not recorded
+	pfUINT activeRecord;//1 + id of the record of the kernel being launched, 0 - none
+	pfUINT launchID;//launches of the active kernel done so far
+	pfUINT measureTime;//0 if timestamps are not recorded by the last VkFFTAppend call
+	double hostStart;
+#if(VKFFT_BACKEND==0)
+	VkQueryPool queryPool;
+	double timestampPeriod;//ns per timestamp tick
+	uint64_t timestampMask;
+	uint64_t timestamps[2 * VKFFT_MAX_PROFILED_DISPATCHES];
+#elif(VKFFT_BACKEND==1)
+	cudaEvent_t events[2 * VKFFT_MAX_PROFILED_DISPATCHES];
+#elif(VKFFT_BACKEND==2)
+	hipEvent_t events[2 * VKFFT_MAX_PROFILED_DISPATCHES];
+#elif(VKFFT_BACKEND==3)
+	cl_event events[2 * VKFFT_MAX_PROFILED_DISPATCHES];//returned by the first and the last launch of each kernel
+#elif(VKFFT_BACKEND==4)
+	ze_event_pool_handle_t eventPool;
+	ze_event_handle_t events[2 * VKFFT_MAX_PROFILED_DISPATCHES];//signaled by the first and the last launch of each kernel
+	double timerResolution;//ns per timestamp tick
+	uint64_t timestampMask;
+#endif
+} VkFFTDispatchProfiler;
+
+static inline void VkFFT_ReleaseDispatchProfileEvents(VkFFTDispatchProfiler* profiler) {
+#if(VKFFT_BACKEND==3)
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		if (profiler->events[i]) {
+			clReleaseEvent(profiler->events[i]);
+			profiler->events[i] = 0;
+		}
+	}
+#endif
+}
+static inline void VkFFT_DeleteDispatchProfiler(VkFFTApplication* app) {
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if (profiler == 0) return;
+#if(VKFFT_BACKEND==0)
+	if (profiler->queryPool) vkDestroyQueryPool(app->configuration.device[0], profiler->queryPool, 0);
+#elif(VKFFT_BACKEND==1)
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		if (profiler->events[i]) cudaEventDestroy(profiler->events[i]);
+	}
+#elif(VKFFT_BACKEND==2)
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		if (profiler->events[i]) hipEventDestroy(profiler->events[i]);
+	}
+#elif(VKFFT_BACKEND==3)
+	VkFFT_ReleaseDispatchProfileEvents(profiler);
+#elif(VKFFT_BACKEND==4)
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		if (profiler->events[i]) zeEventDestroy(profiler->events[i]);
+	}
+	if (profiler->eventPool) zeEventPoolDestroy(profiler->eventPool);
+#endif
+	free(profiler);
+	app->dispatchProfiler = 0;
+}
+static inline VkFFTResult VkFFT_InitDispatchProfiler(VkFFTApplication* app) {
+	app->dispatchProfiler = (VkFFTDispatchProfiler*)calloc(1, sizeof(VkFFTDispatchProfiler));
+	if (!app->dispatchProfiler) return VKFFT_ERROR_MALLOC_FAILED;
+#if(VKFFT_BACKEND==0)
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	VkPhysicalDeviceProperties physicalDeviceProperties = VKFFT_ZERO_INIT;
+	vkGetPhysicalDeviceProperties(app->configuration.physicalDevice[0], &physicalDeviceProperties);
+	profiler->timestampPeriod = (double)physicalDeviceProperties.limits.timestampPeriod;
+	//timestampValidBits of the queue family is not known here, the full range is assumed
+	profiler->timestampMask = ~(uint64_t)0;
+	VkQueryPoolCreateInfo queryPoolCreateInfo = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+	queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+	queryPoolCreateInfo.queryCount = 2 * VKFFT_MAX_PROFILED_DISPATCHES;
+	VkResult res = vkCreateQueryPool(app->configuration.device[0], &queryPoolCreateInfo, 0, &profiler->queryPool);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_QUERY_POOL;
+#elif(VKFFT_BACKEND==1)
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		cudaError_t res = cudaEventCreate(&profiler->events[i]);
+		if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_CREATE_EVENT;
+	}
+#elif(VKFFT_BACKEND==2)
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		hipError_t res = hipEventCreate(&profiler->events[i]);
+		if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_CREATE_EVENT;
+	}
+#elif(VKFFT_BACKEND==4)
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	ze_device_properties_t deviceProperties = VKFFT_ZERO_INIT;
+	deviceProperties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+	ze_result_t res = zeDeviceGetProperties(app->configuration.device[0], &deviceProperties);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+	profiler->timerResolution = (double)deviceProperties.timerResolution;
+	profiler->timestampMask = (deviceProperties.kernelTimestampValidBits >= 64) ? ~(uint64_t)0 : (((uint64_t)1 << deviceProperties.kernelTimestampValidBits) - 1);
+	ze_event_pool_desc_t eventPoolDesc = VKFFT_ZERO_INIT;
+	eventPoolDesc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+	eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+	eventPoolDesc.count = 2 * VKFFT_MAX_PROFILED_DISPATCHES;
+	res = zeEventPoolCreate(app->configuration.context[0], &eventPoolDesc, 1, app->configuration.device, &profiler->eventPool);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_EVENT;
+	for (pfUINT i = 0; i < 2 * VKFFT_MAX_PROFILED_DISPATCHES; i++) {
+		ze_event_desc_t eventDesc = VKFFT_ZERO_INIT;
+		eventDesc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
+		eventDesc.index = (uint32_t)i;
+		eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+		res = zeEventCreate(profiler->eventPool, &eventDesc, &profiler->events[i]);
+		if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_EVENT;
+	}
+#endif
+	return VKFFT_SUCCESS;
+}
+
+static inline VkFFTResult VkFFT_BeginDispatchProfile(VkFFTApplication* app) {
+	//called by VkFFTAppend before the first kernel, the previous report is discarded
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if (!profiler) return VKFFT_SUCCESS;
+	profiler->profile.totalTime = 0;
+	profiler->profile.numDispatches = 0;
+	profiler->activeRecord = 0;
+	profiler->recording = 1;
+	profiler->measureTime = 1;
+#if(VKFFT_BACKEND==0)
+	vkCmdResetQueryPool(app->configuration.commandBuffer[0], profiler->queryPool, 0, 2 * VKFFT_MAX_PROFILED_DISPATCHES);
+#elif((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2))
+	//launches are spread over streams, so events of one stream do not bracket them. Graph captures are not timed either
+	if ((app->configuration.num_streams > 1) || (app->graphCapture)) profiler->measureTime = 0;
+#elif(VKFFT_BACKEND==3)
+	VkFFT_ReleaseDispatchProfileEvents(profiler);
+#elif(VKFFT_BACKEND==5)
+	profiler->measureTime = 0;
+#endif
+	return VKFFT_SUCCESS;
+}
+static inline void VkFFT_EndDispatchProfile(VkFFTApplication* app) {
+	if (app->dispatchProfiler) app->dispatchProfiler->recording = 0;
+}
+static inline VkFFTResult VkFFT_BeginDispatchRecord(VkFFTApplication* app, VkFFTPlan* FFTPlan, VkFFTAxis* axis, pfUINT axis_id, pfUINT axis_upload_id, pfUINT inverse, pfUINT isR2Cdecomposition, pfUINT* dispatchBlock, pfUINT numLaunches) {
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if ((!profiler) || (!profiler->recording)) return VKFFT_SUCCESS;
+	if (profiler->profile.numDispatches == VKFFT_MAX_PROFILED_DISPATCHES) return VKFFT_SUCCESS;
+	pfUINT id = profiler->profile.numDispatches;
+	VkFFTDispatchProfileRecord* record = &profiler->profile.dispatches[id];
+	record->inverse = inverse;
+	record->axis_id = axis_id;
+	record->axis_upload_id = axis_upload_id;
+	if (isR2Cdecomposition)
+		record->type = 2;
+	else
+		record->type = (axis == &FFTPlan->inverseBluesteinAxes[axis_id][axis_upload_id]) ? 1 : 0;
+	for (int i = 0; i < 3; i++) {
+		record->dispatchSize[i] = dispatchBlock[i];
+		record->localSize[i] = axis->specializationConstants.localSize[i].data.i;
+	}
+	record->numLaunches = numLaunches;
+	pfUINT numBatches = (app->actualNumBatches > app->configuration.numberBatches) ? app->actualNumBatches : app->configuration.numberBatches;
+	pfUINT numSystems = app->configuration.coordinateFeatures * numBatches;
+	for (pfUINT i = 1; i < app->configuration.FFTdim; i++)
+		numSystems *= app->configuration.size[i];
+	pfUINT numReal = numSystems * app->configuration.size[0];
+	pfUINT numComplex = (app->configuration.performR2C) ? numSystems * (app->configuration.size[0] / 2 + 1) : numReal;
+	record->bytesRead = ((axis->specializationConstants.inputMemoryCode == axis->specializationConstants.floatTypeInputMemoryCode) ? numReal : numComplex) * axis->specializationConstants.inputNumberByteSize;
+	record->bytesWritten = ((axis->specializationConstants.outputMemoryCode == axis->specializationConstants.floatTypeOutputMemoryCode) ? numReal : numComplex) * axis->specializationConstants.outputNumberByteSize;
+	record->time = -1;
+	profiler->profile.numDispatches++;
+	profiler->activeRecord = id + 1;
+	profiler->launchID = 0;
+	if (!profiler->measureTime) return VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	vkCmdWriteTimestamp(app->configuration.commandBuffer[0], VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, profiler->queryPool, (uint32_t)(2 * id));
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaEventRecord(profiler->events[2 * id], (app->configuration.num_streams >= 1) ? app->configuration.stream[app->configuration.streamID] : 0);
+	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_EVENT_RECORD;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipEventRecord(profiler->events[2 * id], (app->configuration.num_streams >= 1) ? app->configuration.stream[app->configuration.streamID] : 0);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_EVENT_RECORD;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = zeCommandListAppendEventReset(app->configuration.commandList[0], profiler->events[2 * id]);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_EVENT_RECORD;
+	res = zeCommandListAppendEventReset(app->configuration.commandList[0], profiler->events[2 * id + 1]);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_EVENT_RECORD;
+#elif(VKFFT_BACKEND==6)
+	profiler->hostStart = VkFFT_GetHostTime();
+#endif
+	return VKFFT_SUCCESS;
+}
+static inline VkFFTResult VkFFT_EndDispatchRecord(VkFFTApplication* app) {
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if ((!profiler) || (!profiler->activeRecord)) return VKFFT_SUCCESS;
+	if (!profiler->measureTime) {
+		profiler->activeRecord = 0;
+		return VKFFT_SUCCESS;
+	}
+#if(VKFFT_BACKEND==0)
+	pfUINT id = profiler->activeRecord - 1;
+	vkCmdWriteTimestamp(app->configuration.commandBuffer[0], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, profiler->queryPool, (uint32_t)(2 * id + 1));
+#elif(VKFFT_BACKEND==1)
+	pfUINT id = profiler->activeRecord - 1;
+	cudaError_t res = cudaEventRecord(profiler->events[2 * id + 1], (app->configuration.num_streams >= 1) ? app->configuration.stream[app->configuration.streamID] : 0);
+	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_EVENT_RECORD;
+#elif(VKFFT_BACKEND==2)
+	pfUINT id = profiler->activeRecord - 1;
+	hipError_t res = hipEventRecord(profiler->events[2 * id + 1], (app->configuration.num_streams >= 1) ? app->configuration.stream[app->configuration.streamID] : 0);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_EVENT_RECORD;
+#elif(VKFFT_BACKEND==6)
+	//kernels are executed synchronously
+	pfUINT id = profiler->activeRecord - 1;
+	profiler->profile.dispatches[id].time = VkFFT_GetHostTime() - profiler->hostStart;
+#endif
+	profiler->activeRecord = 0;
+	return VKFFT_SUCCESS;
+}
+#if(VKFFT_BACKEND==3)
+static inline cl_event* VkFFT_GetDispatchProfileLaunchEvent(VkFFTApplication* app) {
+	//event slot of the first and the last launch of the profiled kernel, 0 for launches in between
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if ((!profiler) || (!profiler->activeRecord) || (!profiler->measureTime)) return 0;
+	pfUINT id = profiler->activeRecord - 1;
+	pfUINT launchID = profiler->launchID;
+	profiler->launchID++;
+	if (launchID == 0) return &profiler->events[2 * id];
+	if (launchID == profiler->profile.dispatches[id].numLaunches - 1) return &profiler->events[2 * id + 1];
+	return 0;
+}
+#elif(VKFFT_BACKEND==4)
+static inline ze_event_handle_t VkFFT_GetDispatchProfileLaunchEvent(VkFFTApplication* app) {
+	//event signaled by the first and the last launch of the profiled kernel, 0 for launches in between
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if ((!profiler) || (!profiler->activeRecord) || (!profiler->measureTime)) return 0;
+	pfUINT id = profiler->activeRecord - 1;
+	pfUINT launchID = profiler->launchID;
+	profiler->launchID++;
+	if (launchID == 0) return profiler->events[2 * id];
+	if (launchID == profiler->profile.dispatches[id].numLaunches - 1) return profiler->events[2 * id + 1];
+	return 0;
+}
+#endif
+
+static inline VkFFTResult VkFFTGetDispatchProfile(VkFFTApplication* app, VkFFTDispatchProfile* profile) {
+	//copies the report of the last VkFFTAppend call. Waits for its timestamps, so the recorded work has to be submitted
+	VkFFTDispatchProfiler* profiler = app->dispatchProfiler;
+	if (profiler == 0) return VKFFT_ERROR_DISABLED_profileDispatches;
+	VkFFTDispatchProfile* report = &profiler->profile;
+	if ((profiler->measureTime) && (report->numDispatches > 0)) {
+		report->totalTime = 0;
+#if(VKFFT_BACKEND==0)
+		VkResult res = vkGetQueryPoolResults(app->configuration.device[0], profiler->queryPool, 0, (uint32_t)(2 * report->numDispatches), 2 * report->numDispatches * sizeof(uint64_t), profiler->timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+		if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+		for (pfUINT i = 0; i < report->numDispatches; i++)
+			report->dispatches[i].time = (double)((profiler->timestamps[2 * i + 1] - profiler->timestamps[2 * i]) & profiler->timestampMask) * profiler->timestampPeriod * 0.000001;
+#elif(VKFFT_BACKEND==1)
+		for (pfUINT i = 0; i < report->numDispatches; i++) {
+			float time = 0;
+			cudaError_t res = cudaEventSynchronize(profiler->events[2 * i + 1]);
+			if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			res = cudaEventElapsedTime(&time, profiler->events[2 * i], profiler->events[2 * i + 1]);
+			if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			report->dispatches[i].time = (double)time;
+		}
+#elif(VKFFT_BACKEND==2)
+		for (pfUINT i = 0; i < report->numDispatches; i++) {
+			float time = 0;
+			hipError_t res = hipEventSynchronize(profiler->events[2 * i + 1]);
+			if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			res = hipEventElapsedTime(&time, profiler->events[2 * i], profiler->events[2 * i + 1]);
+			if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			report->dispatches[i].time = (double)time;
+		}
+#elif(VKFFT_BACKEND==3)
+		for (pfUINT i = 0; i < report->numDispatches; i++) {
+			cl_event startEvent = profiler->events[2 * i];
+			cl_event endEvent = (profiler->events[2 * i + 1]) ? profiler->events[2 * i + 1] : startEvent;
+			if (!startEvent) continue;
+			cl_int res = clWaitForEvents(1, &endEvent);
+			if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			cl_ulong start = 0;
+			cl_ulong end = 0;
+			//CL_PROFILING_INFO_NOT_AVAILABLE if the queue was created without CL_QUEUE_PROFILING_ENABLE, the time stays negative
+			res = clGetEventProfilingInfo(startEvent, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, 0);
+			if (res != CL_SUCCESS) continue;
+			res = clGetEventProfilingInfo(endEvent, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, 0);
+			if (res != CL_SUCCESS) continue;
+			report->dispatches[i].time = (double)(end - start) * 0.000001;
+		}
+#elif(VKFFT_BACKEND==4)
+		for (pfUINT i = 0; i < report->numDispatches; i++) {
+			ze_event_handle_t endEvent = (report->dispatches[i].numLaunches > 1) ? profiler->events[2 * i + 1] : profiler->events[2 * i];
+			ze_result_t res = zeEventHostSynchronize(endEvent, UINT64_MAX);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			ze_kernel_timestamp_result_t start = VKFFT_ZERO_INIT;
+			ze_kernel_timestamp_result_t end = VKFFT_ZERO_INIT;
+			res = zeEventQueryKernelTimestamp(profiler->events[2 * i], &start);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			res = zeEventQueryKernelTimestamp(endEvent, &end);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			report->dispatches[i].time = (double)((end.global.kernelEnd - start.global.kernelStart) & profiler->timestampMask) * profiler->timerResolution * 0.000001;
+		}
+#endif
+		for (pfUINT i = 0; i < report->numDispatches; i++) {
+			if (report->dispatches[i].time > 0) report->totalTime += report->dispatches[i].time;
+		}
+	}
+	profile[0] = report[0];
+	return VKFFT_SUCCESS;
+}
+
+#endif
@@ -143,6 +143,22 @@ static inline VkFFTResult initMemoryParametersAPI(VkFFTApplication* app, VkFFTSp
 	sprintf(sc->uintDef.name, "uint");
 	sprintf(sc->int64Def.name, "long");
 	sprintf(sc->uint64Def.name, "ulong");
+#elif(VKFFT_BACKEND==6)
+	sprintf(sc->halfLiteral.name, "f16");
+	sprintf(sc->floatLiteral.name, "f");
+	sprintf(sc->halfDef.name, "half");
+	sprintf(sc->floatDef.name, "float");
+	sprintf(sc->doubleDef.name, "double");
+	sprintf(sc->quadDef.name, "double2");
+	sprintf(sc->half2Def.name, "half2");
+	sprintf(sc->float2Def.name, "float2");
+	sprintf(sc->double2Def.name, "double2");
+	sprintf(sc->quad2Def.name, "struct pf_quad2");
+
+	sprintf(sc->intDef.name, "int");
+	sprintf(sc->uintDef.name, "unsigned int");
+	sprintf(sc->int64Def.name, "long long");
+	sprintf(sc->uint64Def.name, "unsigned long long");
 #endif
 
 
@@ -324,17 +340,17 @@ static inline VkFFTResult initParametersAPI(VkFFTApplication* app, VkFFTSpeciali
 		PfSetContainerName(sc, &sc->g_powStruct, name);
 	}
 	sc->gl_LocalInvocationID_x.type = 100 + sc->uintType32Code;
-	PfAllocateContainerFlexible(sc, &sc->gl_LocalInvocationID_x, 50);
+	PfAllocateContainerFlexible(sc, &sc->gl_LocalInvocationID_x, 100);
 	sc->gl_LocalInvocationID_y.type = 100 + sc->uintType32Code;
-	PfAllocateContainerFlexible(sc, &sc->gl_LocalInvocationID_y, 50);
+	PfAllocateContainerFlexible(sc, &sc->gl_LocalInvocationID_y, 100);
 	sc->gl_LocalInvocationID_z.type = 100 + sc->uintType32Code;
-	PfAllocateContainerFlexible(sc, &sc->gl_LocalInvocationID_z, 50);
+	PfAllocateContainerFlexible(sc, &sc->gl_LocalInvocationID_z, 100);
 	sc->gl_GlobalInvocationID_x.type = 100 + sc->uintType32Code;
-	PfAllocateContainerFlexible(sc, &sc->gl_GlobalInvocationID_x, 50);
+	PfAllocateContainerFlexible(sc, &sc->gl_GlobalInvocationID_x, 100);
 	sc->gl_GlobalInvocationID_y.type = 100 + sc->uintType32Code;
-	PfAllocateContainerFlexible(sc, &sc->gl_GlobalInvocationID_y, 50);
+	PfAllocateContainerFlexible(sc, &sc->gl_GlobalInvocationID_y, 100);
 	sc->gl_GlobalInvocationID_z.type = 100 + sc->uintType32Code;
-	PfAllocateContainerFlexible(sc, &sc->gl_GlobalInvocationID_z, 50);
+	PfAllocateContainerFlexible(sc, &sc->gl_GlobalInvocationID_z, 100);
 	sc->gl_WorkGroupSize_x.type = 100 + sc->uintType32Code;
 	PfAllocateContainerFlexible(sc, &sc->gl_WorkGroupSize_x, 50);
 	sc->gl_WorkGroupSize_y.type = 100 + sc->uintType32Code;
@@ -389,6 +405,14 @@ static inline VkFFTResult initParametersAPI(VkFFTApplication* app, VkFFTSpeciali
 		PfAllocateContainerFlexible(sc, &sc->kernelOffset, 50);
 		sprintf(sc->kernelOffset.name, "kernelOffset");
 	}
+	if (sc->performPostCompilationBatchStride) {
+		sc->inputBatchStride.type = 100 + sc->uintTypeCode;
+		PfAllocateContainerFlexible(sc, &sc->inputBatchStride, 50);
+		sprintf(sc->inputBatchStride.name, "inputBatchStride");
+		sc->outputBatchStride.type = 100 + sc->uintTypeCode;
+		PfAllocateContainerFlexible(sc, &sc->outputBatchStride, 50);
+		sprintf(sc->outputBatchStride.name, "outputBatchStride");
+	}
 #if(VKFFT_BACKEND==0)
 	sprintf(sc->inputsStruct.name, "inputs");
 	sprintf(sc->outputsStruct.name, "outputs");
@@ -543,6 +567,44 @@ static inline VkFFTResult initParametersAPI(VkFFTApplication* app, VkFFTSpeciali
 	//sprintf(sc->cosDef.name, "native_cos");
 	//sprintf(sc->sinDef.name, "native_sin");
 	sprintf(sc->constDef.name, "constant");
+#elif(VKFFT_BACKEND==6)
+	//work-item and workgroup ids of the invocation that is being executed by the thread pool
+	snprintf(sc->inputsStruct.name, sc->inputsStruct.size, "inputs");
+	snprintf(sc->outputsStruct.name, sc->outputsStruct.size, "outputs");
+	snprintf(sc->gl_LocalInvocationID_x.name, sc->gl_LocalInvocationID_x.size, "vkfft_inv->localID[0]");
+	snprintf(sc->gl_LocalInvocationID_y.name, sc->gl_LocalInvocationID_y.size, "vkfft_inv->localID[1]");
+	snprintf(sc->gl_LocalInvocationID_z.name, sc->gl_LocalInvocationID_z.size, "vkfft_inv->localID[2]");
+	switch (sc->swapComputeWorkGroupID) {
+	case 0:
+		snprintf(sc->gl_GlobalInvocationID_x.name, sc->gl_GlobalInvocationID_x.size, "(vkfft_inv->localID[0] + vkfft_inv->groupID[0] * %" PRIi64 ")", sc->localSize[0].data.i);
+		snprintf(sc->gl_GlobalInvocationID_y.name, sc->gl_GlobalInvocationID_y.size, "(vkfft_inv->localID[1] + vkfft_inv->groupID[1] * %" PRIi64 ")", sc->localSize[1].data.i);
+		snprintf(sc->gl_GlobalInvocationID_z.name, sc->gl_GlobalInvocationID_z.size, "(vkfft_inv->localID[2] + vkfft_inv->groupID[2] * %" PRIi64 ")", sc->localSize[2].data.i);
+		snprintf(sc->gl_WorkGroupID_x.name, sc->gl_WorkGroupID_x.size, "vkfft_inv->groupID[0]");
+		snprintf(sc->gl_WorkGroupID_y.name, sc->gl_WorkGroupID_y.size, "vkfft_inv->groupID[1]");
+		snprintf(sc->gl_WorkGroupID_z.name, sc->gl_WorkGroupID_z.size, "vkfft_inv->groupID[2]");
+		break;
+	case 1:
+		snprintf(sc->gl_GlobalInvocationID_x.name, sc->gl_GlobalInvocationID_x.size, "(vkfft_inv->localID[0] + vkfft_inv->groupID[1] * %" PRIi64 ")", sc->localSize[0].data.i);
+		snprintf(sc->gl_GlobalInvocationID_y.name, sc->gl_GlobalInvocationID_y.size, "(vkfft_inv->localID[1] + vkfft_inv->groupID[0] * %" PRIi64 ")", sc->localSize[1].data.i);
+		snprintf(sc->gl_GlobalInvocationID_z.name, sc->gl_GlobalInvocationID_z.size, "(vkfft_inv->localID[2] + vkfft_inv->groupID[2] * %" PRIi64 ")", sc->localSize[2].data.i);
+		snprintf(sc->gl_WorkGroupID_x.name, sc->gl_WorkGroupID_x.size, "vkfft_inv->groupID[1]");
+		snprintf(sc->gl_WorkGroupID_y.name, sc->gl_WorkGroupID_y.size, "vkfft_inv->groupID[0]");
+		snprintf(sc->gl_WorkGroupID_z.name, sc->gl_WorkGroupID_z.size, "vkfft_inv->groupID[2]");
+		break;
+	case 2:
+		snprintf(sc->gl_GlobalInvocationID_x.name, sc->gl_GlobalInvocationID_x.size, "(vkfft_inv->localID[0] + vkfft_inv->groupID[2] * %" PRIi64 ")", sc->localSize[0].data.i);
+		snprintf(sc->gl_GlobalInvocationID_y.name, sc->gl_GlobalInvocationID_y.size, "(vkfft_inv->localID[1] + vkfft_inv->groupID[1] * %" PRIi64 ")", sc->localSize[1].data.i);
+		snprintf(sc->gl_GlobalInvocationID_z.name, sc->gl_GlobalInvocationID_z.size, "(vkfft_inv->localID[2] + vkfft_inv->groupID[0] * %" PRIi64 ")", sc->localSize[2].data.i);
+		snprintf(sc->gl_WorkGroupID_x.name, sc->gl_WorkGroupID_x.size, "vkfft_inv->groupID[2]");
+		snprintf(sc->gl_WorkGroupID_y.name, sc->gl_WorkGroupID_y.size, "vkfft_inv->groupID[1]");
+		snprintf(sc->gl_WorkGroupID_z.name, sc->gl_WorkGroupID_z.size, "vkfft_inv->groupID[0]");
+		break;
+	}
+	snprintf(sc->gl_WorkGroupSize_x.name, sc->gl_WorkGroupSize_x.size, "%" PRIi64 "", sc->localSize[0].data.i);
+	snprintf(sc->gl_WorkGroupSize_y.name, sc->gl_WorkGroupSize_y.size, "%" PRIi64 "", sc->localSize[1].data.i);
+	snprintf(sc->gl_WorkGroupSize_z.name, sc->gl_WorkGroupSize_z.size, "%" PRIi64 "", sc->localSize[2].data.i);
+	snprintf(sc->constDef.name, sc->constDef.size, "const");
+	snprintf(sc->functionDef.name, sc->functionDef.size, "static inline ");
 #endif
 	return res;
 }
@@ -630,6 +692,10 @@ static inline VkFFTResult freeParametersAPI(VkFFTApplication* app, VkFFTSpeciali
 	if (sc->performPostCompilationKernelOffset) {
 		PfDeallocateContainer(sc, &sc->kernelOffset);
 	}
+	if (sc->performPostCompilationBatchStride) {
+		PfDeallocateContainer(sc, &sc->inputBatchStride);
+		PfDeallocateContainer(sc, &sc->outputBatchStride);
+	}
 	return res;
 }
 
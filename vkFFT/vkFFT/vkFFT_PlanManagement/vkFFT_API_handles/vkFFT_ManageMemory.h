@@ -65,8 +65,228 @@ static inline VkFFTResult allocateBufferVulkan(VkFFTApplication* app, VkBuffer*
 }
 #endif
 
+// Plan initialization uploads. Between VkFFT_BeginUploadBatch and VkFFT_EndUploadBatch, VkFFT_TransferDataFromCPU copies the data to a staging area
+// that is reused for all uploads and only records the copy. All recorded copies are submitted in one command buffer (OpenCL - one queue, Level Zero - one
+// command list, CUDA/HIP - asynchronous copies on the default stream, CPU - immediate copies) by VkFFT_FlushUploads, which waits once. The staging area is filled from the start
+// again after each flush. The data can be used by the device only after the flush, so code that dispatches kernels on uploaded buffers or makes them
+// visible to other applications has to flush first.
+#define VKFFT_UPLOAD_STAGING_SIZE 1048576 //default size of the staging area in bytes
+#define VKFFT_UPLOAD_STAGING_ALIGNMENT 256
+
+static inline VkFFTResult VkFFT_FlushUploads(VkFFTApplication* app) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTUploadBatch* batch = &app->uploadBatch;
+	if (batch->numPendingCopies == 0) return resFFT;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	res = vkEndCommandBuffer(batch->commandBuffer);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &batch->commandBuffer;
+	res = vkQueueSubmit(app->configuration.queue[0], 1, &submitInfo, app->configuration.fence[0]);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_SUBMIT_QUEUE;
+	res = vkWaitForFences(app->configuration.device[0], 1, app->configuration.fence, VK_TRUE, 100000000000);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_WAIT_FOR_FENCES;
+	res = vkResetFences(app->configuration.device[0], 1, app->configuration.fence);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_RESET_FENCES;
+	vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &batch->commandBuffer);
+	batch->commandBuffer = 0;
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+	res = cudaStreamSynchronize(0);
+	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+	res = hipStreamSynchronize(0);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	res = clFinish(batch->commandQueue);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+	res = zeCommandListClose(batch->commandList);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	res = zeCommandQueueExecuteCommandLists(app->configuration.commandQueue[0], 1, &batch->commandList, 0);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_SUBMIT_QUEUE;
+	res = zeCommandQueueSynchronize(app->configuration.commandQueue[0], UINT32_MAX);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+	zeCommandListDestroy(batch->commandList);
+	batch->commandList = 0;
+#elif(VKFFT_BACKEND==5)
+	batch->blitCommandEncoder->endEncoding();
+	batch->commandBuffer->commit();
+	batch->commandBuffer->waitUntilCompleted();
+	batch->blitCommandEncoder->release();
+	batch->commandBuffer->release();
+	batch->blitCommandEncoder = 0;
+	batch->commandBuffer = 0;
+#endif
+	batch->offset = 0;
+	batch->numPendingCopies = 0;
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_AllocateUploadStaging(VkFFTApplication* app, pfUINT size) {
+	//replaces the staging area with a new one of the specified size. There must be no pending copies
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTUploadBatch* batch = &app->uploadBatch;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	if (batch->stagingBuffer) vkDestroyBuffer(app->configuration.device[0], batch->stagingBuffer, 0);
+	if (batch->stagingBufferMemory) {
+		vkUnmapMemory(app->configuration.device[0], batch->stagingBufferMemory);
+		vkFreeMemory(app->configuration.device[0], batch->stagingBufferMemory, 0);
+	}
+	batch->stagingBuffer = 0;
+	batch->stagingBufferMemory = 0;
+	batch->stagingData = 0;
+	batch->size = 0;
+	resFFT = allocateBufferVulkan(app, &batch->stagingBuffer, &batch->stagingBufferMemory, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, size);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	res = vkMapMemory(app->configuration.device[0], batch->stagingBufferMemory, 0, size, 0, &batch->stagingData);
+	if (res != VK_SUCCESS) {
+		batch->stagingData = 0;
+		return VKFFT_ERROR_FAILED_TO_MAP_MEMORY;
+	}
+#elif(VKFFT_BACKEND==3)
+	if (batch->stagingData) free(batch->stagingData);
+	batch->size = 0;
+	batch->stagingData = malloc(size);
+	if (!batch->stagingData) return VKFFT_ERROR_MALLOC_FAILED;
+#elif(VKFFT_BACKEND==4)
+	if (batch->stagingData) free(batch->stagingData);
+	batch->size = 0;
+	batch->stagingData = malloc(size);
+	if (!batch->stagingData) return VKFFT_ERROR_MALLOC_FAILED;
+#elif(VKFFT_BACKEND==5)
+	if (batch->stagingBuffer) batch->stagingBuffer->release();
+	batch->size = 0;
+	batch->stagingData = 0;
+	batch->stagingBuffer = app->configuration.device->newBuffer(size, MTL::ResourceStorageModeShared);
+	if (batch->stagingBuffer == 0) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	batch->stagingData = batch->stagingBuffer->contents();
+#endif
+	batch->size = size;
+	batch->offset = 0;
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_QueueUpload(VkFFTApplication* app, void* cpu_arr, void* input_buffer, pfUINT transferSize) {
+	//cpu_arr can be reused as soon as this function returns
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTUploadBatch* batch = &app->uploadBatch;
+#if(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+	void* buffer = ((void**)input_buffer)[0];
+	res = cudaMemcpyAsync(buffer, cpu_arr, transferSize, cudaMemcpyHostToDevice, 0);
+	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_COPY;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+	void* buffer = ((void**)input_buffer)[0];
+	res = hipMemcpyAsync(buffer, cpu_arr, transferSize, hipMemcpyHostToDevice, 0);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_COPY;
+#elif(VKFFT_BACKEND==6)
+	void* buffer = ((void**)input_buffer)[0];
+	memcpy(buffer, cpu_arr, transferSize);
+#else
+	if (batch->offset + transferSize > batch->size) {
+		resFFT = VkFFT_FlushUploads(app);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		if (transferSize > batch->size) {
+			resFFT = VkFFT_AllocateUploadStaging(app, (transferSize > VKFFT_UPLOAD_STAGING_SIZE) ? transferSize : VKFFT_UPLOAD_STAGING_SIZE);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
+	}
+	pfUINT stagingOffset = batch->offset;
+	memcpy((char*)batch->stagingData + stagingOffset, cpu_arr, transferSize);
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	VkBuffer* buffer = (VkBuffer*)input_buffer;
+	if (!batch->commandBuffer) {
+		VkCommandBufferAllocateInfo commandBufferAllocateInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+		commandBufferAllocateInfo.commandPool = app->configuration.commandPool[0];
+		commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		commandBufferAllocateInfo.commandBufferCount = 1;
+		res = vkAllocateCommandBuffers(app->configuration.device[0], &commandBufferAllocateInfo, &batch->commandBuffer);
+		if (res != VK_SUCCESS) {
+			batch->commandBuffer = 0;
+			return VKFFT_ERROR_FAILED_TO_ALLOCATE_COMMAND_BUFFERS;
+		}
+		VkCommandBufferBeginInfo commandBufferBeginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+		commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		res = vkBeginCommandBuffer(batch->commandBuffer, &commandBufferBeginInfo);
+		if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_BEGIN_COMMAND_BUFFER;
+	}
+	VkBufferCopy copyRegion = { 0 };
+	copyRegion.srcOffset = stagingOffset;
+	copyRegion.dstOffset = 0;
+	copyRegion.size = transferSize;
+	vkCmdCopyBuffer(batch->commandBuffer, batch->stagingBuffer, buffer[0], 1, &copyRegion);
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	cl_mem* buffer = (cl_mem*)input_buffer;
+	if (!batch->commandQueue) {
+		batch->commandQueue = clCreateCommandQueue(app->configuration.context[0], app->configuration.device[0], 0, &res);
+		if (res != CL_SUCCESS) {
+			batch->commandQueue = 0;
+			return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_QUEUE;
+		}
+	}
+	res = clEnqueueWriteBuffer(batch->commandQueue, buffer[0], CL_FALSE, 0, transferSize, (char*)batch->stagingData + stagingOffset, 0, NULL, NULL);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_COPY;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+	void* buffer = ((void**)input_buffer)[0];
+	if (!batch->commandList) {
+		ze_command_list_desc_t commandListDescription = VKFFT_ZERO_INIT;
+		commandListDescription.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+		commandListDescription.commandQueueGroupOrdinal = (uint32_t)app->configuration.commandQueueID;
+		res = zeCommandListCreate(app->configuration.context[0], app->configuration.device[0], &commandListDescription, &batch->commandList);
+		if (res != ZE_RESULT_SUCCESS) {
+			batch->commandList = 0;
+			return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+		}
+	}
+	res = zeCommandListAppendMemoryCopy(batch->commandList, buffer, (char*)batch->stagingData + stagingOffset, transferSize, 0, 0, 0);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_COPY;
+#elif(VKFFT_BACKEND==5)
+	MTL::Buffer* buffer = ((MTL::Buffer**)input_buffer)[0];
+	if (!batch->commandBuffer) {
+		batch->commandBuffer = app->configuration.queue->commandBuffer();
+		if (batch->commandBuffer == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+		batch->blitCommandEncoder = batch->commandBuffer->blitCommandEncoder();
+		if (batch->blitCommandEncoder == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	}
+	batch->blitCommandEncoder->copyFromBuffer(batch->stagingBuffer, stagingOffset, buffer, 0, transferSize);
+#endif
+	batch->offset = stagingOffset + ((transferSize + VKFFT_UPLOAD_STAGING_ALIGNMENT - 1) / VKFFT_UPLOAD_STAGING_ALIGNMENT) * VKFFT_UPLOAD_STAGING_ALIGNMENT;
+#endif
+	batch->numPendingCopies++;
+	return resFFT;
+}
+
+static inline void VkFFT_BeginUploadBatch(VkFFTApplication* app) {
+#if(VKFFT_BACKEND==0)
+	//the user defined staging buffer is used as before, one transfer at a time
+	if (app->configuration.stagingBuffer) return;
+#endif
+	app->uploadBatch.active = 1;
+}
+
+static inline VkFFTResult VkFFT_EndUploadBatch(VkFFTApplication* app) {
+	//submits the remaining copies and frees the staging area
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	resFFT = VkFFT_FlushUploads(app);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	VkFFT_FreeUploadBatch(app);
+	return resFFT;
+}
+
 static inline VkFFTResult VkFFT_TransferDataFromCPU(VkFFTApplication* app, void* cpu_arr, void* input_buffer, pfUINT transferSize) {
 	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (app->uploadBatch.active) return VkFFT_QueueUpload(app, cpu_arr, input_buffer, transferSize);
 #if(VKFFT_BACKEND==0)
 	VkBuffer* buffer = (VkBuffer*)input_buffer;
 	VkDeviceSize bufferSize = transferSize;
@@ -186,6 +406,9 @@ static inline VkFFTResult VkFFT_TransferDataFromCPU(VkFFTApplication* app, void*
 	blitCommandEncoder->release();
 	copyCommandBuffer->release();
 	stagingBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	void* buffer = ((void**)input_buffer)[0];
+	memcpy(buffer, cpu_arr, transferSize);
 #endif
 	return resFFT;
 }
@@ -311,8 +534,187 @@ static inline VkFFTResult VkFFT_TransferDataToCPU(VkFFTApplication* app, void* c
 	copyCommandBuffer->release();
 	memcpy(cpu_arr, stagingBuffer->contents(), transferSize);
 	stagingBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	void* buffer = ((void**)output_buffer)[0];
+	memcpy(cpu_arr, buffer, transferSize);
 #endif
 	return resFFT;
 }
+static inline VkFFTResult VkFFT_AllocateTempBuffer(VkFFTApplication* app) {
+	//allocates a temp buffer of tempBufferSize[0] bytes, freed with VkFFT_FreeTempBuffer
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+#elif(VKFFT_BACKEND==5)
+#endif
+#if(VKFFT_BACKEND==0)
+	app->configuration.tempBuffer = (VkBuffer*)malloc(sizeof(VkBuffer));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	resFFT = allocateBufferVulkan(app, app->configuration.tempBuffer, &app->configuration.tempBufferDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, app->configuration.tempBufferSize[0]);
+	if (resFFT != VKFFT_SUCCESS) {
+		return resFFT;
+	}
+#elif(VKFFT_BACKEND==1)
+	app->configuration.tempBuffer = (void**)malloc(sizeof(void*));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	res = cudaMalloc(app->configuration.tempBuffer, app->configuration.tempBufferSize[0]);
+	if (res != cudaSuccess) {
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	}
+#elif(VKFFT_BACKEND==2)
+	app->configuration.tempBuffer = (void**)malloc(sizeof(void*));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	res = hipMalloc(app->configuration.tempBuffer, app->configuration.tempBufferSize[0]);
+	if (res != hipSuccess) {
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	}
+#elif(VKFFT_BACKEND==3)
+	app->configuration.tempBuffer = (cl_mem*)malloc(sizeof(cl_mem));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	app->configuration.tempBuffer[0] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, app->configuration.tempBufferSize[0], 0, &res);
+	if (res != CL_SUCCESS) {
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	}
+#elif(VKFFT_BACKEND==4)
+	app->configuration.tempBuffer = (void**)malloc(sizeof(void*));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+	device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+	res = zeMemAllocDevice(app->configuration.context[0], &device_desc, app->configuration.tempBufferSize[0], sizeof(float), app->configuration.device[0], app->configuration.tempBuffer);
+	if (res != ZE_RESULT_SUCCESS) {
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	}
+#elif(VKFFT_BACKEND==5)
+	app->configuration.tempBuffer = (MTL::Buffer**)malloc(sizeof(MTL::Buffer*));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	app->configuration.tempBuffer[0] = app->configuration.device->newBuffer(app->configuration.tempBufferSize[0], MTL::ResourceStorageModePrivate);
+#elif(VKFFT_BACKEND==6)
+	app->configuration.tempBuffer = (void**)calloc(1, sizeof(void*));
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	app->configuration.tempBuffer[0] = malloc(app->configuration.tempBufferSize[0]);
+	if (!app->configuration.tempBuffer[0]) {
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	}
+#endif
+	return resFFT;
+}
+
+// Workspace sub-allocation. Buffers created in the user workspace don't own memory: CUDA, HIP, Level Zero and CPU buffers are pointers into it and
+// are never freed, Vulkan buffers are bound to the workspace memory and OpenCL sub-buffers and Metal heap buffers are released as usual.
+#define VKFFT_WORKSPACE_ALIGNMENT 256 //minimal alignment of workspace offsets in bytes
+
+static inline pfUINT VkFFT_GetWorkspaceAlignment(VkFFTApplication* app) {
+	pfUINT alignment = VKFFT_WORKSPACE_ALIGNMENT;
+	//device handles are not set in dryRun mode
+#if(VKFFT_BACKEND==3)
+	if (app->configuration.device) {
+		cl_uint baseAddressAlignment = 0;
+		if ((clGetDeviceInfo(app->configuration.device[0], CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint), &baseAddressAlignment, 0) == CL_SUCCESS) && (baseAddressAlignment / 8 > alignment))
+			alignment = baseAddressAlignment / 8;
+	}
+#elif(VKFFT_BACKEND==5)
+	if (app->configuration.device) {
+		MTL::SizeAndAlign sizeAndAlign = app->configuration.device->heapBufferSizeAndAlign(1, MTL::ResourceStorageModePrivate);
+		if (sizeAndAlign.align > alignment) alignment = sizeAndAlign.align;
+	}
+#endif
+	return alignment;
+}
+static inline pfUINT VkFFT_AlignWorkspaceSize(pfUINT size, pfUINT alignment) {
+	return ((size + alignment - 1) / alignment) * alignment;
+}
+static inline VkFFTResult VkFFT_AllocateWorkspaceBuffer(VkFFTApplication* app, void* buffer, pfUINT offset, pfUINT size) {
+	//creates a buffer of size bytes at offset in workspace. buffer points to the buffer handle
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (offset + size > app->configuration.workspaceSize) return VKFFT_ERROR_INVALID_workspace_too_small;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	VkBuffer* workspaceBuffer = (VkBuffer*)buffer;
+	VkBufferCreateInfo bufferCreateInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+	bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	bufferCreateInfo.size = size;
+	bufferCreateInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	res = vkCreateBuffer(app->configuration.device[0], &bufferCreateInfo, 0, workspaceBuffer);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_BUFFER;
+	VkMemoryRequirements memoryRequirements = { 0 };
+	vkGetBufferMemoryRequirements(app->configuration.device[0], workspaceBuffer[0], &memoryRequirements);
+	if (offset % memoryRequirements.alignment) return VKFFT_ERROR_INVALID_workspaceOffset;
+	if (offset + memoryRequirements.size > app->configuration.workspaceSize) return VKFFT_ERROR_INVALID_workspace_too_small;
+	res = vkBindBufferMemory(app->configuration.device[0], workspaceBuffer[0], app->configuration.workspace[0], offset);
+	if (res != VK_SUCCESS) return VKFFT_ERROR_FAILED_TO_BIND_BUFFER_MEMORY;
+#elif((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4) || (VKFFT_BACKEND==6))
+	((void**)buffer)[0] = (void*)((char*)app->configuration.workspace[0] + offset);
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	cl_buffer_region region = { (size_t)offset, (size_t)size };
+	((cl_mem*)buffer)[0] = clCreateSubBuffer(app->configuration.workspace[0], CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region, &res);
+	if (res == CL_MISALIGNED_SUB_BUFFER_OFFSET) {
+		((cl_mem*)buffer)[0] = 0;
+		return VKFFT_ERROR_INVALID_workspaceOffset;
+	}
+	if (res != CL_SUCCESS) {
+		((cl_mem*)buffer)[0] = 0;
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+	}
+#elif(VKFFT_BACKEND==5)
+	((MTL::Buffer**)buffer)[0] = app->configuration.workspace[0]->newBuffer(size, app->configuration.workspace[0]->resourceOptions(), offset);
+	if (((MTL::Buffer**)buffer)[0] == 0) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#endif
+	return resFFT;
+}
+static inline VkFFTResult VkFFT_AllocateWorkspaceTempBuffer(VkFFTApplication* app) {
+	//places the temp buffer of tempBufferSize[0] bytes at workspaceTempOffset, freed with VkFFT_FreeTempBuffer
+#if(VKFFT_BACKEND==0)
+	app->configuration.tempBuffer = (VkBuffer*)calloc(1, sizeof(VkBuffer));
+#elif(VKFFT_BACKEND==3)
+	app->configuration.tempBuffer = (cl_mem*)calloc(1, sizeof(cl_mem));
+#elif(VKFFT_BACKEND==5)
+	app->configuration.tempBuffer = (MTL::Buffer**)calloc(1, sizeof(MTL::Buffer*));
+#else
+	app->configuration.tempBuffer = (void**)calloc(1, sizeof(void*));
+#endif
+	if (!app->configuration.tempBuffer) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	if (app->configuration.workspaceTempOffset % VkFFT_GetWorkspaceAlignment(app)) return VKFFT_ERROR_INVALID_workspaceOffset;
+	return VkFFT_AllocateWorkspaceBuffer(app, app->configuration.tempBuffer, app->configuration.workspaceTempOffset, app->configuration.tempBufferSize[0]);
+}
+static inline VkFFTResult VkFFT_AllocateWorkspaceBluestein(VkFFTApplication* app, pfUINT axis_id, pfUINT bufferSize) {
+	//places Bluestein buffers of the axis after the ones of previous axes, starting at workspaceBluesteinOffset. The order matches VkFFTGetWorkspaceSize
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	pfUINT alignment = VkFFT_GetWorkspaceAlignment(app);
+	if (app->configuration.workspaceBluesteinOffset % alignment) return VKFFT_ERROR_INVALID_workspaceOffset;
+	for (pfUINT i = 0; i < 3; i++) {
+		if ((i == 1) && (app->configuration.makeInversePlanOnly)) continue;
+		if ((i == 2) && (app->configuration.makeForwardPlanOnly)) continue;
+		void* buffer = (i == 0) ? (void*)&app->bufferBluestein[axis_id] : ((i == 1) ? (void*)&app->bufferBluesteinFFT[axis_id] : (void*)&app->bufferBluesteinIFFT[axis_id]);
+		resFFT = VkFFT_AllocateWorkspaceBuffer(app, buffer, app->configuration.workspaceBluesteinOffset + app->workspaceBluesteinUsed, bufferSize);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		app->workspaceBluesteinUsed += VkFFT_AlignWorkspaceSize(bufferSize, alignment);
+	}
+	return resFFT;
+}
 
 #endif
@@ -23,7 +23,42 @@
 #define VKFFT_UPDATEBUFFERS_H
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_Descriptors.h"
 
+#if(VKFFT_BACKEND==0)
+static inline VkFFTResult VkFFT_CreateDescriptorSetLayout(VkFFTApplication* app, VkFFTAxis* axis) {
+	pfUINT numDescriptors = 0;
+	for (pfUINT i = 0; i < axis->numBindings; i++)
+		numDescriptors += (pfUINT)axis->specializationConstants.numBuffersBound[i];
+	axis->usePushDescriptors = ((app->configuration.usePushDescriptors) && (numDescriptors <= VKFFT_MAX_PUSH_DESCRIPTORS)) ? 1 : 0;
+	const VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	VkDescriptorSetLayoutBinding* descriptorSetLayoutBindings;
+	descriptorSetLayoutBindings = (VkDescriptorSetLayoutBinding*)malloc(axis->numBindings * sizeof(VkDescriptorSetLayoutBinding));
+	if (!descriptorSetLayoutBindings) {
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	for (pfUINT i = 0; i < axis->numBindings; ++i) {
+		descriptorSetLayoutBindings[i].binding = (uint32_t)i;
+		descriptorSetLayoutBindings[i].descriptorType = descriptorType;
+		descriptorSetLayoutBindings[i].descriptorCount = (uint32_t)axis->specializationConstants.numBuffersBound[i];
+		descriptorSetLayoutBindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		descriptorSetLayoutBindings[i].pImmutableSamplers = 0;
+	}
+
+	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+	if (axis->usePushDescriptors) descriptorSetLayoutCreateInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+	descriptorSetLayoutCreateInfo.bindingCount = (uint32_t)axis->numBindings;
+	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings;
+
+	VkResult res = vkCreateDescriptorSetLayout(app->configuration.device[0], &descriptorSetLayoutCreateInfo, 0, &axis->descriptorSetLayout);
+	free(descriptorSetLayoutBindings);
+	descriptorSetLayoutBindings = 0;
+	if (res != VK_SUCCESS) {
+		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_SET_LAYOUT;
+	}
+	return VkFFT_AllocateDescriptorSets(app, axis);
+}
+#endif
 static inline VkFFTResult VkFFTConfigureDescriptors(VkFFTApplication* app, VkFFTPlan* FFTPlan, VkFFTAxis* axis, pfUINT axis_id, pfUINT axis_upload_id, pfUINT inverse) {
 	pfUINT initPageSize = -1;
 	pfUINT locBufferNum = 1;
@@ -235,33 +270,20 @@ static inline VkFFTResult VkFFTConfigureDescriptors(VkFFTApplication* app, VkFFT
 	axis->specializationConstants.numBuffersBound[1] = (int)axis->specializationConstants.outputBufferBlockNum;
 	axis->specializationConstants.numBuffersBound[2] = 0;
 	axis->specializationConstants.numBuffersBound[3] = 0;
-#if(VKFFT_BACKEND==0)
-	VkDescriptorPoolSize descriptorPoolSize = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER };
-	descriptorPoolSize.descriptorCount = (uint32_t)(axis->specializationConstants.inputBufferBlockNum + axis->specializationConstants.outputBufferBlockNum);
-#endif
 	axis->specializationConstants.convolutionBindingID = -1;
 	if ((axis_id == (app->configuration.FFTdim-1)) && (axis_upload_id == 0) && (app->configuration.performConvolution)) {
 		axis->specializationConstants.convolutionBindingID = (int)axis->numBindings;
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = (int)axis->specializationConstants.kernelBlockNum;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount += (uint32_t)axis->specializationConstants.kernelBlockNum;
-#endif
 		axis->numBindings++;
 	}
 	if (app->configuration.useLUT == 1) {
 		axis->specializationConstants.LUTBindingID = (int)axis->numBindings;
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = 1;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount++;
-#endif
 		axis->numBindings++;
 	}
 	if (axis->specializationConstants.raderUintLUT) {
 		axis->specializationConstants.RaderUintLUTBindingID = (int)axis->numBindings;
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = 1;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount++;
-#endif
 		axis->numBindings++;
 	}
 	if ((app->useBluesteinFFT[axis_id]) && (axis_upload_id == 0)) {
@@ -271,64 +293,20 @@ static inline VkFFTResult VkFFTConfigureDescriptors(VkFFTApplication* app, VkFFT
 			axis->bufferBluesteinFFT = &app->bufferBluesteinFFT[axis_id];
 		axis->specializationConstants.BluesteinConvolutionBindingID = (int)axis->numBindings;
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = 1;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount++;
-#endif
 		axis->numBindings++;
 	}
 	if ((app->useBluesteinFFT[axis_id]) && (axis_upload_id == (FFTPlan->numAxisUploads[axis_id] - 1))) {
 		axis->bufferBluestein = &app->bufferBluestein[axis_id];
 		axis->specializationConstants.BluesteinMultiplicationBindingID = (int)axis->numBindings;
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = 1;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount++;
-#endif
 		axis->numBindings++;
 	}
 #if(VKFFT_BACKEND==0)
-	VkResult res = VK_SUCCESS;
-	VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
-	descriptorPoolCreateInfo.poolSizeCount = 1;
-	descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
-	descriptorPoolCreateInfo.maxSets = 1;
-	res = vkCreateDescriptorPool(app->configuration.device[0], &descriptorPoolCreateInfo, 0, &axis->descriptorPool);
-	if (res != VK_SUCCESS) {
-		deleteVkFFT(app);
-		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_POOL;
-	}
-	const VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-	VkDescriptorSetLayoutBinding* descriptorSetLayoutBindings;
-	descriptorSetLayoutBindings = (VkDescriptorSetLayoutBinding*)malloc(axis->numBindings * sizeof(VkDescriptorSetLayoutBinding));
-	if (!descriptorSetLayoutBindings) {
-		deleteVkFFT(app);
-		return VKFFT_ERROR_MALLOC_FAILED;
-	}
-	for (pfUINT i = 0; i < axis->numBindings; ++i) {
-		descriptorSetLayoutBindings[i].binding = (uint32_t)i;
-		descriptorSetLayoutBindings[i].descriptorType = descriptorType;
-		descriptorSetLayoutBindings[i].descriptorCount = (uint32_t)axis->specializationConstants.numBuffersBound[i];
-		descriptorSetLayoutBindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-	}
-
-	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
-	descriptorSetLayoutCreateInfo.bindingCount = (uint32_t)axis->numBindings;
-	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings;
-
-	res = vkCreateDescriptorSetLayout(app->configuration.device[0], &descriptorSetLayoutCreateInfo, 0, &axis->descriptorSetLayout);
-	if (res != VK_SUCCESS) {
-		deleteVkFFT(app);
-		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_SET_LAYOUT;
-	}
-	free(descriptorSetLayoutBindings);
-	descriptorSetLayoutBindings = 0;
-	VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
-	descriptorSetAllocateInfo.descriptorPool = axis->descriptorPool;
-	descriptorSetAllocateInfo.descriptorSetCount = 1;
-	descriptorSetAllocateInfo.pSetLayouts = &axis->descriptorSetLayout;
-	res = vkAllocateDescriptorSets(app->configuration.device[0], &descriptorSetAllocateInfo, &axis->descriptorSet);
-	if (res != VK_SUCCESS) {
+	if (app->configuration.dryRun) return VKFFT_SUCCESS;
+	VkFFTResult resFFT = VkFFT_CreateDescriptorSetLayout(app, axis);
+	if (resFFT != VKFFT_SUCCESS) {
 		deleteVkFFT(app);
-		return VKFFT_ERROR_FAILED_TO_ALLOCATE_DESCRIPTOR_SETS;
+		return resFFT;
 	}
 #endif
 	return VKFFT_SUCCESS;
@@ -558,73 +536,46 @@ static inline VkFFTResult VkFFTConfigureDescriptorsR2CMultiUploadDecomposition(V
 	axis->specializationConstants.numBuffersBound[2] = 0;
 	axis->specializationConstants.numBuffersBound[3] = 0;
 
-#if(VKFFT_BACKEND==0)
-	VkDescriptorPoolSize descriptorPoolSize = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER };
-	descriptorPoolSize.descriptorCount = (uint32_t)(axis->specializationConstants.numBuffersBound[0] + axis->specializationConstants.numBuffersBound[1]);
-#endif
 	if ((axis_id == (app->configuration.FFTdim-1)) && (axis_upload_id == 0) && (app->configuration.performConvolution)) {
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = (int)axis->specializationConstants.kernelBlockNum;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount += (uint32_t)axis->specializationConstants.kernelBlockNum;
-#endif
 		axis->numBindings++;
 	}
 
 	if (app->configuration.useLUT == 1) {
 		axis->specializationConstants.numBuffersBound[axis->numBindings] = 1;
-#if(VKFFT_BACKEND==0)
-		descriptorPoolSize.descriptorCount++;
-#endif
 		axis->numBindings++;
 	}
 #if(VKFFT_BACKEND==0)
-	VkResult res = VK_SUCCESS;
-	VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
-	descriptorPoolCreateInfo.poolSizeCount = 1;
-	descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
-	descriptorPoolCreateInfo.maxSets = 1;
-	res = vkCreateDescriptorPool(app->configuration.device[0], &descriptorPoolCreateInfo, 0, &axis->descriptorPool);
-	if (res != VK_SUCCESS) {
-		deleteVkFFT(app);
-		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_POOL;
-	}
-	const VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-	VkDescriptorSetLayoutBinding* descriptorSetLayoutBindings;
-	descriptorSetLayoutBindings = (VkDescriptorSetLayoutBinding*)malloc(axis->numBindings * sizeof(VkDescriptorSetLayoutBinding));
-	if (!descriptorSetLayoutBindings) {
-		deleteVkFFT(app);
-		return VKFFT_ERROR_MALLOC_FAILED;
-	}
-	for (pfUINT i = 0; i < axis->numBindings; ++i) {
-		descriptorSetLayoutBindings[i].binding = (uint32_t)i;
-		descriptorSetLayoutBindings[i].descriptorType = descriptorType;
-		descriptorSetLayoutBindings[i].descriptorCount = (uint32_t)axis->specializationConstants.numBuffersBound[i];
-		descriptorSetLayoutBindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
-	}
-
-	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
-	descriptorSetLayoutCreateInfo.bindingCount = (uint32_t)axis->numBindings;
-	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings;
-
-	res = vkCreateDescriptorSetLayout(app->configuration.device[0], &descriptorSetLayoutCreateInfo, 0, &axis->descriptorSetLayout);
-	if (res != VK_SUCCESS) {
-		deleteVkFFT(app);
-		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_SET_LAYOUT;
-	}
-	free(descriptorSetLayoutBindings);
-	descriptorSetLayoutBindings = 0;
-	VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
-	descriptorSetAllocateInfo.descriptorPool = axis->descriptorPool;
-	descriptorSetAllocateInfo.descriptorSetCount = 1;
-	descriptorSetAllocateInfo.pSetLayouts = &axis->descriptorSetLayout;
-	res = vkAllocateDescriptorSets(app->configuration.device[0], &descriptorSetAllocateInfo, &axis->descriptorSet);
-	if (res != VK_SUCCESS) {
+	if (app->configuration.dryRun) return VKFFT_SUCCESS;
+	VkFFTResult resFFT = VkFFT_CreateDescriptorSetLayout(app, axis);
+	if (resFFT != VKFFT_SUCCESS) {
 		deleteVkFFT(app);
-		return VKFFT_ERROR_FAILED_TO_ALLOCATE_DESCRIPTOR_SETS;
+		return resFFT;
 	}
 #endif
 	return VKFFT_SUCCESS;
 }
+static inline pfUINT VkFFT_GetBatchStrideSource(VkFFTApplication* app, pfUINT* usedStride) {
+	if (usedStride == app->configuration.inputBufferStride) return 2;
+	if (usedStride == app->configuration.outputBufferStride) return 3;
+	return 1;
+}
+static inline VkFFTResult VkFFT_UpdateLaunchBatches(VkFFTApplication* app, VkFFTLaunchParams* launchParams) {
+	//zero selects the value of the initializeVkFFT call. Batches can't overlap and have to fit in the extent planned during the initializeVkFFT call
+	pfUINT numberBatches = (launchParams->numberBatches != 0) ? launchParams->numberBatches : app->maxNumberBatches;
+	pfUINT batchStride[4];
+	batchStride[0] = 1;
+	batchStride[1] = (launchParams->bufferBatchStride != 0) ? launchParams->bufferBatchStride : app->initBatchStride[1];
+	batchStride[2] = (launchParams->inputBufferBatchStride != 0) ? launchParams->inputBufferBatchStride : app->initBatchStride[2];
+	batchStride[3] = (launchParams->outputBufferBatchStride != 0) ? launchParams->outputBufferBatchStride : app->initBatchStride[3];
+	if (numberBatches > app->maxNumberBatches) return VKFFT_ERROR_INVALID_numberBatches;
+	for (pfUINT i = 1; i < 4; i++) {
+		if ((batchStride[i] < app->initBatchStride[i]) || (numberBatches * batchStride[i] > app->maxNumberBatches * app->initBatchStride[i])) return VKFFT_ERROR_INVALID_numberBatches;
+	}
+	app->configuration.numberBatches = numberBatches;
+	memcpy(app->batchStride, batchStride, sizeof(batchStride));
+	return VKFFT_SUCCESS;
+}
 static inline VkFFTResult VkFFTCheckUpdateBufferSet(VkFFTApplication* app, VkFFTAxis* axis, pfUINT planStage, VkFFTLaunchParams* launchParams) {
 	pfUINT performBufferSetUpdate = planStage;
 	pfUINT performOffsetUpdate = planStage;
@@ -673,6 +624,10 @@ static inline VkFFTResult VkFFTCheckUpdateBufferSet(VkFFTApplication* app, VkFFT
 				app->configuration.kernelOffset = launchParams->kernelOffset;
 				performOffsetUpdate = 1;
 			}
+			if (app->configuration.specifyBatchesAtLaunch) {
+				VkFFTResult resFFT = VkFFT_UpdateLaunchBatches(app, launchParams);
+				if (resFFT != VKFFT_SUCCESS) return resFFT;
+			}
 		}
 	}
 	if (planStage) {
@@ -691,6 +646,10 @@ static inline VkFFTResult VkFFTCheckUpdateBufferSet(VkFFTApplication* app, VkFFT
 		if ((app->configuration.performConvolution) && (app->configuration.kernel == 0)) {
 			performBufferSetUpdate = 0;
 		}
+		if (app->configuration.dryRun) {
+			//there are no buffers to bind, only offsets are updated
+			performBufferSetUpdate = 0;
+		}
 	}
 	else {
 		if (app->configuration.buffer == 0) {
@@ -779,7 +738,7 @@ static inline VkFFTResult VkFFTUpdateBufferSet(VkFFTApplication* app, VkFFTPlan*
 		axis->specializationConstants.outputOffset.type = 31;
 		axis->specializationConstants.kernelOffset.type = 31;
 #if(VKFFT_BACKEND==0)
-		const VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		pfUINT descriptorID = 0;
 #endif
 		for (pfUINT i = 0; i < axis->numBindings; ++i) {
 			for (pfUINT j = 0; j < axis->specializationConstants.numBuffersBound[i]; ++j) {
@@ -1176,18 +1135,17 @@ static inline VkFFTResult VkFFTUpdateBufferSet(VkFFTApplication* app, VkFFTPlan*
 				}
 #if(VKFFT_BACKEND==0)
 				if (axis->specializationConstants.performBufferSetUpdate) {
-					VkWriteDescriptorSet writeDescriptorSet = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-					writeDescriptorSet.dstSet = axis->descriptorSet;
-					writeDescriptorSet.dstBinding = (uint32_t)i;
-					writeDescriptorSet.dstArrayElement = (uint32_t)j;
-					writeDescriptorSet.descriptorType = descriptorType;
-					writeDescriptorSet.descriptorCount = 1;
-					writeDescriptorSet.pBufferInfo = &descriptorBufferInfo;
-					vkUpdateDescriptorSets(app->configuration.device[0], 1, &writeDescriptorSet, 0, 0);
+					axis->descriptorBufferInfo[descriptorID] = descriptorBufferInfo;
 				}
+				descriptorID++;
 #endif
 			}
 		}
+#if(VKFFT_BACKEND==0)
+		if (axis->specializationConstants.performBufferSetUpdate) {
+			VkFFT_UpdateDescriptorSet(app, axis);
+		}
+#endif
 	}
 	if (axis->specializationConstants.performBufferSetUpdate) {
 		axis->specializationConstants.performBufferSetUpdate = 0;
@@ -1200,7 +1158,7 @@ static inline VkFFTResult VkFFTUpdateBufferSet(VkFFTApplication* app, VkFFTPlan*
 static inline VkFFTResult VkFFTUpdateBufferSetR2CMultiUploadDecomposition(VkFFTApplication* app, VkFFTPlan* FFTPlan, VkFFTAxis* axis, pfUINT axis_id, pfUINT axis_upload_id, pfUINT inverse) {
 	if (axis->specializationConstants.performOffsetUpdate || axis->specializationConstants.performBufferSetUpdate) {
 #if(VKFFT_BACKEND==0)
-		const VkDescriptorType descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		pfUINT descriptorID = 0;
 #endif
 		for (pfUINT i = 0; i < axis->numBindings; ++i) {
 			for (pfUINT j = 0; j < axis->specializationConstants.numBuffersBound[i]; ++j) {
@@ -1555,18 +1513,17 @@ static inline VkFFTResult VkFFTUpdateBufferSetR2CMultiUploadDecomposition(VkFFTA
 				}
 #if(VKFFT_BACKEND==0)
 				if (axis->specializationConstants.performBufferSetUpdate) {
-					VkWriteDescriptorSet writeDescriptorSet = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-					writeDescriptorSet.dstSet = axis->descriptorSet;
-					writeDescriptorSet.dstBinding = (uint32_t)i;
-					writeDescriptorSet.dstArrayElement = (uint32_t)j;
-					writeDescriptorSet.descriptorType = descriptorType;
-					writeDescriptorSet.descriptorCount = 1;
-					writeDescriptorSet.pBufferInfo = &descriptorBufferInfo;
-					vkUpdateDescriptorSets(app->configuration.device[0], 1, &writeDescriptorSet, 0, 0);
+					axis->descriptorBufferInfo[descriptorID] = descriptorBufferInfo;
 				}
+				descriptorID++;
 #endif
 			}
 		}
+#if(VKFFT_BACKEND==0)
+		if (axis->specializationConstants.performBufferSetUpdate) {
+			VkFFT_UpdateDescriptorSet(app, axis);
+		}
+#endif
 	}
 	if (axis->specializationConstants.performBufferSetUpdate) {
 		axis->specializationConstants.performBufferSetUpdate = 0;
@@ -0,0 +1,192 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_APPLICATIONSTRING_H
+#define VKFFT_APPLICATIONSTRING_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+
+// Application string layout (all fields are pfUINT, offsets are in bytes from the start of the string):
+// header - magic, format version, total size, VkFFT version, backend, device hash, configuration hash, number of entries
+// table of contents - key, offset and size of each entry, sorted by key
+// data - compiled kernel binaries, Bluestein kernel preparation applications (nested application strings) and Rader FFT kernels
+// Entries are looked up by binary search of the key, so kernels can be loaded in any order and a string can be partially read without parsing all previous entries.
+
+#define VKFFT_APPLICATION_STRING_MAGIC 0x5050415446464B56 // "VKFFTAPP"
+#define VKFFT_APPLICATION_STRING_FORMAT_VERSION 3
+#define VKFFT_APPLICATION_STRING_HEADER_SIZE 8
+#define VKFFT_APPLICATION_STRING_ENTRY_SIZE 3
+
+#define VKFFT_APPLICATION_STRING_AXIS 1
+#define VKFFT_APPLICATION_STRING_INVERSE_BLUESTEIN_AXIS 2
+#define VKFFT_APPLICATION_STRING_R2C_DECOMPOSITION 3
+#define VKFFT_APPLICATION_STRING_BLUESTEIN_APPLICATION 4
+#define VKFFT_APPLICATION_STRING_RADER_KERNEL 5
+
+static inline pfUINT VkFFT_GetApplicationStringKey(pfUINT type, pfUINT inverse, pfUINT axis_id, pfUINT axis_upload_id) {
+	return type + (inverse << 8) + (axis_id << 16) + (axis_upload_id << 32);
+}
+
+static inline VkFFTResult VkFFTCheckApplicationString(VkFFTApplication* app) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	pfUINT header[VKFFT_APPLICATION_STRING_HEADER_SIZE];
+	if ((app->configuration.loadApplicationStringSize) && (app->configuration.loadApplicationStringSize < sizeof(header))) return VKFFT_ERROR_INVALID_applicationString;
+	memcpy(header, app->configuration.loadApplicationString, sizeof(header));
+	if ((header[0] != VKFFT_APPLICATION_STRING_MAGIC) || (header[1] != VKFFT_APPLICATION_STRING_FORMAT_VERSION) || (header[4] != VKFFT_BACKEND)) return VKFFT_ERROR_INVALID_applicationString;
+	if ((app->configuration.loadApplicationStringSize) && (header[2] > app->configuration.loadApplicationStringSize)) return VKFFT_ERROR_INVALID_applicationString;
+	if (header[2] < (VKFFT_APPLICATION_STRING_HEADER_SIZE + header[7] * VKFFT_APPLICATION_STRING_ENTRY_SIZE) * sizeof(pfUINT)) return VKFFT_ERROR_INVALID_applicationString;
+	pfUINT previousKey = 0;
+	for (pfUINT i = 0; i < header[7]; i++) {
+		pfUINT entry[VKFFT_APPLICATION_STRING_ENTRY_SIZE];
+		memcpy(entry, (char*)app->configuration.loadApplicationString + (VKFFT_APPLICATION_STRING_HEADER_SIZE + i * VKFFT_APPLICATION_STRING_ENTRY_SIZE) * sizeof(pfUINT), sizeof(entry));
+		if ((entry[1] > header[2]) || (entry[2] > header[2] - entry[1])) return VKFFT_ERROR_INVALID_applicationString;
+		if ((i > 0) && (entry[0] < previousKey)) return VKFFT_ERROR_INVALID_applicationString;
+		previousKey = entry[0];
+	}
+	if (!app->deviceHash) {
+		resFFT = VkFFT_GetDeviceHash(app, &app->deviceHash);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+#ifdef VKFFT_VERSION
+	if (header[3] != VKFFT_VERSION) return VKFFT_ERROR_MISMATCHING_applicationString;
+#endif
+	if ((header[5] != app->deviceHash) || (header[6] != app->configurationHash)) return VKFFT_ERROR_MISMATCHING_applicationString;
+	app->applicationStringSize = header[2];
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_FindApplicationStringEntry(VkFFTApplication* app, pfUINT key, pfUINT* offset, pfUINT* size) {
+	//string has been validated by VkFFTCheckApplicationString, so the table of contents is sorted. A missing entry means that the string was saved from a different plan
+	pfUINT numEntries = 0;
+	memcpy(&numEntries, (char*)app->configuration.loadApplicationString + (VKFFT_APPLICATION_STRING_HEADER_SIZE - 1) * sizeof(pfUINT), sizeof(pfUINT));
+	pfUINT first = 0;
+	pfUINT last = numEntries;
+	while (first < last) {
+		pfUINT i = first + (last - first) / 2;
+		pfUINT entry[VKFFT_APPLICATION_STRING_ENTRY_SIZE];
+		memcpy(entry, (char*)app->configuration.loadApplicationString + (VKFFT_APPLICATION_STRING_HEADER_SIZE + i * VKFFT_APPLICATION_STRING_ENTRY_SIZE) * sizeof(pfUINT), sizeof(entry));
+		if (entry[0] == key) {
+			offset[0] = entry[1];
+			size[0] = entry[2];
+			return VKFFT_SUCCESS;
+		}
+		if (entry[0] < key)
+			first = i + 1;
+		else
+			last = i;
+	}
+	return VKFFT_ERROR_MISMATCHING_applicationString;
+}
+
+static inline VkFFTResult VkFFT_LoadKernelFromApplicationString(VkFFTApplication* app, VkFFTAxis* axis, void** binary, pfUINT* binarySize) {
+	//allocated binary has to be freed by the caller
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	pfUINT offset = 0;
+	pfUINT size = 0;
+	resFFT = VkFFT_FindApplicationStringEntry(app, axis->applicationStringKey, &offset, &size);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	if (size == 0) return VKFFT_ERROR_INVALID_applicationString;
+	binary[0] = malloc(size);
+	if (!binary[0]) return VKFFT_ERROR_MALLOC_FAILED;
+	memcpy(binary[0], (char*)app->configuration.loadApplicationString + offset, size);
+	binarySize[0] = size;
+	return resFFT;
+}
+
+static inline void VkFFT_AddApplicationStringEntry(pfUINT* entries, void** entryData, pfUINT* numEntries, pfUINT key, void* data, pfUINT size) {
+	//insertion keeps the table of contents sorted by key
+	pfUINT id = numEntries[0];
+	while ((id > 0) && (entries[(id - 1) * VKFFT_APPLICATION_STRING_ENTRY_SIZE] > key)) {
+		entries[id * VKFFT_APPLICATION_STRING_ENTRY_SIZE] = entries[(id - 1) * VKFFT_APPLICATION_STRING_ENTRY_SIZE];
+		entries[id * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 2] = entries[(id - 1) * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 2];
+		entryData[id] = entryData[id - 1];
+		id--;
+	}
+	entries[id * VKFFT_APPLICATION_STRING_ENTRY_SIZE] = key;
+	entries[id * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 2] = size;
+	entryData[id] = data;
+	numEntries[0]++;
+}
+
+static inline VkFFTResult VkFFTSaveApplicationString(VkFFTApplication* app) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	//inverse and forward plans, each axis has up to 4 uploads, the same number of Bluestein inverse axes and one R2C decomposition kernel. Plus Bluestein applications and Rader kernels
+	pfUINT entries[(2 * VKFFT_MAX_FFT_DIMENSIONS * 9 + VKFFT_MAX_FFT_DIMENSIONS + 30) * VKFFT_APPLICATION_STRING_ENTRY_SIZE];
+	void* entryData[2 * VKFFT_MAX_FFT_DIMENSIONS * 9 + VKFFT_MAX_FFT_DIMENSIONS + 30];
+	pfUINT numEntries = 0;
+	for (pfUINT inverse = 0; inverse < 2; inverse++) {
+		VkFFTPlan* FFTPlan = (inverse) ? app->localFFTPlan_inverse : app->localFFTPlan;
+		if ((inverse) && (app->configuration.makeForwardPlanOnly)) continue;
+		if ((!inverse) && (app->configuration.makeInversePlanOnly)) continue;
+		for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+			for (pfUINT j = 0; j < FFTPlan->numAxisUploads[i]; j++) {
+				VkFFT_AddApplicationStringEntry(entries, entryData, &numEntries, FFTPlan->axes[i][j].applicationStringKey, FFTPlan->axes[i][j].binary, FFTPlan->axes[i][j].binarySize);
+			}
+			if (app->useBluesteinFFT[i] && (FFTPlan->numAxisUploads[i] > 1)) {
+				for (pfUINT j = 1; j < FFTPlan->numAxisUploads[i]; j++) {
+					VkFFT_AddApplicationStringEntry(entries, entryData, &numEntries, FFTPlan->inverseBluesteinAxes[i][j].applicationStringKey, FFTPlan->inverseBluesteinAxes[i][j].binary, FFTPlan->inverseBluesteinAxes[i][j].binarySize);
+				}
+			}
+			if ((FFTPlan->bigSequenceEvenR2C) && (i == 0)) {
+				VkFFT_AddApplicationStringEntry(entries, entryData, &numEntries, FFTPlan->R2Cdecomposition.applicationStringKey, FFTPlan->R2Cdecomposition.binary, FFTPlan->R2Cdecomposition.binarySize);
+			}
+		}
+	}
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if (app->useBluesteinFFT[i]) {
+			VkFFT_AddApplicationStringEntry(entries, entryData, &numEntries, VkFFT_GetApplicationStringKey(VKFFT_APPLICATION_STRING_BLUESTEIN_APPLICATION, 0, i, 0), app->applicationBluesteinString[i], app->applicationBluesteinStringSize[i]);
+		}
+	}
+	for (pfUINT i = 0; i < app->numRaderFFTPrimes; i++) {
+		VkFFT_AddApplicationStringEntry(entries, entryData, &numEntries, VkFFT_GetApplicationStringKey(VKFFT_APPLICATION_STRING_RADER_KERNEL, 0, 0, app->rader_primes[i]), app->raderFFTkernel[i], app->rader_buffer_size[i]);
+	}
+	pfUINT totalBinarySize = (VKFFT_APPLICATION_STRING_HEADER_SIZE + numEntries * VKFFT_APPLICATION_STRING_ENTRY_SIZE) * sizeof(pfUINT);
+	for (pfUINT i = 0; i < numEntries; i++) {
+		entries[i * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 1] = totalBinarySize;
+		totalBinarySize += entries[i * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 2];
+	}
+	if (!app->deviceHash) {
+		resFFT = VkFFT_GetDeviceHash(app, &app->deviceHash);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	app->saveApplicationString = calloc(totalBinarySize, 1);
+	if (!app->saveApplicationString) return VKFFT_ERROR_MALLOC_FAILED;
+	app->applicationStringSize = totalBinarySize;
+	pfUINT header[VKFFT_APPLICATION_STRING_HEADER_SIZE] = { VKFFT_APPLICATION_STRING_MAGIC, VKFFT_APPLICATION_STRING_FORMAT_VERSION, totalBinarySize, 0, VKFFT_BACKEND, app->deviceHash, app->configurationHash, numEntries };
+#ifdef VKFFT_VERSION
+	header[3] = VKFFT_VERSION;
+#endif
+	char* localApplicationStringCast = (char*)app->saveApplicationString;
+	memcpy(localApplicationStringCast, header, sizeof(header));
+	if (numEntries) memcpy(localApplicationStringCast + sizeof(header), entries, numEntries * VKFFT_APPLICATION_STRING_ENTRY_SIZE * sizeof(pfUINT));
+	for (pfUINT i = 0; i < numEntries; i++) {
+		if (entries[i * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 2])
+			memcpy(localApplicationStringCast + entries[i * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 1], entryData[i], entries[i * VKFFT_APPLICATION_STRING_ENTRY_SIZE + 2]);
+	}
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if (app->applicationBluesteinString[i] != 0) {
+			free(app->applicationBluesteinString[i]);
+			app->applicationBluesteinString[i] = 0;
+		}
+	}
+	return resFFT;
+}
+#endif
@@ -0,0 +1,476 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_AUTOTUNE_H
+#define VKFFT_AUTOTUNE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+#include "vkFFT/vkFFT_AppManagement/vkFFT_RunApp.h"
+#include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanProfile.h"
+
+// Plan-time autotuner. Kernel shape parameters that are normally taken from the vendor defaults of setConfigurationVkFFT are tuned one at a time:
+// for every parameter the user has not set, applications with each candidate value (and the best values of the previously tuned parameters) are
+// created, timed with VkFFTAppend on the user buffers and the fastest one is kept. groupedBatch is tuned separately for each axis.
+// The result is stored in wisdomFile as a text line "<key> name=value ...", where key is a hash of the device and of the untuned configuration.
+// Later initializeVkFFT calls with the same wisdomFile apply the stored values to parameters that are not set by the user, without timing anything.
+
+#define VKFFT_AUTOTUNE_ITERATIONS 10
+#define VKFFT_AUTOTUNE_MAX_CANDIDATES 8
+#define VKFFT_AUTOTUNE_NUM_PARAMETERS (7 + VKFFT_MAX_FFT_DIMENSIONS)
+
+static inline VkFFTResult setConfigurationVkFFT(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration);
+static inline VkFFTResult initializeVkFFT(VkFFTApplication* app, VkFFTConfiguration inputLaunchConfiguration);
+
+static inline void VkFFT_GetTuningParameterName(pfUINT id, char* name) {
+	const char* names[7] = { "registerBoost", "aimThreads", "coalescedMemory", "performBandwidthBoost", "swapTo2Stage4Step", "swapTo3Stage4Step", "useLUT" };
+	if (id < 7)
+		sprintf(name, "%s", names[id]);
+	else
+		sprintf(name, "groupedBatch%" PRIu64 "", id - 7);
+}
+
+static inline pfINT VkFFT_GetTuningParameter(VkFFTConfiguration* configuration, pfUINT id) {
+	switch (id) {
+	case 0:
+		return (pfINT)configuration->registerBoost;
+	case 1:
+		return (pfINT)configuration->aimThreads;
+	case 2:
+		return (pfINT)configuration->coalescedMemory;
+	case 3:
+		return (pfINT)configuration->performBandwidthBoost;
+	case 4:
+		return (pfINT)configuration->swapTo2Stage4Step;
+	case 5:
+		return (pfINT)configuration->swapTo3Stage4Step;
+	case 6:
+		return configuration->useLUT;
+	default:
+		return (pfINT)configuration->groupedBatch[id - 7];
+	}
+}
+
+static inline void VkFFT_SetTuningParameter(VkFFTConfiguration* configuration, pfUINT id, pfINT value) {
+	switch (id) {
+	case 0:
+		configuration->registerBoost = (pfUINT)value;
+		break;
+	case 1:
+		configuration->aimThreads = (pfUINT)value;
+		break;
+	case 2:
+		configuration->coalescedMemory = (pfUINT)value;
+		break;
+	case 3:
+		configuration->performBandwidthBoost = (int)value;
+		break;
+	case 4:
+		configuration->swapTo2Stage4Step = (pfUINT)value;
+		break;
+	case 5:
+		configuration->swapTo3Stage4Step = (pfUINT)value;
+		break;
+	case 6:
+		configuration->useLUT = value;
+		break;
+	default:
+		configuration->groupedBatch[id - 7] = (pfUINT)value;
+		break;
+	}
+}
+
+static inline pfUINT VkFFT_GetTuningCandidates(VkFFTConfiguration* configuration, pfUINT id, pfINT* candidates) {
+	//candidate values of a parameter that has not been set by the user. 0 - vendor default, tried first
+	candidates[0] = 0;
+	pfUINT maxSize = 0;
+	for (pfUINT i = 0; i < configuration->FFTdim; i++) {
+		if ((!configuration->omitDimension[i]) && (configuration->size[i] > maxSize)) maxSize = configuration->size[i];
+	}
+	switch (id) {
+	case 0:
+		candidates[1] = 1;
+		candidates[2] = 2;
+		candidates[3] = 4;
+		return 4;
+	case 1:
+		candidates[1] = 64;
+		candidates[2] = 256;
+		return 3;
+	case 2:
+		candidates[1] = 32;
+		candidates[2] = 64;
+		candidates[3] = 128;
+		return 4;
+	case 3:
+		candidates[1] = -1;
+		candidates[2] = 2;
+		candidates[3] = 4;
+		return 4;
+	case 4:
+	case 5:
+		//force or disable the multi-upload 4-step algorithm for the longest axis
+		if (maxSize < ((id == 4) ? 4096 : 65536)) return 1;
+		candidates[1] = (pfINT)maxSize;
+		candidates[2] = (pfINT)maxSize + 1;
+		return 3;
+	case 6:
+		//sincos and LUT twiddles give different accuracy in double and double-double precision, so only lower precisions are tuned
+		if (configuration->doublePrecision || configuration->doublePrecisionFloatMemory || configuration->quadDoubleDoublePrecision || configuration->quadDoubleDoublePrecisionDoubleMemory) return 1;
+		candidates[1] = 1;
+		candidates[2] = -1;
+		return 3;
+	default:
+		if ((id - 7 >= configuration->FFTdim) || (configuration->omitDimension[id - 7])) return 1;
+		candidates[1] = 1;
+		candidates[2] = 4;
+		candidates[3] = 16;
+		return 4;
+	}
+}
+
+static inline VkFFTResult VkFFT_GetTuningHash(VkFFTConfiguration configuration, pfUINT* configurationHash, pfUINT* deviceHash) {
+	//runs only setConfigurationVkFFT, so the hash is computed on final parameters that include vendor defaults and restrictions (for example, registerBoost is reset for R2C)
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTApplication tuningApp = VKFFT_ZERO_INIT;
+	configuration.autotune = 0;
+	configuration.wisdomFile = 0;
+	configuration.usePlanCache = 0;
+	configuration.loadApplicationFromString = 0;
+	configuration.saveApplicationToString = 0;
+	resFFT = setConfigurationVkFFT(&tuningApp, configuration);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	configurationHash[0] = VkFFT_GetConfigurationHash(&tuningApp);
+	if (deviceHash) {
+		resFFT = VkFFT_GetDeviceHash(&tuningApp, deviceHash);
+	}
+	deleteVkFFT(&tuningApp);
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_ExecuteTuningRun(VkFFTApplication* app, pfUINT numIterations, double* time) {
+	//records numIterations forward and inverse transforms in one submission and measures the time from submission to completion
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTLaunchParams launchParams = VKFFT_ZERO_INIT;
+	double timeSubmit = 0;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	VkCommandBufferAllocateInfo commandBufferAllocateInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+	commandBufferAllocateInfo.commandPool = app->configuration.commandPool[0];
+	commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	commandBufferAllocateInfo.commandBufferCount = 1;
+	VkCommandBuffer commandBuffer = VKFFT_ZERO_INIT;
+	res = vkAllocateCommandBuffers(app->configuration.device[0], &commandBufferAllocateInfo, &commandBuffer);
+	if (res != 0) return VKFFT_ERROR_FAILED_TO_ALLOCATE_COMMAND_BUFFERS;
+	VkCommandBufferBeginInfo commandBufferBeginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+	commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	res = vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+	if (res != 0) {
+		vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+		return VKFFT_ERROR_FAILED_TO_BEGIN_COMMAND_BUFFER;
+	}
+	launchParams.commandBuffer = &commandBuffer;
+#elif(VKFFT_BACKEND==1)
+	cudaError_t res = cudaSuccess;
+	timeSubmit = VkFFT_GetHostTime();
+#elif(VKFFT_BACKEND==2)
+	hipError_t res = hipSuccess;
+	timeSubmit = VkFFT_GetHostTime();
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	cl_command_queue commandQueue = clCreateCommandQueue(app->configuration.context[0], app->configuration.device[0], 0, &res);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_QUEUE;
+	launchParams.commandQueue = &commandQueue;
+	timeSubmit = VkFFT_GetHostTime();
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+	ze_command_list_desc_t commandListDescription = VKFFT_ZERO_INIT;
+	commandListDescription.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+	ze_command_list_handle_t commandList = VKFFT_ZERO_INIT;
+	res = zeCommandListCreate(app->configuration.context[0], app->configuration.device[0], &commandListDescription, &commandList);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	launchParams.commandList = &commandList;
+#elif(VKFFT_BACKEND==5)
+	MTL::CommandBuffer* commandBuffer = app->configuration.queue->commandBuffer();
+	if (commandBuffer == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	MTL::ComputeCommandEncoder* commandEncoder = commandBuffer->computeCommandEncoder();
+	if (commandEncoder == 0) {
+		commandBuffer->release();
+		return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	}
+	launchParams.commandBuffer = commandBuffer;
+	launchParams.commandEncoder = commandEncoder;
+#elif(VKFFT_BACKEND==6)
+	timeSubmit = VkFFT_GetHostTime();
+#endif
+	for (pfUINT i = 0; i < numIterations; i++) {
+		if (!app->configuration.makeInversePlanOnly) {
+			resFFT = VkFFTAppend(app, -1, &launchParams);
+			if (resFFT != VKFFT_SUCCESS) break;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			resFFT = VkFFTAppend(app, 1, &launchParams);
+			if (resFFT != VKFFT_SUCCESS) break;
+		}
+	}
+#if(VKFFT_BACKEND==0)
+	res = vkEndCommandBuffer(commandBuffer);
+	if ((res == 0) && (resFFT == VKFFT_SUCCESS)) {
+		VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &commandBuffer;
+		timeSubmit = VkFFT_GetHostTime();
+		res = vkQueueSubmit(app->configuration.queue[0], 1, &submitInfo, app->configuration.fence[0]);
+		if (res != 0) resFFT = VKFFT_ERROR_FAILED_TO_SUBMIT_QUEUE;
+		if (resFFT == VKFFT_SUCCESS) {
+			res = vkWaitForFences(app->configuration.device[0], 1, app->configuration.fence, VK_TRUE, 100000000000);
+			if (res != 0) resFFT = VKFFT_ERROR_FAILED_TO_WAIT_FOR_FENCES;
+			time[0] = VkFFT_GetHostTime() - timeSubmit;
+			res = vkResetFences(app->configuration.device[0], 1, app->configuration.fence);
+			if ((res != 0) && (resFFT == VKFFT_SUCCESS)) resFFT = VKFFT_ERROR_FAILED_TO_RESET_FENCES;
+		}
+	}
+	else if (resFFT == VKFFT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+#elif(VKFFT_BACKEND==1)
+	res = cudaDeviceSynchronize();
+	if ((res != cudaSuccess) && (resFFT == VKFFT_SUCCESS)) resFFT = VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+	time[0] = VkFFT_GetHostTime() - timeSubmit;
+#elif(VKFFT_BACKEND==2)
+	res = hipDeviceSynchronize();
+	if ((res != hipSuccess) && (resFFT == VKFFT_SUCCESS)) resFFT = VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+	time[0] = VkFFT_GetHostTime() - timeSubmit;
+#elif(VKFFT_BACKEND==3)
+	res = clFinish(commandQueue);
+	if ((res != CL_SUCCESS) && (resFFT == VKFFT_SUCCESS)) resFFT = VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+	time[0] = VkFFT_GetHostTime() - timeSubmit;
+	res = clReleaseCommandQueue(commandQueue);
+	if ((res != CL_SUCCESS) && (resFFT == VKFFT_SUCCESS)) resFFT = VKFFT_ERROR_FAILED_TO_RELEASE_COMMAND_QUEUE;
+#elif(VKFFT_BACKEND==4)
+	res = zeCommandListClose(commandList);
+	if ((res == ZE_RESULT_SUCCESS) && (resFFT == VKFFT_SUCCESS)) {
+		timeSubmit = VkFFT_GetHostTime();
+		res = zeCommandQueueExecuteCommandLists(app->configuration.commandQueue[0], 1, &commandList, 0);
+		if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_SUBMIT_QUEUE;
+		if (resFFT == VKFFT_SUCCESS) {
+			res = zeCommandQueueSynchronize(app->configuration.commandQueue[0], UINT32_MAX);
+			if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+			time[0] = VkFFT_GetHostTime() - timeSubmit;
+		}
+	}
+	else if (resFFT == VKFFT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	res = zeCommandListDestroy(commandList);
+	if ((res != ZE_RESULT_SUCCESS) && (resFFT == VKFFT_SUCCESS)) resFFT = VKFFT_ERROR_FAILED_TO_DESTROY_COMMAND_LIST;
+#elif(VKFFT_BACKEND==5)
+	commandEncoder->endEncoding();
+	if (resFFT == VKFFT_SUCCESS) {
+		timeSubmit = VkFFT_GetHostTime();
+		commandBuffer->commit();
+		commandBuffer->waitUntilCompleted();
+		time[0] = VkFFT_GetHostTime() - timeSubmit;
+	}
+	commandEncoder->release();
+	commandBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	//launches are synchronous
+	time[0] = VkFFT_GetHostTime() - timeSubmit;
+#endif
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_TimeTuningCandidate(VkFFTConfiguration configuration, double* time) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTApplication tuningApp = VKFFT_ZERO_INIT;
+	configuration.calibrateHostExecution = 0;
+	configuration.profilePlanCreation = 0;
+	configuration.profileDispatches = 0;
+	resFFT = initializeVkFFT(&tuningApp, configuration);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	//first run includes one-time costs, like module loading and cold caches
+	resFFT = VkFFT_ExecuteTuningRun(&tuningApp, 1, time);
+	if (resFFT == VKFFT_SUCCESS)
+		resFFT = VkFFT_ExecuteTuningRun(&tuningApp, VKFFT_AUTOTUNE_ITERATIONS, time);
+	deleteVkFFT(&tuningApp);
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_CalibrateHostExecution(VkFFTApplication* app) {
+	//compares latency of single executions, as issued by control loops: every device execution is submitted and synchronized separately. Host execution is kept if it is faster
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (app->configuration.buffer == 0) return resFFT;
+	double time = 0;
+	double deviceTime = 0;
+	resFFT = VkFFT_ExecuteTuningRun(app, 1, &time);
+	for (pfUINT i = 0; (i < VKFFT_AUTOTUNE_ITERATIONS) && (resFFT == VKFFT_SUCCESS); i++) {
+		resFFT = VkFFT_ExecuteTuningRun(app, 1, &time);
+		deviceTime += time;
+	}
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	resFFT = VkFFT_InitHostFFT(app);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	void* hostBuffer = calloc(1, VkFFT_GetHostFFTBufferSize(app));
+	if (!hostBuffer) {
+		VkFFT_DeleteHostFFT(app);
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	double timeStart = VkFFT_GetHostTime();
+	for (pfUINT i = 0; i < VKFFT_AUTOTUNE_ITERATIONS; i++) {
+		if (!app->configuration.makeInversePlanOnly)
+			VkFFT_ExecuteHostFFT(app, -1, hostBuffer);
+		if (!app->configuration.makeForwardPlanOnly)
+			VkFFT_ExecuteHostFFT(app, 1, hostBuffer);
+	}
+	double hostTime = VkFFT_GetHostTime() - timeStart;
+	free(hostBuffer);
+	if (hostTime >= deviceTime)
+		VkFFT_DeleteHostFFT(app);
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_AutotuneConfiguration(VkFFTConfiguration* configuration) {
+	//coordinate search over the parameters that have not been set by the user. Candidates that fail to initialize or run (for example, too big registerBoost) are skipped
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTConfiguration bestConfiguration = configuration[0];
+	bestConfiguration.autotune = 0;
+	bestConfiguration.wisdomFile = 0;
+	bestConfiguration.usePlanCache = 0;
+	bestConfiguration.saveApplicationToString = 0;
+	double bestTime = 0;
+	resFFT = VkFFT_TimeTuningCandidate(bestConfiguration, &bestTime);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	pfUINT testedHashes[VKFFT_AUTOTUNE_NUM_PARAMETERS * VKFFT_AUTOTUNE_MAX_CANDIDATES + 1];
+	pfUINT numTestedHashes = 0;
+	resFFT = VkFFT_GetTuningHash(bestConfiguration, &testedHashes[0], 0);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	numTestedHashes++;
+	for (pfUINT id = 0; id < VKFFT_AUTOTUNE_NUM_PARAMETERS; id++) {
+		if (VkFFT_GetTuningParameter(configuration, id) != 0) continue;
+		pfINT candidates[VKFFT_AUTOTUNE_MAX_CANDIDATES];
+		pfUINT numCandidates = VkFFT_GetTuningCandidates(configuration, id, candidates);
+		pfINT bestValue = 0;
+		for (pfUINT i = 1; i < numCandidates; i++) {
+			VkFFTConfiguration candidateConfiguration = bestConfiguration;
+			VkFFT_SetTuningParameter(&candidateConfiguration, id, candidates[i]);
+			//values overridden by setConfigurationVkFFT produce an already tested configuration
+			pfUINT candidateHash = 0;
+			if (VkFFT_GetTuningHash(candidateConfiguration, &candidateHash, 0) != VKFFT_SUCCESS) continue;
+			pfUINT tested = 0;
+			for (pfUINT j = 0; j < numTestedHashes; j++) {
+				if (testedHashes[j] == candidateHash) tested = 1;
+			}
+			if (tested) continue;
+			testedHashes[numTestedHashes] = candidateHash;
+			numTestedHashes++;
+			double candidateTime = 0;
+			if (VkFFT_TimeTuningCandidate(candidateConfiguration, &candidateTime) != VKFFT_SUCCESS) continue;
+			if (candidateTime < bestTime) {
+				bestTime = candidateTime;
+				bestValue = candidates[i];
+			}
+		}
+		VkFFT_SetTuningParameter(&bestConfiguration, id, bestValue);
+	}
+	for (pfUINT id = 0; id < VKFFT_AUTOTUNE_NUM_PARAMETERS; id++) {
+		if (VkFFT_GetTuningParameter(configuration, id) == 0) VkFFT_SetTuningParameter(configuration, id, VkFFT_GetTuningParameter(&bestConfiguration, id));
+	}
+	return resFFT;
+}
+
+static inline pfUINT VkFFT_ReadWisdom(VkFFTConfiguration* configuration, pfUINT key) {
+	//applies the last entry with the given key to parameters that have not been set by the user. Returns 1 if the entry has been found
+	FILE* wisdomFile = fopen(configuration->wisdomFile, "r");
+	if (!wisdomFile) return 0;
+	pfUINT found = 0;
+	pfINT values[VKFFT_AUTOTUNE_NUM_PARAMETERS] = VKFFT_ZERO_INIT;
+	char line[1024];
+	while (fgets(line, 1024, wisdomFile)) {
+		pfUINT lineKey = 0;
+		int offset = 0;
+		if ((line[0] == '#') || (sscanf(line, "%" SCNx64 "%n", &lineKey, &offset) != 1) || (lineKey != key)) continue;
+		found = 1;
+		memset(values, 0, sizeof(values));
+		char name[64];
+		pfINT value = 0;
+		int length = 0;
+		while (sscanf(line + offset, " %63[^= \n]=%" SCNd64 "%n", name, &value, &length) == 2) {
+			offset += length;
+			for (pfUINT id = 0; id < VKFFT_AUTOTUNE_NUM_PARAMETERS; id++) {
+				char parameterName[64];
+				VkFFT_GetTuningParameterName(id, parameterName);
+				if (!strcmp(name, parameterName)) values[id] = value;
+			}
+		}
+	}
+	fclose(wisdomFile);
+	if (found) {
+		for (pfUINT id = 0; id < VKFFT_AUTOTUNE_NUM_PARAMETERS; id++) {
+			if (VkFFT_GetTuningParameter(configuration, id) == 0) VkFFT_SetTuningParameter(configuration, id, values[id]);
+		}
+	}
+	return found;
+}
+
+static inline VkFFTResult VkFFT_WriteWisdom(VkFFTConfiguration* configuration, VkFFTConfiguration* tunedConfiguration, pfUINT key) {
+	//appends the parameters set by the autotuner, so the file can be shared between processes and edited by hand
+	FILE* wisdomFile = fopen(configuration->wisdomFile, "r");
+	pfUINT newFile = (wisdomFile == 0);
+	if (wisdomFile) fclose(wisdomFile);
+	wisdomFile = fopen(configuration->wisdomFile, "a");
+	if (!wisdomFile) return VKFFT_ERROR_FAILED_TO_WRITE_wisdomFile;
+	char line[1024];
+	int length = sprintf(line, "%016" PRIx64 "", key);
+	for (pfUINT id = 0; id < VKFFT_AUTOTUNE_NUM_PARAMETERS; id++) {
+		pfINT value = VkFFT_GetTuningParameter(tunedConfiguration, id);
+		if (value == VkFFT_GetTuningParameter(configuration, id)) continue;
+		char name[64];
+		VkFFT_GetTuningParameterName(id, name);
+		length += sprintf(line + length, " %s=%" PRIi64 "", name, value);
+	}
+	sprintf(line + length, "\n");
+	if (newFile) fprintf(wisdomFile, "# VkFFT wisdom: <key> name=value ...\n");
+	pfUINT success = (fputs(line, wisdomFile) >= 0);
+	fclose(wisdomFile);
+	return (success) ? VKFFT_SUCCESS : VKFFT_ERROR_FAILED_TO_WRITE_wisdomFile;
+}
+
+static inline VkFFTResult VkFFT_TuneConfiguration(VkFFTConfiguration* configuration) {
+	//called by initializeVkFFT before setConfigurationVkFFT if autotune or wisdomFile is enabled
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	pfUINT configurationHash = 0;
+	pfUINT deviceHash = 0;
+	resFFT = VkFFT_GetTuningHash(configuration[0], &configurationHash, &deviceHash);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	pfUINT key = VkFFT_HashUint(deviceHash, configurationHash);
+	if ((configuration->wisdomFile) && (VkFFT_ReadWisdom(configuration, key))) return resFFT;
+	//kernels of applications loaded from a string are fixed by the string
+	if ((!configuration->autotune) || (configuration->loadApplicationFromString)) return resFFT;
+	VkFFTConfiguration tunedConfiguration = configuration[0];
+	resFFT = VkFFT_AutotuneConfiguration(&tunedConfiguration);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	if (configuration->wisdomFile) {
+		resFFT = VkFFT_WriteWisdom(configuration, &tunedConfiguration, key);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	for (pfUINT id = 0; id < VKFFT_AUTOTUNE_NUM_PARAMETERS; id++)
+		VkFFT_SetTuningParameter(configuration, id, VkFFT_GetTuningParameter(&tunedConfiguration, id));
+	return resFFT;
+}
+#endif
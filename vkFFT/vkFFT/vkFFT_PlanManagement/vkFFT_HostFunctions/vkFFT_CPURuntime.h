@@ -0,0 +1,584 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_CPURUNTIME_H
+#define VKFFT_CPURUNTIME_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#if(VKFFT_BACKEND==6)
+
+// Runtime of the CPU backend. Generated kernels are C functions that execute one invocation of a workgroup. They are built into a shared library
+// by the system C compiler and loaded with dlopen (LoadLibrary on Windows). Workgroups of a dispatch are distributed between numCPUThreads workers
+// of a persistent thread pool, each worker has its own shared memory. Invocations of a workgroup are executed by the same worker: in a loop, if
+// the kernel has no barriers, or as fibers that switch back to the worker at each barrier otherwise. Kernel launches are synchronous.
+// Fibers are Win32 fibers on Windows and ucontext on other systems. ucontext is deprecated on macOS, so the CPU backend supports Linux and Windows.
+
+#ifdef __APPLE__
+#error "VKFFT_BACKEND==6 is supported on Linux and Windows: barriers of CPU kernels use ucontext, which is deprecated on macOS"
+#endif
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <process.h>
+#else
+#include <dlfcn.h>
+#include <pthread.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+#ifndef VKFFT_CPU_COMPILER_COMMAND
+#ifdef _WIN32
+#define VKFFT_CPU_COMPILER_COMMAND "clang -O3 -march=native -shared"
+#else
+#define VKFFT_CPU_COMPILER_COMMAND "cc -O3 -march=native -shared -fPIC"
+#endif
+#endif
+#ifndef VKFFT_CPU_FIBER_STACK_SIZE
+#define VKFFT_CPU_FIBER_STACK_SIZE 131072 //stack size of one invocation of a kernel with barriers, in bytes
+#endif
+
+typedef struct VkFFTCPUInvocation {
+	unsigned int localID[3];
+	unsigned int groupID[3];
+	void* sharedMemory;
+	void (*barrier)(struct VkFFTCPUInvocation* invocation);
+	void* worker;
+} VkFFTCPUInvocation;//has to match the definition appended to generated code by appendExtensions
+
+typedef void (*VkFFTCPUKernel)(VkFFTCPUInvocation* invocation, void** args);
+
+typedef struct {
+	struct VkFFTCPUThreadPool* pool;
+	void* sharedMemory;
+	VkFFTCPUInvocation* invocations;
+	char* finished;//invocations of the current workgroup that have returned from the kernel
+	pfUINT numFinished;
+#ifdef _WIN32
+	HANDLE thread;
+	LPVOID schedulerFiber;
+	LPVOID* fibers;
+#else
+	pthread_t thread;
+	ucontext_t scheduler;
+	ucontext_t* fibers;
+	char** fiberStacks;
+#endif
+} VkFFTCPUWorker;
+
+struct VkFFTCPUThreadPool {
+	pfUINT numThreads;//running threads, including the calling thread
+	pfUINT numWorkers;
+	VkFFTCPUWorker* workers;
+	pfUINT maxInvocations;
+	pfUINT numFibers;//fibers are created for all workers on the first launch of a kernel with barriers and reused by next kernels
+	//current launch
+	VkFFTCPUKernel kernel;
+	void** args;
+	pfUINT dispatchSize[3];
+	pfUINT localSize[3];
+	pfUINT useBarriers;
+	pfUINT numGroups;
+	volatile pfUINT nextGroup;
+	pfUINT generation;
+	pfUINT numBusy;
+	pfUINT shutdown;
+#ifdef _WIN32
+	SRWLOCK lock;
+	CONDITION_VARIABLE start;
+	CONDITION_VARIABLE done;
+#else
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+#endif
+};
+typedef struct VkFFTCPUThreadPool VkFFTCPUThreadPool;
+
+static inline pfUINT VkFFT_GetNextCPUWorkGroup(VkFFTCPUThreadPool* pool) {
+#ifdef _WIN32
+	return (pfUINT)InterlockedIncrement64((volatile LONG64*)&pool->nextGroup) - 1;
+#else
+	return __atomic_fetch_add(&pool->nextGroup, 1, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline void VkFFT_CPUBarrier(VkFFTCPUInvocation* invocation) {
+	//switches back to the worker, which resumes this invocation after all other invocations of the workgroup have reached the barrier
+	VkFFTCPUWorker* worker = (VkFFTCPUWorker*)invocation->worker;
+#ifdef _WIN32
+	SwitchToFiber(worker->schedulerFiber);
+#else
+	swapcontext(&worker->fibers[invocation - worker->invocations], &worker->scheduler);
+#endif
+}
+
+static inline void VkFFT_CPUFiberMain(VkFFTCPUInvocation* invocation) {
+	VkFFTCPUWorker* worker = (VkFFTCPUWorker*)invocation->worker;
+	for (;;) {
+		worker->pool->kernel(invocation, worker->pool->args);
+		worker->finished[invocation - worker->invocations] = 1;
+		worker->numFinished++;
+		VkFFT_CPUBarrier(invocation);
+	}
+}
+
+#ifdef _WIN32
+static inline void __stdcall VkFFT_CPUFiberEntry(LPVOID invocation) {
+	VkFFT_CPUFiberMain((VkFFTCPUInvocation*)invocation);
+}
+#else
+static inline void VkFFT_CPUFiberEntry(unsigned int invocationLow, unsigned int invocationHigh) {
+	//makecontext only passes int arguments
+	VkFFT_CPUFiberMain((VkFFTCPUInvocation*)(size_t)((((pfUINT)invocationHigh) << 32) | invocationLow));
+}
+#endif
+
+static inline VkFFTResult VkFFT_CreateCPUFibers(VkFFTCPUThreadPool* pool, pfUINT numFibers) {
+	//loop counters are volatile, as getcontext can return twice
+	for (volatile pfUINT i = 0; i < pool->numWorkers; i++) {
+		VkFFTCPUWorker* worker = &pool->workers[i];
+		for (volatile pfUINT j = pool->numFibers; j < numFibers; j++) {
+#ifdef _WIN32
+			worker->fibers[j] = CreateFiber(VKFFT_CPU_FIBER_STACK_SIZE, VkFFT_CPUFiberEntry, &worker->invocations[j]);
+			if (!worker->fibers[j]) return VKFFT_ERROR_MALLOC_FAILED;
+#else
+			if (!worker->fiberStacks[j]) {
+				worker->fiberStacks[j] = (char*)malloc(VKFFT_CPU_FIBER_STACK_SIZE);
+				if (!worker->fiberStacks[j]) return VKFFT_ERROR_MALLOC_FAILED;
+			}
+			if (getcontext(&worker->fibers[j]) != 0) return VKFFT_ERROR_FAILED_TO_LAUNCH_KERNEL;
+			worker->fibers[j].uc_stack.ss_sp = worker->fiberStacks[j];
+			worker->fibers[j].uc_stack.ss_size = VKFFT_CPU_FIBER_STACK_SIZE;
+			worker->fibers[j].uc_link = 0;
+			pfUINT invocation = (pfUINT)(size_t)&worker->invocations[j];
+			makecontext(&worker->fibers[j], (void (*)(void))VkFFT_CPUFiberEntry, 2, (unsigned int)invocation, (unsigned int)(invocation >> 32));
+#endif
+		}
+	}
+	pool->numFibers = numFibers;
+	return VKFFT_SUCCESS;
+}
+
+static inline void VkFFT_CPURunWorkGroups(VkFFTCPUWorker* worker) {
+	VkFFTCPUThreadPool* pool = worker->pool;
+	pfUINT numInvocations = pool->localSize[0] * pool->localSize[1] * pool->localSize[2];
+#ifdef _WIN32
+	pfUINT convertedThread = 0;
+	if (pool->useBarriers) {
+		if (IsThreadAFiber())
+			worker->schedulerFiber = GetCurrentFiber();
+		else {
+			worker->schedulerFiber = ConvertThreadToFiber(0);
+			convertedThread = 1;
+		}
+	}
+#endif
+	pfUINT groupID = VkFFT_GetNextCPUWorkGroup(pool);
+	while (groupID < pool->numGroups) {
+		for (pfUINT i = 0; i < numInvocations; i++) {
+			VkFFTCPUInvocation* invocation = &worker->invocations[i];
+			invocation->localID[0] = (unsigned int)(i % pool->localSize[0]);
+			invocation->localID[1] = (unsigned int)((i / pool->localSize[0]) % pool->localSize[1]);
+			invocation->localID[2] = (unsigned int)(i / (pool->localSize[0] * pool->localSize[1]));
+			invocation->groupID[0] = (unsigned int)(groupID % pool->dispatchSize[0]);
+			invocation->groupID[1] = (unsigned int)((groupID / pool->dispatchSize[0]) % pool->dispatchSize[1]);
+			invocation->groupID[2] = (unsigned int)(groupID / (pool->dispatchSize[0] * pool->dispatchSize[1]));
+			if (!pool->useBarriers) pool->kernel(invocation, pool->args);
+		}
+		if (pool->useBarriers) {
+			memset(worker->finished, 0, numInvocations);
+			worker->numFinished = 0;
+			//each pass advances all invocations to their next barrier
+			while (worker->numFinished < numInvocations) {
+				for (pfUINT i = 0; i < numInvocations; i++) {
+					if (worker->finished[i]) continue;
+#ifdef _WIN32
+					SwitchToFiber(worker->fibers[i]);
+#else
+					swapcontext(&worker->scheduler, &worker->fibers[i]);
+#endif
+				}
+			}
+		}
+		groupID = VkFFT_GetNextCPUWorkGroup(pool);
+	}
+#ifdef _WIN32
+	if (convertedThread) ConvertFiberToThread();
+#endif
+}
+
+#ifdef _WIN32
+static inline unsigned __stdcall VkFFT_CPUWorkerThread(void* cpuWorker) {
+#else
+static inline void* VkFFT_CPUWorkerThread(void* cpuWorker) {
+#endif
+	VkFFTCPUWorker* worker = (VkFFTCPUWorker*)cpuWorker;
+	VkFFTCPUThreadPool* pool = worker->pool;
+	pfUINT generation = 0;
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&pool->lock);
+#else
+	pthread_mutex_lock(&pool->lock);
+#endif
+	for (;;) {
+		while ((pool->generation == generation) && (!pool->shutdown)) {
+#ifdef _WIN32
+			SleepConditionVariableSRW(&pool->start, &pool->lock, INFINITE, 0);
+#else
+			pthread_cond_wait(&pool->start, &pool->lock);
+#endif
+		}
+		if (pool->shutdown) break;
+		generation = pool->generation;
+#ifdef _WIN32
+		ReleaseSRWLockExclusive(&pool->lock);
+#else
+		pthread_mutex_unlock(&pool->lock);
+#endif
+		VkFFT_CPURunWorkGroups(worker);
+#ifdef _WIN32
+		AcquireSRWLockExclusive(&pool->lock);
+		pool->numBusy--;
+		if (pool->numBusy == 0) WakeConditionVariable(&pool->done);
+#else
+		pthread_mutex_lock(&pool->lock);
+		pool->numBusy--;
+		if (pool->numBusy == 0) pthread_cond_signal(&pool->done);
+#endif
+	}
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&pool->lock);
+#else
+	pthread_mutex_unlock(&pool->lock);
+#endif
+	return 0;
+}
+
+static inline pfUINT VkFFT_GetNumCPUThreads() {
+#ifdef _WIN32
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	return (pfUINT)systemInfo.dwNumberOfProcessors;
+#else
+	long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+	return (numProcessors > 0) ? (pfUINT)numProcessors : 1;
+#endif
+}
+
+static inline void VkFFT_DestroyCPUThreadPool(VkFFTApplication* app) {
+	VkFFTCPUThreadPool* pool = app->cpuThreadPool;
+	if (!pool) return;
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&pool->lock);
+	pool->shutdown = 1;
+	WakeAllConditionVariable(&pool->start);
+	ReleaseSRWLockExclusive(&pool->lock);
+#else
+	pthread_mutex_lock(&pool->lock);
+	pool->shutdown = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+#endif
+	for (pfUINT i = 1; i < pool->numThreads; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(pool->workers[i].thread, INFINITE);
+		CloseHandle(pool->workers[i].thread);
+#else
+		pthread_join(pool->workers[i].thread, 0);
+#endif
+	}
+	if (pool->workers) {
+		for (pfUINT i = 0; i < pool->numWorkers; i++) {
+			VkFFTCPUWorker* worker = &pool->workers[i];
+#ifdef _WIN32
+			if (worker->fibers) {
+				for (pfUINT j = 0; j < pool->maxInvocations; j++) {
+					if (worker->fibers[j]) DeleteFiber(worker->fibers[j]);
+				}
+			}
+			free(worker->fibers);
+#else
+			if (worker->fiberStacks) {
+				for (pfUINT j = 0; j < pool->maxInvocations; j++)
+					free(worker->fiberStacks[j]);
+			}
+			free(worker->fiberStacks);
+			free(worker->fibers);
+#endif
+			free(worker->finished);
+			free(worker->invocations);
+			free(worker->sharedMemory);
+		}
+		free(pool->workers);
+	}
+#ifndef _WIN32
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->start);
+	pthread_mutex_destroy(&pool->lock);
+#endif
+	free(pool);
+	app->cpuThreadPool = 0;
+}
+
+static inline VkFFTResult VkFFT_CreateCPUThreadPool(VkFFTApplication* app) {
+	VkFFTCPUThreadPool* pool = (VkFFTCPUThreadPool*)calloc(1, sizeof(VkFFTCPUThreadPool));
+	if (!pool) return VKFFT_ERROR_MALLOC_FAILED;
+#ifdef _WIN32
+	InitializeSRWLock(&pool->lock);
+	InitializeConditionVariable(&pool->start);
+	InitializeConditionVariable(&pool->done);
+#else
+	pthread_mutex_init(&pool->lock, 0);
+	pthread_cond_init(&pool->start, 0);
+	pthread_cond_init(&pool->done, 0);
+#endif
+	app->cpuThreadPool = pool;
+	pool->maxInvocations = app->configuration.maxThreadsNum;
+	pool->numThreads = 1;
+	pool->workers = (VkFFTCPUWorker*)calloc(app->configuration.numCPUThreads, sizeof(VkFFTCPUWorker));
+	if (!pool->workers) return VKFFT_ERROR_MALLOC_FAILED;
+	pool->numWorkers = app->configuration.numCPUThreads;
+	for (pfUINT i = 0; i < pool->numWorkers; i++) {
+		VkFFTCPUWorker* worker = &pool->workers[i];
+		worker->pool = pool;
+		worker->sharedMemory = malloc(app->configuration.sharedMemorySize);
+		worker->invocations = (VkFFTCPUInvocation*)calloc(pool->maxInvocations, sizeof(VkFFTCPUInvocation));
+		worker->finished = (char*)calloc(pool->maxInvocations, sizeof(char));
+#ifdef _WIN32
+		worker->fibers = (LPVOID*)calloc(pool->maxInvocations, sizeof(LPVOID));
+		if (!worker->fibers) return VKFFT_ERROR_MALLOC_FAILED;
+#else
+		worker->fibers = (ucontext_t*)calloc(pool->maxInvocations, sizeof(ucontext_t));
+		worker->fiberStacks = (char**)calloc(pool->maxInvocations, sizeof(char*));
+		if ((!worker->fibers) || (!worker->fiberStacks)) return VKFFT_ERROR_MALLOC_FAILED;
+#endif
+		if ((!worker->sharedMemory) || (!worker->invocations) || (!worker->finished)) return VKFFT_ERROR_MALLOC_FAILED;
+		for (pfUINT j = 0; j < pool->maxInvocations; j++) {
+			worker->invocations[j].sharedMemory = worker->sharedMemory;
+			worker->invocations[j].barrier = VkFFT_CPUBarrier;
+			worker->invocations[j].worker = worker;
+		}
+	}
+	//calling thread is the first worker. If a thread can't be created, workgroups are distributed between the launched ones
+	for (pfUINT i = 1; i < pool->numWorkers; i++) {
+#ifdef _WIN32
+		pool->workers[i].thread = (HANDLE)_beginthreadex(0, 0, VkFFT_CPUWorkerThread, &pool->workers[i], 0, 0);
+		if (pool->workers[i].thread == 0) break;
+#else
+		if (pthread_create(&pool->workers[i].thread, 0, VkFFT_CPUWorkerThread, &pool->workers[i]) != 0) break;
+#endif
+		pool->numThreads++;
+	}
+	return VKFFT_SUCCESS;
+}
+
+static inline VkFFTResult VkFFT_CPULaunchKernel(VkFFTApplication* app, VkFFTAxis* axis, void** args, pfUINT* dispatchSize) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTCPUThreadPool* pool = app->cpuThreadPool;
+	pfUINT numInvocations = axis->specializationConstants.localSize[0].data.i * axis->specializationConstants.localSize[1].data.i * axis->specializationConstants.localSize[2].data.i;
+	if ((numInvocations == 0) || (numInvocations > pool->maxInvocations)) return VKFFT_ERROR_FAILED_TO_LAUNCH_KERNEL;
+	if ((axis->useBarriers) && (numInvocations > pool->numFibers)) {
+		resFFT = VkFFT_CreateCPUFibers(pool, numInvocations);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	pool->kernel = (VkFFTCPUKernel)axis->VkFFTKernel;
+	pool->args = args;
+	for (int i = 0; i < 3; i++) {
+		pool->dispatchSize[i] = dispatchSize[i];
+		pool->localSize[i] = axis->specializationConstants.localSize[i].data.i;
+	}
+	pool->useBarriers = axis->useBarriers;
+	pool->numGroups = dispatchSize[0] * dispatchSize[1] * dispatchSize[2];
+	pool->nextGroup = 0;
+	pfUINT wakeThreads = ((pool->numThreads > 1) && (pool->numGroups > 1));
+	if (wakeThreads) {
+#ifdef _WIN32
+		AcquireSRWLockExclusive(&pool->lock);
+		pool->numBusy = pool->numThreads - 1;
+		pool->generation++;
+		WakeAllConditionVariable(&pool->start);
+		ReleaseSRWLockExclusive(&pool->lock);
+#else
+		pthread_mutex_lock(&pool->lock);
+		pool->numBusy = pool->numThreads - 1;
+		pool->generation++;
+		pthread_cond_broadcast(&pool->start);
+		pthread_mutex_unlock(&pool->lock);
+#endif
+	}
+	VkFFT_CPURunWorkGroups(&pool->workers[0]);
+	if (wakeThreads) {
+#ifdef _WIN32
+		AcquireSRWLockExclusive(&pool->lock);
+		while (pool->numBusy) SleepConditionVariableSRW(&pool->done, &pool->lock, INFINITE, 0);
+		ReleaseSRWLockExclusive(&pool->lock);
+#else
+		pthread_mutex_lock(&pool->lock);
+		while (pool->numBusy) pthread_cond_wait(&pool->done, &pool->lock);
+		pthread_mutex_unlock(&pool->lock);
+#endif
+	}
+	return resFFT;
+}
+
+static inline void VkFFT_GetCPULibraryPath(VkFFTApplication* app, VkFFTAxis* axis, char* path, const char* extension) {
+	//axes of applications that exist at the same time have different addresses, so their files don't collide
+	const char* directory = app->configuration.cpuTemporaryDirectory;
+#ifdef _WIN32
+	if (!directory) directory = getenv("TEMP");
+	if (!directory) directory = ".";
+	sprintf(path, "%s\\vkfft_%" PRIu64 "_%016" PRIx64 "%s", directory, (pfUINT)GetCurrentProcessId(), (pfUINT)(size_t)axis, extension);
+#else
+	if (!directory) directory = getenv("TMPDIR");
+	if (!directory) directory = "/tmp";
+	sprintf(path, "%s/vkfft_%" PRIu64 "_%016" PRIx64 "%s", directory, (pfUINT)getpid(), (pfUINT)(size_t)axis, extension);
+#endif
+}
+
+static inline VkFFTResult VkFFT_OpenCPULibrary(VkFFTAxis* axis, const char* libraryPath) {
+#ifdef _WIN32
+	axis->library = (void*)LoadLibraryA(libraryPath);
+	if (!axis->library) {
+		remove(libraryPath);
+		return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+	}
+	axis->VkFFTKernel = (void*)GetProcAddress((HMODULE)axis->library, axis->VkFFTFunctionName);
+#else
+	//the library stays mapped after its file is removed. On Windows the file is removed when the library is closed
+	axis->library = dlopen(libraryPath, RTLD_NOW | RTLD_LOCAL);
+	remove(libraryPath);
+	if (!axis->library) return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+	axis->VkFFTKernel = dlsym(axis->library, axis->VkFFTFunctionName);
+#endif
+	if (!axis->VkFFTKernel) return VKFFT_ERROR_FAILED_TO_CREATE_SHADER_MODULE;
+	return VKFFT_SUCCESS;
+}
+
+static inline void VkFFT_CloseCPULibrary(VkFFTAxis* axis) {
+	if (!axis->library) return;
+#ifdef _WIN32
+	char libraryPath[MAX_PATH];
+	DWORD libraryPathLength = GetModuleFileNameA((HMODULE)axis->library, libraryPath, MAX_PATH);
+	FreeLibrary((HMODULE)axis->library);
+	if ((libraryPathLength > 0) && (libraryPathLength < MAX_PATH)) remove(libraryPath);
+#else
+	dlclose(axis->library);
+#endif
+	axis->library = 0;
+	axis->VkFFTKernel = 0;
+}
+
+static inline VkFFTResult VkFFT_LoadCPULibrary(VkFFTApplication* app, VkFFTAxis* axis, const void* binary, pfUINT binarySize) {
+	//binaries from the application string or the kernel cache are written back to a file, as libraries can't be loaded from memory
+	char* libraryPath = (char*)malloc(strlen(app->configuration.cpuTemporaryDirectory ? app->configuration.cpuTemporaryDirectory : "") + 1024);
+	if (!libraryPath) return VKFFT_ERROR_MALLOC_FAILED;
+#ifdef _WIN32
+	VkFFT_GetCPULibraryPath(app, axis, libraryPath, ".dll");
+#else
+	VkFFT_GetCPULibraryPath(app, axis, libraryPath, ".so");
+#endif
+	FILE* libraryFile = fopen(libraryPath, "wb");
+	if (!libraryFile) {
+		free(libraryPath);
+		return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+	}
+	pfUINT success = (fwrite(binary, 1, binarySize, libraryFile) == binarySize);
+	fclose(libraryFile);
+	if (!success) {
+		remove(libraryPath);
+		free(libraryPath);
+		return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+	}
+	VkFFTResult resFFT = VkFFT_OpenCPULibrary(axis, libraryPath);
+	free(libraryPath);
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_BuildCPULibrary(VkFFTApplication* app, VkFFTAxis* axis, const char* code0, pfUINT saveBinary) {
+	//builds generated code with cpuCompilerCommand. If saveBinary is set, the library is also stored in axis->binary
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	const char* compilerCommand = (app->configuration.cpuCompilerCommand) ? app->configuration.cpuCompilerCommand : VKFFT_CPU_COMPILER_COMMAND;
+	pfUINT pathLength = strlen(app->configuration.cpuTemporaryDirectory ? app->configuration.cpuTemporaryDirectory : "") + 1024;
+	char* sourcePath = (char*)malloc(3 * pathLength + strlen(compilerCommand));
+	if (!sourcePath) return VKFFT_ERROR_MALLOC_FAILED;
+	char* libraryPath = sourcePath + pathLength;
+	char* command = libraryPath + pathLength;
+	VkFFT_GetCPULibraryPath(app, axis, sourcePath, ".c");
+#ifdef _WIN32
+	VkFFT_GetCPULibraryPath(app, axis, libraryPath, ".dll");
+#else
+	VkFFT_GetCPULibraryPath(app, axis, libraryPath, ".so");
+#endif
+	FILE* sourceFile = fopen(sourcePath, "wb");
+	if (!sourceFile) {
+		free(sourcePath);
+		return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+	}
+	pfUINT codeLength = strlen(code0);
+	pfUINT success = (fwrite(code0, 1, codeLength, sourceFile) == codeLength);
+	fclose(sourceFile);
+	if (!success) {
+		remove(sourcePath);
+		free(sourcePath);
+		return VKFFT_ERROR_FAILED_TO_CREATE_PROGRAM;
+	}
+	sprintf(command, "%s -o \"%s\" \"%s\" -lm", compilerCommand, libraryPath, sourcePath);
+	int res = system(command);
+	remove(sourcePath);
+	if (res != 0) {
+		remove(libraryPath);
+		free(sourcePath);
+		return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
+	}
+	if (saveBinary) {
+		FILE* libraryFile = fopen(libraryPath, "rb");
+		if (libraryFile) {
+			fseek(libraryFile, 0, SEEK_END);
+			long librarySize = ftell(libraryFile);
+			fseek(libraryFile, 0, SEEK_SET);
+			axis->binary = (librarySize > 0) ? malloc((size_t)librarySize) : 0;
+			if (axis->binary) {
+				axis->binarySize = (pfUINT)librarySize;
+				if (fread(axis->binary, 1, axis->binarySize, libraryFile) != axis->binarySize) {
+					free(axis->binary);
+					axis->binary = 0;
+					axis->binarySize = 0;
+				}
+			}
+			fclose(libraryFile);
+		}
+		if (!axis->binary) {
+			remove(libraryPath);
+			free(sourcePath);
+			return VKFFT_ERROR_FAILED_TO_COMPILE_PROGRAM;
+		}
+	}
+	resFFT = VkFFT_OpenCPULibrary(axis, libraryPath);
+	free(sourcePath);
+	return resFFT;
+}
+#endif
+#endif
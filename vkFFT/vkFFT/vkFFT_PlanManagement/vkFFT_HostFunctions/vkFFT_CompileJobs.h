@@ -0,0 +1,178 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_COMPILEJOBS_H
+#define VKFFT_COMPILEJOBS_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_InitAPIParameters.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_CompileKernel.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_HostTasks.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanProfile.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel2/vkFFT_FFT.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel2/vkFFT_R2C_even_decomposition.h"
+
+// Kernel generation and compilation is the last step of axis planning and only touches the axis itself, so it can be postponed.
+// If numCompileThreads > 1 or compileTaskExecutor is set, axes are queued as compile jobs during planning and all of them are
+// generated and compiled in parallel by VkFFTRunCompileJobs once both plans are created. Otherwise jobs are executed immediately.
+
+typedef struct {
+	VkFFTApplication* app;
+#if(VKFFT_BACKEND==1)
+	CUcontext context;
+#elif(VKFFT_BACKEND==2)
+	int device;
+#endif
+} VkFFTCompileTaskData;
+
+static inline VkFFTResult VkFFT_AllocateCodeBuffer(VkFFTApplication* app, VkFFTSpecializationConstantsLayout* sc) {
+	//takes the buffer left by the previously compiled axis, if there is one. The buffer grows during code generation if needed
+	if (app->codeBuffer) {
+		sc->code0 = app->codeBuffer;
+		sc->maxCodeLength = app->codeBufferLength;
+		app->codeBuffer = 0;
+		app->codeBufferLength = 0;
+	}
+	else {
+		sc->code0 = (char*)malloc(sizeof(char) * app->configuration.maxCodeLength);
+		if (!sc->code0) return VKFFT_ERROR_MALLOC_FAILED;
+		sc->maxCodeLength = app->configuration.maxCodeLength;
+	}
+	sc->code0[0] = 0;
+	return VKFFT_SUCCESS;
+}
+
+static inline void VkFFT_ReleaseCodeBuffer(VkFFTApplication* app, VkFFTSpecializationConstantsLayout* sc, int reuseCodeBuffer) {
+	//reuse is only allowed on the planning thread, jobs executed in parallel free their buffers
+	if (!sc->code0) return;
+	if ((reuseCodeBuffer) && (sc->maxCodeLength > app->codeBufferLength)) {
+		free(app->codeBuffer);
+		app->codeBuffer = sc->code0;
+		app->codeBufferLength = sc->maxCodeLength;
+	}
+	else
+		free(sc->code0);
+	sc->code0 = 0;
+}
+
+static inline VkFFTResult VkFFT_RunCompileJob(VkFFTApplication* app, VkFFTCompileJob* job, int reuseCodeBuffer) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTAxis* axis = job->axis;
+	VkFFTPlanProfileAxisUpload* profile = VkFFT_GetAxisUploadProfile(app, axis);
+	double profileStart = VkFFT_ProfileStart(app);
+	if (job->isR2Cdecomposition)
+		resFFT = shaderGen_R2C_even_decomposition(&axis->specializationConstants, job->type);
+	else
+		resFFT = shaderGen_FFT(&axis->specializationConstants, job->type);
+	if (profile) {
+		profile->codeGenerationTime = VkFFT_GetHostTime() - profileStart;
+		profile->codeSize = (resFFT == VKFFT_SUCCESS) ? (pfUINT)strlen(axis->specializationConstants.code0) : 0;
+		profileStart = VkFFT_GetHostTime();
+	}
+	if ((resFFT == VKFFT_SUCCESS) && (!app->configuration.dryRun)) {
+		resFFT = VkFFT_CompileKernel(app, axis);
+		if (resFFT != VKFFT_SUCCESS) axis->specializationConstants.code0 = 0; //freed by VkFFT_CompileKernel
+		if (profile) {
+			profile->compilationTime = VkFFT_GetHostTime() - profileStart;
+			profile->binarySize = axis->binarySize;
+		}
+	}
+	//in dryRun mode generated code is the result of planning and is kept for VkFFTSavePlanDescription
+	if (((!app->configuration.keepShaderCode) && (!app->configuration.dryRun)) || (resFFT != VKFFT_SUCCESS))
+		VkFFT_ReleaseCodeBuffer(app, &axis->specializationConstants, reuseCodeBuffer);
+	if (!job->isR2Cdecomposition) {
+		freeMemoryParametersAPI(app, &axis->specializationConstants);
+		freeParametersAPI(app, &axis->specializationConstants);
+		if (axis->specializationConstants.axisSwapped) {//swap back for correct dispatch
+			pfUINT temp = axis->axisBlock[1];
+			axis->axisBlock[1] = axis->axisBlock[0];
+			axis->axisBlock[0] = temp;
+			axis->specializationConstants.axisSwapped = 0;
+		}
+	}
+	return resFFT;
+}
+
+static inline void VkFFT_ReleaseCompileJobs(VkFFTApplication* app) {
+	//releases jobs that were queued, but never executed (plan creation failed before VkFFTRunCompileJobs)
+	for (pfUINT i = 0; i < app->numCompileJobs; i++) {
+		VkFFTAxis* axis = app->compileJobs[i].axis;
+		if (axis->specializationConstants.code0) {
+			free(axis->specializationConstants.code0);
+			axis->specializationConstants.code0 = 0;
+		}
+		if (!app->compileJobs[i].isR2Cdecomposition) {
+			freeMemoryParametersAPI(app, &axis->specializationConstants);
+			freeParametersAPI(app, &axis->specializationConstants);
+		}
+	}
+	app->numCompileJobs = 0;
+}
+
+static inline VkFFTResult VkFFTAddCompileJob(VkFFTApplication* app, VkFFTAxis* axis, int type, int isR2Cdecomposition) {
+	VkFFTCompileJob job = VKFFT_ZERO_INIT;
+	job.axis = axis;
+	job.type = type;
+	job.isR2Cdecomposition = isR2Cdecomposition;
+	if ((app->configuration.numCompileThreads < 2) && (!app->configuration.compileTaskExecutor))
+		return VkFFT_RunCompileJob(app, &job, 1);
+	if (app->numCompileJobs == sizeof(app->compileJobs) / sizeof(app->compileJobs[0]))
+		return VkFFT_RunCompileJob(app, &job, 1);
+	app->compileJobs[app->numCompileJobs] = job;
+	app->numCompileJobs++;
+	return VKFFT_SUCCESS;
+}
+
+static inline void VkFFT_CompileTask(void* taskData, pfUINT taskID) {
+	VkFFTCompileTaskData* data = (VkFFTCompileTaskData*)taskData;
+#if(VKFFT_BACKEND==1)
+	if (!data->app->configuration.dryRun) cuCtxSetCurrent(data->context);
+#elif(VKFFT_BACKEND==2)
+	if (!data->app->configuration.dryRun) hipSetDevice(data->device);
+#endif
+	data->app->compileJobs[taskID].result = VkFFT_RunCompileJob(data->app, &data->app->compileJobs[taskID], 0);
+}
+
+static inline VkFFTResult VkFFTRunCompileJobs(VkFFTApplication* app) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (app->numCompileJobs == 0) return resFFT;
+	if ((app->configuration.kernelCacheDirectory) && (!app->deviceHash)) {
+		//computed once here, as compile jobs only read it
+		resFFT = VkFFT_GetDeviceHash(app, &app->deviceHash);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	VkFFTCompileTaskData taskData = VKFFT_ZERO_INIT;
+	taskData.app = app;
+#if(VKFFT_BACKEND==1)
+	if ((!app->configuration.dryRun) && (cuCtxGetCurrent(&taskData.context) != CUDA_SUCCESS)) return VKFFT_ERROR_FAILED_TO_GET_DEVICE;
+#elif(VKFFT_BACKEND==2)
+	if ((!app->configuration.dryRun) && (hipGetDevice(&taskData.device) != hipSuccess)) return VKFFT_ERROR_FAILED_TO_GET_DEVICE;
+#endif
+	for (pfUINT i = 0; i < app->numCompileJobs; i++)
+		app->compileJobs[i].result = VKFFT_SUCCESS;
+	VkFFT_RunHostTasks(&app->configuration, app->numCompileJobs, VkFFT_CompileTask, &taskData);
+	for (pfUINT i = 0; i < app->numCompileJobs; i++) {
+		if ((app->compileJobs[i].result != VKFFT_SUCCESS) && (resFFT == VKFFT_SUCCESS)) resFFT = app->compileJobs[i].result;
+	}
+	app->numCompileJobs = 0;
+	return resFFT;
+}
+#endif
@@ -0,0 +1,177 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_COMPUTELUT_H
+#define VKFFT_COMPUTELUT_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_HostTasks.h"
+
+// Host computation of large twiddle tables (4-step, DCT and R2C LUTs), which can have up to the full system size number of values.
+// VkFFT_ComputeLUTTable fills numRows rows of rowLength values, starting at LUT position offset, with exp(i * sign * 2 * pi * m / N),
+// where m = (c * (r * rowStep + colStep) + start) mod N for the row r and the column c of the table.
+// Instead of evaluating sin and cos for every value, m is split as m = a * B + b with B being a power of two close to sqrt(N) and
+// the value is obtained as the product of two precomputed roots in long double, which needs only 2 * sqrt(N) sin/cos evaluations.
+// Tables are split in chunks of VKFFT_LUT_CHUNK_SIZE values that are computed in parallel with VkFFT_RunHostTasks.
+// Double-double tables and double tables on systems where long double is not wider than double are evaluated directly, as the product
+// of two roots would lose precision there.
+
+#define VKFFT_LUT_CHUNK_SIZE 65536
+
+typedef struct {
+	VkFFTLUTTable* table;
+	long double* fineRoots;//exp(i * 2 * pi * b / N), b < B
+	long double* coarseRoots;//exp(i * 2 * pi * a * B / N), a < N / B
+	pfUINT splitBits;//B = 2^splitBits
+	pfUINT numValues;
+} VkFFTLUTTaskData;
+
+static inline void VkFFT_StoreLUTValue(VkFFTLUTTable* table, pfUINT id, pfLD cosValue, pfLD sinValue) {
+	if (table->precision == 0) {
+		float* LUT = (float*)table->LUT;
+		LUT[2 * id] = (float)cosValue;
+		LUT[2 * id + 1] = (float)sinValue;
+	}
+	else if (table->precision == 1) {
+		double* LUT = (double*)table->LUT;
+		LUT[2 * id] = (double)cosValue;
+		LUT[2 * id + 1] = (double)sinValue;
+	}
+	else {
+		//same split as PfConvToDoubleDouble
+		double* LUT = (double*)table->LUT;
+		pfLD values[2] = { cosValue, sinValue };
+		for (pfUINT i = 0; i < 2; i++) {
+			double high = (double)values[i];
+			double low = (double)(values[i] - (pfLD)high);
+			double temp = high + low;
+			low = (high - temp) + low;
+			high = temp;
+			LUT[4 * id + 2 * i] = high;
+			LUT[4 * id + 2 * i + 1] = low;
+		}
+	}
+}
+
+static inline void VkFFT_ComputeLUTRoot(pfLD angle, long double* root) {
+	//roots are computed in long double precision, as pfcos and pfsin are evaluated in double precision when compiled as C
+#ifdef VKFFT_USE_QUADMATH_FP128
+	root[0] = (long double)pfcos(angle);
+	root[1] = (long double)pfsin(angle);
+#else
+	root[0] = cosl(angle);
+	root[1] = sinl(angle);
+#endif
+}
+
+static inline pfUINT VkFFT_MulModLUT(pfUINT a, pfUINT b, pfUINT N) {
+	a %= N;
+	b %= N;
+	if ((a < ((pfUINT)1 << 32)) && (b < ((pfUINT)1 << 32))) return (a * b) % N;
+	pfUINT result = 0;
+	while (b) {
+		if (b & 1) result = (result >= N - a) ? result - (N - a) : result + a;
+		a = (a >= N - a) ? a - (N - a) : a + a;
+		b >>= 1;
+	}
+	return result;
+}
+
+static inline void VkFFT_ComputeLUTChunk(void* taskData, pfUINT taskID) {
+	VkFFTLUTTaskData* data = (VkFFTLUTTaskData*)taskData;
+	VkFFTLUTTable* table = data->table;
+	pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
+	pfUINT firstValue = taskID * VKFFT_LUT_CHUNK_SIZE;
+	pfUINT lastValue = (firstValue + VKFFT_LUT_CHUNK_SIZE < data->numValues) ? firstValue + VKFFT_LUT_CHUNK_SIZE : data->numValues;
+	pfUINT r = firstValue / table->rowLength;
+	pfUINT c = firstValue - r * table->rowLength;
+	pfUINT mask = ((pfUINT)1 << data->splitBits) - 1;
+	pfUINT id = firstValue;
+	while (id < lastValue) {
+		//m only needs a full computation at the start of a row, then it is advanced by step
+		pfUINT step = (VkFFT_MulModLUT(r, table->rowStep, table->N) + table->colStep % table->N) % table->N;
+		pfUINT m = (VkFFT_MulModLUT(c, step, table->N) + table->start % table->N) % table->N;
+		pfUINT rowEnd = (lastValue - id < table->rowLength - c) ? lastValue : id + table->rowLength - c;
+		if (data->fineRoots) {
+			for (; id < rowEnd; id++) {
+				const long double* fine = data->fineRoots + 2 * (m & mask);
+				const long double* coarse = data->coarseRoots + 2 * (m >> data->splitBits);
+				long double cosValue = coarse[0] * fine[0] - coarse[1] * fine[1];
+				long double sinValue = table->sign * (coarse[1] * fine[0] + coarse[0] * fine[1]);
+				if (table->precision == 0) {
+					((float*)table->LUT)[2 * (table->offset + id)] = (float)cosValue;
+					((float*)table->LUT)[2 * (table->offset + id) + 1] = (float)sinValue;
+				}
+				else {
+					((double*)table->LUT)[2 * (table->offset + id)] = (double)cosValue;
+					((double*)table->LUT)[2 * (table->offset + id) + 1] = (double)sinValue;
+				}
+				m += step;
+				if (m >= table->N) m -= table->N;
+			}
+		}
+		else {
+			for (; id < rowEnd; id++) {
+				pfLD angle = 2 * double_PI * (m / (pfLD)table->N);
+				VkFFT_StoreLUTValue(table, table->offset + id, pfcos(angle), table->sign * pfsin(angle));
+				m += step;
+				if (m >= table->N) m -= table->N;
+			}
+		}
+		r++;
+		c = 0;
+	}
+}
+
+static inline VkFFTResult VkFFT_ComputeLUTTable(VkFFTConfiguration* configuration, void* LUT, pfUINT precision, pfUINT offset, pfUINT N, pfUINT numRows, pfUINT rowLength, pfUINT rowStep, pfUINT colStep, pfUINT start, pfINT sign) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTLUTTable localTable = { LUT, precision, offset, N, numRows, rowLength, rowStep, colStep, start, sign, 0 };
+	VkFFTLUTTable* table = &localTable;
+	VkFFTLUTTaskData taskData = VKFFT_ZERO_INIT;
+	taskData.table = table;
+	taskData.numValues = table->numRows * table->rowLength;
+	if ((taskData.numValues == 0) || (table->N == 0)) return resFFT;
+	if ((table->precision == 0) || ((table->precision == 1) && (LDBL_MANT_DIG > DBL_MANT_DIG))) {
+		pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
+		while (((pfUINT)1 << (2 * taskData.splitBits)) < table->N) taskData.splitBits++;
+		pfUINT numFineRoots = (pfUINT)1 << taskData.splitBits;
+		pfUINT numCoarseRoots = (table->N + numFineRoots - 1) / numFineRoots;
+		//not worth it for tables that have fewer values than roots to precompute
+		if (taskData.numValues > 2 * (numFineRoots + numCoarseRoots)) {
+			taskData.fineRoots = (long double*)malloc(2 * (numFineRoots + numCoarseRoots) * sizeof(long double));
+			if (!taskData.fineRoots) return VKFFT_ERROR_MALLOC_FAILED;
+			taskData.coarseRoots = taskData.fineRoots + 2 * numFineRoots;
+			for (pfUINT i = 0; i < numFineRoots; i++) {
+				VkFFT_ComputeLUTRoot(2 * double_PI * (i / (pfLD)table->N), taskData.fineRoots + 2 * i);
+			}
+			for (pfUINT i = 0; i < numCoarseRoots; i++) {
+				VkFFT_ComputeLUTRoot(2 * double_PI * ((i * numFineRoots) / (pfLD)table->N), taskData.coarseRoots + 2 * i);
+			}
+		}
+	}
+	pfUINT numChunks = (taskData.numValues + VKFFT_LUT_CHUNK_SIZE - 1) / VKFFT_LUT_CHUNK_SIZE;
+	if (numChunks > 1)
+		VkFFT_RunHostTasks(configuration, numChunks, VkFFT_ComputeLUTChunk, &taskData);
+	else
+		VkFFT_ComputeLUTChunk(&taskData, 0);
+	free(taskData.fineRoots);
+	return resFFT;
+}
+#endif
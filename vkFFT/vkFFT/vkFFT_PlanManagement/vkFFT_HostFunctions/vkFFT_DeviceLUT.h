@@ -0,0 +1,402 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_DEVICELUT_H
+#define VKFFT_DEVICELUT_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_ManageMemory.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_InitAPIParameters.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_CompileKernel.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_DispatchPlan.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_DeletePlan.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CompileJobs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_ComputeLUT.h"
+#include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel2/vkFFT_LUTGeneration.h"
+
+// Generation of large LUT tables and Bluestein chirps in device memory, used if generateLUTOnDevice is enabled.
+// While the host part of a LUT is prepared, VkFFT_AddLUTTable records the large tables instead of computing them. The buffer is then
+// allocated, only the host part is uploaded and the recorded tables are filled by a kernel from shaderGen_LUTGeneration, which is
+// compiled (or taken from the kernel cache), dispatched once and destroyed. Tables with fewer than VKFFT_DEVICE_LUT_MIN_SIZE values
+// and double-double tables are always computed on the host.
+
+#define VKFFT_DEVICE_LUT_MIN_SIZE 1048576
+#define VKFFT_DEVICE_LUT_MAX_TABLES 4
+
+typedef struct {
+	VkFFTLUTTable tables[VKFFT_DEVICE_LUT_MAX_TABLES];
+	pfUINT numTables;
+	pfUINT enabled;
+	pfUINT precision;//0 - float, 1 - double
+	pfUINT hostLUTSize;//bytes at the start of the buffer that are computed on the host and uploaded
+} VkFFTDeviceLUT;
+
+static inline void VkFFT_InitDeviceLUT(VkFFTApplication* app, VkFFTDeviceLUT* deviceLUT, pfUINT precision, pfUINT bufferSize, pfUINT deviceValues) {
+	//deviceValues - number of values at the end of the buffer that can be generated on the device
+	deviceLUT->numTables = 0;
+	deviceLUT->precision = precision;
+	deviceLUT->enabled = (app->configuration.generateLUTOnDevice) && (precision < 2) && (!app->configuration.loadApplicationFromString) && (deviceValues >= VKFFT_DEVICE_LUT_MIN_SIZE);
+	//the generation kernel is dispatched on a 2D grid without work group shifts
+	pfUINT localSize = (app->configuration.maxThreadsNum < 256) ? app->configuration.maxThreadsNum : 256;
+	pfUINT numGroups = (deviceValues + localSize - 1) / localSize;
+	pfUINT numGroupsY = numGroups / app->configuration.maxComputeWorkGroupCount[0] + ((numGroups % app->configuration.maxComputeWorkGroupCount[0]) != 0);
+	if (numGroupsY > app->configuration.maxComputeWorkGroupCount[1]) deviceLUT->enabled = 0;
+	deviceLUT->hostLUTSize = (deviceLUT->enabled) ? bufferSize - deviceValues * 2 * ((precision) ? sizeof(double) : sizeof(float)) : bufferSize;
+}
+
+static inline VkFFTResult VkFFT_AddLUTTable(VkFFTApplication* app, VkFFTDeviceLUT* deviceLUT, void* LUT, pfUINT offset, pfUINT N, pfUINT numRows, pfUINT rowLength, pfUINT rowStep, pfUINT colStep, pfUINT start, pfINT sign) {
+	//same arguments as VkFFT_ComputeLUTTable. The table is recorded for device generation if it is enabled and computed on the host otherwise
+	if ((!deviceLUT->enabled) || (deviceLUT->numTables == VKFFT_DEVICE_LUT_MAX_TABLES)) return VkFFT_ComputeLUTTable(&app->configuration, LUT, deviceLUT->precision, offset, N, numRows, rowLength, rowStep, colStep, start, sign);
+	if ((numRows * rowLength == 0) || (N == 0)) return VKFFT_SUCCESS;
+	VkFFTLUTTable table = { 0, deviceLUT->precision, offset, N, numRows, rowLength, rowStep, colStep, start, sign, 0 };
+	deviceLUT->tables[deviceLUT->numTables] = table;
+	deviceLUT->numTables++;
+	return VKFFT_SUCCESS;
+}
+
+static inline VkFFTResult VkFFT_AddChirpTable(VkFFTApplication* app, VkFFTDeviceLUT* deviceLUT, pfUINT N, pfUINT length, pfUINT chirpLength, pfINT sign) {
+	//Bluestein chirp of the length values, recorded only if device generation is enabled
+	if (!deviceLUT->enabled) return VKFFT_SUCCESS;
+	VkFFTLUTTable table = { 0, deviceLUT->precision, 0, N, 1, length, 0, 0, 0, sign, chirpLength };
+	deviceLUT->tables[0] = table;
+	deviceLUT->numTables = 1;
+	return VKFFT_SUCCESS;
+}
+
+static inline VkFFTResult VkFFT_DispatchLUTGeneration(VkFFTApplication* app, VkFFTAxis* axis, pfUINT* dispatchBlock) {
+	//records the generation kernel, submits it and waits for completion. Command buffer/queue/list of the configuration are only replaced for the duration of the call
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	VkCommandBufferAllocateInfo commandBufferAllocateInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+	commandBufferAllocateInfo.commandPool = app->configuration.commandPool[0];
+	commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	commandBufferAllocateInfo.commandBufferCount = 1;
+	VkCommandBuffer commandBuffer = VKFFT_ZERO_INIT;
+	res = vkAllocateCommandBuffers(app->configuration.device[0], &commandBufferAllocateInfo, &commandBuffer);
+	if (res != 0) return VKFFT_ERROR_FAILED_TO_ALLOCATE_COMMAND_BUFFERS;
+	VkCommandBufferBeginInfo commandBufferBeginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+	commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	res = vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+	if (res != 0) {
+		vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+		return VKFFT_ERROR_FAILED_TO_BEGIN_COMMAND_BUFFER;
+	}
+	VkCommandBuffer* userCommandBuffer = app->configuration.commandBuffer;
+	app->configuration.commandBuffer = &commandBuffer;
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipeline);
+	vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, axis->pipelineLayout, 0, 1, &axis->descriptorSet, 0, 0);
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+	app->configuration.commandBuffer = userCommandBuffer;
+	if (resFFT != VKFFT_SUCCESS) {
+		vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+		return resFFT;
+	}
+	res = vkEndCommandBuffer(commandBuffer);
+	if (res != 0) {
+		vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+		return VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	}
+	VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &commandBuffer;
+	res = vkQueueSubmit(app->configuration.queue[0], 1, &submitInfo, app->configuration.fence[0]);
+	if (res != 0) {
+		vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+		return VKFFT_ERROR_FAILED_TO_SUBMIT_QUEUE;
+	}
+	res = vkWaitForFences(app->configuration.device[0], 1, app->configuration.fence, VK_TRUE, 100000000000);
+	if (res != 0) {
+		vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+		return VKFFT_ERROR_FAILED_TO_WAIT_FOR_FENCES;
+	}
+	res = vkResetFences(app->configuration.device[0], 1, app->configuration.fence);
+	vkFreeCommandBuffers(app->configuration.device[0], app->configuration.commandPool[0], 1, &commandBuffer);
+	if (res != 0) return VKFFT_ERROR_FAILED_TO_RESET_FENCES;
+#elif(VKFFT_BACKEND==1)
+	pfUINT streamID = app->configuration.streamID;
+	pfUINT streamCounter = app->configuration.streamCounter;
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+	app->configuration.streamID = streamID;
+	app->configuration.streamCounter = streamCounter;
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	if (cudaDeviceSynchronize() != cudaSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==2)
+	pfUINT streamID = app->configuration.streamID;
+	pfUINT streamCounter = app->configuration.streamCounter;
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+	app->configuration.streamID = streamID;
+	app->configuration.streamCounter = streamCounter;
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	if (hipDeviceSynchronize() != hipSuccess) return VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	cl_command_queue commandQueue = clCreateCommandQueue(app->configuration.context[0], app->configuration.device[0], 0, &res);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_QUEUE;
+	cl_command_queue* userCommandQueue = app->configuration.commandQueue;
+	app->configuration.commandQueue = &commandQueue;
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+	app->configuration.commandQueue = userCommandQueue;
+	if (resFFT == VKFFT_SUCCESS) {
+		res = clFinish(commandQueue);
+		if (res != CL_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+	}
+	clReleaseCommandQueue(commandQueue);
+#elif(VKFFT_BACKEND==4)
+	ze_result_t res = ZE_RESULT_SUCCESS;
+	ze_command_list_desc_t commandListDescription = VKFFT_ZERO_INIT;
+	commandListDescription.stype = ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC;
+	ze_command_list_handle_t commandList = VKFFT_ZERO_INIT;
+	res = zeCommandListCreate(app->configuration.context[0], app->configuration.device[0], &commandListDescription, &commandList);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	ze_command_list_handle_t* userCommandList = app->configuration.commandList;
+	app->configuration.commandList = &commandList;
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+	app->configuration.commandList = userCommandList;
+	if (resFFT == VKFFT_SUCCESS) {
+		res = zeCommandListClose(commandList);
+		if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_END_COMMAND_BUFFER;
+	}
+	if (resFFT == VKFFT_SUCCESS) {
+		res = zeCommandQueueExecuteCommandLists(app->configuration.commandQueue[0], 1, &commandList, 0);
+		if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_SUBMIT_QUEUE;
+	}
+	if (resFFT == VKFFT_SUCCESS) {
+		res = zeCommandQueueSynchronize(app->configuration.commandQueue[0], UINT32_MAX);
+		if (res != ZE_RESULT_SUCCESS) resFFT = VKFFT_ERROR_FAILED_TO_SYNCHRONIZE;
+	}
+	zeCommandListDestroy(commandList);
+#elif(VKFFT_BACKEND==5)
+	MTL::CommandBuffer* commandBuffer = app->configuration.queue->commandBuffer();
+	if (commandBuffer == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	MTL::ComputeCommandEncoder* commandEncoder = commandBuffer->computeCommandEncoder();
+	if (commandEncoder == 0) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST;
+	MTL::ComputeCommandEncoder* userCommandEncoder = app->configuration.commandEncoder;
+	app->configuration.commandEncoder = commandEncoder;
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+	app->configuration.commandEncoder = userCommandEncoder;
+	commandEncoder->endEncoding();
+	if (resFFT == VKFFT_SUCCESS) {
+		commandBuffer->commit();
+		commandBuffer->waitUntilCompleted();
+	}
+	commandEncoder->release();
+	commandBuffer->release();
+#elif(VKFFT_BACKEND==6)
+	//launches are synchronous
+	resFFT = VkFFT_DispatchPlan(app, axis, dispatchBlock);
+#endif
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_GenerateDeviceLUT(VkFFTApplication* app, VkFFTDeviceLUT* deviceLUT, void* buffer, pfUINT bufferSize) {
+	//fills the recorded tables of the device buffer, which must be allocated with bufferSize bytes. The kernel is planned on a temporary axis that is destroyed afterwards
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (deviceLUT->numTables == 0) return resFFT;
+	VkFFTAxis* axis = (VkFFTAxis*)calloc(1, sizeof(VkFFTAxis));
+	if (!axis) return VKFFT_ERROR_MALLOC_FAILED;
+	VkFFTSpecializationConstantsLayout* sc = &axis->specializationConstants;
+	sc->warpSize = (int)app->configuration.warpSize;
+	sc->numSharedBanks = (int)app->configuration.numSharedBanks;
+	//extensions for 64-bit integers, indices are computed in 64 bits
+	sc->useUint64 = 1;
+	sc->disableSetLocale = (int)app->configuration.disableSetLocale;
+	sc->maxCodeLength = (int)app->configuration.maxCodeLength;
+	sc->maxTempLength = (int)app->configuration.maxTempLength;
+	sc->double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
+	sc->precision = (int)deviceLUT->precision;
+	sc->complexSize = (deviceLUT->precision) ? (2 * sizeof(double)) : (2 * sizeof(float));
+
+	pfUINT firstValue = deviceLUT->tables[0].offset;
+	pfUINT lastValue = 0;
+	for (pfUINT i = 0; i < deviceLUT->numTables; i++) {
+		VkFFTLUTTable* table = &deviceLUT->tables[i];
+		if (table->offset < firstValue) firstValue = table->offset;
+		if (table->offset + table->numRows * table->rowLength > lastValue) lastValue = table->offset + table->numRows * table->rowLength;
+	}
+	axis->axisBlock[0] = 256;
+	if (axis->axisBlock[0] > app->configuration.maxThreadsNum) axis->axisBlock[0] = app->configuration.maxThreadsNum;
+	axis->axisBlock[1] = 1;
+	axis->axisBlock[2] = 1;
+	pfUINT numGroups = (lastValue - firstValue + axis->axisBlock[0] - 1) / axis->axisBlock[0];
+	pfUINT dispatchBlock[3];
+	dispatchBlock[0] = (numGroups < app->configuration.maxComputeWorkGroupCount[0]) ? numGroups : app->configuration.maxComputeWorkGroupCount[0];
+	dispatchBlock[1] = (numGroups + dispatchBlock[0] - 1) / dispatchBlock[0];
+	dispatchBlock[2] = 1;
+	for (int i = 0; i < 3; i++) {
+		sc->localSize[i].type = 31;
+		sc->localSize[i].data.i = (pfINT)axis->axisBlock[i];
+	}
+	axis->pushConstants.structSize = 0;
+	sc->pushConstantsStructSize = 0;
+#if(VKFFT_BACKEND==0)
+	axis->inputBuffer = (VkBuffer*)buffer;
+	axis->outputBuffer = (VkBuffer*)buffer;
+#elif(VKFFT_BACKEND==1)
+	axis->inputBuffer = (void**)buffer;
+	axis->outputBuffer = (void**)buffer;
+#elif(VKFFT_BACKEND==2)
+	axis->inputBuffer = (void**)buffer;
+	axis->outputBuffer = (void**)buffer;
+#elif(VKFFT_BACKEND==3)
+	axis->inputBuffer = (cl_mem*)buffer;
+	axis->outputBuffer = (cl_mem*)buffer;
+#elif(VKFFT_BACKEND==4)
+	axis->inputBuffer = (void**)buffer;
+	axis->outputBuffer = (void**)buffer;
+#elif(VKFFT_BACKEND==5)
+	axis->inputBuffer = (MTL::Buffer**)buffer;
+	axis->outputBuffer = (MTL::Buffer**)buffer;
+#elif(VKFFT_BACKEND==6)
+	axis->inputBuffer = (void**)buffer;
+	axis->outputBuffer = (void**)buffer;
+#endif
+	sc->inputBufferBlockNum = 1;
+	sc->inputBufferBlockSize = bufferSize;
+	sc->outputBufferBlockNum = 1;
+	sc->outputBufferBlockSize = bufferSize;
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	VkDescriptorPoolSize descriptorPoolSize = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER };
+	descriptorPoolSize.descriptorCount = 2;
+	VkDescriptorPoolCreateInfo descriptorPoolCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+	descriptorPoolCreateInfo.poolSizeCount = 1;
+	descriptorPoolCreateInfo.pPoolSizes = &descriptorPoolSize;
+	descriptorPoolCreateInfo.maxSets = 1;
+	res = vkCreateDescriptorPool(app->configuration.device[0], &descriptorPoolCreateInfo, 0, &axis->descriptorPool);
+	if (res != VK_SUCCESS) {
+		free(axis);
+		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_POOL;
+	}
+	VkDescriptorSetLayoutBinding descriptorSetLayoutBindings[2];
+	for (pfUINT i = 0; i < 2; ++i) {
+		descriptorSetLayoutBindings[i].binding = (uint32_t)i;
+		descriptorSetLayoutBindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptorSetLayoutBindings[i].descriptorCount = 1;
+		descriptorSetLayoutBindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+		descriptorSetLayoutBindings[i].pImmutableSamplers = 0;
+	}
+	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+	descriptorSetLayoutCreateInfo.bindingCount = 2;
+	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings;
+	res = vkCreateDescriptorSetLayout(app->configuration.device[0], &descriptorSetLayoutCreateInfo, 0, &axis->descriptorSetLayout);
+	if (res != VK_SUCCESS) {
+		deleteAxis(app, axis, 1);
+		free(axis);
+		return VKFFT_ERROR_FAILED_TO_CREATE_DESCRIPTOR_SET_LAYOUT;
+	}
+	VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+	descriptorSetAllocateInfo.descriptorPool = axis->descriptorPool;
+	descriptorSetAllocateInfo.descriptorSetCount = 1;
+	descriptorSetAllocateInfo.pSetLayouts = &axis->descriptorSetLayout;
+	res = vkAllocateDescriptorSets(app->configuration.device[0], &descriptorSetAllocateInfo, &axis->descriptorSet);
+	if (res != VK_SUCCESS) {
+		deleteAxis(app, axis, 1);
+		free(axis);
+		return VKFFT_ERROR_FAILED_TO_ALLOCATE_DESCRIPTOR_SETS;
+	}
+	for (pfUINT i = 0; i < 2; ++i) {
+		VkDescriptorBufferInfo descriptorBufferInfo = { 0 };
+		descriptorBufferInfo.buffer = axis->inputBuffer[0];
+		descriptorBufferInfo.offset = 0;
+		descriptorBufferInfo.range = bufferSize;
+		VkWriteDescriptorSet writeDescriptorSet = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+		writeDescriptorSet.dstSet = axis->descriptorSet;
+		writeDescriptorSet.dstBinding = (uint32_t)i;
+		writeDescriptorSet.dstArrayElement = 0;
+		writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		writeDescriptorSet.descriptorCount = 1;
+		writeDescriptorSet.pBufferInfo = &descriptorBufferInfo;
+		vkUpdateDescriptorSets(app->configuration.device[0], 1, &writeDescriptorSet, 0, 0);
+	}
+#endif
+	resFFT = initMemoryParametersAPI(app, sc);
+	if (resFFT != VKFFT_SUCCESS) {
+		deleteAxis(app, axis, 1);
+		free(axis);
+		return resFFT;
+	}
+	//tables are computed and stored in the LUT precision regardless of the memory precision of the application
+	sc->floatTypeCode = (deviceLUT->precision) ? 22 : 12;
+	sc->vecTypeCode = sc->floatTypeCode + 1;
+	sc->floatTypeKernelMemoryCode = sc->floatTypeCode;
+	sc->floatTypeInputMemoryCode = sc->floatTypeCode;
+	sc->floatTypeOutputMemoryCode = sc->floatTypeCode;
+	sc->vecTypeKernelMemoryCode = sc->vecTypeCode;
+	sc->vecTypeInputMemoryCode = sc->vecTypeCode;
+	sc->vecTypeOutputMemoryCode = sc->vecTypeCode;
+	sc->inputMemoryCode = sc->vecTypeCode;
+	sc->outputMemoryCode = sc->vecTypeCode;
+	sc->inputNumberByteSize = (int)sc->complexSize;
+	sc->outputNumberByteSize = (int)sc->complexSize;
+	resFFT = initParametersAPI(app, sc);
+	if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_AllocateCodeBuffer(app, sc);
+	if (resFFT == VKFFT_SUCCESS) {
+#if(VKFFT_BACKEND==0)
+		sprintf(axis->VkFFTFunctionName, "main");
+#else
+		sprintf(axis->VkFFTFunctionName, "VkFFT_main_R2C");
+#endif
+		resFFT = shaderGen_LUTGeneration(sc, deviceLUT->tables, deviceLUT->numTables, dispatchBlock[0]);
+		if (resFFT == VKFFT_SUCCESS) {
+			resFFT = VkFFT_CompileKernel(app, axis);
+			if (resFFT != VKFFT_SUCCESS) sc->code0 = 0; //freed by VkFFT_CompileKernel
+		}
+		VkFFT_ReleaseCodeBuffer(app, sc, 1);
+	}
+	freeMemoryParametersAPI(app, sc);
+	freeParametersAPI(app, sc);
+	if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_DispatchLUTGeneration(app, axis, dispatchBlock);
+	deleteAxis(app, axis, 1);
+	free(axis);
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_AllocateDeviceLUT(VkFFTApplication* app, VkFFTAxis* axis, VkFFTDeviceLUT* deviceLUT, void* tempLUT) {
+	//allocates axis->bufferLUT, uploads the part computed on the host and generates the recorded tables
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+#if(VKFFT_BACKEND==0)
+	resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+#elif(VKFFT_BACKEND==1)
+	if (cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize) != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==2)
+	if (hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize) != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==3)
+	cl_int res = CL_SUCCESS;
+	axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, axis->bufferLUTSize, 0, &res);
+	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==4)
+	ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+	device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+	if (zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT) != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#elif(VKFFT_BACKEND==5)
+	axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
+#elif(VKFFT_BACKEND==6)
+	axis->bufferLUT = malloc(axis->bufferLUTSize);
+	if (!axis->bufferLUT) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+#endif
+	if (deviceLUT->hostLUTSize) {
+		resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, deviceLUT->hostLUTSize);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	return VkFFT_GenerateDeviceLUT(app, deviceLUT, &axis->bufferLUT, axis->bufferLUTSize);
+}
+#endif
@@ -0,0 +1,353 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_DEVICEPROFILE_H
+#define VKFFT_DEVICEPROFILE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+
+// Device profiles. setConfigurationVkFFT takes the device limits from the device, fills tuning parameters from the built-in profile of the vendor
+// and backend and applies the user profile (deviceProfile and deviceProfileFile) on top of both. The result is kept in app->deviceProfile and can be
+// written with VkFFTSaveDeviceProfile, so that plans made on one machine can be reproduced from the file on another one with the same GPU.
+
+#define VKFFT_DEVICE_PROFILE_NUM_LIMITS 9
+#define VKFFT_DEVICE_PROFILE_NUM_FIELDS 22
+
+static inline void VkFFT_GetPrecisionClass(VkFFTConfiguration* configuration, const char** precision, const char** fallbackPrecision) {
+	//precision names used in device profile and Bluestein padding files. Half and double-double precisions fall back to single and double
+	precision[0] = "single";
+	fallbackPrecision[0] = 0;
+	if (configuration->quadDoubleDoublePrecision || configuration->quadDoubleDoublePrecisionDoubleMemory) {
+		precision[0] = "doubledouble";
+		fallbackPrecision[0] = "double";
+	}
+	else if (configuration->doublePrecision || configuration->doublePrecisionFloatMemory) {
+		precision[0] = "double";
+	}
+	else if (configuration->halfPrecision) {
+		precision[0] = "half";
+		fallbackPrecision[0] = "single";
+	}
+}
+
+static inline pfINT* VkFFT_GetDeviceProfileField(VkFFTDeviceProfile* profile, pfUINT id, const char** name, pfUINT* size) {
+	//fields 0 to VKFFT_DEVICE_PROFILE_NUM_LIMITS-1 are device limits, the rest are tuning parameters. useLUT and useLUT_4step are signed
+	const char* names[VKFFT_DEVICE_PROFILE_NUM_FIELDS] = { "vendorID", "maxThreadsNum", "maxComputeWorkGroupCount", "maxComputeWorkGroupSize", "sharedMemorySizeStatic", "sharedMemorySize", "warpSize", "computeCapabilityMajor", "computeCapabilityMinor",
+		"coalescedMemory", "useLUT", "useLUT_4step", "registerBoost", "registerBoostNonPow2", "registerBoost4Step", "swapTo3Stage4Step", "fixMinRaderPrimeMult", "fixMaxRaderPrimeMult", "fixMinRaderPrimeFFT", "fixMaxRaderPrimeFFT", "aimThreads", "numSharedBanks" };
+	pfINT* fields[VKFFT_DEVICE_PROFILE_NUM_FIELDS] = { (pfINT*)&profile->vendorID, (pfINT*)&profile->maxThreadsNum, (pfINT*)profile->maxComputeWorkGroupCount, (pfINT*)profile->maxComputeWorkGroupSize, (pfINT*)&profile->sharedMemorySizeStatic, (pfINT*)&profile->sharedMemorySize, (pfINT*)&profile->warpSize, (pfINT*)&profile->computeCapabilityMajor, (pfINT*)&profile->computeCapabilityMinor,
+		(pfINT*)&profile->coalescedMemory, &profile->useLUT, &profile->useLUT_4step, (pfINT*)&profile->registerBoost, (pfINT*)&profile->registerBoostNonPow2, (pfINT*)&profile->registerBoost4Step, (pfINT*)&profile->swapTo3Stage4Step, (pfINT*)&profile->fixMinRaderPrimeMult, (pfINT*)&profile->fixMaxRaderPrimeMult, (pfINT*)&profile->fixMinRaderPrimeFFT, (pfINT*)&profile->fixMaxRaderPrimeFFT, (pfINT*)&profile->aimThreads, (pfINT*)&profile->numSharedBanks };
+	name[0] = names[id];
+	size[0] = ((id == 2) || (id == 3)) ? 3 : 1;
+	return fields[id];
+}
+
+static inline void VkFFT_MergeDeviceProfile(VkFFTDeviceProfile* profile, VkFFTDeviceProfile* userProfile, pfUINT firstField, pfUINT lastField) {
+	//copies non-zero fields of userProfile
+	for (pfUINT id = firstField; id < lastField; id++) {
+		const char* name;
+		pfUINT size;
+		pfINT* field = VkFFT_GetDeviceProfileField(profile, id, &name, &size);
+		pfINT* userField = VkFFT_GetDeviceProfileField(userProfile, id, &name, &size);
+		for (pfUINT i = 0; i < size; i++) {
+			if (userField[i] != 0) field[i] = userField[i];
+		}
+	}
+}
+
+static inline void VkFFT_SetBuiltInDeviceProfile(VkFFTConfiguration* configuration, VkFFTDeviceProfile* profile, VkFFTDeviceProfile* userProfile) {
+	//default tuning parameters of the vendor and backend. Queried limits are corrected for known driver issues, unless they are set by the user
+	pfUINT isDouble = (configuration->doublePrecision || configuration->doublePrecisionFloatMemory || configuration->quadDoubleDoublePrecision || configuration->quadDoubleDoublePrecisionDoubleMemory);
+	pfUINT isQuad = (configuration->quadDoubleDoublePrecision || configuration->quadDoubleDoublePrecisionDoubleMemory);
+#if(VKFFT_BACKEND!=1)
+	pfUINT useSmallerSwap = (configuration->doublePrecision || configuration->quadDoubleDoublePrecision || configuration->quadDoubleDoublePrecisionDoubleMemory);
+#endif
+	profile->useLUT = (isDouble) ? 1 : -1;
+	profile->registerBoostNonPow2 = 0;
+	profile->registerBoost = 1;
+	profile->registerBoost4Step = 1;
+#if((VKFFT_BACKEND==0)||(VKFFT_BACKEND==3))
+	switch (profile->vendorID) {
+	case 0x10DE://NVIDIA
+		profile->coalescedMemory = (configuration->halfPrecision) ? 64 : 32;//the coalesced memory is equal to 32 bytes between L2 and VRAM.
+		if (!profile->warpSize) profile->warpSize = 32;
+		profile->registerBoost = 4;
+		profile->swapTo3Stage4Step = 4194305;
+#if(VKFFT_BACKEND==3)
+		if (!userProfile->sharedMemorySize) profile->sharedMemorySize -= 0x10;//reserved by system
+#endif
+		break;
+	case 0x8086://INTEL
+		profile->coalescedMemory = (configuration->halfPrecision) ? 128 : 64;
+		profile->useLUT = 1;
+		if (!profile->warpSize) profile->warpSize = 32;
+		profile->registerBoost = (profile->sharedMemorySize >= 65536) ? 1 : 2;
+		profile->swapTo3Stage4Step = (useSmallerSwap) ? 262144 : 524288;
+#if(VKFFT_BACKEND==0)
+		if (!userProfile->maxThreadsNum) profile->maxThreadsNum = 256; //Intel fix
+#endif
+		break;
+	case 0x1002://AMD
+		profile->coalescedMemory = (configuration->halfPrecision) ? 64 : 32;
+		if (!profile->warpSize) profile->warpSize = 64;
+		profile->registerBoost = (profile->sharedMemorySize >= 65536) ? 2 : 4;
+		profile->swapTo3Stage4Step = (useSmallerSwap) ? 262144 : 524288;
+		break;
+	default:
+		profile->coalescedMemory = (configuration->halfPrecision) ? 128 : 64;
+		if (!profile->warpSize) profile->warpSize = 32;
+		profile->swapTo3Stage4Step = (useSmallerSwap) ? 262144 : 524288;
+		break;
+	}
+#elif(VKFFT_BACKEND==1)
+	profile->coalescedMemory = (configuration->halfPrecision) ? 64 : 32;//the coalesced memory is equal to 32 bytes between L2 and VRAM.
+	profile->swapTo3Stage4Step = 4194305;
+#elif(VKFFT_BACKEND==2)
+	profile->coalescedMemory = (configuration->halfPrecision) ? 64 : 32;
+	profile->useLUT_4step = -1;
+	profile->swapTo3Stage4Step = (useSmallerSwap) ? 1048576 : 2097152;
+#elif(VKFFT_BACKEND==4)
+	profile->coalescedMemory = (configuration->halfPrecision) ? 128 : 64;
+	profile->useLUT = 1;
+	profile->registerBoost = (profile->sharedMemorySize >= 65536) ? 1 : 2;
+	profile->swapTo3Stage4Step = (useSmallerSwap) ? 262144 : 524288;
+#elif(VKFFT_BACKEND==5)
+	profile->coalescedMemory = (configuration->halfPrecision) ? 128 : 64;//the coalesced memory is equal to 64 bytes between L2 and VRAM.
+	profile->swapTo3Stage4Step = (useSmallerSwap) ? 262144 : 524288;
+#elif(VKFFT_BACKEND==6)
+	profile->coalescedMemory = (configuration->halfPrecision) ? 128 : 64;//cache line size
+	profile->useLUT = 1;
+	profile->swapTo3Stage4Step = (useSmallerSwap) ? 262144 : 524288;
+#endif
+	if (isQuad) {
+		profile->fixMinRaderPrimeMult = 11;
+		profile->fixMaxRaderPrimeMult = 29;
+	}
+	else {
+		profile->fixMinRaderPrimeMult = 17;
+		switch (profile->vendorID) {
+		case 0x10DE://NVIDIA
+			profile->fixMaxRaderPrimeMult = 89;
+			break;
+		case 0x1002://AMD profile
+			profile->fixMaxRaderPrimeMult = 89;
+			break;
+		default:
+			profile->fixMaxRaderPrimeMult = 17;
+			break;
+		}
+	}
+	switch (profile->vendorID) {
+	case 0x1002://AMD profile
+		if (isQuad)
+			profile->fixMinRaderPrimeFFT = 19;
+		else if (configuration->doublePrecision || configuration->doublePrecisionFloatMemory)
+			profile->fixMinRaderPrimeFFT = 29;
+		else
+			profile->fixMinRaderPrimeFFT = 17;
+		break;
+	default:
+		profile->fixMinRaderPrimeFFT = 17;
+		break;
+	}
+	profile->fixMaxRaderPrimeFFT = 16384;
+	profile->aimThreads = 128;
+	profile->numSharedBanks = 32;
+}
+
+static inline VkFFTResult VkFFT_ReadDeviceProfileFile(VkFFTConfiguration* configuration, const char* fileName, VkFFTDeviceProfile* profile) {
+	//lines without a precision suffix are applied first, then lines of the fallback precision, then lines of the precision of the application
+	FILE* profileFile = fopen(fileName, "r");
+	if (!profileFile) return VKFFT_ERROR_EMPTY_FILE;
+	const char* precisions[3] = { 0, 0, 0 };
+	VkFFT_GetPrecisionClass(configuration, &precisions[2], &precisions[1]);
+	char line[1024];
+	for (int pass = 0; pass < 3; pass++) {
+		if ((pass > 0) && (!precisions[pass])) continue;
+		pfUINT paddingFound = 0;
+		rewind(profileFile);
+		while (fgets(line, sizeof(line), profileFile)) {
+			char key[128];
+			int keyLength = 0;
+			if (sscanf(line, " %127s%n", key, &keyLength) != 1) continue;
+			if (key[0] == '#') continue;
+			char* suffix = strchr(key, '.');
+			if (suffix) {
+				suffix[0] = 0;
+				suffix++;
+				if (strcmp(suffix, "half") && strcmp(suffix, "single") && strcmp(suffix, "double") && strcmp(suffix, "doubledouble")) {
+					fclose(profileFile);
+					return VKFFT_ERROR_INVALID_deviceProfile;
+				}
+			}
+			if (pass == 0) {
+				if (suffix) continue;
+			}
+			else if ((!suffix) || strcmp(suffix, precisions[pass])) continue;
+			pfUINT numValues = 1;
+			pfINT* field = 0;
+			pfINT paddingValues[2];
+			if (!strcmp(key, "bluesteinPadding")) {
+				//the last precision that has padding lines replaces the whole pattern
+				if (!paddingFound) profile->numBluesteinPaddingSizes = 0;
+				paddingFound = 1;
+				if (profile->numBluesteinPaddingSizes == VKFFT_MAX_DEVICE_PROFILE_PADDING_SIZES) {
+					fclose(profileFile);
+					return VKFFT_ERROR_INVALID_deviceProfile;
+				}
+				field = paddingValues;
+				numValues = 2;
+			}
+			else {
+				pfUINT id = 0;
+				for (id = 0; id < VKFFT_DEVICE_PROFILE_NUM_FIELDS; id++) {
+					const char* name;
+					field = VkFFT_GetDeviceProfileField(profile, id, &name, &numValues);
+					if (!strcmp(name, key)) break;
+				}
+				//device limits do not depend on precision
+				if ((id == VKFFT_DEVICE_PROFILE_NUM_FIELDS) || ((id < VKFFT_DEVICE_PROFILE_NUM_LIMITS) && (suffix))) {
+					fclose(profileFile);
+					return VKFFT_ERROR_INVALID_deviceProfile;
+				}
+			}
+			char* values = line + keyLength;
+			for (pfUINT i = 0; i < numValues; i++) {
+				char* end = values;
+				while ((values[0] == ' ') || (values[0] == '\t')) values++;
+				if (values[0] == '-')
+					field[i] = (pfINT)strtoll(values, &end, 0);
+				else
+					field[i] = (pfINT)strtoull(values, &end, 0);
+				if (end == values) {
+					fclose(profileFile);
+					return VKFFT_ERROR_INVALID_deviceProfile;
+				}
+				values = end;
+			}
+			if (field == paddingValues) {
+				profile->bluesteinPrimeSizes[profile->numBluesteinPaddingSizes] = (pfUINT)paddingValues[0];
+				profile->bluesteinPaddedSizes[profile->numBluesteinPaddingSizes] = (pfUINT)paddingValues[1];
+				profile->numBluesteinPaddingSizes++;
+			}
+		}
+	}
+	fclose(profileFile);
+	return VKFFT_SUCCESS;
+}
+
+static inline VkFFTResult VkFFT_InitializeDeviceProfile(VkFFTApplication* app, VkFFTConfiguration* inputLaunchConfiguration) {
+	//called after the device has been queried. Builds app->deviceProfile and sets the device-dependent parameters of the configuration from it
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTDeviceProfile* profile = &app->deviceProfile;
+	VkFFTDeviceProfile userProfile;
+	memset(profile, 0, sizeof(VkFFTDeviceProfile));
+	memset(&userProfile, 0, sizeof(VkFFTDeviceProfile));
+	profile->vendorID = app->configuration.vendorID;
+	profile->maxThreadsNum = app->configuration.maxThreadsNum;
+	for (pfUINT i = 0; i < 3; i++) {
+		profile->maxComputeWorkGroupCount[i] = app->configuration.maxComputeWorkGroupCount[i];
+		profile->maxComputeWorkGroupSize[i] = app->configuration.maxComputeWorkGroupSize[i];
+	}
+	profile->sharedMemorySizeStatic = app->configuration.sharedMemorySizeStatic;
+	profile->sharedMemorySize = app->configuration.sharedMemorySize;
+	profile->warpSize = app->configuration.warpSize;
+	profile->computeCapabilityMajor = app->configuration.computeCapabilityMajor;
+	profile->computeCapabilityMinor = app->configuration.computeCapabilityMinor;
+	profile->useLUT_4step = app->configuration.useLUT_4step;
+
+	if (inputLaunchConfiguration->deviceProfileFile) {
+		resFFT = VkFFT_ReadDeviceProfileFile(&app->configuration, inputLaunchConfiguration->deviceProfileFile, &userProfile);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	if (inputLaunchConfiguration->deviceProfile) {
+		VkFFT_MergeDeviceProfile(&userProfile, inputLaunchConfiguration->deviceProfile, 0, VKFFT_DEVICE_PROFILE_NUM_FIELDS);
+		if (inputLaunchConfiguration->deviceProfile->numBluesteinPaddingSizes) {
+			if (inputLaunchConfiguration->deviceProfile->numBluesteinPaddingSizes > VKFFT_MAX_DEVICE_PROFILE_PADDING_SIZES) return VKFFT_ERROR_INVALID_deviceProfile;
+			userProfile.numBluesteinPaddingSizes = inputLaunchConfiguration->deviceProfile->numBluesteinPaddingSizes;
+			memcpy(userProfile.bluesteinPrimeSizes, inputLaunchConfiguration->deviceProfile->bluesteinPrimeSizes, userProfile.numBluesteinPaddingSizes * sizeof(pfUINT));
+			memcpy(userProfile.bluesteinPaddedSizes, inputLaunchConfiguration->deviceProfile->bluesteinPaddedSizes, userProfile.numBluesteinPaddingSizes * sizeof(pfUINT));
+		}
+	}
+	//tuning parameters of the built-in profile depend on the vendor and limits set by the user
+	VkFFT_MergeDeviceProfile(profile, &userProfile, 0, VKFFT_DEVICE_PROFILE_NUM_LIMITS);
+	VkFFT_SetBuiltInDeviceProfile(&app->configuration, profile, &userProfile);
+	VkFFT_MergeDeviceProfile(profile, &userProfile, VKFFT_DEVICE_PROFILE_NUM_LIMITS, VKFFT_DEVICE_PROFILE_NUM_FIELDS);
+	profile->numBluesteinPaddingSizes = userProfile.numBluesteinPaddingSizes;
+	memcpy(profile->bluesteinPrimeSizes, userProfile.bluesteinPrimeSizes, userProfile.numBluesteinPaddingSizes * sizeof(pfUINT));
+	memcpy(profile->bluesteinPaddedSizes, userProfile.bluesteinPaddedSizes, userProfile.numBluesteinPaddingSizes * sizeof(pfUINT));
+
+	app->configuration.vendorID = profile->vendorID;
+	app->configuration.maxThreadsNum = profile->maxThreadsNum;
+	for (pfUINT i = 0; i < 3; i++) {
+		app->configuration.maxComputeWorkGroupCount[i] = profile->maxComputeWorkGroupCount[i];
+		app->configuration.maxComputeWorkGroupSize[i] = profile->maxComputeWorkGroupSize[i];
+	}
+	app->configuration.sharedMemorySizeStatic = profile->sharedMemorySizeStatic;
+	app->configuration.sharedMemorySize = profile->sharedMemorySize;
+	app->configuration.warpSize = profile->warpSize;
+	app->configuration.computeCapabilityMajor = profile->computeCapabilityMajor;
+	app->configuration.computeCapabilityMinor = profile->computeCapabilityMinor;
+	app->configuration.coalescedMemory = profile->coalescedMemory;
+	app->configuration.useLUT = profile->useLUT;
+	app->configuration.useLUT_4step = profile->useLUT_4step;
+	app->configuration.registerBoost = profile->registerBoost;
+	app->configuration.registerBoostNonPow2 = profile->registerBoostNonPow2;
+	app->configuration.registerBoost4Step = profile->registerBoost4Step;
+	app->configuration.swapTo3Stage4Step = profile->swapTo3Stage4Step;
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFTSaveDeviceProfile(VkFFTApplication* app, const char* fileName) {
+	//appends the profile of an initialized application to fileName. Tuning parameters and the Bluestein padding pattern are written for the precision
+	//of the application, so profiles of applications with different precisions can be collected in one file
+	const char* precision;
+	const char* fallbackPrecision;
+	VkFFT_GetPrecisionClass(&app->configuration, &precision, &fallbackPrecision);
+	FILE* profileFile = fopen(fileName, "r");
+	pfUINT newFile = (profileFile == 0);
+	if (profileFile) fclose(profileFile);
+	profileFile = fopen(fileName, "a");
+	if (!profileFile) return VKFFT_ERROR_FAILED_TO_WRITE_deviceProfileFile;
+	pfUINT success = 1;
+	if (newFile) success = (fprintf(profileFile, "# VkFFT device profile: name[.precision] values\n") >= 0);
+	for (pfUINT id = 0; id < VKFFT_DEVICE_PROFILE_NUM_FIELDS; id++) {
+		const char* name;
+		pfUINT size;
+		pfINT* field = VkFFT_GetDeviceProfileField(&app->deviceProfile, id, &name, &size);
+		char line[256];
+		int length = (id < VKFFT_DEVICE_PROFILE_NUM_LIMITS) ? sprintf(line, "%s", name) : sprintf(line, "%s.%s", name, precision);
+		for (pfUINT i = 0; i < size; i++) {
+			if (id == 0)
+				length += sprintf(line + length, " 0x%" PRIX64 "", (pfUINT)field[i]);
+			else if ((id == 10) || (id == 11))
+				length += sprintf(line + length, " %" PRIi64 "", field[i]);
+			else
+				length += sprintf(line + length, " %" PRIu64 "", (pfUINT)field[i]);
+		}
+		sprintf(line + length, "\n");
+		if (fputs(line, profileFile) < 0) success = 0;
+	}
+	for (pfUINT i = 0; i < app->configuration.autoCustomBluesteinPaddingPattern; i++) {
+		if (fprintf(profileFile, "bluesteinPadding.%s %" PRIu64 " %" PRIu64 "\n", precision, app->configuration.primeSizes[i], app->configuration.paddedSizes[i]) < 0) success = 0;
+	}
+	fclose(profileFile);
+	return (success) ? VKFFT_SUCCESS : VKFFT_ERROR_FAILED_TO_WRITE_deviceProfileFile;
+}
+#endif
@@ -0,0 +1,187 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_HASH_H
+#define VKFFT_HASH_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CPURuntime.h"
+
+static inline pfUINT VkFFT_HashBytes(pfUINT hash, const void* data, pfUINT size) {
+	//FNV-1a
+	const unsigned char* bytes = (const unsigned char*)data;
+	for (pfUINT i = 0; i < size; i++) {
+		hash ^= (pfUINT)bytes[i];
+		hash *= 0x100000001B3;
+	}
+	return hash;
+}
+static inline pfUINT VkFFT_HashUint(pfUINT hash, pfUINT value) {
+	return VkFFT_HashBytes(hash, &value, sizeof(pfUINT));
+}
+static inline pfUINT VkFFT_HashString(pfUINT hash, const char* str) {
+	if (!str) return hash;
+	return VkFFT_HashBytes(hash, str, (pfUINT)strlen(str));
+}
+static inline pfUINT VkFFT_HashSizes(pfUINT hash, pfUINT* sizes, pfUINT num) {
+	//buffer sizes set the block sizes of multiple buffer support and the array lengths of buffer declarations
+	hash = VkFFT_HashUint(hash, (sizes) ? num : 0);
+	if (!sizes) return hash;
+	return VkFFT_HashBytes(hash, sizes, num * sizeof(pfUINT));
+}
+
+static inline VkFFTResult VkFFT_GetDeviceHash(VkFFTApplication* app, pfUINT* hash) {
+	pfUINT localHash = 0xCBF29CE484222325;
+#ifdef VKFFT_VERSION
+	localHash = VkFFT_HashUint(localHash, VKFFT_VERSION);
+#endif
+	localHash = VkFFT_HashUint(localHash, VKFFT_BACKEND);
+	localHash = VkFFT_HashUint(localHash, app->configuration.halfPrecision);
+	localHash = VkFFT_HashUint(localHash, app->configuration.quadDoubleDoublePrecision);
+	localHash = VkFFT_HashUint(localHash, app->configuration.quadDoubleDoublePrecisionDoubleMemory);
+	localHash = VkFFT_HashUint(localHash, app->configuration.useUint64);
+#if(VKFFT_BACKEND==0)
+	VkPhysicalDeviceProperties physicalDeviceProperties = { 0 };
+	vkGetPhysicalDeviceProperties(app->configuration.physicalDevice[0], &physicalDeviceProperties);
+	localHash = VkFFT_HashUint(localHash, physicalDeviceProperties.vendorID);
+	localHash = VkFFT_HashUint(localHash, physicalDeviceProperties.deviceID);
+	localHash = VkFFT_HashUint(localHash, physicalDeviceProperties.driverVersion);
+	localHash = VkFFT_HashBytes(localHash, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+	for (int i = 0; i < 3; i++) {
+		localHash = VkFFT_HashUint(localHash, app->configuration.maxComputeWorkGroupCount[i]);
+		localHash = VkFFT_HashUint(localHash, app->configuration.maxComputeWorkGroupSize[i]);
+	}
+#ifdef GLSLANG_VERSION_MAJOR
+	localHash = VkFFT_HashUint(localHash, GLSLANG_VERSION_MAJOR);
+	localHash = VkFFT_HashUint(localHash, GLSLANG_VERSION_MINOR);
+	localHash = VkFFT_HashUint(localHash, GLSLANG_VERSION_PATCH);
+#endif
+#elif(VKFFT_BACKEND==1)
+	int major = 0;
+	int minor = 0;
+	nvrtcResult result = nvrtcVersion(&major, &minor);
+	if (result != NVRTC_SUCCESS) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+	localHash = VkFFT_HashUint(localHash, (pfUINT)major);
+	localHash = VkFFT_HashUint(localHash, (pfUINT)minor);
+	int driverVersion = 0;
+	CUresult res = cuDriverGetVersion(&driverVersion);
+	if (res != CUDA_SUCCESS) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+	localHash = VkFFT_HashUint(localHash, (pfUINT)driverVersion);
+	localHash = VkFFT_HashUint(localHash, CUDA_VERSION);
+	localHash = VkFFT_HashUint(localHash, app->configuration.computeCapabilityMajor);
+	localHash = VkFFT_HashUint(localHash, app->configuration.computeCapabilityMinor);
+#elif(VKFFT_BACKEND==2)
+	hipDeviceProp_t deviceProperties;
+	hipError_t res = hipGetDeviceProperties(&deviceProperties, app->configuration.device[0]);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+	localHash = VkFFT_HashString(localHash, deviceProperties.gcnArchName);
+	int runtimeVersion = 0;
+	res = hipRuntimeGetVersion(&runtimeVersion);
+	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+	localHash = VkFFT_HashUint(localHash, (pfUINT)runtimeVersion);
+	localHash = VkFFT_HashUint(localHash, app->configuration.computeCapabilityMajor);
+	localHash = VkFFT_HashUint(localHash, app->configuration.computeCapabilityMinor);
+#elif(VKFFT_BACKEND==3)
+	cl_device_info deviceInfo[4] = { CL_DEVICE_NAME, CL_DEVICE_VENDOR, CL_DEVICE_VERSION, CL_DRIVER_VERSION };
+	for (int i = 0; i < 4; i++) {
+		size_t infoSize = 0;
+		cl_int res = clGetDeviceInfo(app->configuration.device[0], deviceInfo[i], 0, 0, &infoSize);
+		if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+		char* info = (char*)malloc(infoSize);
+		if (!info) return VKFFT_ERROR_MALLOC_FAILED;
+		res = clGetDeviceInfo(app->configuration.device[0], deviceInfo[i], infoSize, info, 0);
+		if (res != CL_SUCCESS) {
+			free(info);
+			return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+		}
+		localHash = VkFFT_HashBytes(localHash, info, (pfUINT)infoSize);
+		free(info);
+	}
+#elif(VKFFT_BACKEND==4)
+	ze_device_properties_t deviceProperties;
+	deviceProperties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+	deviceProperties.pNext = 0;
+	ze_result_t res = zeDeviceGetProperties(app->configuration.device[0], &deviceProperties);
+	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_GET_ATTRIBUTE;
+	localHash = VkFFT_HashUint(localHash, deviceProperties.vendorId);
+	localHash = VkFFT_HashUint(localHash, deviceProperties.deviceId);
+	localHash = VkFFT_HashBytes(localHash, deviceProperties.uuid.id, ZE_MAX_DEVICE_UUID_SIZE);
+#elif(VKFFT_BACKEND==6)
+	//libraries are built for the host with the configured compiler, so its command defines the target
+	localHash = VkFFT_HashString(localHash, (app->configuration.cpuCompilerCommand) ? app->configuration.cpuCompilerCommand : VKFFT_CPU_COMPILER_COMMAND);
+#endif
+	hash[0] = localHash;
+	return VKFFT_SUCCESS;
+}
+
+static inline pfUINT VkFFT_GetConfigurationHash(VkFFTApplication* app) {
+	//hash of all configuration parameters that affect generated kernels and their launch layout. Buffer handles, queues, makeForwardPlanOnly/makeInversePlanOnly and other parameters that don't change the kernels are excluded.
+	pfUINT hash = 0xCBF29CE484222325;
+	hash = VkFFT_HashUint(hash, app->configuration.FFTdim);
+	for (pfUINT i = 0; i < VKFFT_MAX_FFT_DIMENSIONS; i++) {
+		hash = VkFFT_HashUint(hash, app->configuration.size[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.omitDimension[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.groupedBatch[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.bufferStride[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.inputBufferStride[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.outputBufferStride[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.performZeropadding[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.fft_zeropad_left[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.fft_zeropad_right[i]);
+	}
+	for (int i = 0; i < 3; i++) {
+		hash = VkFFT_HashUint(hash, app->configuration.maxComputeWorkGroupCount[i]);
+		hash = VkFFT_HashUint(hash, app->configuration.maxComputeWorkGroupSize[i]);
+	}
+	hash = VkFFT_HashSizes(hash, app->configuration.bufferSize, app->configuration.bufferNum);
+	hash = VkFFT_HashSizes(hash, app->configuration.inputBufferSize, app->configuration.inputBufferNum);
+	hash = VkFFT_HashSizes(hash, app->configuration.outputBufferSize, app->configuration.outputBufferNum);
+	hash = VkFFT_HashSizes(hash, app->configuration.kernelSize, app->configuration.kernelNum);
+	//temp buffer sizes set by VkFFT are computed from the hashed parameters
+	hash = VkFFT_HashUint(hash, app->configuration.userTempBuffer);
+	if (app->configuration.userTempBuffer) hash = VkFFT_HashSizes(hash, app->configuration.tempBufferSize, app->configuration.tempBufferNum);
+	pfUINT parameters[] = {
+		app->configuration.numberBatches, app->configuration.coordinateFeatures, app->configuration.numberKernels, app->configuration.matrixConvolution, app->configuration.symmetricKernel,
+		app->configuration.performConvolution, app->configuration.conjugateConvolution, app->configuration.crossPowerSpectrumNormalization, app->configuration.kernelConvolution, app->configuration.frequencyZeroPadding,
+		app->configuration.doublePrecision, app->configuration.quadDoubleDoublePrecision, app->configuration.quadDoubleDoublePrecisionDoubleMemory, app->configuration.halfPrecision, app->configuration.halfPrecisionMemoryOnly, app->configuration.doublePrecisionFloatMemory,
+		app->configuration.performR2C, app->configuration.performDCT, app->configuration.performDST, app->configuration.disableMergeSequencesR2C, app->configuration.forceCallbackVersionRealTransforms,
+		app->configuration.normalize, app->configuration.disableReorderFourStep, app->configuration.reorderFourStep, (pfUINT)app->configuration.useLUT, (pfUINT)app->configuration.useLUT_4step,
+		app->configuration.isInputFormatted, app->configuration.isOutputFormatted, app->configuration.inverseReturnToInputBuffer, app->configuration.considerAllAxesStrided,
+		app->configuration.swapTo2Stage4Step, app->configuration.swapTo3Stage4Step, app->configuration.coalescedMemory, app->configuration.aimThreads, app->configuration.numSharedBanks, (pfUINT)app->configuration.performBandwidthBoost,
+		app->configuration.registerBoost, app->configuration.registerBoostNonPow2, app->configuration.registerBoost4Step, app->configuration.useUint64, app->configuration.useRaderUintLUT,
+		app->configuration.fixMaxRadixBluestein, app->configuration.forceBluesteinSequenceSize, app->configuration.useCustomBluesteinPaddingPattern, app->configuration.autoCustomBluesteinPaddingPattern,
+		app->configuration.fixMinRaderPrimeMult, app->configuration.fixMaxRaderPrimeMult, app->configuration.fixMinRaderPrimeFFT, app->configuration.fixMaxRaderPrimeFFT,
+		app->configuration.bufferNum, app->configuration.tempBufferNum, app->configuration.inputBufferNum, app->configuration.outputBufferNum, app->configuration.kernelNum,
+		app->configuration.bufferOffset, app->configuration.tempBufferOffset, app->configuration.inputBufferOffset, app->configuration.outputBufferOffset, app->configuration.kernelOffset, app->configuration.specifyOffsetsAtLaunch, app->configuration.specifyBatchesAtLaunch,
+		app->configuration.maxThreadsNum, app->configuration.sharedMemorySizeStatic, app->configuration.sharedMemorySize, app->configuration.warpSize, app->configuration.halfThreads, app->configuration.vendorID,
+#if(VKFFT_BACKEND==2)
+		(pfUINT)app->configuration.useStrict32BitAddress,
+#endif
+	};
+	hash = VkFFT_HashBytes(hash, parameters, sizeof(parameters));
+	pfUINT numBluesteinPaddingSizes = (app->configuration.useCustomBluesteinPaddingPattern) ? app->configuration.useCustomBluesteinPaddingPattern : app->configuration.autoCustomBluesteinPaddingPattern;
+	if (numBluesteinPaddingSizes) {
+		//automatic patterns can be loaded from bluesteinPaddingFile, so their contents are hashed as well
+		hash = VkFFT_HashBytes(hash, app->configuration.primeSizes, numBluesteinPaddingSizes * sizeof(pfUINT));
+		hash = VkFFT_HashBytes(hash, app->configuration.paddedSizes, numBluesteinPaddingSizes * sizeof(pfUINT));
+	}
+	return hash;
+}
+#endif
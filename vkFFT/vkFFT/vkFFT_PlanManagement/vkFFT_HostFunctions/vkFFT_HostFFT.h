@@ -0,0 +1,269 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_HOSTFFT_H
+#define VKFFT_HOSTFFT_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+
+// Host execution path for tiny transforms. When the whole system is a few hundred points, kernel launches and synchronization cost far more
+// than the math, so VkFFTAppend can transform a host-visible copy of the buffer on the calling thread instead. Sequences are done one at a time
+// with a self-sorting Stockham FFT over the prime factors of the length, in double precision, with twiddles computed during initializeVkFFT.
+
+#define VKFFT_HOST_FFT_MAX_FACTORS 64
+
+typedef struct {
+	pfUINT size;
+	pfUINT numFactors;
+	pfUINT factors[VKFFT_HOST_FFT_MAX_FACTORS];
+	double* twiddles;//exp(-2*pi*i*k/size) for k < size, interleaved real and imaginary parts
+} VkFFTHostFFTAxis;
+struct VkFFTHostFFT {
+	VkFFTHostFFTAxis axes[VKFFT_MAX_FFT_DIMENSIONS];
+	double* work;//two sequences of the longest axis, ping-ponged between Stockham stages
+};
+typedef struct VkFFTHostFFT VkFFTHostFFT;
+
+static inline pfUINT VkFFT_CheckHostFFTSupport(VkFFTApplication* app) {
+	if ((app->configuration.performConvolution) || (app->configuration.performDCT) || (app->configuration.performDST)) return 0;
+	if ((app->configuration.isInputFormatted) || (app->configuration.isOutputFormatted) || (app->configuration.bufferNum > 1)) return 0;
+	if ((app->configuration.halfPrecision) || (app->configuration.halfPrecisionMemoryOnly) || (app->configuration.doublePrecisionFloatMemory)) return 0;
+	if ((app->configuration.quadDoubleDoublePrecision) || (app->configuration.quadDoubleDoublePrecisionDoubleMemory)) return 0;
+	if ((app->configuration.frequencyZeroPadding) || (app->configuration.specifyBatchesAtLaunch)) return 0;
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if ((app->configuration.omitDimension[i]) || (app->configuration.performZeropadding[i])) return 0;
+	}
+	return 1;
+}
+static inline pfUINT VkFFT_GetHostFFTNumBatches(VkFFTApplication* app) {
+	//single-dimensional batched systems are moved to actualNumBatches by the planner
+	return (app->actualNumBatches > app->configuration.numberBatches) ? app->actualNumBatches : app->configuration.numberBatches;
+}
+static inline pfUINT VkFFT_GetHostFFTPoints(VkFFTApplication* app) {
+	pfUINT numPoints = app->configuration.coordinateFeatures * VkFFT_GetHostFFTNumBatches(app);
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++)
+		numPoints *= app->configuration.size[i];
+	return numPoints;
+}
+static inline pfUINT VkFFT_GetHostFFTBufferSize(VkFFTApplication* app) {
+	pfUINT complexSize = (app->configuration.doublePrecision) ? 2 * sizeof(double) : 2 * sizeof(float);
+	return app->configuration.bufferStride[app->configuration.FFTdim - 1] * app->configuration.coordinateFeatures * VkFFT_GetHostFFTNumBatches(app) * complexSize;
+}
+
+static inline void VkFFT_DeleteHostFFT(VkFFTApplication* app) {
+	if (app->hostFFT == 0) return;
+	for (pfUINT i = 0; i < VKFFT_MAX_FFT_DIMENSIONS; i++) {
+		if (app->hostFFT->axes[i].twiddles) free(app->hostFFT->axes[i].twiddles);
+	}
+	if (app->hostFFT->work) free(app->hostFFT->work);
+	free(app->hostFFT);
+	app->hostFFT = 0;
+}
+static inline VkFFTResult VkFFT_InitHostFFT(VkFFTApplication* app) {
+	app->hostFFT = (VkFFTHostFFT*)calloc(1, sizeof(VkFFTHostFFT));
+	if (!app->hostFFT) return VKFFT_ERROR_MALLOC_FAILED;
+	pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
+	pfUINT maxSize = 0;
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		VkFFTHostFFTAxis* axis = &app->hostFFT->axes[i];
+		axis->size = app->configuration.size[i];
+		pfUINT remainder = axis->size;
+		for (pfUINT p = 2; remainder > 1; p++) {
+			if (p * p > remainder) p = remainder;
+			while ((remainder % p) == 0) {
+				axis->factors[axis->numFactors] = p;
+				axis->numFactors++;
+				remainder /= p;
+			}
+		}
+		axis->twiddles = (double*)malloc(2 * axis->size * sizeof(double));
+		if (!axis->twiddles) {
+			VkFFT_DeleteHostFFT(app);
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		for (pfUINT k = 0; k < axis->size; k++) {
+			axis->twiddles[2 * k] = (double)pfcos(2 * k * double_PI / axis->size);
+			axis->twiddles[2 * k + 1] = (double)-pfsin(2 * k * double_PI / axis->size);
+		}
+		if (axis->size > maxSize) maxSize = axis->size;
+	}
+	app->hostFFT->work = (double*)malloc(4 * maxSize * sizeof(double));
+	if (!app->hostFFT->work) {
+		VkFFT_DeleteHostFFT(app);
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	return VKFFT_SUCCESS;
+}
+
+static inline double* VkFFT_HostFFTSequence(VkFFTHostFFTAxis* axis, double* x, double* y, int inverse) {
+	//Stockham decimation in frequency: stage with radix r splits the remaining length n = r*m into r sequences of length m, s of which are already interleaved
+	pfUINT N = axis->size;
+	pfUINT n = N;
+	pfUINT s = 1;
+	double sign = (inverse == 1) ? -1.0 : 1.0;
+	double* tw = axis->twiddles;
+	for (pfUINT f = 0; f < axis->numFactors; f++) {
+		pfUINT r = axis->factors[f];
+		pfUINT m = n / r;
+		for (pfUINT p = 0; p < m; p++) {
+			for (pfUINT k = 0; k < r; k++) {
+				//p * k * s < N, so stage twiddles are read without wrapping
+				double w_re = tw[2 * (p * k * s)];
+				double w_im = sign * tw[2 * (p * k * s) + 1];
+				for (pfUINT q = 0; q < s; q++) {
+					double acc_re = 0;
+					double acc_im = 0;
+					if (r == 2) {
+						pfUINT id0 = 2 * (q + s * p);
+						pfUINT id1 = 2 * (q + s * (p + m));
+						acc_re = (k == 0) ? x[id0] + x[id1] : x[id0] - x[id1];
+						acc_im = (k == 0) ? x[id0 + 1] + x[id1 + 1] : x[id0 + 1] - x[id1 + 1];
+					}
+					else {
+						for (pfUINT j = 0; j < r; j++) {
+							pfUINT id = 2 * (q + s * (p + j * m));
+							pfUINT twid = 2 * (((j * k) % r) * (N / r));
+							double r_re = tw[twid];
+							double r_im = sign * tw[twid + 1];
+							acc_re += x[id] * r_re - x[id + 1] * r_im;
+							acc_im += x[id] * r_im + x[id + 1] * r_re;
+						}
+					}
+					pfUINT od = 2 * (q + s * (r * p + k));
+					y[od] = acc_re * w_re - acc_im * w_im;
+					y[od + 1] = acc_re * w_im + acc_im * w_re;
+				}
+			}
+		}
+		double* swap = x;
+		x = y;
+		y = swap;
+		n = m;
+		s *= r;
+	}
+	return x;
+}
+
+static inline double VkFFT_HostFFTLoad(void* buffer, pfUINT doublePrecision, pfUINT id) {
+	return (doublePrecision) ? ((double*)buffer)[id] : (double)((float*)buffer)[id];
+}
+static inline void VkFFT_HostFFTStore(void* buffer, pfUINT doublePrecision, pfUINT id, double value) {
+	if (doublePrecision)
+		((double*)buffer)[id] = value;
+	else
+		((float*)buffer)[id] = (float)value;
+}
+static inline void VkFFT_HostFFTAxis(VkFFTApplication* app, pfUINT axis_id, int inverse, void* buffer, double scale) {
+	//buffer dimensions are FFT axes, coordinate features and batches. Strides are in complex elements, the real view of in-place R2C has doubled strides
+	pfUINT numDims = app->configuration.FFTdim + 2;
+	pfUINT extent[VKFFT_MAX_FFT_DIMENSIONS + 2];
+	pfUINT stride[VKFFT_MAX_FFT_DIMENSIONS + 2];
+	pfUINT index[VKFFT_MAX_FFT_DIMENSIONS + 2];
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		extent[i] = app->configuration.size[i];
+		stride[i] = (i == 0) ? 1 : app->configuration.bufferStride[i - 1];
+	}
+	if (app->configuration.performR2C) extent[0] = app->configuration.size[0] / 2 + 1;
+	extent[numDims - 2] = app->configuration.coordinateFeatures;
+	stride[numDims - 2] = app->configuration.bufferStride[app->configuration.FFTdim - 1];
+	extent[numDims - 1] = VkFFT_GetHostFFTNumBatches(app);
+	stride[numDims - 1] = stride[numDims - 2] * app->configuration.coordinateFeatures;
+
+	VkFFTHostFFTAxis* axis = &app->hostFFT->axes[axis_id];
+	pfUINT N = axis->size;
+	pfUINT isR2C = ((axis_id == 0) && (app->configuration.performR2C));
+	pfUINT doublePrecision = app->configuration.doublePrecision;
+	double* x = app->hostFFT->work;
+	double* y = app->hostFFT->work + 2 * N;
+	pfUINT numLines = 1;
+	for (pfUINT i = 0; i < numDims; i++) {
+		index[i] = 0;
+		if (i != axis_id) numLines *= extent[i];
+	}
+	for (pfUINT line = 0; line < numLines; line++) {
+		pfUINT base = 0;
+		for (pfUINT i = 0; i < numDims; i++)
+			base += index[i] * stride[i];
+		pfUINT lineStride = stride[axis_id];
+		if (isR2C && (inverse != 1)) {
+			for (pfUINT j = 0; j < N; j++) {
+				x[2 * j] = VkFFT_HostFFTLoad(buffer, doublePrecision, 2 * base + j);
+				x[2 * j + 1] = 0;
+			}
+		}
+		else if (isR2C) {
+			//Hermitian extension of the N/2+1 stored values
+			for (pfUINT j = 0; j < N / 2 + 1; j++) {
+				x[2 * j] = VkFFT_HostFFTLoad(buffer, doublePrecision, 2 * (base + j));
+				x[2 * j + 1] = VkFFT_HostFFTLoad(buffer, doublePrecision, 2 * (base + j) + 1);
+			}
+			for (pfUINT j = N / 2 + 1; j < N; j++) {
+				x[2 * j] = x[2 * (N - j)];
+				x[2 * j + 1] = -x[2 * (N - j) + 1];
+			}
+		}
+		else {
+			for (pfUINT j = 0; j < N; j++) {
+				x[2 * j] = VkFFT_HostFFTLoad(buffer, doublePrecision, 2 * (base + j * lineStride));
+				x[2 * j + 1] = VkFFT_HostFFTLoad(buffer, doublePrecision, 2 * (base + j * lineStride) + 1);
+			}
+		}
+		double* result = VkFFT_HostFFTSequence(axis, x, y, inverse);
+		if (isR2C && (inverse != 1)) {
+			for (pfUINT j = 0; j < N / 2 + 1; j++) {
+				VkFFT_HostFFTStore(buffer, doublePrecision, 2 * (base + j), result[2 * j] * scale);
+				VkFFT_HostFFTStore(buffer, doublePrecision, 2 * (base + j) + 1, result[2 * j + 1] * scale);
+			}
+		}
+		else if (isR2C) {
+			for (pfUINT j = 0; j < N; j++)
+				VkFFT_HostFFTStore(buffer, doublePrecision, 2 * base + j, result[2 * j] * scale);
+		}
+		else {
+			for (pfUINT j = 0; j < N; j++) {
+				VkFFT_HostFFTStore(buffer, doublePrecision, 2 * (base + j * lineStride), result[2 * j] * scale);
+				VkFFT_HostFFTStore(buffer, doublePrecision, 2 * (base + j * lineStride) + 1, result[2 * j + 1] * scale);
+			}
+		}
+		for (pfUINT i = 0; i < numDims; i++) {
+			if (i == axis_id) continue;
+			index[i]++;
+			if (index[i] < extent[i]) break;
+			index[i] = 0;
+		}
+	}
+}
+static inline VkFFTResult VkFFT_ExecuteHostFFT(VkFFTApplication* app, int inverse, void* buffer) {
+	//forward R2C starts with the real axis, inverse ends with it. Normalization is applied when the last axis is stored
+	double scale = 1;
+	if ((inverse == 1) && (app->configuration.normalize)) {
+		for (pfUINT i = 0; i < app->configuration.FFTdim; i++)
+			scale /= (double)app->configuration.size[i];
+	}
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if (inverse != 1)
+			VkFFT_HostFFTAxis(app, i, inverse, buffer, (i == app->configuration.FFTdim - 1) ? scale : 1.0);
+		else
+			VkFFT_HostFFTAxis(app, app->configuration.FFTdim - 1 - i, inverse, buffer, (i == app->configuration.FFTdim - 1) ? scale : 1.0);
+	}
+	return VKFFT_SUCCESS;
+}
+
+#endif
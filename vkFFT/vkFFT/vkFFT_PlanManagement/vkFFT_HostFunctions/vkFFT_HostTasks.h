@@ -0,0 +1,110 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_HOSTTASKS_H
+#define VKFFT_HOSTTASKS_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+// Minimal parallel-for used by plan initialization (kernel compilation, LUT computation). Tasks are executed by the user-provided
+// compileTaskExecutor, if it is set, or by up to numCompileThreads threads, one of which is the calling thread.
+
+typedef struct {
+	void (*task)(void* taskData, pfUINT taskID);
+	void* taskData;
+	pfUINT numTasks;
+	volatile pfUINT nextTask;
+} VkFFTHostTaskQueue;
+
+static inline pfUINT VkFFT_GetNextHostTask(VkFFTHostTaskQueue* queue) {
+#ifdef _WIN32
+	return (pfUINT)InterlockedIncrement64((volatile LONG64*)&queue->nextTask) - 1;
+#else
+	return __atomic_fetch_add(&queue->nextTask, 1, __ATOMIC_SEQ_CST);
+#endif
+}
+
+#ifdef _WIN32
+static inline unsigned __stdcall VkFFT_HostTaskThread(void* taskQueue) {
+#else
+static inline void* VkFFT_HostTaskThread(void* taskQueue) {
+#endif
+	VkFFTHostTaskQueue* queue = (VkFFTHostTaskQueue*)taskQueue;
+	pfUINT taskID = VkFFT_GetNextHostTask(queue);
+	while (taskID < queue->numTasks) {
+		queue->task(queue->taskData, taskID);
+		taskID = VkFFT_GetNextHostTask(queue);
+	}
+	return 0;
+}
+
+static inline void VkFFT_RunHostTasks(VkFFTConfiguration* configuration, pfUINT numTasks, void (*task)(void* taskData, pfUINT taskID), void* taskData) {
+	if (numTasks == 0) return;
+	if (configuration->compileTaskExecutor) {
+		configuration->compileTaskExecutor(configuration->compileTaskExecutorData, numTasks, task, taskData);
+		return;
+	}
+	VkFFTHostTaskQueue queue = VKFFT_ZERO_INIT;
+	queue.task = task;
+	queue.taskData = taskData;
+	queue.numTasks = numTasks;
+	pfUINT numThreads = (configuration->numCompileThreads < numTasks) ? configuration->numCompileThreads : numTasks;
+	pfUINT numLaunchedThreads = 0;
+	//calling thread is one of the workers. If a thread can't be created, remaining tasks are taken by the launched ones
+#ifdef _WIN32
+	HANDLE* threads = (numThreads > 1) ? (HANDLE*)malloc(numThreads * sizeof(HANDLE)) : 0;
+#else
+	pthread_t* threads = (numThreads > 1) ? (pthread_t*)malloc(numThreads * sizeof(pthread_t)) : 0;
+#endif
+	if (threads) {
+		for (pfUINT i = 1; i < numThreads; i++) {
+#ifdef _WIN32
+			threads[numLaunchedThreads] = (HANDLE)_beginthreadex(0, 0, VkFFT_HostTaskThread, &queue, 0, 0);
+			if (threads[numLaunchedThreads] == 0) break;
+#else
+			if (pthread_create(&threads[numLaunchedThreads], 0, VkFFT_HostTaskThread, &queue) != 0) break;
+#endif
+			numLaunchedThreads++;
+		}
+	}
+	VkFFT_HostTaskThread(&queue);
+	for (pfUINT i = 0; i < numLaunchedThreads; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(threads[i], INFINITE);
+		CloseHandle(threads[i]);
+#else
+		pthread_join(threads[i], 0);
+#endif
+	}
+	free(threads);
+}
+#endif
@@ -0,0 +1,347 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_KERNELCACHE_H
+#define VKFFT_KERNELCACHE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+// On-disk kernel binary cache. Every compiled kernel is stored in kernelCacheDirectory as VkFFT_<key>.bin, where key is a hash of the generated code
+// and of everything that can change the binary produced from it (VkFFT version, backend, device, driver and compiler versions, compile options).
+// VkFFT_kernel_cache.idx keeps size and last use of every entry, so the cache can be trimmed to kernelCacheMaxSize bytes in least-recently-used order.
+// The cache is best-effort: any I/O failure or failed device query is treated as a cache miss and the kernel is compiled as usual.
+// Index updates are read-modify-write, so they hold a process-wide mutex and an exclusive lock on VkFFT_kernel_cache.lock, shared with other processes.
+
+#define VKFFT_KERNEL_CACHE_MAGIC 0x45484341434B4656 // "VFKCACHE"
+#define VKFFT_KERNEL_CACHE_INDEX_MAGIC 0x5844494341434B56 // "VKCACIDX"
+
+typedef struct {
+	pfUINT key;
+	pfUINT size;
+	pfUINT lastUse;
+} VkFFTKernelCacheEntry;
+
+static inline VkFFTResult VkFFT_GetKernelCacheKey(VkFFTApplication* app, const char* code0, pfUINT* key, pfUINT* codeHash) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (!app->deviceHash) {
+		resFFT = VkFFT_GetDeviceHash(app, &app->deviceHash);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	pfUINT codeLength = (pfUINT)strlen(code0);
+	key[0] = VkFFT_HashBytes(app->deviceHash, code0, codeLength);
+	//second hash with a different seed is stored inside of the entry and guards against key collisions
+	codeHash[0] = VkFFT_HashUint(VkFFT_HashBytes(0x84222325CBF29CE4, code0, codeLength), codeLength);
+	return resFFT;
+}
+
+static inline void VkFFT_GetKernelCacheEntryName(VkFFTApplication* app, char* name, pfUINT key) {
+	sprintf(name, "%s/VkFFT_%016" PRIx64 ".bin", app->configuration.kernelCacheDirectory, key);
+}
+
+static inline char* VkFFT_GetKernelCacheTempName(const char* name) {
+	//returns allocated name of a temporary file that is renamed to name when complete, 0 if allocation fails. Suffix is unique between threads and processes: process id, address of the counter (differs between translation units) and counter value
+#ifdef _WIN32
+	static volatile LONG64 tempCounter = 0;
+	pfUINT count = (pfUINT)InterlockedIncrement64(&tempCounter);
+	pfUINT processID = (pfUINT)GetCurrentProcessId();
+#else
+	static pfUINT tempCounter = 0;
+	pfUINT count = __atomic_add_fetch(&tempCounter, 1, __ATOMIC_SEQ_CST);
+	pfUINT processID = (pfUINT)getpid();
+#endif
+	size_t tempNameSize = strlen(name) + 64;
+	char* tempName = (char*)malloc(tempNameSize);
+	if (!tempName) return 0;
+	snprintf(tempName, tempNameSize, "%s.%" PRIu64 ".%" PRIx64 ".%" PRIu64 "", name, processID, (pfUINT)(size_t)&tempCounter, count);
+	return tempName;
+}
+
+static inline void VkFFT_LockKernelCacheMutex(int lock) {
+#ifdef _WIN32
+	static SRWLOCK kernelCacheLock = SRWLOCK_INIT;
+	if (lock) AcquireSRWLockExclusive(&kernelCacheLock);
+	else ReleaseSRWLockExclusive(&kernelCacheLock);
+#else
+	static pthread_mutex_t kernelCacheLock = PTHREAD_MUTEX_INITIALIZER;
+	if (lock) pthread_mutex_lock(&kernelCacheLock);
+	else pthread_mutex_unlock(&kernelCacheLock);
+#endif
+}
+
+static inline pfINT VkFFT_LockKernelCacheIndex(VkFFTApplication* app) {
+	//returns handle of the locked VkFFT_kernel_cache.lock or -1 if the lock can't be acquired. The file lock also orders threads that use different translation unit copies of the mutex
+	char* name = (char*)malloc(strlen(app->configuration.kernelCacheDirectory) + 64);
+	if (!name) return -1;
+	sprintf(name, "%s/VkFFT_kernel_cache.lock", app->configuration.kernelCacheDirectory);
+	VkFFT_LockKernelCacheMutex(1);
+#ifdef _WIN32
+	HANDLE lockFile = CreateFileA(name, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, 0, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+	free(name);
+	if (lockFile == INVALID_HANDLE_VALUE) {
+		VkFFT_LockKernelCacheMutex(0);
+		return -1;
+	}
+	OVERLAPPED overlapped = { 0 };
+	if (!LockFileEx(lockFile, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped)) {
+		CloseHandle(lockFile);
+		VkFFT_LockKernelCacheMutex(0);
+		return -1;
+	}
+	return (pfINT)(intptr_t)lockFile;
+#else
+	int lockFile = open(name, O_RDWR | O_CREAT, 0666);
+	free(name);
+	if (lockFile < 0) {
+		VkFFT_LockKernelCacheMutex(0);
+		return -1;
+	}
+	while (flock(lockFile, LOCK_EX) != 0) {
+		if (errno != EINTR) {
+			close(lockFile);
+			VkFFT_LockKernelCacheMutex(0);
+			return -1;
+		}
+	}
+	return (pfINT)lockFile;
+#endif
+}
+
+static inline void VkFFT_UnlockKernelCacheIndex(pfINT lockFile) {
+#ifdef _WIN32
+	OVERLAPPED overlapped = { 0 };
+	UnlockFileEx((HANDLE)(intptr_t)lockFile, 0, 1, 0, &overlapped);
+	CloseHandle((HANDLE)(intptr_t)lockFile);
+#else
+	flock((int)lockFile, LOCK_UN);
+	close((int)lockFile);
+#endif
+	VkFFT_LockKernelCacheMutex(0);
+}
+
+static inline pfUINT VkFFT_ReadKernelCacheIndex(VkFFTApplication* app, VkFFTKernelCacheEntry** entries) {
+	//returns number of entries, 0 if index doesn't exist or is corrupted
+	char* name = (char*)malloc(strlen(app->configuration.kernelCacheDirectory) + 64);
+	if (!name) return 0;
+	sprintf(name, "%s/VkFFT_kernel_cache.idx", app->configuration.kernelCacheDirectory);
+	FILE* indexFile = fopen(name, "rb");
+	free(name);
+	if (!indexFile) return 0;
+	pfUINT header[2];
+	if ((fread(header, sizeof(pfUINT), 2, indexFile) != 2) || (header[0] != VKFFT_KERNEL_CACHE_INDEX_MAGIC) || (header[1] == 0)) {
+		fclose(indexFile);
+		return 0;
+	}
+	entries[0] = (VkFFTKernelCacheEntry*)malloc(header[1] * sizeof(VkFFTKernelCacheEntry));
+	if (!entries[0]) {
+		fclose(indexFile);
+		return 0;
+	}
+	if (fread(entries[0], sizeof(VkFFTKernelCacheEntry), header[1], indexFile) != header[1]) {
+		free(entries[0]);
+		entries[0] = 0;
+		fclose(indexFile);
+		return 0;
+	}
+	fclose(indexFile);
+	return header[1];
+}
+
+static inline void VkFFT_WriteKernelCacheIndex(VkFFTApplication* app, VkFFTKernelCacheEntry* entries, pfUINT numEntries) {
+	char* name = (char*)malloc(strlen(app->configuration.kernelCacheDirectory) + 64);
+	if (!name) return;
+	sprintf(name, "%s/VkFFT_kernel_cache.idx", app->configuration.kernelCacheDirectory);
+	char* tempName = VkFFT_GetKernelCacheTempName(name);
+	if (!tempName) {
+		free(name);
+		return;
+	}
+	FILE* indexFile = fopen(tempName, "wb");
+	if (!indexFile) {
+		free(tempName);
+		free(name);
+		return;
+	}
+	pfUINT header[2] = { VKFFT_KERNEL_CACHE_INDEX_MAGIC, numEntries };
+	pfUINT success = (fwrite(header, sizeof(pfUINT), 2, indexFile) == 2);
+	if (success && numEntries) success = (fwrite(entries, sizeof(VkFFTKernelCacheEntry), numEntries, indexFile) == numEntries);
+	fclose(indexFile);
+	if (success) {
+		if (rename(tempName, name) != 0) {
+			remove(name);
+			if (rename(tempName, name) != 0) remove(tempName);
+		}
+	}
+	else
+		remove(tempName);
+	free(tempName);
+	free(name);
+}
+
+static inline void VkFFT_UpdateKernelCacheIndex(VkFFTApplication* app, pfUINT key, pfUINT size) {
+	//marks key as most recently used (size == 0 - lookup hit, size > 0 - new entry) and evicts least recently used entries above kernelCacheMaxSize
+	pfINT lockFile = VkFFT_LockKernelCacheIndex(app);
+	if (lockFile == -1) return;
+	VkFFTKernelCacheEntry* entries = 0;
+	pfUINT numEntries = VkFFT_ReadKernelCacheIndex(app, &entries);
+	pfUINT maxLastUse = 0;
+	pfUINT id = numEntries;
+	for (pfUINT i = 0; i < numEntries; i++) {
+		if (entries[i].lastUse > maxLastUse) maxLastUse = entries[i].lastUse;
+		if (entries[i].key == key) id = i;
+	}
+	if (id == numEntries) {
+		if (size == 0) {
+			//entry exists on disk, but not in the index - size will be restored on the next store
+			free(entries);
+			VkFFT_UnlockKernelCacheIndex(lockFile);
+			return;
+		}
+		VkFFTKernelCacheEntry* newEntries = (VkFFTKernelCacheEntry*)realloc(entries, (numEntries + 1) * sizeof(VkFFTKernelCacheEntry));
+		if (!newEntries) {
+			free(entries);
+			VkFFT_UnlockKernelCacheIndex(lockFile);
+			return;
+		}
+		entries = newEntries;
+		entries[id].key = key;
+		numEntries++;
+	}
+	if (size) entries[id].size = size;
+	entries[id].lastUse = maxLastUse + 1;
+	if (app->configuration.kernelCacheMaxSize) {
+		pfUINT totalSize = 0;
+		for (pfUINT i = 0; i < numEntries; i++)
+			totalSize += entries[i].size;
+		char* name = (char*)malloc(strlen(app->configuration.kernelCacheDirectory) + 64);
+		while ((totalSize > app->configuration.kernelCacheMaxSize) && (numEntries > 1) && (name)) {
+			pfUINT lruID = 0;
+			for (pfUINT i = 1; i < numEntries; i++) {
+				if (entries[i].lastUse < entries[lruID].lastUse) lruID = i;
+			}
+			VkFFT_GetKernelCacheEntryName(app, name, entries[lruID].key);
+			remove(name);
+			totalSize -= entries[lruID].size;
+			entries[lruID] = entries[numEntries - 1];
+			numEntries--;
+		}
+		free(name);
+	}
+	VkFFT_WriteKernelCacheIndex(app, entries, numEntries);
+	free(entries);
+	VkFFT_UnlockKernelCacheIndex(lockFile);
+}
+
+static inline VkFFTResult VkFFT_LoadKernelFromCache(VkFFTApplication* app, const char* code0, void** binary, pfUINT* binarySize) {
+	//binary is set to 0 on cache miss. Allocated binary has to be freed by the caller.
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	binary[0] = 0;
+	binarySize[0] = 0;
+	pfUINT key = 0;
+	pfUINT codeHash = 0;
+	//device that can't be identified is a cache miss, the kernel is compiled as usual
+	if (VkFFT_GetKernelCacheKey(app, code0, &key, &codeHash) != VKFFT_SUCCESS) return resFFT;
+	char* name = (char*)malloc(strlen(app->configuration.kernelCacheDirectory) + 64);
+	if (!name) return VKFFT_ERROR_MALLOC_FAILED;
+	VkFFT_GetKernelCacheEntryName(app, name, key);
+	FILE* entryFile = fopen(name, "rb");
+	free(name);
+	if (!entryFile) return resFFT;
+	pfUINT header[4];
+	if ((fread(header, sizeof(pfUINT), 4, entryFile) != 4) || (header[0] != VKFFT_KERNEL_CACHE_MAGIC) || (header[1] != key) || (header[2] != codeHash) || (header[3] == 0)) {
+		fclose(entryFile);
+		return resFFT;
+	}
+	void* localBinary = malloc(header[3]);
+	if (!localBinary) {
+		fclose(entryFile);
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	if (fread(localBinary, 1, header[3], entryFile) != header[3]) {
+		free(localBinary);
+		fclose(entryFile);
+		return resFFT;
+	}
+	fclose(entryFile);
+	binary[0] = localBinary;
+	binarySize[0] = header[3];
+	VkFFT_UpdateKernelCacheIndex(app, key, 0);
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_SaveKernelToCache(VkFFTApplication* app, const char* code0, const void* binary, pfUINT binarySize) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if ((!binary) || (binarySize == 0)) return resFFT;
+	if ((app->configuration.kernelCacheMaxSize) && (binarySize + 4 * sizeof(pfUINT) > app->configuration.kernelCacheMaxSize)) return resFFT;
+	pfUINT key = 0;
+	pfUINT codeHash = 0;
+	//device that can't be identified is not stored
+	if (VkFFT_GetKernelCacheKey(app, code0, &key, &codeHash) != VKFFT_SUCCESS) return resFFT;
+	char* name = (char*)malloc(strlen(app->configuration.kernelCacheDirectory) + 64);
+	if (!name) return VKFFT_ERROR_MALLOC_FAILED;
+	VkFFT_GetKernelCacheEntryName(app, name, key);
+	//write to a temporary file first, so other processes never see partially written entries
+	char* tempName = VkFFT_GetKernelCacheTempName(name);
+	if (!tempName) {
+		free(name);
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	FILE* entryFile = fopen(tempName, "wb");
+	if (!entryFile) {
+		free(tempName);
+		free(name);
+		return resFFT;
+	}
+	pfUINT header[4] = { VKFFT_KERNEL_CACHE_MAGIC, key, codeHash, binarySize };
+	pfUINT success = (fwrite(header, sizeof(pfUINT), 4, entryFile) == 4);
+	if (success) success = (fwrite(binary, 1, binarySize, entryFile) == binarySize);
+	fclose(entryFile);
+	if (success) {
+		if (rename(tempName, name) != 0) {
+			remove(name);
+			if (rename(tempName, name) != 0) {
+				remove(tempName);
+				success = 0;
+			}
+		}
+	}
+	else
+		remove(tempName);
+	free(tempName);
+	free(name);
+	if (success) VkFFT_UpdateKernelCacheIndex(app, key, binarySize + 4 * sizeof(pfUINT));
+	return resFFT;
+}
+#endif
@@ -0,0 +1,216 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_KERNELREUSE_H
+#define VKFFT_KERNELREUSE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CPURuntime.h"
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Kernel reuse between an application and the one that replaces it in VkFFTUpdateConfiguration. Every axis stores a hash of its generated code.
+// Before compiling, an axis of the new application looks for a kernel with the same code in previousApplication and borrows its compiled objects.
+// Borrowed objects are released by neither application until the update succeeds and they are handed over, so the previous application
+// stays usable if the update fails.
+
+#define VKFFT_KERNEL_OWNED 0
+#define VKFFT_KERNEL_BORROWED 1 //compiled objects belong to previousApplication until the update succeeds
+#define VKFFT_KERNEL_LENT 2 //compiled objects are borrowed by the application that replaces this one
+
+static inline void VkFFT_LockKernelReuse(int lock) {
+	//compile jobs of one application can borrow kernels in parallel
+#ifdef _WIN32
+	static SRWLOCK kernelReuseLock = SRWLOCK_INIT;
+	if (lock) AcquireSRWLockExclusive(&kernelReuseLock);
+	else ReleaseSRWLockExclusive(&kernelReuseLock);
+#else
+	static pthread_mutex_t kernelReuseLock = PTHREAD_MUTEX_INITIALIZER;
+	if (lock) pthread_mutex_lock(&kernelReuseLock);
+	else pthread_mutex_unlock(&kernelReuseLock);
+#endif
+}
+
+static inline void VkFFT_GetKernelReuseKey(VkFFTAxis* axis, const char* code0) {
+	//second hash with a different seed guards against key collisions
+	pfUINT codeLength = (pfUINT)strlen(code0);
+	axis->kernelKey[0] = VkFFT_HashBytes(0xCBF29CE484222325, code0, codeLength);
+	axis->kernelKey[1] = VkFFT_HashUint(VkFFT_HashBytes(0x84222325CBF29CE4, code0, codeLength), codeLength);
+}
+
+static inline pfUINT VkFFT_GetApplicationAxes(VkFFTApplication* app, VkFFTAxis** axes) {
+	//collects axes that hold kernels in the order of deleteVkFFT. axes has to hold 2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1) pointers
+	pfUINT numAxes = 0;
+	for (pfUINT p = 0; p < 2; p++) {
+		VkFFTPlan* FFTPlan = (p == 0) ? app->localFFTPlan : app->localFFTPlan_inverse;
+		if (FFTPlan == 0) continue;
+		for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+			for (pfUINT j = 0; j < FFTPlan->numAxisUploads[i]; j++)
+				axes[numAxes++] = &FFTPlan->axes[i][j];
+			if (app->useBluesteinFFT[i] && (FFTPlan->numAxisUploads[i] > 1)) {
+				for (pfUINT j = 1; j < FFTPlan->numAxisUploads[i]; j++)
+					axes[numAxes++] = &FFTPlan->inverseBluesteinAxes[i][j];
+			}
+		}
+		if (FFTPlan->bigSequenceEvenR2C) axes[numAxes++] = &FFTPlan->R2Cdecomposition;
+	}
+	return numAxes;
+}
+
+static inline pfUINT VkFFT_CanReuseKernels(VkFFTConfiguration* configuration, VkFFTConfiguration* previousConfiguration) {
+	//kernels are only valid on the device and context they were compiled for
+#if((VKFFT_BACKEND==0) || (VKFFT_BACKEND==1) || (VKFFT_BACKEND==2))
+	return ((configuration->device != 0) && (previousConfiguration->device != 0) && (configuration->device[0] == previousConfiguration->device[0]));
+#elif((VKFFT_BACKEND==3) || (VKFFT_BACKEND==4))
+	return ((configuration->device != 0) && (previousConfiguration->device != 0) && (configuration->device[0] == previousConfiguration->device[0]) && (configuration->context != 0) && (previousConfiguration->context != 0) && (configuration->context[0] == previousConfiguration->context[0]));
+#elif(VKFFT_BACKEND==5)
+	return ((configuration->device != 0) && (configuration->device == previousConfiguration->device));
+#elif(VKFFT_BACKEND==6)
+	//libraries built with a different compiler command may differ for the same code
+	const char* compilerCommand = (configuration->cpuCompilerCommand) ? configuration->cpuCompilerCommand : VKFFT_CPU_COMPILER_COMMAND;
+	const char* previousCompilerCommand = (previousConfiguration->cpuCompilerCommand) ? previousConfiguration->cpuCompilerCommand : VKFFT_CPU_COMPILER_COMMAND;
+	return (strcmp(compilerCommand, previousCompilerCommand) == 0);
+#endif
+}
+
+static inline pfUINT VkFFT_HasKernel(VkFFTAxis* axis) {
+#if(VKFFT_BACKEND==0)
+	return (axis->pipeline != 0);
+#elif((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4) || (VKFFT_BACKEND==6))
+	return (axis->VkFFTKernel != 0);
+#elif(VKFFT_BACKEND==3)
+	return (axis->kernel != 0);
+#elif(VKFFT_BACKEND==5)
+	return (axis->pipeline != 0);
+#endif
+}
+
+static inline void VkFFT_CopyKernel(VkFFTAxis* axis, VkFFTAxis* sourceAxis) {
+	//copies compiled objects, everything else is created by the plan of axis
+#if(VKFFT_BACKEND==0)
+	axis->pipelineLayout = sourceAxis->pipelineLayout;
+	axis->pipeline = sourceAxis->pipeline;
+#elif((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4))
+	axis->VkFFTModule = sourceAxis->VkFFTModule;
+	axis->VkFFTKernel = sourceAxis->VkFFTKernel;
+#elif(VKFFT_BACKEND==3)
+	axis->program = sourceAxis->program;
+	axis->kernel = sourceAxis->kernel;
+#elif(VKFFT_BACKEND==5)
+	axis->library = sourceAxis->library;
+	axis->pipeline = sourceAxis->pipeline;
+#elif(VKFFT_BACKEND==6)
+	axis->library = sourceAxis->library;
+	axis->VkFFTKernel = sourceAxis->VkFFTKernel;
+	axis->useBarriers = sourceAxis->useBarriers;
+#endif
+}
+
+static inline void VkFFT_DetachKernel(VkFFTAxis* axis) {
+	//clears compiled objects owned by another axis, so deleteAxis doesn't release them
+#if(VKFFT_BACKEND==0)
+	axis->pipelineLayout = 0;
+	axis->pipeline = 0;
+#elif((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4))
+	axis->VkFFTModule = 0;
+	axis->VkFFTKernel = 0;
+#elif(VKFFT_BACKEND==3)
+	axis->program = 0;
+	axis->kernel = 0;
+#elif(VKFFT_BACKEND==5)
+	axis->library = 0;
+	axis->pipeline = 0;
+#elif(VKFFT_BACKEND==6)
+	axis->library = 0;
+	axis->VkFFTKernel = 0;
+#endif
+	axis->kernelReuse = VKFFT_KERNEL_OWNED;
+}
+
+static inline VkFFTResult VkFFT_BorrowKernel(VkFFTApplication* app, VkFFTAxis* axis, pfUINT* kernelBorrowed) {
+	//looks for a compiled kernel with the same code and launch requirements as axis in app->previousApplication. axis->kernelKey has to be set
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	kernelBorrowed[0] = 0;
+	VkFFTApplication* previousApp = app->previousApplication;
+	VkFFTAxis* previousAxes[2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1)];
+	pfUINT numPreviousAxes = VkFFT_GetApplicationAxes(previousApp, previousAxes);
+	VkFFTAxis* previousAxis = 0;
+	VkFFT_LockKernelReuse(1);
+	for (pfUINT i = 0; i < numPreviousAxes; i++) {
+		VkFFTAxis* candidate = previousAxes[i];
+		if ((candidate->kernelReuse != VKFFT_KERNEL_OWNED) || (!VkFFT_HasKernel(candidate))) continue;
+		if ((candidate->kernelKey[0] != axis->kernelKey[0]) || (candidate->kernelKey[1] != axis->kernelKey[1])) continue;
+		//dynamic shared memory size is set on the kernel object, push constant and binding layouts are part of the Vulkan pipeline layout
+		if (candidate->specializationConstants.usedSharedMemory.data.i != axis->specializationConstants.usedSharedMemory.data.i) continue;
+		if (candidate->pushConstants.structSize != axis->pushConstants.structSize) continue;
+#if(VKFFT_BACKEND==0)
+		if (candidate->usePushDescriptors != axis->usePushDescriptors) continue;
+#endif
+		if ((app->configuration.saveApplicationToString) && (candidate->binary == 0)) continue;
+		candidate->kernelReuse = VKFFT_KERNEL_LENT;
+		previousAxis = candidate;
+		break;
+	}
+	VkFFT_LockKernelReuse(0);
+	if (previousAxis == 0) return resFFT;
+	if (app->configuration.saveApplicationToString) {
+		axis->binary = malloc(previousAxis->binarySize);
+		if (!axis->binary) {
+			previousAxis->kernelReuse = VKFFT_KERNEL_OWNED;
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		memcpy(axis->binary, previousAxis->binary, previousAxis->binarySize);
+		axis->binarySize = previousAxis->binarySize;
+	}
+	VkFFT_CopyKernel(axis, previousAxis);
+	axis->kernelReuse = VKFFT_KERNEL_BORROWED;
+	kernelBorrowed[0] = 1;
+	return resFFT;
+}
+
+static inline void VkFFT_FinishKernelReuse(VkFFTApplication* app, VkFFTApplication* previousApp, pfUINT updateSucceeded) {
+	//hands lent kernels over to app if the update succeeded, returns them to previousApp otherwise
+	VkFFTAxis* axes[2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1)];
+	pfUINT numAxes = 0;
+	if (updateSucceeded) {
+		numAxes = VkFFT_GetApplicationAxes(app, axes);
+		for (pfUINT i = 0; i < numAxes; i++)
+			axes[i]->kernelReuse = VKFFT_KERNEL_OWNED;
+	}
+	numAxes = VkFFT_GetApplicationAxes(previousApp, axes);
+	for (pfUINT i = 0; i < numAxes; i++) {
+		if (axes[i]->kernelReuse != VKFFT_KERNEL_LENT) continue;
+		if (updateSucceeded)
+			VkFFT_DetachKernel(axes[i]);
+		else
+			axes[i]->kernelReuse = VKFFT_KERNEL_OWNED;
+	}
+}
+#endif
@@ -24,6 +24,9 @@
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_ManageMemory.h"
 #include "vkFFT/vkFFT_CodeGen/vkFFT_MathUtils/vkFFT_MathUtils.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_ComputeLUT.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_SharedBuffers.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_DeviceLUT.h"
 
 static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FFTPlan, VkFFTAxis* axis, pfUINT inverse){
 	VkFFTResult resFFT = VKFFT_SUCCESS;
@@ -38,6 +41,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 #elif(VKFFT_BACKEND==4)
 	ze_result_t res = ZE_RESULT_SUCCESS;
 #elif(VKFFT_BACKEND==5)
+#elif(VKFFT_BACKEND==6)
 #endif
 	//allocate LUT
 	if (app->configuration.useLUT == 1) {
@@ -288,10 +292,17 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 			}
 		}
 
+		//forward plan and reverse Bluestein uploads reference already uploaded LUT, so its largest part (4-step twiddles) is not computed for them
+		pfUINT reuseLUT = (!disableReferenceLUT_DCT) && ((axis->specializationConstants.reverseBluesteinMultiUpload == 1) || ((!inverse) && (!app->configuration.makeForwardPlanOnly)));
+		//4-step and DCT tables follow the per-stage twiddles and can be generated on the device, unless Rader kernels are stored after them
+		pfUINT deviceLUTValues = (reuseLUT) ? 0 : currentLUTPos - maxStageSum;
+		if (axis->specializationConstants.useRader && (!axis->specializationConstants.inline_rader_kernel) && (axis->specializationConstants.numRaderPrimes)) deviceLUTValues = 0;
 		if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
 			pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
 			axis->bufferLUTSize = currentLUTPos * 4 * sizeof(double);			
 			if (axis->bufferLUTSize == 0) axis->bufferLUTSize = 2 * sizeof(double);
+			VkFFTDeviceLUT deviceLUT;
+			VkFFT_InitDeviceLUT(app, &deviceLUT, 2, axis->bufferLUTSize, deviceLUTValues);
 			double* tempLUT = (double*)malloc(axis->bufferLUTSize);
 			if (!tempLUT) {
 				deleteVkFFT(app);
@@ -465,64 +476,51 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 					}
 				}
 			}
-			if ((axis->specializationConstants.axis_upload_id > 0) && (app->configuration.useLUT_4step == 1)) {
-				for (pfUINT i = 0; i < (pfUINT)axis->specializationConstants.stageStartSize.data.i; i++) {
-					for (pfUINT j = 0; j < (pfUINT)axis->specializationConstants.fftDim.data.i; j++) {
-						pfLD angle = pfFPinit("2.0") * double_PI * ((i * j) / (pfLD)(axis->specializationConstants.stageStartSize.data.i * axis->specializationConstants.fftDim.data.i));
-						in.data.d = pfcos(angle);
-						PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-						tempLUT[maxStageSum * 4 + 4 * (i + j * axis->specializationConstants.stageStartSize.data.i)] = (double)temp1.data.dd[0].data.d;
-						tempLUT[maxStageSum * 4 + 4 * (i + j * axis->specializationConstants.stageStartSize.data.i) + 1] = (double)temp1.data.dd[1].data.d;
-						in.data.d = pfsin(angle);
-						PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-						tempLUT[maxStageSum * 4 + 4 * (i + j * axis->specializationConstants.stageStartSize.data.i) + 2] = (double)temp1.data.dd[0].data.d;
-						tempLUT[maxStageSum * 4 + 4 * (i + j * axis->specializationConstants.stageStartSize.data.i) + 3] = (double)temp1.data.dd[1].data.d;
-					}
+			if ((axis->specializationConstants.axis_upload_id > 0) && (app->configuration.useLUT_4step == 1) && (!reuseLUT)) {
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, maxStageSum, axis->specializationConstants.stageStartSize.data.i * axis->specializationConstants.fftDim.data.i, axis->specializationConstants.fftDim.data.i, axis->specializationConstants.stageStartSize.data.i, 1, 0, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					PfDeallocateContainer(&axis->specializationConstants, &temp1);
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if ((((((axis->specializationConstants.performDCT == 3) || (axis->specializationConstants.performDST == 3)) && (axis->specializationConstants.actualInverse == 0)) || (((axis->specializationConstants.performDCT == 2) || (axis->specializationConstants.performDST == 2)) && (axis->specializationConstants.actualInverse == 1))) && ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) || (((((axis->specializationConstants.performDCT == 2) || (axis->specializationConstants.performDST == 2)) && (axis->specializationConstants.actualInverse == 0)) || (((axis->specializationConstants.performDCT == 3) || (axis->specializationConstants.performDST == 3)) && (axis->specializationConstants.actualInverse == 1))) && (((axis->specializationConstants.axis_upload_id == 0) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 0) && (axis->specializationConstants.numAxisUploads > 1))))) || ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 2 + 2; j++) {
-					pfLD angle = (double_PI / pfFPinit("2.0") / (pfLD)(app->configuration.size[axis->specializationConstants.axis_id])) * j;
-					in.data.d = pfcos(angle);
-					PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j] = (double)temp1.data.dd[0].data.d;
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j + 1] = (double)temp1.data.dd[1].data.d;
-					in.data.d = pfsin(angle);
-					PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j + 2] = (double)temp1.data.dd[0].data.d;
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j + 3] = (double)temp1.data.dd[1].data.d;
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT3LUT.data.i, 4 * app->configuration.size[axis->specializationConstants.axis_id], 1, app->configuration.size[axis->specializationConstants.axis_id] / 2 + 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					PfDeallocateContainer(&axis->specializationConstants, &temp1);
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if (((axis->specializationConstants.performDCT == 4) || (axis->specializationConstants.performDST == 4)) && (app->configuration.size[axis->specializationConstants.axis_id] % 2 == 0) && ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads - 1)) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 4 + 2; j++) {
-					pfLD angle = (double_PI / pfFPinit("2.0") / (pfLD)(app->configuration.size[axis->specializationConstants.axis_id] / 2)) * j;
-					in.data.d = pfcos(angle);
-					PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j] = (double)temp1.data.dd[0].data.d;
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j + 1] = (double)temp1.data.dd[1].data.d;
-					in.data.d = pfsin(angle);
-					PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j + 2] = (double)temp1.data.dd[0].data.d;
-					tempLUT[4 * axis->specializationConstants.startDCT3LUT.data.i + 4 * j + 3] = (double)temp1.data.dd[1].data.d;
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT3LUT.data.i, 4 * (app->configuration.size[axis->specializationConstants.axis_id] / 2), 1, app->configuration.size[axis->specializationConstants.axis_id] / 4 + 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					PfDeallocateContainer(&axis->specializationConstants, &temp1);
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if (((axis->specializationConstants.performDCT == 4) || (axis->specializationConstants.performDST == 4)) && (app->configuration.size[axis->specializationConstants.axis_id] % 2 == 0) && (((axis->specializationConstants.axis_upload_id == 0) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 0) && (axis->specializationConstants.numAxisUploads > 1))))) || ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 2; j++) {
-					pfLD angle = (-double_PI / pfFPinit("8.0") / (pfLD)(app->configuration.size[axis->specializationConstants.axis_id] / 2)) * (2 * j + 1);
-					in.data.d = pfcos(angle);
-					PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-					tempLUT[4 * axis->specializationConstants.startDCT4LUT.data.i + 4 * j] = (double)temp1.data.dd[0].data.d;
-					tempLUT[4 * axis->specializationConstants.startDCT4LUT.data.i + 4 * j + 1] = (double)temp1.data.dd[1].data.d;
-					in.data.d = pfsin(angle);
-					PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-					tempLUT[4 * axis->specializationConstants.startDCT4LUT.data.i + 4 * j + 2] = (double)temp1.data.dd[0].data.d;
-					tempLUT[4 * axis->specializationConstants.startDCT4LUT.data.i + 4 * j + 3] = (double)temp1.data.dd[1].data.d;
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT4LUT.data.i, 16 * (app->configuration.size[axis->specializationConstants.axis_id] / 2), 1, app->configuration.size[axis->specializationConstants.axis_id] / 2, 0, 2, 1, -1);
+				if (resFFT != VKFFT_SUCCESS) {
+					PfDeallocateContainer(&axis->specializationConstants, &temp1);
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			PfDeallocateContainer(&axis->specializationConstants, &temp1);
 			axis->referenceLUT = 0;
 			if ((axis->specializationConstants.reverseBluesteinMultiUpload == 1) && (!disableReferenceLUT_DCT)) {
 				axis->bufferLUT = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUT;
+				axis->hostLUT = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 				axis->bufferLUTDeviceMemory = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -532,6 +530,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 			else {
 				if ((!inverse) && (!app->configuration.makeForwardPlanOnly) && (!disableReferenceLUT_DCT)) {
 					axis->bufferLUT = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUT;
+					axis->hostLUT = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 					axis->bufferLUTDeviceMemory = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -553,6 +552,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 					}
 					if (checkRadixOrder && (!disableReferenceLUT_DCT) && (axis->specializationConstants.axis_id >= 1) && (!((!axis->specializationConstants.reorderFourStep) && (FFTPlan->numAxisUploads[axis->specializationConstants.axis_id] > 1))) && ((axis->specializationConstants.fft_dim_full.data.i == FFTPlan->axes[0][0].specializationConstants.fft_dim_full.data.i) && (FFTPlan->numAxisUploads[axis->specializationConstants.axis_id] == 1) && (axis->specializationConstants.fft_dim_full.data.i < axis->specializationConstants.maxSingleSizeStrided.data.i / axis->specializationConstants.registerBoost)) && (((!axis->specializationConstants.performDCT) && (!axis->specializationConstants.performDST)) || (app->configuration.size[axis->specializationConstants.axis_id] == app->configuration.size[0]))) {
 						axis->bufferLUT = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].bufferLUT;
+						axis->hostLUT = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 						axis->bufferLUTDeviceMemory = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -576,6 +576,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
                                 }
                                 if (checkRadixOrder && (!disableReferenceLUT_DCT) && (axis->specializationConstants.fft_dim_full.data.i == FFTPlan->axes[p][0].specializationConstants.fft_dim_full.data.i) && (((!axis->specializationConstants.performDCT) && (!axis->specializationConstants.performDST)) || (app->configuration.size[axis->specializationConstants.axis_id] == app->configuration.size[p]))) {
                                     axis->bufferLUT = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].bufferLUT;
+                                    axis->hostLUT = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
                                     axis->bufferLUTDeviceMemory = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -584,7 +585,12 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
                                 }
                             }
                         }
-                        if(axis->referenceLUT == 0){
+                        if ((axis->referenceLUT == 0) && (app->configuration.shareLUT)) VkFFT_AcquireSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+                        if ((axis->referenceLUT == 0) && (app->configuration.dryRun)) {
+                        	axis->hostLUT = tempLUT;
+                        	tempLUT = 0;
+                        }
+                        else if ((axis->referenceLUT == 0) && (axis->sharedLUT == 0)) {
 #if(VKFFT_BACKEND==0)
 							resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
 							if (resFFT != VKFFT_SUCCESS) {
@@ -664,7 +670,32 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 								tempLUT = 0;
 								return resFFT;
 							}
+#elif(VKFFT_BACKEND==6)
+							axis->bufferLUT = malloc(axis->bufferLUTSize);
+							if (!axis->bufferLUT) {
+								deleteVkFFT(app);
+								free(tempLUT);
+								tempLUT = 0;
+								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+							}
+							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+							if (resFFT != VKFFT_SUCCESS) {
+								deleteVkFFT(app);
+								free(tempLUT);
+								tempLUT = 0;
+								return resFFT;
+							}
 #endif
+							if (app->configuration.shareLUT) {
+								resFFT = VkFFT_FlushUploads(app);
+								if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+							}
 						}
 					}
 				}
@@ -676,7 +707,9 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 			pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
 			axis->bufferLUTSize = currentLUTPos * 2 * sizeof(double);
 			if (axis->bufferLUTSize == 0) axis->bufferLUTSize = sizeof(double);
-			double* tempLUT = (double*)malloc(axis->bufferLUTSize);
+			VkFFTDeviceLUT deviceLUT;
+			VkFFT_InitDeviceLUT(app, &deviceLUT, 1, axis->bufferLUTSize, deviceLUTValues);
+			double* tempLUT = (double*)malloc((deviceLUT.hostLUTSize) ? deviceLUT.hostLUTSize : sizeof(double));
 			if (!tempLUT) {
 				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
@@ -788,39 +821,46 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 					}
 				}
 			}
-			if ((axis->specializationConstants.axis_upload_id > 0) && (app->configuration.useLUT_4step == 1)) {
-				for (pfUINT i = 0; i < (pfUINT)axis->specializationConstants.stageStartSize.data.i; i++) {
-					for (pfUINT j = 0; j < (pfUINT)axis->specializationConstants.fftDim.data.i; j++) {
-						pfLD angle = 2 * double_PI * ((i * j) / (pfLD)(axis->specializationConstants.stageStartSize.data.i * axis->specializationConstants.fftDim.data.i));
-						tempLUT[maxStageSum * 2 + 2 * (i + j * axis->specializationConstants.stageStartSize.data.i)] = (double)pfcos(angle);
-						tempLUT[maxStageSum * 2 + 2 * (i + j * axis->specializationConstants.stageStartSize.data.i) + 1] = (double)pfsin(angle);
-					}
+			if ((axis->specializationConstants.axis_upload_id > 0) && (app->configuration.useLUT_4step == 1) && (!reuseLUT)) {
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, maxStageSum, axis->specializationConstants.stageStartSize.data.i * axis->specializationConstants.fftDim.data.i, axis->specializationConstants.fftDim.data.i, axis->specializationConstants.stageStartSize.data.i, 1, 0, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if ((((((axis->specializationConstants.performDCT == 3) || (axis->specializationConstants.performDST == 3)) && (axis->specializationConstants.actualInverse == 0)) || (((axis->specializationConstants.performDCT == 2) || (axis->specializationConstants.performDST == 2)) && (axis->specializationConstants.actualInverse == 1))) && ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) || (((((axis->specializationConstants.performDCT == 2) || (axis->specializationConstants.performDST == 2)) && (axis->specializationConstants.actualInverse == 0)) || (((axis->specializationConstants.performDCT == 3) || (axis->specializationConstants.performDST == 3)) && (axis->specializationConstants.actualInverse == 1))) && (((axis->specializationConstants.axis_upload_id == 0) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 0) && (axis->specializationConstants.numAxisUploads > 1))))) || ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 2 + 2; j++) {
-					pfLD angle = (double_PI / 2.0 / (pfLD)(app->configuration.size[axis->specializationConstants.axis_id])) * j;
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j] = (double)pfcos(angle);
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j + 1] = (double)pfsin(angle);
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT3LUT.data.i, 4 * app->configuration.size[axis->specializationConstants.axis_id], 1, app->configuration.size[axis->specializationConstants.axis_id] / 2 + 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if (((axis->specializationConstants.performDCT == 4) || (axis->specializationConstants.performDST == 4)) && (app->configuration.size[axis->specializationConstants.axis_id] % 2 == 0) && ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 4 + 2; j++) {
-					pfLD angle = (double_PI / 2.0 / (pfLD)(app->configuration.size[axis->specializationConstants.axis_id] / 2)) * j;
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j] = (double)pfcos(angle);
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j + 1] = (double)pfsin(angle);
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT3LUT.data.i, 4 * (app->configuration.size[axis->specializationConstants.axis_id] / 2), 1, app->configuration.size[axis->specializationConstants.axis_id] / 4 + 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if (((axis->specializationConstants.performDCT == 4) || (axis->specializationConstants.performDST == 4)) && (app->configuration.size[axis->specializationConstants.axis_id] % 2 == 0) && (((axis->specializationConstants.axis_upload_id == 0) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 0) && (axis->specializationConstants.numAxisUploads > 1))))) || ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 2; j++) {
-					pfLD angle = (-double_PI / 8.0 / (pfLD)(app->configuration.size[axis->specializationConstants.axis_id] / 2)) * (2 * j + 1);
-					tempLUT[2 * axis->specializationConstants.startDCT4LUT.data.i + 2 * j] = (double)pfcos(angle);
-					tempLUT[2 * axis->specializationConstants.startDCT4LUT.data.i + 2 * j + 1] = (double)pfsin(angle);
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT4LUT.data.i, 16 * (app->configuration.size[axis->specializationConstants.axis_id] / 2), 1, app->configuration.size[axis->specializationConstants.axis_id] / 2, 0, 2, 1, -1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			axis->referenceLUT = 0;
 			if ((axis->specializationConstants.reverseBluesteinMultiUpload == 1) && (!disableReferenceLUT_DCT)) {
 				axis->bufferLUT = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUT;
+				axis->hostLUT = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 				axis->bufferLUTDeviceMemory = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -830,6 +870,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 			else {
 				if ((!inverse) && (!app->configuration.makeForwardPlanOnly) && (!disableReferenceLUT_DCT)) {
 					axis->bufferLUT = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUT;
+					axis->hostLUT = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 					axis->bufferLUTDeviceMemory = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -851,6 +892,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 					}
 					if (checkRadixOrder && (!disableReferenceLUT_DCT) && (axis->specializationConstants.axis_id >= 1) && (!((!axis->specializationConstants.reorderFourStep) && (FFTPlan->numAxisUploads[axis->specializationConstants.axis_id] > 1))) && ((axis->specializationConstants.fft_dim_full.data.i == FFTPlan->axes[0][0].specializationConstants.fft_dim_full.data.i) && (FFTPlan->numAxisUploads[axis->specializationConstants.axis_id] == 1) && (axis->specializationConstants.fft_dim_full.data.i < axis->specializationConstants.maxSingleSizeStrided.data.i / axis->specializationConstants.registerBoost)) && ((((!axis->specializationConstants.performDCT) && (!axis->specializationConstants.performDST)) && (!axis->specializationConstants.performDST)) || (app->configuration.size[axis->specializationConstants.axis_id] == app->configuration.size[0]))) {
 						axis->bufferLUT = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].bufferLUT;
+						axis->hostLUT = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 						axis->bufferLUTDeviceMemory = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -874,6 +916,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
                                 }
                                 if (checkRadixOrder && (!disableReferenceLUT_DCT) && (axis->specializationConstants.fft_dim_full.data.i == FFTPlan->axes[p][0].specializationConstants.fft_dim_full.data.i) && (((!axis->specializationConstants.performDCT) && (!axis->specializationConstants.performDST)) || (app->configuration.size[axis->specializationConstants.axis_id] == app->configuration.size[p]))) {
                                     axis->bufferLUT = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].bufferLUT;
+                                    axis->hostLUT = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
                                     axis->bufferLUTDeviceMemory = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -882,87 +925,128 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
                                 }
                             }
                         }
-                        if(axis->referenceLUT == 0){
-#if(VKFFT_BACKEND==0)
-							resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
+                        if ((axis->referenceLUT == 0) && (app->configuration.shareLUT)) VkFFT_AcquireSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+                        if ((axis->referenceLUT == 0) && (app->configuration.dryRun)) {
+                        	axis->hostLUT = tempLUT;
+                        	tempLUT = 0;
+                        }
+                        else if ((axis->referenceLUT == 0) && (axis->sharedLUT == 0)) {
+							if (deviceLUT.numTables) {
+								resFFT = VkFFT_AllocateDeviceLUT(app, axis, &deviceLUT, tempLUT);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 							}
+							else {
+#if(VKFFT_BACKEND==0)
+								resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==1)
-							res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-							if (res != cudaSuccess) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
+								res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+								if (res != cudaSuccess) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==2)
-							res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-							if (res != hipSuccess) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
+								res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+								if (res != hipSuccess) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==3)
-							axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
-							if (res != CL_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
+								axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
+								if (res != CL_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
 #elif(VKFFT_BACKEND==4)
-							ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
-							device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-							res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
-							if (res != ZE_RESULT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
+								ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+								device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+								res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
+								if (res != ZE_RESULT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==5)
-							axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
+								axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+#elif(VKFFT_BACKEND==6)
+								axis->bufferLUT = malloc(axis->bufferLUTSize);
+								if (!axis->bufferLUT) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #endif
+							}
+							if (app->configuration.shareLUT) {
+								resFFT = VkFFT_FlushUploads(app);
+								if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+							}
 						}
 					}
 				}
@@ -974,7 +1058,9 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 			double double_PI = 3.14159265358979323846264338327950288419716939937510;
 			axis->bufferLUTSize = currentLUTPos * 2 * sizeof(float);		
 			if (axis->bufferLUTSize == 0) axis->bufferLUTSize = sizeof(float);
-			float* tempLUT = (float*)malloc(axis->bufferLUTSize);
+			VkFFTDeviceLUT deviceLUT;
+			VkFFT_InitDeviceLUT(app, &deviceLUT, 0, axis->bufferLUTSize, deviceLUTValues);
+			float* tempLUT = (float*)malloc((deviceLUT.hostLUTSize) ? deviceLUT.hostLUTSize : sizeof(float));
 			if (!tempLUT) {
 				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
@@ -1084,40 +1170,47 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 				}
 			}
 
-			if ((axis->specializationConstants.axis_upload_id > 0) && (app->configuration.useLUT_4step == 1)) {
-				for (pfUINT i = 0; i < (pfUINT)axis->specializationConstants.stageStartSize.data.i; i++) {
-					for (pfUINT j = 0; j < (pfUINT)axis->specializationConstants.fftDim.data.i; j++) {
-						double angle = 2 * double_PI * ((i * j) / (double)(axis->specializationConstants.stageStartSize.data.i * axis->specializationConstants.fftDim.data.i));
-						tempLUT[maxStageSum * 2 + 2 * (i + j * axis->specializationConstants.stageStartSize.data.i)] = (float)pfcos(angle);
-						tempLUT[maxStageSum * 2 + 2 * (i + j * axis->specializationConstants.stageStartSize.data.i) + 1] = (float)pfsin(angle);
-					}
+			if ((axis->specializationConstants.axis_upload_id > 0) && (app->configuration.useLUT_4step == 1) && (!reuseLUT)) {
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, maxStageSum, axis->specializationConstants.stageStartSize.data.i * axis->specializationConstants.fftDim.data.i, axis->specializationConstants.fftDim.data.i, axis->specializationConstants.stageStartSize.data.i, 1, 0, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if ((((((axis->specializationConstants.performDCT == 3) || (axis->specializationConstants.performDST == 3)) && (axis->specializationConstants.actualInverse == 0)) || (((axis->specializationConstants.performDCT == 2) || (axis->specializationConstants.performDST == 2)) && (axis->specializationConstants.actualInverse == 1))) && ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) || (((((axis->specializationConstants.performDCT == 2) || (axis->specializationConstants.performDST == 2)) && (axis->specializationConstants.actualInverse == 0)) || (((axis->specializationConstants.performDCT == 3) || (axis->specializationConstants.performDST == 3)) && (axis->specializationConstants.actualInverse == 1))) && (((axis->specializationConstants.axis_upload_id == 0) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 0) && (axis->specializationConstants.numAxisUploads > 1))))) || ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 2 + 2; j++) {
-					double angle = (double_PI / 2.0 / (double)(app->configuration.size[axis->specializationConstants.axis_id])) * j;
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j] = (float)pfcos(angle);
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j + 1] = (float)pfsin(angle);
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT3LUT.data.i, 4 * app->configuration.size[axis->specializationConstants.axis_id], 1, app->configuration.size[axis->specializationConstants.axis_id] / 2 + 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if (((axis->specializationConstants.performDCT == 4) || (axis->specializationConstants.performDST == 4)) && (app->configuration.size[axis->specializationConstants.axis_id] % 2 == 0) && ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1)))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 4 + 2; j++) {
-					double angle = (double_PI / 2.0 / (double)(app->configuration.size[axis->specializationConstants.axis_id] / 2)) * j;
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j] = (float)pfcos(angle);
-					tempLUT[2 * axis->specializationConstants.startDCT3LUT.data.i + 2 * j + 1] = (float)pfsin(angle);
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT3LUT.data.i, 4 * (app->configuration.size[axis->specializationConstants.axis_id] / 2), 1, app->configuration.size[axis->specializationConstants.axis_id] / 4 + 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			if (((axis->specializationConstants.performDCT == 4) || (axis->specializationConstants.performDST == 4)) && (app->configuration.size[axis->specializationConstants.axis_id] % 2 == 0) && (((axis->specializationConstants.axis_upload_id == 0) && (!((axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 0) && (axis->specializationConstants.numAxisUploads > 1))))) || ((axis->specializationConstants.axis_upload_id == (axis->specializationConstants.numAxisUploads-1)) && (axis->specializationConstants.useBluesteinFFT && (axis->specializationConstants.reverseBluesteinMultiUpload == 1))))) {
-				for (pfUINT j = 0; j < app->configuration.size[axis->specializationConstants.axis_id] / 2; j++) {
-					double angle = (-double_PI / 8.0 / (double)(app->configuration.size[axis->specializationConstants.axis_id] / 2)) * (2 * j + 1);
-					tempLUT[2 * axis->specializationConstants.startDCT4LUT.data.i + 2 * j] = (float)pfcos(angle);
-					tempLUT[2 * axis->specializationConstants.startDCT4LUT.data.i + 2 * j + 1] = (float)pfsin(angle);
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, axis->specializationConstants.startDCT4LUT.data.i, 16 * (app->configuration.size[axis->specializationConstants.axis_id] / 2), 1, app->configuration.size[axis->specializationConstants.axis_id] / 2, 0, 2, 1, -1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
 				}
 			}
 			axis->referenceLUT = 0;
 
 			if ((axis->specializationConstants.reverseBluesteinMultiUpload == 1) && (!disableReferenceLUT_DCT)) {
 				axis->bufferLUT = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUT;
+				axis->hostLUT = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 				axis->bufferLUTDeviceMemory = FFTPlan->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -1127,6 +1220,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 			else {
 				if ((!inverse) && (!app->configuration.makeForwardPlanOnly) && (!disableReferenceLUT_DCT)) {
 					axis->bufferLUT = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUT;
+					axis->hostLUT = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 					axis->bufferLUTDeviceMemory = app->localFFTPlan_inverse->axes[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -1148,6 +1242,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
 					}
 					if (checkRadixOrder && (!disableReferenceLUT_DCT) && (axis->specializationConstants.axis_id >= 1) && (!((!axis->specializationConstants.reorderFourStep) && (FFTPlan->numAxisUploads[axis->specializationConstants.axis_id] > 1))) && ((axis->specializationConstants.fft_dim_full.data.i == FFTPlan->axes[0][0].specializationConstants.fft_dim_full.data.i) && (FFTPlan->numAxisUploads[axis->specializationConstants.axis_id] == 1) && (axis->specializationConstants.fft_dim_full.data.i < axis->specializationConstants.maxSingleSizeStrided.data.i / axis->specializationConstants.registerBoost)) && ((((!axis->specializationConstants.performDCT) && (!axis->specializationConstants.performDST)) && (!axis->specializationConstants.performDST)) || (app->configuration.size[axis->specializationConstants.axis_id] == app->configuration.size[0]))) {
 						axis->bufferLUT = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].bufferLUT;
+						axis->hostLUT = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
 						axis->bufferLUTDeviceMemory = FFTPlan->axes[0][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -1171,6 +1266,7 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
                                 }
                                 if (checkRadixOrder && (!disableReferenceLUT_DCT) && (axis->specializationConstants.fft_dim_full.data.i == FFTPlan->axes[p][0].specializationConstants.fft_dim_full.data.i) && (((!axis->specializationConstants.performDCT) && (!axis->specializationConstants.performDST)) || (app->configuration.size[axis->specializationConstants.axis_id] == app->configuration.size[p]))) {
                                     axis->bufferLUT = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].bufferLUT;
+                                    axis->hostLUT = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].hostLUT;
 #if(VKFFT_BACKEND==0)
                                     axis->bufferLUTDeviceMemory = FFTPlan->axes[p][axis->specializationConstants.axis_upload_id].bufferLUTDeviceMemory;
 #endif
@@ -1179,87 +1275,128 @@ static inline VkFFTResult VkFFT_AllocateLUT(VkFFTApplication* app, VkFFTPlan* FF
                                 }
                             }
                         }
-                        if(axis->referenceLUT == 0){
-#if(VKFFT_BACKEND==0)
-							resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
+                        if ((axis->referenceLUT == 0) && (app->configuration.shareLUT)) VkFFT_AcquireSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+                        if ((axis->referenceLUT == 0) && (app->configuration.dryRun)) {
+                        	axis->hostLUT = tempLUT;
+                        	tempLUT = 0;
+                        }
+                        else if ((axis->referenceLUT == 0) && (axis->sharedLUT == 0)) {
+							if (deviceLUT.numTables) {
+								resFFT = VkFFT_AllocateDeviceLUT(app, axis, &deviceLUT, tempLUT);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 							}
+							else {
+#if(VKFFT_BACKEND==0)
+								resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==1)
-							res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-							if (res != cudaSuccess) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
+								res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+								if (res != cudaSuccess) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==2)
-							res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-							if (res != hipSuccess) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
+								res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+								if (res != hipSuccess) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 #elif(VKFFT_BACKEND==3)
-							axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
-							if (res != CL_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-							}
+								axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
+								if (res != CL_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
 #elif(VKFFT_BACKEND==4)
-							ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
-							device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-							res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
-							if (res != ZE_RESULT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+								device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+								res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
+								if (res != ZE_RESULT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+#elif(VKFFT_BACKEND==5)
+								axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+#elif(VKFFT_BACKEND==6)
+								axis->bufferLUT = malloc(axis->bufferLUTSize);
+								if (!axis->bufferLUT) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+								}
+								resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
+#endif
 							}
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
+							if (app->configuration.shareLUT) {
+								resFFT = VkFFT_FlushUploads(app);
+								if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+								if (resFFT != VKFFT_SUCCESS) {
+									deleteVkFFT(app);
+									free(tempLUT);
+									tempLUT = 0;
+									return resFFT;
+								}
 							}
-#elif(VKFFT_BACKEND==5)
-							axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
-							resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-							if (resFFT != VKFFT_SUCCESS) {
-								deleteVkFFT(app);
-								free(tempLUT);
-								tempLUT = 0;
-								return resFFT;
-							}
-#endif
 						}
 					}
 				}
@@ -1284,6 +1421,7 @@ static inline VkFFTResult VkFFT_AllocateRaderUintLUT(VkFFTApplication* app, VkFF
 #elif(VKFFT_BACKEND==4)
 	ze_result_t res = ZE_RESULT_SUCCESS;
 #elif(VKFFT_BACKEND==5)
+#elif(VKFFT_BACKEND==6)
 #endif
 	//allocate RaderUintLUT
 	if (axis->specializationConstants.raderUintLUT) {
@@ -1311,7 +1449,11 @@ static inline VkFFTResult VkFFT_AllocateRaderUintLUT(VkFFTApplication* app, VkFF
 					}
 				}
 			}
-
+			if (app->configuration.dryRun) {
+				axis->hostRaderUintLUT = tempRaderUintLUT;
+				axis->bufferRaderUintLUTSize = app->bufferRaderUintLUTSize[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id];
+				return resFFT;
+			}
 #if(VKFFT_BACKEND==0)
 			resFFT = allocateBufferVulkan(app, &app->bufferRaderUintLUT[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id], &app->bufferRaderUintLUTDeviceMemory[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, app->bufferRaderUintLUTSize[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id]);
 			if (resFFT != VKFFT_SUCCESS) {
@@ -1391,6 +1533,21 @@ static inline VkFFTResult VkFFT_AllocateRaderUintLUT(VkFFTApplication* app, VkFF
 				tempRaderUintLUT = 0;
 				return resFFT;
 			}
+#elif(VKFFT_BACKEND==6)
+			app->bufferRaderUintLUT[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id] = malloc(app->bufferRaderUintLUTSize[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id]);
+			if (!app->bufferRaderUintLUT[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id]) {
+				deleteVkFFT(app);
+				free(tempRaderUintLUT);
+				tempRaderUintLUT = 0;
+				return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+			}
+			resFFT = VkFFT_TransferDataFromCPU(app, tempRaderUintLUT, &app->bufferRaderUintLUT[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id], app->bufferRaderUintLUTSize[axis->specializationConstants.axis_id][axis->specializationConstants.axis_upload_id]);
+			if (resFFT != VKFFT_SUCCESS) {
+				deleteVkFFT(app);
+				free(tempRaderUintLUT);
+				tempRaderUintLUT = 0;
+				return resFFT;
+			}
 #endif
 			free(tempRaderUintLUT);
 			tempRaderUintLUT = 0;
@@ -1428,340 +1585,471 @@ static inline VkFFTResult VkFFT_AllocateLUT_R2C(VkFFTApplication* app, VkFFTPlan
 #elif(VKFFT_BACKEND==4)
 	ze_result_t res = ZE_RESULT_SUCCESS;
 #elif(VKFFT_BACKEND==5)
+#elif(VKFFT_BACKEND==6)
 	#endif
 	if (app->configuration.useLUT == 1) {
 		if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
-			PfContainer in = VKFFT_ZERO_INIT;
-			PfContainer temp1 = VKFFT_ZERO_INIT;
-			in.type = 22;
-			
-			pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
 			axis->bufferLUTSize = (app->configuration.size[0] / 2) * 4 * sizeof(double);
+			VkFFTDeviceLUT deviceLUT;
+			VkFFT_InitDeviceLUT(app, &deviceLUT, 2, axis->bufferLUTSize, 0);
 			double* tempLUT = (double*)malloc(axis->bufferLUTSize);
 			if (!tempLUT) {
 				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
 			}
-			for (pfUINT i = 0; i < app->configuration.size[0] / 2; i++) {
-				pfLD angle = double_PI * i / (app->configuration.size[0] / 2);
-				
-				in.data.d = pfcos(angle);
-				PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-				tempLUT[4 * i] = (double)temp1.data.dd[0].data.d;
-				tempLUT[4 * i + 1] = (double)temp1.data.dd[1].data.d;
-				in.data.d = pfsin(angle);
-				PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
-				tempLUT[4 * i + 2] = (double)temp1.data.dd[0].data.d;
-				tempLUT[4 * i + 3] = (double)temp1.data.dd[1].data.d;
+			if ((inverse) || (app->configuration.makeForwardPlanOnly)) {//forward plan references LUT of the inverse plan
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, 0, 2 * (app->configuration.size[0] / 2), 1, app->configuration.size[0] / 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
+				}
 			}
 			axis->referenceLUT = 0;
-			PfDeallocateContainer(&axis->specializationConstants, &temp1);
 			if ((!inverse) && (!app->configuration.makeForwardPlanOnly)) {
 				axis->bufferLUT = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUT;
+				axis->hostLUT = app->localFFTPlan_inverse->R2Cdecomposition.hostLUT;
 #if(VKFFT_BACKEND==0)
 				axis->bufferLUTDeviceMemory = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUTDeviceMemory;
 #endif
 				axis->bufferLUTSize = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUTSize;
 				axis->referenceLUT = 1;
+				free(tempLUT);
+				tempLUT = 0;
 			}
 			else {
-#if(VKFFT_BACKEND==0)
-				resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
+				if (app->configuration.shareLUT) VkFFT_AcquireSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+				if (app->configuration.dryRun) {
+					axis->hostLUT = tempLUT;
 					tempLUT = 0;
-					return resFFT;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
 				}
+				else if (axis->sharedLUT == 0) {
+#if(VKFFT_BACKEND==0)
+					resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
+					resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
 #elif(VKFFT_BACKEND==1)
-				res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-				if (res != cudaSuccess) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+					res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+					if (res != cudaSuccess) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+					}
+					resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
 #elif(VKFFT_BACKEND==2)
-				res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-				if (res != hipSuccess) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+					res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+					if (res != hipSuccess) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+					}
+					resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
 #elif(VKFFT_BACKEND==3)
-				axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
-				if (res != CL_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
+					axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
+					if (res != CL_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+					}
 #elif(VKFFT_BACKEND==4)
-				ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
-				device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-				res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
-				if (res != ZE_RESULT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+					ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+					device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+					res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
+					if (res != ZE_RESULT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+					}
+					resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
 #elif(VKFFT_BACKEND==5)
-				axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
+					axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
 
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+					resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
+#elif(VKFFT_BACKEND==6)
+					axis->bufferLUT = malloc(axis->bufferLUTSize);
+					if (!axis->bufferLUT) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+					}
+					resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+					if (resFFT != VKFFT_SUCCESS) {
+						deleteVkFFT(app);
+						free(tempLUT);
+						tempLUT = 0;
+						return resFFT;
+					}
 #endif
+					if (app->configuration.shareLUT) {
+						resFFT = VkFFT_FlushUploads(app);
+						if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+					}
+				}
 				free(tempLUT);
 				tempLUT = 0;
 			}
 		}
 		else if (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory) {
-			pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
 			axis->bufferLUTSize = (app->configuration.size[0] / 2) * 2 * sizeof(double);
-			double* tempLUT = (double*)malloc(axis->bufferLUTSize);
+			VkFFTDeviceLUT deviceLUT;
+			VkFFT_InitDeviceLUT(app, &deviceLUT, 1, axis->bufferLUTSize, ((inverse) || (app->configuration.makeForwardPlanOnly)) ? app->configuration.size[0] / 2 : 0);
+			double* tempLUT = (double*)malloc((deviceLUT.hostLUTSize) ? deviceLUT.hostLUTSize : sizeof(double));
 			if (!tempLUT) {
 				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
 			}
-			for (pfUINT i = 0; i < app->configuration.size[0] / 2; i++) {
-				pfLD angle = double_PI * i / (app->configuration.size[0] / 2);
-				tempLUT[2 * i] = (double)pfcos(angle);
-				tempLUT[2 * i + 1] = (double)pfsin(angle);
+			if ((inverse) || (app->configuration.makeForwardPlanOnly)) {//forward plan references LUT of the inverse plan
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, 0, 2 * (app->configuration.size[0] / 2), 1, app->configuration.size[0] / 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
+				}
 			}
 			axis->referenceLUT = 0;
 			if ((!inverse) && (!app->configuration.makeForwardPlanOnly)) {
 				axis->bufferLUT = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUT;
+				axis->hostLUT = app->localFFTPlan_inverse->R2Cdecomposition.hostLUT;
 #if(VKFFT_BACKEND==0)
 				axis->bufferLUTDeviceMemory = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUTDeviceMemory;
 #endif
 				axis->bufferLUTSize = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUTSize;
 				axis->referenceLUT = 1;
+				free(tempLUT);
+				tempLUT = 0;
 			}
 			else {
-#if(VKFFT_BACKEND==0)
-				resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
+				if (app->configuration.shareLUT) VkFFT_AcquireSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+				if (app->configuration.dryRun) {
+					axis->hostLUT = tempLUT;
 					tempLUT = 0;
-					return resFFT;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
 				}
+				else if (axis->sharedLUT == 0) {
+					if (deviceLUT.numTables) {
+						resFFT = VkFFT_AllocateDeviceLUT(app, axis, &deviceLUT, tempLUT);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+					}
+					else {
+#if(VKFFT_BACKEND==0)
+						resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==1)
-				res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-				if (res != cudaSuccess) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+						if (res != cudaSuccess) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==2)
-				res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-				if (res != hipSuccess) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+						if (res != hipSuccess) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==3)
-				axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
-				if (res != CL_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
+						axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
+						if (res != CL_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
 #elif(VKFFT_BACKEND==4)
-				ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
-				device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-				res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
-				if (res != ZE_RESULT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+						device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+						res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
+						if (res != ZE_RESULT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==5)
-				axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
+						axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
 
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+#elif(VKFFT_BACKEND==6)
+						axis->bufferLUT = malloc(axis->bufferLUTSize);
+						if (!axis->bufferLUT) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #endif
+					}
+					if (app->configuration.shareLUT) {
+						resFFT = VkFFT_FlushUploads(app);
+						if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+					}
+				}
 				free(tempLUT);
 				tempLUT = 0;
 			}
 		}
 		else {
-			double double_PI = 3.14159265358979323846264338327950288419716939937510;
 			axis->bufferLUTSize = (app->configuration.size[0] / 2) * 2 * sizeof(float);
-			float* tempLUT = (float*)malloc(axis->bufferLUTSize);
+			VkFFTDeviceLUT deviceLUT;
+			VkFFT_InitDeviceLUT(app, &deviceLUT, 0, axis->bufferLUTSize, ((inverse) || (app->configuration.makeForwardPlanOnly)) ? app->configuration.size[0] / 2 : 0);
+			float* tempLUT = (float*)malloc((deviceLUT.hostLUTSize) ? deviceLUT.hostLUTSize : sizeof(float));
 			if (!tempLUT) {
 				deleteVkFFT(app);
 				return VKFFT_ERROR_MALLOC_FAILED;
 			}
-			for (pfUINT i = 0; i < app->configuration.size[0] / 2; i++) {
-				double angle = double_PI * i / (app->configuration.size[0] / 2);
-				tempLUT[2 * i] = (float)pfcos(angle);
-				tempLUT[2 * i + 1] = (float)pfsin(angle);
+			if ((inverse) || (app->configuration.makeForwardPlanOnly)) {//forward plan references LUT of the inverse plan
+				resFFT = VkFFT_AddLUTTable(app, &deviceLUT, tempLUT, 0, 2 * (app->configuration.size[0] / 2), 1, app->configuration.size[0] / 2, 0, 1, 0, 1);
+				if (resFFT != VKFFT_SUCCESS) {
+					deleteVkFFT(app);
+					free(tempLUT);
+					tempLUT = 0;
+					return resFFT;
+				}
 			}
 			axis->referenceLUT = 0;
 			if ((!inverse) && (!app->configuration.makeForwardPlanOnly)) {
 				axis->bufferLUT = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUT;
+				axis->hostLUT = app->localFFTPlan_inverse->R2Cdecomposition.hostLUT;
 #if(VKFFT_BACKEND==0)
 				axis->bufferLUTDeviceMemory = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUTDeviceMemory;
 #endif
 				axis->bufferLUTSize = app->localFFTPlan_inverse->R2Cdecomposition.bufferLUTSize;
 				axis->referenceLUT = 1;
+				free(tempLUT);
+				tempLUT = 0;
 			}
 			else {
-#if(VKFFT_BACKEND==0)
-				resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
+				if (app->configuration.shareLUT) VkFFT_AcquireSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+				if (app->configuration.dryRun) {
+					axis->hostLUT = tempLUT;
 					tempLUT = 0;
-					return resFFT;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
 				}
+				else if (axis->sharedLUT == 0) {
+					if (deviceLUT.numTables) {
+						resFFT = VkFFT_AllocateDeviceLUT(app, axis, &deviceLUT, tempLUT);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+					}
+					else {
+#if(VKFFT_BACKEND==0)
+						resFFT = allocateBufferVulkan(app, &axis->bufferLUT, &axis->bufferLUTDeviceMemory, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==1)
-				res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-				if (res != cudaSuccess) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						res = cudaMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+						if (res != cudaSuccess) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==2)
-				res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
-				if (res != hipSuccess) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						res = hipMalloc((void**)&axis->bufferLUT, axis->bufferLUTSize);
+						if (res != hipSuccess) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==3)
-				axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
-				if (res != CL_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
+						axis->bufferLUT = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, axis->bufferLUTSize, tempLUT, &res);
+						if (res != CL_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
 #elif(VKFFT_BACKEND==4)
-				ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
-				device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-				res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
-				if (res != ZE_RESULT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-				}
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
+						device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
+						res = zeMemAllocDevice(app->configuration.context[0], &device_desc, axis->bufferLUTSize, sizeof(float), app->configuration.device[0], &axis->bufferLUT);
+						if (res != ZE_RESULT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #elif(VKFFT_BACKEND==5)
-				axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
+						axis->bufferLUT = app->configuration.device->newBuffer(axis->bufferLUTSize, MTL::ResourceStorageModePrivate);
 
-				resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
-				if (resFFT != VKFFT_SUCCESS) {
-					deleteVkFFT(app);
-					free(tempLUT);
-					tempLUT = 0;
-					return resFFT;
-				}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+#elif(VKFFT_BACKEND==6)
+						axis->bufferLUT = malloc(axis->bufferLUTSize);
+						if (!axis->bufferLUT) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+						}
+						resFFT = VkFFT_TransferDataFromCPU(app, tempLUT, &axis->bufferLUT, axis->bufferLUTSize);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
 #endif
+					}
+					if (app->configuration.shareLUT) {
+						resFFT = VkFFT_FlushUploads(app);
+						if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedLUT(app, axis, tempLUT, deviceLUT.hostLUTSize, deviceLUT.tables, deviceLUT.numTables);
+						if (resFFT != VKFFT_SUCCESS) {
+							deleteVkFFT(app);
+							free(tempLUT);
+							tempLUT = 0;
+							return resFFT;
+						}
+					}
+				}
 				free(tempLUT);
 				tempLUT = 0;
 			}
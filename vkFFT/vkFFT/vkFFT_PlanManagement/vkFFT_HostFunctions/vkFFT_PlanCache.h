@@ -0,0 +1,206 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_PLANCACHE_H
+#define VKFFT_PLANCACHE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// In-process cache of compiled applications, used if usePlanCache is enabled. The first application created with a configuration stores all of its
+// binaries (in the application string format) in the cache, keyed by the device hash and the hash of configuration parameters that affect generated kernels.
+// Next applications with the same key load their binaries from the cache instead of compiling them and share LUT and Bluestein buffers through shareLUT.
+// Entries are kept after applications are deleted, until they are evicted above planCacheMaxSize or removed with VkFFTClearPlanCache.
+// The cache is a static variable of this header, so it is shared by all applications created from the same translation unit.
+
+#define VKFFT_PLAN_CACHE_LOAD 1
+#define VKFFT_PLAN_CACHE_STORE 2
+
+typedef struct {
+	pfUINT key;
+	pfUINT refCount;//applications that are being initialized from this entry
+	pfUINT lastUse;
+	pfUINT size;
+	void* data;
+} VkFFTPlanCacheEntry;
+
+typedef struct {
+	VkFFTPlanCacheEntry* entries;
+	pfUINT numEntries;
+	pfUINT maxEntries;
+	pfUINT useCounter;
+#ifdef _WIN32
+	SRWLOCK lock;
+#else
+	pthread_mutex_t lock;
+#endif
+} VkFFTPlanCache;
+
+static inline VkFFTPlanCache* VkFFT_LockPlanCache() {
+#ifdef _WIN32
+	static VkFFTPlanCache cache = { 0, 0, 0, 0, SRWLOCK_INIT };
+	AcquireSRWLockExclusive(&cache.lock);
+#else
+	static VkFFTPlanCache cache = { 0, 0, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+	pthread_mutex_lock(&cache.lock);
+#endif
+	return &cache;
+}
+
+static inline void VkFFT_UnlockPlanCache(VkFFTPlanCache* cache) {
+	if (cache->numEntries == 0) {
+		free(cache->entries);
+		cache->entries = 0;
+		cache->maxEntries = 0;
+	}
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&cache->lock);
+#else
+	pthread_mutex_unlock(&cache->lock);
+#endif
+}
+
+static inline void VkFFT_RemovePlanCacheEntry(VkFFTPlanCache* cache, pfUINT id) {
+	free(cache->entries[id].data);
+	cache->entries[id] = cache->entries[cache->numEntries - 1];
+	cache->numEntries--;
+}
+
+static inline VkFFTResult VkFFT_AcquirePlanCacheEntry(VkFFTApplication* app) {
+	//called at the end of setConfigurationVkFFT. On a hit the application loads its binaries from the cache entry, on a miss it saves them to be stored after initialization
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (!app->deviceHash) {
+		resFFT = VkFFT_GetDeviceHash(app, &app->deviceHash);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	//application strings only contain kernels of the plans that have been made
+	app->planCacheKey = VkFFT_HashUint(VkFFT_HashUint(VkFFT_HashUint(app->deviceHash, app->configurationHash), app->configuration.makeForwardPlanOnly), app->configuration.makeInversePlanOnly);
+	app->configuration.shareLUT = 1;
+	VkFFTPlanCache* cache = VkFFT_LockPlanCache();
+	cache->useCounter++;
+	for (pfUINT i = 0; i < cache->numEntries; i++) {
+		if (cache->entries[i].key == app->planCacheKey) {
+			cache->entries[i].refCount++;
+			cache->entries[i].lastUse = cache->useCounter;
+			app->configuration.loadApplicationFromString = 1;
+			app->configuration.loadApplicationString = cache->entries[i].data;
+			app->configuration.loadApplicationStringSize = cache->entries[i].size;
+			app->planCacheState = VKFFT_PLAN_CACHE_LOAD;
+			VkFFT_UnlockPlanCache(cache);
+			return resFFT;
+		}
+	}
+	VkFFT_UnlockPlanCache(cache);
+	app->configuration.saveApplicationToString = 1;
+	app->planCacheState = VKFFT_PLAN_CACHE_STORE;
+	return resFFT;
+}
+
+static inline void VkFFT_ReleasePlanCacheEntry(VkFFTApplication* app) {
+	//called at the end of initializeVkFFT and in deleteVkFFT. Binaries are not needed after initialization, so the entry can be evicted afterwards
+	if (app->planCacheState != VKFFT_PLAN_CACHE_LOAD) return;
+	VkFFTPlanCache* cache = VkFFT_LockPlanCache();
+	for (pfUINT i = 0; i < cache->numEntries; i++) {
+		if ((cache->entries[i].key == app->planCacheKey) && (cache->entries[i].data == app->configuration.loadApplicationString)) {
+			cache->entries[i].refCount--;
+			break;
+		}
+	}
+	VkFFT_UnlockPlanCache(cache);
+	app->configuration.loadApplicationFromString = 0;
+	app->configuration.loadApplicationString = 0;
+	app->configuration.loadApplicationStringSize = 0;
+	app->planCacheState = 0;
+}
+
+static inline VkFFTResult VkFFT_StorePlanCacheEntry(VkFFTApplication* app) {
+	//moves the application string saved by an initialized application to the cache, evicting least recently used entries above planCacheMaxSize
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	if (app->planCacheState != VKFFT_PLAN_CACHE_STORE) return resFFT;
+	app->planCacheState = 0;
+	VkFFTPlanCache* cache = VkFFT_LockPlanCache();
+	for (pfUINT i = 0; i < cache->numEntries; i++) {
+		if (cache->entries[i].key == app->planCacheKey) {
+			//another application with the same configuration has been initialized in the meantime
+			VkFFT_UnlockPlanCache(cache);
+			return resFFT;
+		}
+	}
+	if (cache->numEntries == cache->maxEntries) {
+		pfUINT maxEntries = (cache->maxEntries) ? 2 * cache->maxEntries : 16;
+		VkFFTPlanCacheEntry* entries = (VkFFTPlanCacheEntry*)realloc(cache->entries, maxEntries * sizeof(VkFFTPlanCacheEntry));
+		if (!entries) {
+			VkFFT_UnlockPlanCache(cache);
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		cache->entries = entries;
+		cache->maxEntries = maxEntries;
+	}
+	cache->useCounter++;
+	cache->entries[cache->numEntries].key = app->planCacheKey;
+	cache->entries[cache->numEntries].refCount = 0;
+	cache->entries[cache->numEntries].lastUse = cache->useCounter;
+	cache->entries[cache->numEntries].size = app->applicationStringSize;
+	cache->entries[cache->numEntries].data = app->saveApplicationString;
+	cache->numEntries++;
+	app->saveApplicationString = 0;
+	app->applicationStringSize = 0;
+	if (app->configuration.planCacheMaxSize) {
+		pfUINT totalSize = 0;
+		for (pfUINT i = 0; i < cache->numEntries; i++)
+			totalSize += cache->entries[i].size;
+		while (totalSize > app->configuration.planCacheMaxSize) {
+			pfUINT lruID = cache->numEntries;
+			for (pfUINT i = 0; i < cache->numEntries; i++) {
+				if ((cache->entries[i].refCount == 0) && ((lruID == cache->numEntries) || (cache->entries[i].lastUse < cache->entries[lruID].lastUse))) lruID = i;
+			}
+			if (lruID == cache->numEntries) break;
+			totalSize -= cache->entries[lruID].size;
+			VkFFT_RemovePlanCacheEntry(cache, lruID);
+		}
+	}
+	VkFFT_UnlockPlanCache(cache);
+	return resFFT;
+}
+
+static inline void VkFFTClearPlanCache() {
+	//frees all cached binaries, except for entries that applications are being initialized from at the moment
+	VkFFTPlanCache* cache = VkFFT_LockPlanCache();
+	pfUINT i = 0;
+	while (i < cache->numEntries) {
+		if (cache->entries[i].refCount == 0)
+			VkFFT_RemovePlanCacheEntry(cache, i);
+		else
+			i++;
+	}
+	VkFFT_UnlockPlanCache(cache);
+}
+#endif
@@ -0,0 +1,180 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_PLANDESCRIPTION_H
+#define VKFFT_PLANDESCRIPTION_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_DeviceProfile.h"
+
+// Plan description is a text file with everything needed to execute an application without VkFFT planning: buffer requirements, and for each kernel
+// of the forward and inverse dispatch lists (in launch order) its source code, work group size, shared memory, push constant layout, bindings and
+// dispatch blocks with packed push constants. LUT contents are written as hex data at the end of the file and are referenced by kernels by id.
+// LUTs are only available in dryRun mode, as they are uploaded and freed on the host otherwise. Kernel sources need dryRun or keepShaderCode.
+
+#define VKFFT_PLAN_DESCRIPTION_MAX_LUTS 1024
+
+typedef struct {
+	void* data[VKFFT_PLAN_DESCRIPTION_MAX_LUTS];
+	pfUINT size[VKFFT_PLAN_DESCRIPTION_MAX_LUTS];
+	pfUINT numLUTs;
+} VkFFTPlanDescriptionLUTs;
+
+static inline pfINT VkFFT_GetPlanDescriptionLUT(VkFFTPlanDescriptionLUTs* luts, void* data, pfUINT size) {
+	//axes that reference the LUT of another axis share its host copy, so they get the same id
+	if (!data) return -1;
+	for (pfUINT i = 0; i < luts->numLUTs; i++) {
+		if (luts->data[i] == data) return (pfINT)i;
+	}
+	if (luts->numLUTs == VKFFT_PLAN_DESCRIPTION_MAX_LUTS) return -1;
+	luts->data[luts->numLUTs] = data;
+	luts->size[luts->numLUTs] = size;
+	luts->numLUTs++;
+	return (pfINT)(luts->numLUTs - 1);
+}
+
+static inline int VkFFT_WritePlanDescriptionHex(FILE* file, const char* data, pfUINT size, pfUINT lineSize) {
+	int res = 0;
+	for (pfUINT i = 0; i < size; i++) {
+		if (fprintf(file, "%02x", (unsigned char)data[i]) < 0) res = -1;
+		if ((((i + 1) % lineSize) == 0) || (i == size - 1)) {
+			if (fputc('\n', file) == EOF) res = -1;
+		}
+	}
+	return res;
+}
+
+static inline int VkFFT_WritePlanDescriptionKernel(VkFFTApplication* app, FILE* file, VkFFTDispatchList* dispatchList, VkFFTDispatchListEntry* entry, pfUINT kernelID, VkFFTPlanDescriptionLUTs* luts) {
+	VkFFTAxis* axis = entry->axis;
+	VkFFTSpecializationConstantsLayout* sc = &axis->specializationConstants;
+	int res = 0;
+	const char* type = "axis";
+	if (entry->isR2Cdecomposition)
+		type = "R2Cdecomposition";
+	else if (axis == &entry->FFTPlan->inverseBluesteinAxes[entry->axis_id][entry->axis_upload_id])
+		type = "inverseBluesteinAxis";
+	if (fprintf(file, "kernel %" PRIu64 " %s\n", kernelID, axis->VkFFTFunctionName) < 0) res = -1;
+	if (fprintf(file, "axis %" PRIu64 " %" PRIu64 " %s\n", entry->axis_id, entry->axis_upload_id, type) < 0) res = -1;
+	if (fprintf(file, "localSize %" PRIi64 " %" PRIi64 " %" PRIi64 "\n", sc->localSize[0].data.i, sc->localSize[1].data.i, sc->localSize[2].data.i) < 0) res = -1;
+	if (fprintf(file, "sharedMemory %" PRIi64 "\n", sc->usedSharedMemory.data.i) < 0) res = -1;
+
+	//push constants are packed in this order, each element is 8 bytes with useUint64 and 4 bytes otherwise
+	if (fprintf(file, "pushConstants %" PRIu64 " %" PRIu64 "", axis->pushConstants.structSize, (app->configuration.useUint64) ? (pfUINT)sizeof(pfUINT) : (pfUINT)sizeof(uint32_t)) < 0) res = -1;
+	const char* shiftNames[3] = { "workGroupShiftX", "workGroupShiftY", "workGroupShiftZ" };
+	for (int i = 0; i < 3; i++) {
+		if (sc->performWorkGroupShift[i]) {
+			if (fprintf(file, " %s", shiftNames[i]) < 0) res = -1;
+		}
+	}
+	if (sc->performPostCompilationInputOffset) {
+		if (fprintf(file, " inputOffset") < 0) res = -1;
+	}
+	if (sc->performPostCompilationOutputOffset) {
+		if (fprintf(file, " outputOffset") < 0) res = -1;
+	}
+	if (sc->performPostCompilationKernelOffset) {
+		if (fprintf(file, " kernelOffset") < 0) res = -1;
+	}
+	if (sc->performPostCompilationBatchStride) {
+		if (fprintf(file, " inputBatchStride outputBatchStride") < 0) res = -1;
+	}
+	if (fputc('\n', file) == EOF) res = -1;
+
+	if (fprintf(file, "bindings %" PRIu64 "", axis->numBindings) < 0) res = -1;
+	for (pfUINT i = 0; i < axis->numBindings; i++) {
+		if (fprintf(file, " %d", sc->numBuffersBound[i]) < 0) res = -1;
+	}
+	if (fputc('\n', file) == EOF) res = -1;
+	if (fprintf(file, "bindingIDs LUT %d RaderUintLUT %d BluesteinConvolution %d BluesteinMultiplication %d convolution %d\n", (sc->LUT) ? sc->LUTBindingID : -1, (sc->raderUintLUT) ? sc->RaderUintLUTBindingID : -1, (sc->BluesteinConvolutionStep) ? sc->BluesteinConvolutionBindingID : -1, (sc->BluesteinPreMultiplication || sc->BluesteinPostMultiplication) ? sc->BluesteinMultiplicationBindingID : -1, (sc->convolutionStep) ? sc->convolutionBindingID : -1) < 0) res = -1;
+	if (fprintf(file, "LUT %" PRIi64 " %" PRIu64 "\n", VkFFT_GetPlanDescriptionLUT(luts, axis->hostLUT, axis->bufferLUTSize), axis->bufferLUTSize) < 0) res = -1;
+	if (fprintf(file, "RaderUintLUT %" PRIi64 " %" PRIu64 "\n", VkFFT_GetPlanDescriptionLUT(luts, axis->hostRaderUintLUT, axis->bufferRaderUintLUTSize), axis->bufferRaderUintLUTSize) < 0) res = -1;
+
+	if (fprintf(file, "dispatch %" PRIu64 "\n", entry->numBlocks) < 0) res = -1;
+	for (pfUINT b = entry->firstBlock; b < entry->firstBlock + entry->numBlocks; b++) {
+		VkFFTDispatchBlock* block = &dispatchList->blocks[b];
+		if (fprintf(file, "block %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " ", block->dispatchSize[0], block->dispatchSize[1], block->dispatchSize[2], block->workGroupShift[0], block->workGroupShift[1], block->workGroupShift[2]) < 0) res = -1;
+		if (axis->pushConstants.structSize > 0) {
+			if (VkFFT_WritePlanDescriptionHex(file, block->pushConstants, axis->pushConstants.structSize, axis->pushConstants.structSize) < 0) res = -1;
+		}
+		else {
+			if (fprintf(file, "-\n") < 0) res = -1;
+		}
+	}
+
+	pfUINT codeLength = (sc->code0) ? (pfUINT)strlen(sc->code0) : 0;
+	if (fprintf(file, "code %" PRIu64 "\n", codeLength) < 0) res = -1;
+	if (codeLength) {
+		if (fwrite(sc->code0, 1, codeLength, file) != codeLength) res = -1;
+		if (fputc('\n', file) == EOF) res = -1;
+	}
+	if (fprintf(file, "end\n") < 0) res = -1;
+	return res;
+}
+
+static inline VkFFTResult VkFFTSavePlanDescription(VkFFTApplication* app, const char* fileName) {
+	//writes the plan description of an initialized application to fileName. Offsets specified at launch are zero in the packed push constants
+	if (!app->localFFTPlan && !app->localFFTPlan_inverse) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+	if ((app->dispatchList[0].numEntries == 0) && (app->dispatchList[1].numEntries == 0)) return VKFFT_ERROR_PLAN_NOT_INITIALIZED;
+	const char* precision;
+	const char* fallbackPrecision;
+	VkFFT_GetPrecisionClass(&app->configuration, &precision, &fallbackPrecision);
+	FILE* file = fopen(fileName, "wb");
+	if (!file) return VKFFT_ERROR_FAILED_TO_WRITE_planDescriptionFile;
+	VkFFTPlanDescriptionLUTs* luts = (VkFFTPlanDescriptionLUTs*)calloc(1, sizeof(VkFFTPlanDescriptionLUTs));
+	if (!luts) {
+		fclose(file);
+		return VKFFT_ERROR_MALLOC_FAILED;
+	}
+	int res = 0;
+	if (fprintf(file, "# VkFFT plan description\n") < 0) res = -1;
+#ifdef VKFFT_VERSION
+	if (fprintf(file, "version %d\n", VKFFT_VERSION) < 0) res = -1;
+#endif
+	if (fprintf(file, "backend %d\n", VKFFT_BACKEND) < 0) res = -1;
+	if (fprintf(file, "vendorID 0x%" PRIX64 "\n", app->configuration.vendorID) < 0) res = -1;
+	if (fprintf(file, "precision %s\n", precision) < 0) res = -1;
+	if (fprintf(file, "useUint64 %" PRIu64 "\n", app->configuration.useUint64) < 0) res = -1;
+	if (fprintf(file, "specifyOffsetsAtLaunch %" PRIu64 "\n", app->configuration.specifyOffsetsAtLaunch) < 0) res = -1;
+	if (fprintf(file, "specifyBatchesAtLaunch %" PRIu64 "\n", app->configuration.specifyBatchesAtLaunch) < 0) res = -1;
+	pfUINT tempBufferSize = ((app->configuration.allocateTempBuffer || app->configuration.userTempBuffer) && app->configuration.tempBufferSize) ? app->configuration.tempBufferSize[0] : 0;
+	if (fprintf(file, "tempBuffer %" PRIu64 " %" PRIu64 "\n", app->configuration.allocateTempBuffer, tempBufferSize) < 0) res = -1;
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if (app->useBluesteinFFT[i]) {
+			if (fprintf(file, "bluesteinBuffer %" PRIu64 " %" PRIu64 "\n", i, app->bufferBluesteinSize[i]) < 0) res = -1;
+		}
+	}
+	const char* planNames[2] = { "forward", "inverse" };
+	for (int p = 0; p < 2; p++) {
+		VkFFTDispatchList* dispatchList = &app->dispatchList[p];
+		if (dispatchList->numEntries == 0) continue;
+		if (fprintf(file, "plan %s %" PRIu64 "\n", planNames[p], dispatchList->numEntries) < 0) res = -1;
+		for (pfUINT e = 0; e < dispatchList->numEntries; e++) {
+			if (VkFFT_WritePlanDescriptionKernel(app, file, dispatchList, &dispatchList->entries[e], e, luts) < 0) res = -1;
+		}
+	}
+	for (pfUINT i = 0; i < luts->numLUTs; i++) {
+		if (fprintf(file, "lut %" PRIu64 " %" PRIu64 "\n", i, luts->size[i]) < 0) res = -1;
+		if (VkFFT_WritePlanDescriptionHex(file, (const char*)luts->data[i], luts->size[i], 32) < 0) res = -1;
+	}
+	free(luts);
+	if (fclose(file) != 0) res = -1;
+	return (res == 0) ? VKFFT_SUCCESS : VKFFT_ERROR_FAILED_TO_WRITE_planDescriptionFile;
+}
+#endif
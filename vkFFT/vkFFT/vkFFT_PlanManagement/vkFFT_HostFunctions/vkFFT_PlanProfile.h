@@ -0,0 +1,117 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_PLANPROFILE_H
+#define VKFFT_PLANPROFILE_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Plan creation profiling. Phases executed once are timed where initializeVkFFT calls them. Per-upload steps (LUT, code generation, compilation)
+// are recorded in the upload entry of the axis, so compile jobs executed in parallel only write to their own entry, and are summed into
+// the phases when initializeVkFFT finishes.
+
+static inline double VkFFT_GetHostTime() {
+	//monotonic host clock in ms
+#ifdef _WIN32
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+	struct timespec currentTime;
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+	return (double)currentTime.tv_sec * 1000.0 + (double)currentTime.tv_nsec * 0.000001;
+#endif
+}
+
+static inline double VkFFT_ProfileStart(VkFFTApplication* app) {
+	return (app->planProfile) ? VkFFT_GetHostTime() : 0;
+}
+static inline void VkFFT_ProfilePhase(VkFFTApplication* app, VkFFTPlanProfilePhase phase, double startTime) {
+	if (app->planProfile) app->planProfile->phases[phase].time += VkFFT_GetHostTime() - startTime;
+}
+static inline VkFFTPlanProfileAxisUpload* VkFFT_GetAxisUploadProfile(VkFFTApplication* app, VkFFTAxis* axis) {
+	if ((!app->planProfile) || (!axis->profileID)) return 0;
+	return &app->planProfile->axisUploads[axis->profileID - 1];
+}
+static inline void VkFFT_BeginAxisUploadProfile(VkFFTApplication* app, VkFFTAxis* axis, pfUINT inverse, pfUINT axis_id, pfUINT axis_upload_id, pfUINT type) {
+	if (!app->planProfile) return;
+	VkFFTPlanProfile* profile = app->planProfile;
+	if (profile->numAxisUploads == sizeof(profile->axisUploads) / sizeof(profile->axisUploads[0])) return;
+	VkFFTPlanProfileAxisUpload* upload = &profile->axisUploads[profile->numAxisUploads];
+	upload->inverse = inverse;
+	upload->axis_id = axis_id;
+	upload->axis_upload_id = axis_upload_id;
+	upload->type = type;
+	profile->numAxisUploads++;
+	axis->profileID = profile->numAxisUploads;
+}
+static inline void VkFFT_ProfileAxisUploadLUT(VkFFTApplication* app, VkFFTAxis* axis, double startTime) {
+	VkFFTPlanProfileAxisUpload* upload = VkFFT_GetAxisUploadProfile(app, axis);
+	if (upload) upload->lutTime = VkFFT_GetHostTime() - startTime;
+}
+static inline void VkFFT_EndAxisUploadProfile(VkFFTApplication* app, VkFFTAxis* axis, double startTime) {
+	//code generation and compilation are already done here, unless they are postponed to compile jobs
+	VkFFTPlanProfileAxisUpload* upload = VkFFT_GetAxisUploadProfile(app, axis);
+	if (!upload) return;
+	upload->setupTime = VkFFT_GetHostTime() - startTime - upload->lutTime - upload->codeGenerationTime - upload->compilationTime;
+	upload->lutSize = axis->bufferLUTSize + axis->bufferRaderUintLUTSize;
+}
+static inline void VkFFT_FinalizePlanProfile(VkFFTApplication* app, double startTime) {
+	VkFFTPlanProfile* profile = app->planProfile;
+	if (!profile) return;
+	profile->totalTime = VkFFT_GetHostTime() - startTime;
+	for (pfUINT i = 0; i < profile->numAxisUploads; i++) {
+		VkFFTPlanProfileAxisUpload* upload = &profile->axisUploads[i];
+		profile->phases[VKFFT_PLAN_PROFILE_AXIS_SETUP].time += upload->setupTime;
+		profile->phases[VKFFT_PLAN_PROFILE_LUT].time += upload->lutTime;
+		profile->phases[VKFFT_PLAN_PROFILE_LUT].allocatedSize += upload->lutSize;
+		profile->phases[VKFFT_PLAN_PROFILE_CODE_GENERATION].time += upload->codeGenerationTime;
+		profile->phases[VKFFT_PLAN_PROFILE_CODE_GENERATION].codeSize += upload->codeSize;
+		profile->phases[VKFFT_PLAN_PROFILE_COMPILATION].time += upload->compilationTime;
+		profile->phases[VKFFT_PLAN_PROFILE_COMPILATION].binarySize += upload->binarySize;
+	}
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if (!app->useBluesteinFFT[i]) continue;
+		pfUINT numBuffers = 1 + ((app->configuration.makeInversePlanOnly) ? 0 : 1) + ((app->configuration.makeForwardPlanOnly) ? 0 : 1);
+		profile->phases[VKFFT_PLAN_PROFILE_BLUESTEIN].allocatedSize += numBuffers * app->bufferBluesteinSize[i];
+	}
+}
+
+static inline VkFFTResult VkFFTGetPlanProfile(VkFFTApplication* app, VkFFTPlanProfile* profile) {
+	//copies the report collected by initializeVkFFT
+	if (app->planProfile == 0) return VKFFT_ERROR_DISABLED_profilePlanCreation;
+	profile[0] = app->planProfile[0];
+	return VKFFT_SUCCESS;
+}
+
+#endif
@@ -24,6 +24,9 @@
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_ManageMemory.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_ApplicationString.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_SharedBuffers.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_DeviceLUT.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_InitializeApp.h"
 #include "vkFFT/vkFFT_CodeGen/vkFFT_MathUtils/vkFFT_MathUtils.h"
 #ifdef VkFFT_use_FP128_Bluestein_RaderFFT
@@ -39,80 +42,115 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 	if (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory) bufferSize *= sizeof(double) / sizeof(float);
 	if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) bufferSize *= 4;
 	app->bufferBluesteinSize[axis_id] = bufferSize;
-#if(VKFFT_BACKEND==0)
-	VkResult res = VK_SUCCESS;
-	resFFT = allocateBufferVulkan(app, &app->bufferBluestein[axis_id], &app->bufferBluesteinDeviceMemory[axis_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
-	if (resFFT != VKFFT_SUCCESS) return resFFT;
-	if (!app->configuration.makeInversePlanOnly) {
-		resFFT = allocateBufferVulkan(app, &app->bufferBluesteinFFT[axis_id], &app->bufferBluesteinFFTDeviceMemory[axis_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+	if (app->configuration.dryRun) return resFFT; //only the size is reported, phase vectors are computed with an FFT on the device
+	//buffers in workspace are not shared, as the registry frees buffers when the last application that uses them is deleted
+	if ((app->configuration.shareLUT) && (!app->configuration.saveApplicationToString) && (!app->configuration.workspace)) {
+		//Bluestein kernels have to be built to be saved to the application string, so with saveApplicationToString the buffers are only shared after generation
+		if (VkFFT_AcquireSharedBluestein(app, FFTPlan, axis_id)) return resFFT;
+	}
+	if (app->configuration.workspace) {
+		//otherwise buffers are allocated below
+		resFFT = VkFFT_AllocateWorkspaceBluestein(app, axis_id, bufferSize);
 		if (resFFT != VKFFT_SUCCESS) return resFFT;
 	}
-	if (!app->configuration.makeForwardPlanOnly) {
-		resFFT = allocateBufferVulkan(app, &app->bufferBluesteinIFFT[axis_id], &app->bufferBluesteinIFFTDeviceMemory[axis_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+#if(VKFFT_BACKEND==0)
+	VkResult res = VK_SUCCESS;
+	if (!app->configuration.workspace) {
+		resFFT = allocateBufferVulkan(app, &app->bufferBluestein[axis_id], &app->bufferBluesteinDeviceMemory[axis_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
 		if (resFFT != VKFFT_SUCCESS) return resFFT;
+		if (!app->configuration.makeInversePlanOnly) {
+			resFFT = allocateBufferVulkan(app, &app->bufferBluesteinFFT[axis_id], &app->bufferBluesteinFFTDeviceMemory[axis_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			resFFT = allocateBufferVulkan(app, &app->bufferBluesteinIFFT[axis_id], &app->bufferBluesteinIFFTDeviceMemory[axis_id], VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT, bufferSize);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+		}
 	}
 #elif(VKFFT_BACKEND==1)
 	cudaError_t res = cudaSuccess;
-	res = cudaMalloc((void**)&app->bufferBluestein[axis_id], bufferSize);
-	if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	if (!app->configuration.makeInversePlanOnly) {
-		res = cudaMalloc((void**)&app->bufferBluesteinFFT[axis_id], bufferSize);
-		if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	}
-	if (!app->configuration.makeForwardPlanOnly) {
-		res = cudaMalloc((void**)&app->bufferBluesteinIFFT[axis_id], bufferSize);
+	if (!app->configuration.workspace) {
+		res = cudaMalloc((void**)&app->bufferBluestein[axis_id], bufferSize);
 		if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		if (!app->configuration.makeInversePlanOnly) {
+			res = cudaMalloc((void**)&app->bufferBluesteinFFT[axis_id], bufferSize);
+			if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			res = cudaMalloc((void**)&app->bufferBluesteinIFFT[axis_id], bufferSize);
+			if (res != cudaSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
 	}
 #elif(VKFFT_BACKEND==2)
 	hipError_t res = hipSuccess;
-	res = hipMalloc((void**)&app->bufferBluestein[axis_id], bufferSize);
-	if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	if (!app->configuration.makeInversePlanOnly) {
-		res = hipMalloc((void**)&app->bufferBluesteinFFT[axis_id], bufferSize);
-		if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	}
-	if (!app->configuration.makeForwardPlanOnly) {
-		res = hipMalloc((void**)&app->bufferBluesteinIFFT[axis_id], bufferSize);
+	if (!app->configuration.workspace) {
+		res = hipMalloc((void**)&app->bufferBluestein[axis_id], bufferSize);
 		if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		if (!app->configuration.makeInversePlanOnly) {
+			res = hipMalloc((void**)&app->bufferBluesteinFFT[axis_id], bufferSize);
+			if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			res = hipMalloc((void**)&app->bufferBluesteinIFFT[axis_id], bufferSize);
+			if (res != hipSuccess) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
 	}
 #elif(VKFFT_BACKEND==3)
 	cl_int res = CL_SUCCESS;
-	app->bufferBluestein[axis_id] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, bufferSize, 0, &res);
-	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	if (!app->configuration.makeInversePlanOnly) {
-		app->bufferBluesteinFFT[axis_id] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, bufferSize, 0, &res);
-		if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	}
-	if (!app->configuration.makeForwardPlanOnly) {
-		app->bufferBluesteinIFFT[axis_id] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, bufferSize, 0, &res);
+	if (!app->configuration.workspace) {
+		app->bufferBluestein[axis_id] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, bufferSize, 0, &res);
 		if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		if (!app->configuration.makeInversePlanOnly) {
+			app->bufferBluesteinFFT[axis_id] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, bufferSize, 0, &res);
+			if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			app->bufferBluesteinIFFT[axis_id] = clCreateBuffer(app->configuration.context[0], CL_MEM_READ_WRITE, bufferSize, 0, &res);
+			if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
 	}
 	cl_command_queue commandQueue = clCreateCommandQueue(app->configuration.context[0], app->configuration.device[0], 0, &res);
 	if (res != CL_SUCCESS) return VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_QUEUE;
 #elif(VKFFT_BACKEND==4)
 	ze_result_t res = ZE_RESULT_SUCCESS;
-
 	ze_device_mem_alloc_desc_t device_desc = VKFFT_ZERO_INIT;
 	device_desc.stype = ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC;
-	res = zeMemAllocDevice(app->configuration.context[0], &device_desc, bufferSize, sizeof(float), app->configuration.device[0], &app->bufferBluestein[axis_id]);
-	if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-
-	if (!app->configuration.makeInversePlanOnly) {
-		res = zeMemAllocDevice(app->configuration.context[0], &device_desc, bufferSize, sizeof(float), app->configuration.device[0], &app->bufferBluesteinFFT[axis_id]);
-		if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
-	}
-	if (!app->configuration.makeForwardPlanOnly) {
-		res = zeMemAllocDevice(app->configuration.context[0], &device_desc, bufferSize, sizeof(float), app->configuration.device[0], &app->bufferBluesteinIFFT[axis_id]);
+	if (!app->configuration.workspace) {
+		res = zeMemAllocDevice(app->configuration.context[0], &device_desc, bufferSize, sizeof(float), app->configuration.device[0], &app->bufferBluestein[axis_id]);
 		if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+
+		if (!app->configuration.makeInversePlanOnly) {
+			res = zeMemAllocDevice(app->configuration.context[0], &device_desc, bufferSize, sizeof(float), app->configuration.device[0], &app->bufferBluesteinFFT[axis_id]);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			res = zeMemAllocDevice(app->configuration.context[0], &device_desc, bufferSize, sizeof(float), app->configuration.device[0], &app->bufferBluesteinIFFT[axis_id]);
+			if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
 	}
 #elif(VKFFT_BACKEND==5)
-	app->bufferBluestein[axis_id] = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+	if (!app->configuration.workspace) {
+		app->bufferBluestein[axis_id] = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
 
-	if (!app->configuration.makeInversePlanOnly) {
-		app->bufferBluesteinFFT[axis_id] = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+		if (!app->configuration.makeInversePlanOnly) {
+			app->bufferBluesteinFFT[axis_id] = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			app->bufferBluesteinIFFT[axis_id] = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+		}
 	}
-	if (!app->configuration.makeForwardPlanOnly) {
-		app->bufferBluesteinIFFT[axis_id] = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+#elif(VKFFT_BACKEND==6)
+	if (!app->configuration.workspace) {
+		app->bufferBluestein[axis_id] = malloc(bufferSize);
+		if (!app->bufferBluestein[axis_id]) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		if (!app->configuration.makeInversePlanOnly) {
+			app->bufferBluesteinFFT[axis_id] = malloc(bufferSize);
+			if (!app->bufferBluesteinFFT[axis_id]) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
+		if (!app->configuration.makeForwardPlanOnly) {
+			app->bufferBluesteinIFFT[axis_id] = malloc(bufferSize);
+			if (!app->bufferBluesteinIFFT[axis_id]) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
+		}
 	}
 #endif
 #ifdef VkFFT_use_FP128_Bluestein_RaderFFT
@@ -257,8 +295,18 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 		kernelPreparationConfiguration.saveApplicationToString = app->configuration.saveApplicationToString;
 		kernelPreparationConfiguration.loadApplicationFromString = app->configuration.loadApplicationFromString;
 		kernelPreparationConfiguration.sharedMemorySize = app->configuration.sharedMemorySize;
+		kernelPreparationConfiguration.kernelCacheDirectory = app->configuration.kernelCacheDirectory;
+		kernelPreparationConfiguration.kernelCacheMaxSize = app->configuration.kernelCacheMaxSize;
+		kernelPreparationConfiguration.numCompileThreads = app->configuration.numCompileThreads;
+		kernelPreparationConfiguration.compileTaskExecutor = app->configuration.compileTaskExecutor;
+		kernelPreparationConfiguration.compileTaskExecutorData = app->configuration.compileTaskExecutorData;
 		if (kernelPreparationConfiguration.loadApplicationFromString) {
-			kernelPreparationConfiguration.loadApplicationString = (void*)((char*)app->configuration.loadApplicationString + app->currentApplicationStringPos);
+			pfUINT offset = 0;
+			pfUINT size = 0;
+			resFFT = VkFFT_FindApplicationStringEntry(app, VkFFT_GetApplicationStringKey(VKFFT_APPLICATION_STRING_BLUESTEIN_APPLICATION, 0, axis_id, 0), &offset, &size);
+			if (resFFT != VKFFT_SUCCESS) return resFFT;
+			kernelPreparationConfiguration.loadApplicationString = (void*)((char*)app->configuration.loadApplicationString + offset);
+			kernelPreparationConfiguration.loadApplicationStringSize = size;
 		}
 		kernelPreparationConfiguration.performBandwidthBoost = (app->configuration.performBandwidthBoost > 0) ? app->configuration.performBandwidthBoost : 1;
 		if (axis_id == 0) kernelPreparationConfiguration.performBandwidthBoost = 0;
@@ -269,7 +317,9 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 			kernelPreparationConfiguration.tempBufferSize = app->configuration.tempBufferSize;
 			kernelPreparationConfiguration.tempBufferNum = app->configuration.tempBufferNum;
 		}
+#if(VKFFT_BACKEND!=6)
 		kernelPreparationConfiguration.device = app->configuration.device;
+#endif
 #if(VKFFT_BACKEND==0)
 		kernelPreparationConfiguration.queue = app->configuration.queue; //to allocate memory for LUT, we have to pass a queue, vkGPU->fence, commandPool and physicalDevice pointers 
 		kernelPreparationConfiguration.fence = app->configuration.fence;
@@ -290,6 +340,10 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 #elif(VKFFT_BACKEND==5)
 		kernelPreparationConfiguration.device = app->configuration.device;
 		kernelPreparationConfiguration.queue = app->configuration.queue;
+#elif(VKFFT_BACKEND==6)
+		kernelPreparationConfiguration.numCPUThreads = app->configuration.numCPUThreads;
+		kernelPreparationConfiguration.cpuCompilerCommand = app->configuration.cpuCompilerCommand;
+		kernelPreparationConfiguration.cpuTemporaryDirectory = app->configuration.cpuTemporaryDirectory;
 #endif			
 
 		kernelPreparationConfiguration.inputBufferSize = &app->bufferBluesteinSize[axis_id];
@@ -297,10 +351,10 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 		kernelPreparationConfiguration.isInputFormatted = 1;
 		resFFT = initializeVkFFT(&kernelPreparationApplication, kernelPreparationConfiguration);
 		if (resFFT != VKFFT_SUCCESS) return resFFT;
-		if (kernelPreparationConfiguration.loadApplicationFromString) {
-			app->currentApplicationStringPos += kernelPreparationApplication.currentApplicationStringPos;
-		}
-		void* phaseVectors = malloc(bufferSize);
+		//chirps of large sequences are generated directly in bufferBluestein
+		VkFFTDeviceLUT bluesteinLUT;
+		VkFFT_InitDeviceLUT(app, &bluesteinLUT, (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) ? 2 : ((app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory) ? 1 : 0), bufferSize, FFTPlan->actualFFTSizePerAxis[axis_id][axis_id]);
+		void* phaseVectors = malloc((bluesteinLUT.enabled) ? sizeof(float) : bufferSize);
 		if (!phaseVectors) {
 			deleteVkFFT(&kernelPreparationApplication);
 			return VKFFT_ERROR_MALLOC_FAILED;
@@ -309,7 +363,10 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 		if (app->configuration.performDCT == 1) phaseVectorsNonZeroSize = 2 * app->configuration.size[axis_id] - 2;
 		if (app->configuration.performDST == 1) phaseVectorsNonZeroSize = 2 * app->configuration.size[axis_id] + 2;
 		if ((FFTPlan->numAxisUploads[axis_id] > 1) && (!app->configuration.makeForwardPlanOnly)) {
-			if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
+			if (bluesteinLUT.enabled) {
+				resFFT = VkFFT_AddChirpTable(app, &bluesteinLUT, 2 * phaseVectorsNonZeroSize, FFTPlan->actualFFTSizePerAxis[axis_id][axis_id], phaseVectorsNonZeroSize, -1);
+			}
+			else if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
 				PfContainer in = VKFFT_ZERO_INIT;
 				PfContainer temp1 = VKFFT_ZERO_INIT;
 				in.type = 22;
@@ -363,7 +420,12 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 					phaseVectors_cast[2 * (FFTPlan->actualFFTSizePerAxis[axis_id][axis_id] - i) + 1] = phaseVectors_cast[2 * i + 1];
 				}
 			}
-			resFFT = VkFFT_TransferDataFromCPU(app, phaseVectors, &app->bufferBluestein[axis_id], bufferSize);
+			if (bluesteinLUT.enabled)
+				resFFT = VkFFT_GenerateDeviceLUT(app, &bluesteinLUT, &app->bufferBluestein[axis_id], bufferSize);
+			else
+				resFFT = VkFFT_TransferDataFromCPU(app, phaseVectors, &app->bufferBluestein[axis_id], bufferSize);
+			//the chirp is transformed on the device right away
+			if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_FlushUploads(app);
 			if (resFFT != VKFFT_SUCCESS) {
 				free(phaseVectors);
 				deleteVkFFT(&kernelPreparationApplication);
@@ -541,10 +603,24 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 			commandBuffer->waitUntilCompleted();
 			commandEncoder->release();
 			commandBuffer->release();
+#elif(VKFFT_BACKEND==6)
+			//launches are synchronous
+			VkFFTLaunchParams launchParams = VKFFT_ZERO_INIT;
+			launchParams.inputBuffer = &app->bufferBluestein[axis_id];
+			launchParams.buffer = &app->bufferBluesteinIFFT[axis_id];
+			resFFT = VkFFTAppend(&kernelPreparationApplication, -1, &launchParams);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(phaseVectors);
+				deleteVkFFT(&kernelPreparationApplication);
+				return resFFT;
+			}
 #endif
 		}
 		if ((FFTPlan->numAxisUploads[axis_id] > 1) && (!app->configuration.makeForwardPlanOnly)) {
-			if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
+			if (bluesteinLUT.enabled) {
+				resFFT = VkFFT_AddChirpTable(app, &bluesteinLUT, 2 * phaseVectorsNonZeroSize, FFTPlan->actualFFTSizePerAxis[axis_id][axis_id], phaseVectorsNonZeroSize, 1);
+			}
+			else if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
 				double* phaseVectors_cast = (double*)phaseVectors;
 				for (pfUINT i = 0; i < FFTPlan->actualFFTSizePerAxis[axis_id][axis_id]; i++) {
 					phaseVectors_cast[4 * i + 2] = -phaseVectors_cast[4 * i + 2];
@@ -566,7 +642,10 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 			}
 		}
 		else {
-			if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
+			if (bluesteinLUT.enabled) {
+				resFFT = VkFFT_AddChirpTable(app, &bluesteinLUT, 2 * phaseVectorsNonZeroSize, FFTPlan->actualFFTSizePerAxis[axis_id][axis_id], phaseVectorsNonZeroSize, 1);
+			}
+			else if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
 				PfContainer in = VKFFT_ZERO_INIT;
 				PfContainer temp1 = VKFFT_ZERO_INIT;
 				in.type = 22;
@@ -621,7 +700,12 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 				}
 			}
 		}
-		resFFT = VkFFT_TransferDataFromCPU(app, phaseVectors, &app->bufferBluestein[axis_id], bufferSize);
+		if (bluesteinLUT.enabled)
+			resFFT = VkFFT_GenerateDeviceLUT(app, &bluesteinLUT, &app->bufferBluestein[axis_id], bufferSize);
+		else
+			resFFT = VkFFT_TransferDataFromCPU(app, phaseVectors, &app->bufferBluestein[axis_id], bufferSize);
+		//the chirp is transformed on the device right away
+		if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_FlushUploads(app);
 		if (resFFT != VKFFT_SUCCESS) {
 			free(phaseVectors);
 			deleteVkFFT(&kernelPreparationApplication);
@@ -970,6 +1054,27 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 			commandEncoder->release();
 			commandBuffer->release();
 		}
+#elif(VKFFT_BACKEND==6)
+		VkFFTLaunchParams launchParams = VKFFT_ZERO_INIT;
+		launchParams.inputBuffer = &app->bufferBluestein[axis_id];
+		if (!app->configuration.makeInversePlanOnly) {
+			launchParams.buffer = &app->bufferBluesteinFFT[axis_id];
+			resFFT = VkFFTAppend(&kernelPreparationApplication, -1, &launchParams);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(phaseVectors);
+				deleteVkFFT(&kernelPreparationApplication);
+				return resFFT;
+			}
+		}
+		if ((FFTPlan->numAxisUploads[axis_id] == 1) && (!app->configuration.makeForwardPlanOnly)) {
+			launchParams.buffer = &app->bufferBluesteinIFFT[axis_id];
+			resFFT = VkFFTAppend(&kernelPreparationApplication, 1, &launchParams);
+			if (resFFT != VKFFT_SUCCESS) {
+				free(phaseVectors);
+				deleteVkFFT(&kernelPreparationApplication);
+				return resFFT;
+			}
+		}
 #endif
 #if(VKFFT_BACKEND==0)
 		kernelPreparationApplication.configuration.isCompilerInitialized = 0;
@@ -991,8 +1096,70 @@ static inline VkFFTResult VkFFTGeneratePhaseVectors(VkFFTApplication* app, VkFFT
 #ifdef VkFFT_use_FP128_Bluestein_RaderFFT
 	}
 #endif
+	if ((app->configuration.shareLUT) && (!app->configuration.workspace)) {
+		resFFT = VkFFT_FlushUploads(app);
+		if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_RegisterSharedBluestein(app, FFTPlan, axis_id);
+	}
 	return resFFT;
 }
+static inline VkFFTResult VkFFT_HostRaderFFTKernel(VkFFTApplication* app, VkFFTAxis* axis, void* raderFFTkernel, pfUINT size) {
+	//forward DFT of the Rader kernel computed on the host in dryRun mode, in place of the FFT done by a separate application on the device
+	pfLD double_PI = pfFPinit("3.14159265358979323846264338327950288419716939937510");
+	pfUINT isQuad = (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory);
+	pfUINT isDouble = (app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory);
+	pfLD* input = (pfLD*)malloc(size * sizeof(pfLD) * 4);
+	if (!input) return VKFFT_ERROR_MALLOC_FAILED;
+	pfLD* twiddles = input + 2 * size;
+	for (pfUINT j = 0; j < size; j++) {
+		if (isQuad) {
+			input[2 * j] = (pfLD)((double*)raderFFTkernel)[4 * j] + (pfLD)((double*)raderFFTkernel)[4 * j + 1];
+			input[2 * j + 1] = (pfLD)((double*)raderFFTkernel)[4 * j + 2] + (pfLD)((double*)raderFFTkernel)[4 * j + 3];
+		}
+		else if (isDouble) {
+			input[2 * j] = (pfLD)((double*)raderFFTkernel)[2 * j];
+			input[2 * j + 1] = (pfLD)((double*)raderFFTkernel)[2 * j + 1];
+		}
+		else {
+			input[2 * j] = (pfLD)((float*)raderFFTkernel)[2 * j];
+			input[2 * j + 1] = (pfLD)((float*)raderFFTkernel)[2 * j + 1];
+		}
+		twiddles[2 * j] = pfcos(2 * double_PI * j / size);
+		twiddles[2 * j + 1] = -pfsin(2 * double_PI * j / size);
+	}
+	PfContainer in = VKFFT_ZERO_INIT;
+	PfContainer temp1 = VKFFT_ZERO_INIT;
+	in.type = 22;
+	for (pfUINT k = 0; k < size; k++) {
+		pfLD re = 0;
+		pfLD im = 0;
+		for (pfUINT j = 0; j < size; j++) {
+			pfUINT id = (j * k) % size;
+			re += input[2 * j] * twiddles[2 * id] - input[2 * j + 1] * twiddles[2 * id + 1];
+			im += input[2 * j] * twiddles[2 * id + 1] + input[2 * j + 1] * twiddles[2 * id];
+		}
+		if (isQuad) {
+			in.data.d = re;
+			PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
+			((double*)raderFFTkernel)[4 * k] = (double)temp1.data.dd[0].data.d;
+			((double*)raderFFTkernel)[4 * k + 1] = (double)temp1.data.dd[1].data.d;
+			in.data.d = im;
+			PfConvToDoubleDouble(&axis->specializationConstants, &temp1, &in);
+			((double*)raderFFTkernel)[4 * k + 2] = (double)temp1.data.dd[0].data.d;
+			((double*)raderFFTkernel)[4 * k + 3] = (double)temp1.data.dd[1].data.d;
+		}
+		else if (isDouble) {
+			((double*)raderFFTkernel)[2 * k] = (double)re;
+			((double*)raderFFTkernel)[2 * k + 1] = (double)im;
+		}
+		else {
+			((float*)raderFFTkernel)[2 * k] = (float)re;
+			((float*)raderFFTkernel)[2 * k + 1] = (float)im;
+		}
+	}
+	PfDeallocateContainer(&axis->specializationConstants, &temp1);
+	free(input);
+	return VKFFT_SUCCESS;
+}
 static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkFFTAxis* axis) {
 	//generate Rader FFTKernel
 	VkFFTResult resFFT = VKFFT_SUCCESS;
@@ -1102,6 +1269,11 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 						raderFFTkernel[2 * j + 1] = (float)(-pfsin(2.0 * g_pow * double_PI / axis->specializationConstants.raderContainer[i].prime));
 					}
 				}
+				if (app->configuration.dryRun) {
+					resFFT = VkFFT_HostRaderFFTKernel(app, axis, axis->specializationConstants.raderContainer[i].raderFFTkernel, axis->specializationConstants.raderContainer[i].prime - 1);
+					if (resFFT != VKFFT_SUCCESS) return resFFT;
+					continue;
+				}
 
 				VkFFTApplication kernelPreparationApplication = VKFFT_ZERO_INIT;
 				VkFFTConfiguration kernelPreparationConfiguration = VKFFT_ZERO_INIT;
@@ -1117,8 +1289,15 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 				kernelPreparationConfiguration.fixMinRaderPrimeMult = 17;
 				kernelPreparationConfiguration.fixMaxRaderPrimeFFT = 17;
 				kernelPreparationConfiguration.fixMaxRaderPrimeMult = 17;
+				kernelPreparationConfiguration.kernelCacheDirectory = app->configuration.kernelCacheDirectory;
+				kernelPreparationConfiguration.kernelCacheMaxSize = app->configuration.kernelCacheMaxSize;
+				kernelPreparationConfiguration.numCompileThreads = app->configuration.numCompileThreads;
+				kernelPreparationConfiguration.compileTaskExecutor = app->configuration.compileTaskExecutor;
+				kernelPreparationConfiguration.compileTaskExecutorData = app->configuration.compileTaskExecutorData;
 
+#if(VKFFT_BACKEND!=6)
 				kernelPreparationConfiguration.device = app->configuration.device;
+#endif
 #if(VKFFT_BACKEND==0)
 				kernelPreparationConfiguration.queue = app->configuration.queue; //to allocate memory for LUT, we have to pass a queue, vkGPU->fence, commandPool and physicalDevice pointers 
 				kernelPreparationConfiguration.fence = app->configuration.fence;
@@ -1136,6 +1315,10 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 #elif(VKFFT_BACKEND==5)
 				kernelPreparationConfiguration.device = app->configuration.device;
 				kernelPreparationConfiguration.queue = app->configuration.queue;
+#elif(VKFFT_BACKEND==6)
+				kernelPreparationConfiguration.numCPUThreads = app->configuration.numCPUThreads;
+				kernelPreparationConfiguration.cpuCompilerCommand = app->configuration.cpuCompilerCommand;
+				kernelPreparationConfiguration.cpuTemporaryDirectory = app->configuration.cpuTemporaryDirectory;
 #endif			
 
 				pfUINT bufferSize = (pfUINT)sizeof(float) * 2 * kernelPreparationConfiguration.size[0] * kernelPreparationConfiguration.size[1] * kernelPreparationConfiguration.size[2];
@@ -1159,6 +1342,8 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 				void* bufferRaderFFT;
 #elif(VKFFT_BACKEND==5)
 				MTL::Buffer* bufferRaderFFT;
+#elif(VKFFT_BACKEND==6)
+				void* bufferRaderFFT;
 #endif
 #if(VKFFT_BACKEND==0)
 				VkResult res = VK_SUCCESS;
@@ -1186,9 +1371,13 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 				if (res != ZE_RESULT_SUCCESS) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
 #elif(VKFFT_BACKEND==5)
 				bufferRaderFFT = app->configuration.device->newBuffer(bufferSize, MTL::ResourceStorageModePrivate);
+#elif(VKFFT_BACKEND==6)
+				bufferRaderFFT = malloc(bufferSize);
+				if (!bufferRaderFFT) return VKFFT_ERROR_FAILED_TO_ALLOCATE;
 #endif
 
 				resFFT = VkFFT_TransferDataFromCPU(app, axis->specializationConstants.raderContainer[i].raderFFTkernel, &bufferRaderFFT, bufferSize);
+				if (resFFT == VKFFT_SUCCESS) resFFT = VkFFT_FlushUploads(app);
 				if (resFFT != VKFFT_SUCCESS) {
 					free(axis->specializationConstants.raderContainer[i].raderFFTkernel);
 					deleteVkFFT(&kernelPreparationApplication);
@@ -1360,6 +1549,15 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 				commandBuffer->waitUntilCompleted();
 				commandEncoder->release();
 				commandBuffer->release();
+#elif(VKFFT_BACKEND==6)
+				VkFFTLaunchParams launchParams = VKFFT_ZERO_INIT;
+				launchParams.buffer = &bufferRaderFFT;
+				resFFT = VkFFTAppend(&kernelPreparationApplication, -1, &launchParams);
+				if (resFFT != VKFFT_SUCCESS) {
+					free(axis->specializationConstants.raderContainer[i].raderFFTkernel);
+					deleteVkFFT(&kernelPreparationApplication);
+					return resFFT;
+				}
 #endif
 				resFFT = VkFFT_TransferDataToCPU(&kernelPreparationApplication, axis->specializationConstants.raderContainer[i].raderFFTkernel, &bufferRaderFFT, bufferSize);
 				if (resFFT != VKFFT_SUCCESS) {
@@ -1387,12 +1585,13 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 				zeMemFree(app->configuration.context[0], bufferRaderFFT);
 #elif(VKFFT_BACKEND==5)
 				bufferRaderFFT->release();
+#elif(VKFFT_BACKEND==6)
+				free(bufferRaderFFT);
 #endif
 				deleteVkFFT(&kernelPreparationApplication);
 			}
 		}
 		if (app->configuration.loadApplicationFromString) {
-			pfUINT offset = 0;
 			for (pfUINT i = 0; i < app->numRaderFFTPrimes; i++) {
 				pfUINT current_size = 0;
 				if (app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory) {
@@ -1405,15 +1604,19 @@ static inline VkFFTResult VkFFTGenerateRaderFFTKernel(VkFFTApplication* app, VkF
 					current_size = (app->rader_primes[i] - 1) * sizeof(float) * 2;
 				}
 				if (!app->raderFFTkernel[i]) {
+					pfUINT offset = 0;
+					pfUINT size = 0;
+					resFFT = VkFFT_FindApplicationStringEntry(app, VkFFT_GetApplicationStringKey(VKFFT_APPLICATION_STRING_RADER_KERNEL, 0, 0, app->rader_primes[i]), &offset, &size);
+					if (resFFT != VKFFT_SUCCESS) return resFFT;
+					if (size != current_size) return VKFFT_ERROR_MISMATCHING_applicationString;
 					app->raderFFTkernel[i] = (void*)malloc(current_size);
 					if (!app->raderFFTkernel[i]) return VKFFT_ERROR_MALLOC_FAILED;
-					memcpy(app->raderFFTkernel[i], (char*)app->configuration.loadApplicationString + app->applicationStringOffsetRader + offset, current_size);
+					memcpy(app->raderFFTkernel[i], (char*)app->configuration.loadApplicationString + offset, current_size);
 				}
 				for (pfUINT j = 0; j < axis->specializationConstants.numRaderPrimes; j++) {
 					if ((app->rader_primes[i] == axis->specializationConstants.raderContainer[j].prime) && (axis->specializationConstants.raderContainer[j].type == 0))
 						axis->specializationConstants.raderContainer[j].raderFFTkernel = app->raderFFTkernel[i];
 				}
-				offset += current_size;
 			}
 		}
 	}
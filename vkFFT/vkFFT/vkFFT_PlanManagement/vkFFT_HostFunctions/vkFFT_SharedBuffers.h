@@ -0,0 +1,343 @@
+// This file is part of VkFFT
+//
+// Copyright (C) 2021 - present Dmitrii Tolmachev <dtolm96@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef VKFFT_SHAREDBUFFERS_H
+#define VKFFT_SHAREDBUFFERS_H
+#include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_Hash.h"
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// Reference-counted registry of read-only LUT and Bluestein buffers, used if shareLUT is enabled. Applications created on the same device/context
+// with identical LUT contents (LUTs are keyed by the hash of the data, which covers precision, FFT length and stage decomposition) or identical
+// Bluestein parameters reuse one set of buffers, which is freed when the last application that uses it is deleted.
+// The registry is a static variable of this header, so it is shared by all applications created from the same translation unit.
+
+#define VKFFT_SHARED_BUFFER_LUT 0
+#define VKFFT_SHARED_BUFFER_BLUESTEIN 1
+
+typedef struct {
+	pfUINT key;
+	pfUINT checkHash;//second hash with a different seed guards against key collisions
+	pfUINT refCount;
+#if(VKFFT_BACKEND==0)
+	VkBuffer buffer[3];
+	VkDeviceMemory deviceMemory[3];
+#elif(VKFFT_BACKEND==1)
+	void* buffer[3];
+#elif(VKFFT_BACKEND==2)
+	void* buffer[3];
+#elif(VKFFT_BACKEND==3)
+	cl_mem buffer[3];
+#elif(VKFFT_BACKEND==4)
+	void* buffer[3];
+#elif(VKFFT_BACKEND==5)
+	MTL::Buffer* buffer[3];
+#elif(VKFFT_BACKEND==6)
+	void* buffer[3];
+#endif
+} VkFFTSharedBuffers;
+
+typedef struct {
+	VkFFTSharedBuffers* entries;
+	pfUINT numEntries;
+	pfUINT maxEntries;
+#ifdef _WIN32
+	SRWLOCK lock;
+#else
+	pthread_mutex_t lock;
+#endif
+} VkFFTSharedBufferRegistry;
+
+static inline VkFFTSharedBufferRegistry* VkFFT_LockSharedBufferRegistry() {
+#ifdef _WIN32
+	static VkFFTSharedBufferRegistry registry = { 0, 0, 0, SRWLOCK_INIT };
+	AcquireSRWLockExclusive(&registry.lock);
+#else
+	static VkFFTSharedBufferRegistry registry = { 0, 0, 0, PTHREAD_MUTEX_INITIALIZER };
+	pthread_mutex_lock(&registry.lock);
+#endif
+	return &registry;
+}
+
+static inline void VkFFT_UnlockSharedBufferRegistry(VkFFTSharedBufferRegistry* registry) {
+	if (registry->numEntries == 0) {
+		free(registry->entries);
+		registry->entries = 0;
+		registry->maxEntries = 0;
+	}
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&registry->lock);
+#else
+	pthread_mutex_unlock(&registry->lock);
+#endif
+}
+
+static inline void VkFFT_GetSharedBuffersKey(VkFFTApplication* app, pfUINT type, const void* data, pfUINT dataSize, VkFFTSharedBuffers* sharedBuffers) {
+	pfUINT hash = VkFFT_HashUint(0xCBF29CE484222325, type);
+#if(VKFFT_BACKEND==0)
+	hash = VkFFT_HashBytes(hash, &app->configuration.device[0], sizeof(VkDevice));
+#elif(VKFFT_BACKEND==1)
+	CUcontext context = 0;
+	cuCtxGetCurrent(&context);
+	hash = VkFFT_HashBytes(hash, &app->configuration.device[0], sizeof(CUdevice));
+	hash = VkFFT_HashBytes(hash, &context, sizeof(CUcontext));
+#elif(VKFFT_BACKEND==2)
+	hash = VkFFT_HashBytes(hash, &app->configuration.device[0], sizeof(hipDevice_t));
+#elif(VKFFT_BACKEND==3)
+	hash = VkFFT_HashBytes(hash, &app->configuration.device[0], sizeof(cl_device_id));
+	hash = VkFFT_HashBytes(hash, &app->configuration.context[0], sizeof(cl_context));
+#elif(VKFFT_BACKEND==4)
+	hash = VkFFT_HashBytes(hash, &app->configuration.device[0], sizeof(ze_device_handle_t));
+	hash = VkFFT_HashBytes(hash, &app->configuration.context[0], sizeof(ze_context_handle_t));
+#elif(VKFFT_BACKEND==5)
+	hash = VkFFT_HashBytes(hash, &app->configuration.device, sizeof(MTL::Device*));
+#elif(VKFFT_BACKEND==6)
+	//host memory is shared by all applications of the process
+#endif
+	sharedBuffers->key = VkFFT_HashBytes(VkFFT_HashUint(hash, dataSize), data, dataSize);
+	sharedBuffers->checkHash = VkFFT_HashBytes(VkFFT_HashUint(0x84222325CBF29CE4, hash), data, dataSize);
+}
+
+static inline void VkFFT_FreeSharedBuffers(VkFFTApplication* app, VkFFTSharedBuffers* sharedBuffers) {
+	for (int i = 0; i < 3; i++) {
+#if(VKFFT_BACKEND==0)
+		if (sharedBuffers->buffer[i] != 0) vkDestroyBuffer(app->configuration.device[0], sharedBuffers->buffer[i], 0);
+		if (sharedBuffers->deviceMemory[i] != 0) vkFreeMemory(app->configuration.device[0], sharedBuffers->deviceMemory[i], 0);
+		sharedBuffers->deviceMemory[i] = 0;
+#elif(VKFFT_BACKEND==1)
+		if (sharedBuffers->buffer[i] != 0) cudaFree(sharedBuffers->buffer[i]);
+#elif(VKFFT_BACKEND==2)
+		if (sharedBuffers->buffer[i] != 0) hipFree(sharedBuffers->buffer[i]);
+#elif(VKFFT_BACKEND==3)
+		if (sharedBuffers->buffer[i] != 0) clReleaseMemObject(sharedBuffers->buffer[i]);
+#elif(VKFFT_BACKEND==4)
+		if (sharedBuffers->buffer[i] != 0) zeMemFree(app->configuration.context[0], sharedBuffers->buffer[i]);
+#elif(VKFFT_BACKEND==5)
+		if (sharedBuffers->buffer[i] != 0) sharedBuffers->buffer[i]->release();
+#elif(VKFFT_BACKEND==6)
+		if (sharedBuffers->buffer[i] != 0) free(sharedBuffers->buffer[i]);
+#endif
+		sharedBuffers->buffer[i] = 0;
+	}
+}
+
+static inline pfUINT VkFFT_AcquireSharedBuffers(VkFFTSharedBuffers* sharedBuffers) {
+	//copies buffers of a registered entry with the same key to sharedBuffers and returns 1, returns 0 if there is none
+	pfUINT found = 0;
+	VkFFTSharedBufferRegistry* registry = VkFFT_LockSharedBufferRegistry();
+	for (pfUINT i = 0; i < registry->numEntries; i++) {
+		if ((registry->entries[i].key == sharedBuffers->key) && (registry->entries[i].checkHash == sharedBuffers->checkHash)) {
+			registry->entries[i].refCount++;
+			sharedBuffers[0] = registry->entries[i];
+			found = 1;
+			break;
+		}
+	}
+	VkFFT_UnlockSharedBufferRegistry(registry);
+	return found;
+}
+
+static inline VkFFTResult VkFFT_RegisterSharedBuffers(VkFFTApplication* app, VkFFTSharedBuffers* sharedBuffers) {
+	//adds newly created buffers to the registry. If another application has registered the same key in the meantime, the new buffers are freed and replaced with the registered ones
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTSharedBufferRegistry* registry = VkFFT_LockSharedBufferRegistry();
+	for (pfUINT i = 0; i < registry->numEntries; i++) {
+		if ((registry->entries[i].key == sharedBuffers->key) && (registry->entries[i].checkHash == sharedBuffers->checkHash)) {
+			VkFFT_FreeSharedBuffers(app, sharedBuffers);
+			registry->entries[i].refCount++;
+			sharedBuffers[0] = registry->entries[i];
+			VkFFT_UnlockSharedBufferRegistry(registry);
+			return resFFT;
+		}
+	}
+	if (registry->numEntries == registry->maxEntries) {
+		pfUINT maxEntries = (registry->maxEntries) ? 2 * registry->maxEntries : 16;
+		VkFFTSharedBuffers* entries = (VkFFTSharedBuffers*)realloc(registry->entries, maxEntries * sizeof(VkFFTSharedBuffers));
+		if (!entries) {
+			VkFFT_UnlockSharedBufferRegistry(registry);
+			return VKFFT_ERROR_MALLOC_FAILED;
+		}
+		registry->entries = entries;
+		registry->maxEntries = maxEntries;
+	}
+	sharedBuffers->refCount = 1;
+	registry->entries[registry->numEntries] = sharedBuffers[0];
+	registry->numEntries++;
+	VkFFT_UnlockSharedBufferRegistry(registry);
+	return resFFT;
+}
+
+static inline void VkFFT_ReleaseSharedBuffers(VkFFTApplication* app, VkFFTSharedBuffers* sharedBuffers) {
+	//entries are identified by their first buffer, buffers are freed when the last reference is released
+	VkFFTSharedBufferRegistry* registry = VkFFT_LockSharedBufferRegistry();
+	for (pfUINT i = 0; i < registry->numEntries; i++) {
+		if (registry->entries[i].buffer[0] == sharedBuffers->buffer[0]) {
+			registry->entries[i].refCount--;
+			if (registry->entries[i].refCount == 0) {
+				VkFFT_FreeSharedBuffers(app, &registry->entries[i]);
+				registry->entries[i] = registry->entries[registry->numEntries - 1];
+				registry->numEntries--;
+			}
+			break;
+		}
+	}
+	VkFFT_UnlockSharedBufferRegistry(registry);
+}
+
+static inline void VkFFT_GetSharedLUTKey(VkFFTApplication* app, VkFFTAxis* axis, const void* tempLUT, pfUINT tempLUTSize, const VkFFTLUTTable* deviceTables, pfUINT numDeviceTables, VkFFTSharedBuffers* sharedBuffers) {
+	//tempLUT holds the first tempLUTSize bytes of the LUT, the rest is described by the tables generated on the device
+	VkFFT_GetSharedBuffersKey(app, VKFFT_SHARED_BUFFER_LUT, tempLUT, tempLUTSize, sharedBuffers);
+	if (numDeviceTables) {
+		sharedBuffers->key = VkFFT_HashBytes(VkFFT_HashUint(sharedBuffers->key, axis->bufferLUTSize), deviceTables, numDeviceTables * sizeof(VkFFTLUTTable));
+		sharedBuffers->checkHash = VkFFT_HashBytes(VkFFT_HashUint(sharedBuffers->checkHash, axis->bufferLUTSize), deviceTables, numDeviceTables * sizeof(VkFFTLUTTable));
+	}
+}
+
+static inline void VkFFT_AcquireSharedLUT(VkFFTApplication* app, VkFFTAxis* axis, const void* tempLUT, pfUINT tempLUTSize, const VkFFTLUTTable* deviceTables, pfUINT numDeviceTables) {
+	VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+	VkFFT_GetSharedLUTKey(app, axis, tempLUT, tempLUTSize, deviceTables, numDeviceTables, &sharedBuffers);
+	if (VkFFT_AcquireSharedBuffers(&sharedBuffers)) {
+		axis->bufferLUT = sharedBuffers.buffer[0];
+#if(VKFFT_BACKEND==0)
+		axis->bufferLUTDeviceMemory = sharedBuffers.deviceMemory[0];
+#endif
+		axis->sharedLUT = 1;
+	}
+}
+
+static inline VkFFTResult VkFFT_RegisterSharedLUT(VkFFTApplication* app, VkFFTAxis* axis, const void* tempLUT, pfUINT tempLUTSize, const VkFFTLUTTable* deviceTables, pfUINT numDeviceTables) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+	VkFFT_GetSharedLUTKey(app, axis, tempLUT, tempLUTSize, deviceTables, numDeviceTables, &sharedBuffers);
+	sharedBuffers.buffer[0] = axis->bufferLUT;
+#if(VKFFT_BACKEND==0)
+	sharedBuffers.deviceMemory[0] = axis->bufferLUTDeviceMemory;
+#endif
+	resFFT = VkFFT_RegisterSharedBuffers(app, &sharedBuffers);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	axis->bufferLUT = sharedBuffers.buffer[0];
+#if(VKFFT_BACKEND==0)
+	axis->bufferLUTDeviceMemory = sharedBuffers.deviceMemory[0];
+#endif
+	axis->sharedLUT = 1;
+	return resFFT;
+}
+
+static inline void VkFFT_ReleaseSharedLUT(VkFFTApplication* app, VkFFTAxis* axis) {
+	VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+	sharedBuffers.buffer[0] = axis->bufferLUT;
+	VkFFT_ReleaseSharedBuffers(app, &sharedBuffers);
+	axis->bufferLUT = 0;
+#if(VKFFT_BACKEND==0)
+	axis->bufferLUTDeviceMemory = 0;
+#endif
+	axis->sharedLUT = 0;
+}
+
+static inline void VkFFT_GetSharedBluesteinKey(VkFFTApplication* app, VkFFTPlan* FFTPlan, pfUINT axis_id, VkFFTSharedBuffers* sharedBuffers) {
+	//everything that changes the contents of bufferBluestein, bufferBluesteinFFT and bufferBluesteinIFFT
+	pfUINT parameters[] = {
+		FFTPlan->actualFFTSizePerAxis[axis_id][axis_id], app->bufferBluesteinSize[axis_id], app->configuration.size[axis_id], app->configuration.performDCT, app->configuration.performDST, (pfUINT)((FFTPlan->bigSequenceEvenR2C) && (axis_id == 0)),
+		(pfUINT)(FFTPlan->numAxisUploads[axis_id] > 1), (pfUINT)(axis_id > 0),
+		(pfUINT)(app->configuration.doublePrecision || app->configuration.doublePrecisionFloatMemory), (pfUINT)(app->configuration.quadDoubleDoublePrecision || app->configuration.quadDoubleDoublePrecisionDoubleMemory),
+		app->configuration.makeForwardPlanOnly, app->configuration.makeInversePlanOnly, app->configuration.generateLUTOnDevice,
+	};
+	VkFFT_GetSharedBuffersKey(app, VKFFT_SHARED_BUFFER_BLUESTEIN, parameters, sizeof(parameters), sharedBuffers);
+}
+
+static inline void VkFFT_SetSharedBluestein(VkFFTApplication* app, pfUINT axis_id, VkFFTSharedBuffers* sharedBuffers) {
+	app->bufferBluestein[axis_id] = sharedBuffers->buffer[0];
+	app->bufferBluesteinFFT[axis_id] = sharedBuffers->buffer[1];
+	app->bufferBluesteinIFFT[axis_id] = sharedBuffers->buffer[2];
+#if(VKFFT_BACKEND==0)
+	app->bufferBluesteinDeviceMemory[axis_id] = sharedBuffers->deviceMemory[0];
+	app->bufferBluesteinFFTDeviceMemory[axis_id] = sharedBuffers->deviceMemory[1];
+	app->bufferBluesteinIFFTDeviceMemory[axis_id] = sharedBuffers->deviceMemory[2];
+#endif
+}
+
+static inline pfUINT VkFFT_AcquireSharedBluestein(VkFFTApplication* app, VkFFTPlan* FFTPlan, pfUINT axis_id) {
+	VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+	VkFFT_GetSharedBluesteinKey(app, FFTPlan, axis_id, &sharedBuffers);
+	if (!VkFFT_AcquireSharedBuffers(&sharedBuffers)) return 0;
+	VkFFT_SetSharedBluestein(app, axis_id, &sharedBuffers);
+	app->sharedBluestein[axis_id] = 1;
+	return 1;
+}
+
+static inline VkFFTResult VkFFT_RegisterSharedBluestein(VkFFTApplication* app, VkFFTPlan* FFTPlan, pfUINT axis_id) {
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+	VkFFT_GetSharedBluesteinKey(app, FFTPlan, axis_id, &sharedBuffers);
+	sharedBuffers.buffer[0] = app->bufferBluestein[axis_id];
+	sharedBuffers.buffer[1] = app->bufferBluesteinFFT[axis_id];
+	sharedBuffers.buffer[2] = app->bufferBluesteinIFFT[axis_id];
+#if(VKFFT_BACKEND==0)
+	sharedBuffers.deviceMemory[0] = app->bufferBluesteinDeviceMemory[axis_id];
+	sharedBuffers.deviceMemory[1] = app->bufferBluesteinFFTDeviceMemory[axis_id];
+	sharedBuffers.deviceMemory[2] = app->bufferBluesteinIFFTDeviceMemory[axis_id];
+#endif
+	resFFT = VkFFT_RegisterSharedBuffers(app, &sharedBuffers);
+	if (resFFT != VKFFT_SUCCESS) return resFFT;
+	VkFFT_SetSharedBluestein(app, axis_id, &sharedBuffers);
+	app->sharedBluestein[axis_id] = 1;
+	return resFFT;
+}
+
+static inline VkFFTResult VkFFT_ShareApplicationBluestein(VkFFTApplication* app) {
+	//registers Bluestein buffers of an application created without shareLUT, so an application with the same Bluestein parameters can acquire them.
+	//Buffers are only registered if no other application has registered identical ones, as kernels of app may already reference them
+	VkFFTResult resFFT = VKFFT_SUCCESS;
+	VkFFTPlan* FFTPlan = (app->configuration.makeInversePlanOnly) ? app->localFFTPlan_inverse : app->localFFTPlan;
+	if ((FFTPlan == 0) || (app->configuration.workspace)) return resFFT;
+	for (pfUINT i = 0; i < app->configuration.FFTdim; i++) {
+		if ((!app->useBluesteinFFT[i]) || (app->sharedBluestein[i]) || (app->bufferBluestein[i] == 0)) continue;
+		VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+		VkFFT_GetSharedBluesteinKey(app, FFTPlan, i, &sharedBuffers);
+		if (VkFFT_AcquireSharedBuffers(&sharedBuffers)) {
+			VkFFT_ReleaseSharedBuffers(app, &sharedBuffers);
+			continue;
+		}
+		resFFT = VkFFT_RegisterSharedBluestein(app, FFTPlan, i);
+		if (resFFT != VKFFT_SUCCESS) return resFFT;
+	}
+	return resFFT;
+}
+
+static inline void VkFFT_ReleaseSharedBluestein(VkFFTApplication* app, pfUINT axis_id) {
+	VkFFTSharedBuffers sharedBuffers = VKFFT_ZERO_INIT;
+	sharedBuffers.buffer[0] = app->bufferBluestein[axis_id];
+	VkFFT_ReleaseSharedBuffers(app, &sharedBuffers);
+	sharedBuffers.buffer[0] = 0;
+	VkFFT_SetSharedBluestein(app, axis_id, &sharedBuffers);
+	app->sharedBluestein[axis_id] = 0;
+}
+#endif
@@ -26,8 +26,10 @@
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_ManageMemory.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_InitAPIParameters.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_CompileKernel.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CompileJobs.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_ManageLUT.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_AxisBlockSplitter.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanProfile.h"
 #include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel2/vkFFT_FFT.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
 static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPlan, pfUINT axis_id, pfUINT axis_upload_id, pfUINT inverse, pfUINT reverseBluesteinMultiUpload) {
@@ -46,13 +48,16 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 #elif(VKFFT_BACKEND==5)
 #endif
 	VkFFTAxis* axis = (reverseBluesteinMultiUpload) ? &FFTPlan->inverseBluesteinAxes[axis_id][axis_upload_id] : &FFTPlan->axes[axis_id][axis_upload_id];
+	axis->applicationStringKey = VkFFT_GetApplicationStringKey((reverseBluesteinMultiUpload) ? VKFFT_APPLICATION_STRING_INVERSE_BLUESTEIN_AXIS : VKFFT_APPLICATION_STRING_AXIS, inverse, axis_id, axis_upload_id);
+	double profileStart = VkFFT_ProfileStart(app);
+	VkFFT_BeginAxisUploadProfile(app, axis, inverse, axis_id, axis_upload_id, reverseBluesteinMultiUpload);
 
 	axis->specializationConstants.sourceFFTSize.type = 31;
 	axis->specializationConstants.sourceFFTSize.data.i = app->configuration.size[axis_id];
 	axis->specializationConstants.axis_id = (int)axis_id;
 	axis->specializationConstants.axis_upload_id = (int)axis_upload_id;
     axis->specializationConstants.numFFTdims = (int)app->configuration.FFTdim;
-	if ((app->configuration.FFTdim == 1) && (FFTPlan->actualFFTSizePerAxis[axis_id][1] == 1) && ((app->configuration.numberBatches > 1) || (app->actualNumBatches > 1)) && (!app->configuration.performConvolution) && (app->configuration.coordinateFeatures == 1)) {
+	if ((app->configuration.FFTdim == 1) && (FFTPlan->actualFFTSizePerAxis[axis_id][1] == 1) && ((app->configuration.numberBatches > 1) || (app->actualNumBatches > 1)) && (!app->configuration.performConvolution) && (app->configuration.coordinateFeatures == 1) && (!app->configuration.specifyBatchesAtLaunch)) {
 		if (app->configuration.numberBatches > 1) {
 			app->actualNumBatches = app->configuration.numberBatches;
 			app->configuration.numberBatches = 1;
@@ -228,6 +233,7 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 		app->configuration.allocateTempBuffer = 1;
 	}
 	//generate Rader Kernels
+	double lutStart = VkFFT_ProfileStart(app);
 	resFFT = VkFFTGenerateRaderFFTKernel(app, axis);
 	if (resFFT != VKFFT_SUCCESS) {
 		deleteVkFFT(app);
@@ -246,6 +252,7 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 		deleteVkFFT(app);
 		return resFFT;
 	}
+	VkFFT_ProfileAxisUploadLUT(app, axis, lutStart);
 
 	//configure strides
 
@@ -253,6 +260,7 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 	pfUINT* usedStride = app->configuration.bufferStride;
 	if ((!inverse) && (axis_id == app->firstAxis) && (axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1) && (app->configuration.isInputFormatted)) usedStride = app->configuration.inputBufferStride;
 	if ((inverse) && (axis_id == app->lastAxis) && ((axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1) && ((app->useBluesteinFFT[axis_id] && (reverseBluesteinMultiUpload == 0)) || (!app->useBluesteinFFT[axis_id])) && (!app->configuration.performConvolution)) && (app->configuration.isInputFormatted) && (!app->configuration.inverseReturnToInputBuffer)) usedStride = app->configuration.inputBufferStride;
+	axis->pushConstants.inputBatchStrideSource = VkFFT_GetBatchStrideSource(app, usedStride);
 	axisStride[0].type = 31;
 	axisStride[0].data.i = 1;
 
@@ -282,6 +290,7 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 	axisStride[app->configuration.FFTdim+1].type = 31;
 	axisStride[app->configuration.FFTdim+1].data.i = axisStride[app->configuration.FFTdim].data.i * app->configuration.coordinateFeatures;
 	if ((FFTPlan->numAxisUploads[axis_id] > 1) && ((app->useBluesteinFFT[axis_id] && (!((axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1) && (reverseBluesteinMultiUpload == 0))))) || ((!app->useBluesteinFFT[axis_id]) && (!((axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1))))) {
+		axis->pushConstants.inputBatchStrideSource = 0;
 		axisStride[0].data.i = 1;
         pfINT prevStride = axisStride[0].data.i;
         
@@ -330,11 +339,13 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 			axisStride[i].data.i /= 2;
 		}
 	}
+	axis->pushConstants.inputBatchStride = axisStride[app->configuration.FFTdim+1].data.i;
 	axisStride = axis->specializationConstants.outputStride;
 	usedStride = app->configuration.bufferStride;
 	if ((!inverse) && (axis_id == app->lastAxis) && (axis_upload_id == 0) && (app->configuration.isOutputFormatted)) usedStride = app->configuration.outputBufferStride;
 	if ((inverse) && (axis_id == app->firstAxis) && (((axis_upload_id == 0) && (!app->configuration.performConvolution)) || ((axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1) && ((reverseBluesteinMultiUpload == 1) || (app->configuration.performConvolution)))) && ((app->configuration.isOutputFormatted))) usedStride = app->configuration.outputBufferStride;
 	if ((inverse) && (axis_id == app->firstAxis) && (((axis_upload_id == 0) && (app->configuration.isInputFormatted)) || ((axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1) && (!axis->specializationConstants.reorderFourStep))) && (app->configuration.inverseReturnToInputBuffer)) usedStride = app->configuration.inputBufferStride;
+	axis->pushConstants.outputBatchStrideSource = VkFFT_GetBatchStrideSource(app, usedStride);
 
 	axisStride[0].type = 31;
 	axisStride[0].data.i = 1;
@@ -365,6 +376,7 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
     axisStride[app->configuration.FFTdim+1].type = 31;
     axisStride[app->configuration.FFTdim+1].data.i = axisStride[app->configuration.FFTdim].data.i * app->configuration.coordinateFeatures;
 	if ((FFTPlan->numAxisUploads[axis_id] > 1) && ((app->useBluesteinFFT[axis_id] && (!((axis_upload_id == FFTPlan->numAxisUploads[axis_id] - 1) && (reverseBluesteinMultiUpload == 1)))) || ((!app->useBluesteinFFT[axis_id]) && (axis_upload_id != 0)))) {
+		axis->pushConstants.outputBatchStrideSource = 0;
 		axisStride[0].data.i = 1;
         pfINT prevStride = axisStride[0].data.i;
         
@@ -415,6 +427,7 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 			axisStride[i].data.i /= 2;
 		}
 	}
+	axis->pushConstants.outputBatchStride = axisStride[app->configuration.FFTdim+1].data.i;
 
 	resFFT = VkFFTConfigureDescriptors(app, FFTPlan, axis, axis_id, axis_upload_id, inverse);
 	if (resFFT != VKFFT_SUCCESS) {
@@ -436,6 +449,8 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 		axis->specializationConstants.kernelOffset.type = 31;
 		axis->specializationConstants.kernelOffset.data.i = app->configuration.kernelOffset;
 	}
+	if ((app->configuration.specifyBatchesAtLaunch) && (app->configuration.numberBatches > 1))
+		axis->specializationConstants.performPostCompilationBatchStride = 1;
 
 	resFFT = VkFFTCheckUpdateBufferSet(app, axis, 1, 0);
 	if (resFFT != VKFFT_SUCCESS) {
@@ -672,6 +687,10 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 				axis->pushConstants.performPostCompilationKernelOffset = 1;
 				axis->pushConstants.structSize += 1;
 			}
+			if (axis->specializationConstants.performPostCompilationBatchStride) {
+				axis->pushConstants.performPostCompilationBatchStride = 1;
+				axis->pushConstants.structSize += 2;
+			}
 			if (app->configuration.useUint64)
 				axis->pushConstants.structSize *= sizeof(pfUINT);
 			else
@@ -754,41 +773,24 @@ static inline VkFFTResult VkFFTPlanAxis(VkFFTApplication* app, VkFFTPlan* FFTPla
 			return resFFT;
 		}
 
-		axis->specializationConstants.code0 = (char*)malloc(sizeof(char) * app->configuration.maxCodeLength);
-		char* code0 = axis->specializationConstants.code0;
-		if (!code0) {
+		resFFT = VkFFT_AllocateCodeBuffer(app, &axis->specializationConstants);
+		if (resFFT != VKFFT_SUCCESS) {
 			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
 #if(VKFFT_BACKEND==0)
 		sprintf(axis->VkFFTFunctionName, "main");
 #else
 		sprintf(axis->VkFFTFunctionName, "VkFFT_main");
 #endif
-		resFFT = shaderGen_FFT(&axis->specializationConstants, (int)type);
+		//generates and compiles the kernel, frees code generation parameters and swaps axis back for correct dispatch. Can be postponed for parallel compilation
+		resFFT = VkFFTAddCompileJob(app, axis, (int)type, 0);
 		if (resFFT != VKFFT_SUCCESS) {
 			deleteVkFFT(app);
 			return resFFT;
 		}
-		resFFT = VkFFT_CompileKernel(app, axis);
-		if (resFFT != VKFFT_SUCCESS) {
-			deleteVkFFT(app);
-			return resFFT;
-		}
-		if (!app->configuration.keepShaderCode) {
-			free(code0);
-			code0 = 0;
-			axis->specializationConstants.code0 = 0;
-		}
-	}
-	freeMemoryParametersAPI(app, &axis->specializationConstants);
-	freeParametersAPI(app, &axis->specializationConstants);
-	if (axis->specializationConstants.axisSwapped) {//swap back for correct dispatch
-		pfUINT temp = axis->axisBlock[1];
-		axis->axisBlock[1] = axis->axisBlock[0];
-		axis->axisBlock[0] = temp;
-		axis->specializationConstants.axisSwapped = 0;
 	}
+	VkFFT_EndAxisUploadProfile(app, axis, profileStart);
 	return resFFT;
 }
 
@@ -24,7 +24,9 @@
 #include "vkFFT/vkFFT_Structs/vkFFT_Structs.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_InitAPIParameters.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_API_handles/vkFFT_CompileKernel.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_CompileJobs.h"
 #include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_ManageLUT.h"
+#include "vkFFT/vkFFT_PlanManagement/vkFFT_HostFunctions/vkFFT_PlanProfile.h"
 #include "vkFFT/vkFFT_CodeGen/vkFFT_KernelsLevel2/vkFFT_R2C_even_decomposition.h"
 #include "vkFFT/vkFFT_AppManagement/vkFFT_DeleteApp.h"
 static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication* app, VkFFTPlan* FFTPlan, pfUINT inverse) {
@@ -42,6 +44,9 @@ static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication*
 #elif(VKFFT_BACKEND==5)
 #endif
 	VkFFTAxis* axis = &FFTPlan->R2Cdecomposition;
+	axis->applicationStringKey = VkFFT_GetApplicationStringKey(VKFFT_APPLICATION_STRING_R2C_DECOMPOSITION, inverse, 0, 0);
+	double profileStart = VkFFT_ProfileStart(app);
+	VkFFT_BeginAxisUploadProfile(app, axis, inverse, 0, 0, 2);
 	axis->specializationConstants.sourceFFTSize.type = 31;
 	axis->specializationConstants.sourceFFTSize.data.i = (pfINT)app->configuration.size[0];
     axis->specializationConstants.numFFTdims = (int)app->configuration.FFTdim;
@@ -91,25 +96,36 @@ static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication*
 	axis->specializationConstants.dispatchZactualFFTSize.type = 31;
 	axis->specializationConstants.dispatchZactualFFTSize.data.i = 1;
 	//allocate LUT
+	double lutStart = VkFFT_ProfileStart(app);
 	resFFT = VkFFT_AllocateLUT_R2C(app, FFTPlan, axis, inverse);
 	if (resFFT != VKFFT_SUCCESS) {
 		deleteVkFFT(app);
 		return resFFT;
 	}
+	VkFFT_ProfileAxisUploadLUT(app, axis, lutStart);
 	//configure strides
 	PfContainer* axisStride = axis->specializationConstants.inputStride;
 	PfContainer* usedStride = 0;
+	pfUINT batchStrideSource = 0;
 	if (app->useBluesteinFFT[0] && (FFTPlan->numAxisUploads[0] > 1)) {
-		if (inverse)
+		if (inverse) {
 			usedStride = FFTPlan->axes[0][FFTPlan->numAxisUploads[0] - 1].specializationConstants.inputStride;
-		else
+			batchStrideSource = FFTPlan->axes[0][FFTPlan->numAxisUploads[0] - 1].pushConstants.inputBatchStrideSource;
+		}
+		else {
 			usedStride = FFTPlan->inverseBluesteinAxes[0][FFTPlan->numAxisUploads[0] - 1].specializationConstants.outputStride;
+			batchStrideSource = FFTPlan->inverseBluesteinAxes[0][FFTPlan->numAxisUploads[0] - 1].pushConstants.outputBatchStrideSource;
+		}
 	}
 	else {
-		if (inverse)
+		if (inverse) {
 			usedStride = FFTPlan->axes[0][FFTPlan->numAxisUploads[0] - 1].specializationConstants.inputStride;
-		else
+			batchStrideSource = FFTPlan->axes[0][FFTPlan->numAxisUploads[0] - 1].pushConstants.inputBatchStrideSource;
+		}
+		else {
 			usedStride = FFTPlan->axes[0][0].specializationConstants.outputStride;
+			batchStrideSource = FFTPlan->axes[0][0].pushConstants.outputBatchStrideSource;
+		}
 	}
 	for (int i = 0; i < app->configuration.FFTdim+2; i++){
         axisStride[i].type = 31;
@@ -123,6 +139,10 @@ static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication*
         axisStride[i].type = 31;
         axisStride[i].data.i = usedStride[i].data.i;
     }
+	axis->pushConstants.inputBatchStride = axisStride[app->configuration.FFTdim+1].data.i;
+	axis->pushConstants.inputBatchStrideSource = batchStrideSource;
+	axis->pushConstants.outputBatchStride = axis->pushConstants.inputBatchStride;
+	axis->pushConstants.outputBatchStrideSource = batchStrideSource;
     
 	axis->specializationConstants.inverse = (int)inverse;
 	pfUINT axis_id = 0;
@@ -140,6 +160,8 @@ static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication*
 		if (app->configuration.performConvolution)
 			axis->specializationConstants.performPostCompilationKernelOffset = 1;
 	}
+	if ((app->configuration.specifyBatchesAtLaunch) && (app->configuration.numberBatches > 1))
+		axis->specializationConstants.performPostCompilationBatchStride = 1;
 
 	resFFT = VkFFTCheckUpdateBufferSet(app, axis, 1, 0);
 	if (resFFT != VKFFT_SUCCESS) {
@@ -289,6 +311,10 @@ static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication*
 				axis->pushConstants.performPostCompilationKernelOffset = 1;
 				axis->pushConstants.structSize += 1;
 			}
+			if (axis->specializationConstants.performPostCompilationBatchStride) {
+				axis->pushConstants.performPostCompilationBatchStride = 1;
+				axis->pushConstants.structSize += 2;
+			}
 			if (app->configuration.useUint64)
 				axis->pushConstants.structSize *= sizeof(pfUINT);
 			else
@@ -342,33 +368,23 @@ static inline VkFFTResult VkFFTPlanR2CMultiUploadDecomposition(VkFFTApplication*
 			return resFFT;
 		}
 
-		axis->specializationConstants.code0 = (char*)malloc(sizeof(char) * app->configuration.maxCodeLength);
-		char* code0 = axis->specializationConstants.code0;
-		if (!code0) {
+		resFFT = VkFFT_AllocateCodeBuffer(app, &axis->specializationConstants);
+		if (resFFT != VKFFT_SUCCESS) {
 			deleteVkFFT(app);
-			return VKFFT_ERROR_MALLOC_FAILED;
+			return resFFT;
 		}
 #if(VKFFT_BACKEND==0)
 		sprintf(axis->VkFFTFunctionName, "main");
 #else
 		sprintf(axis->VkFFTFunctionName, "VkFFT_main_R2C");
 #endif
-		resFFT = shaderGen_R2C_even_decomposition(&axis->specializationConstants, (int)type);
-		if (resFFT != VKFFT_SUCCESS) {
-			deleteVkFFT(app);
-			return resFFT;
-		}
-		resFFT = VkFFT_CompileKernel(app, axis);
+		resFFT = VkFFTAddCompileJob(app, axis, (int)type, 1);
 		if (resFFT != VKFFT_SUCCESS) {
 			deleteVkFFT(app);
 			return resFFT;
 		}
-		if (!app->configuration.keepShaderCode) {
-			free(code0);
-			code0 = 0;
-			axis->specializationConstants.code0 = 0;
-		}
 	}
+	VkFFT_EndAxisUploadProfile(app, axis, profileStart);
 	return resFFT;
 }
 
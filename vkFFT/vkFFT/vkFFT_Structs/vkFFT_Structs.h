@@ -90,6 +90,39 @@ struct PfContainer{
 	int size; //  bytes allcoated in name
 };
 
+#define VKFFT_MAX_DEVICE_PROFILE_PADDING_SIZES 256
+#define VKFFT_MAX_PUSH_DESCRIPTORS 32 //minimal maxPushDescriptors required by VK_KHR_push_descriptor
+typedef struct {
+	//device limits, filled from the device during initializeVkFFT. Non-zero values set by the user replace the queried ones
+	pfUINT vendorID; // 0x10DE - NVIDIA, 0x8086 - Intel, 0x1002 - AMD, etc. Selects the built-in profile of tuning parameters
+	pfUINT maxThreadsNum; // same as in VkFFTConfiguration
+	pfUINT maxComputeWorkGroupCount[3]; // same as in VkFFTConfiguration
+	pfUINT maxComputeWorkGroupSize[3]; // same as in VkFFTConfiguration
+	pfUINT sharedMemorySizeStatic; // same as in VkFFTConfiguration
+	pfUINT sharedMemorySize; // same as in VkFFTConfiguration
+	pfUINT warpSize; // same as in VkFFTConfiguration
+	pfUINT computeCapabilityMajor; // same as in VkFFTConfiguration
+	pfUINT computeCapabilityMinor; // same as in VkFFTConfiguration
+
+	//tuning parameters, filled from the built-in profile of vendorID. Non-zero values set by the user replace the built-in ones, values set in VkFFTConfiguration replace both
+	pfUINT coalescedMemory; // same as in VkFFTConfiguration
+	pfINT useLUT; // same as in VkFFTConfiguration
+	pfINT useLUT_4step; // same as in VkFFTConfiguration
+	pfUINT registerBoost; // same as in VkFFTConfiguration
+	pfUINT registerBoostNonPow2; // same as in VkFFTConfiguration
+	pfUINT registerBoost4Step; // same as in VkFFTConfiguration
+	pfUINT swapTo3Stage4Step; // same as in VkFFTConfiguration
+	pfUINT fixMinRaderPrimeMult; // same as in VkFFTConfiguration
+	pfUINT fixMaxRaderPrimeMult; // same as in VkFFTConfiguration
+	pfUINT fixMinRaderPrimeFFT; // same as in VkFFTConfiguration
+	pfUINT fixMaxRaderPrimeFFT; // same as in VkFFTConfiguration
+	pfUINT aimThreads; // same as in VkFFTConfiguration
+	pfUINT numSharedBanks; // same as in VkFFTConfiguration
+	pfUINT numBluesteinPaddingSizes; // number of elements in bluesteinPrimeSizes and bluesteinPaddedSizes, which have the same meaning as primeSizes and paddedSizes of useCustomBluesteinPaddingPattern. Replaces the vendor-based autoCustomBluesteinPaddingPattern. Default 0 - vendor-based pattern
+	pfUINT bluesteinPrimeSizes[VKFFT_MAX_DEVICE_PROFILE_PADDING_SIZES]; // described in numBluesteinPaddingSizes
+	pfUINT bluesteinPaddedSizes[VKFFT_MAX_DEVICE_PROFILE_PADDING_SIZES]; // described in numBluesteinPaddingSizes
+} VkFFTDeviceProfile;//device limits and tuning parameters used by initializeVkFFT
+
 typedef struct {
 	//WHDCN layout
 
@@ -126,6 +159,10 @@ typedef struct {
 #elif(VKFFT_BACKEND==5)
 	MTL::Device* device;
 	MTL::CommandQueue* queue;
+#elif(VKFFT_BACKEND==6)
+	pfUINT numCPUThreads;//number of threads that execute workgroups of CPU kernels, including the calling thread. Default - number of logical processors
+	const char* cpuCompilerCommand;//command used to build generated C code into a shared library, output and source file paths are appended to it. Default VKFFT_CPU_COMPILER_COMMAND
+	const char* cpuTemporaryDirectory;//directory where generated sources and libraries are written during compilation. Default - TMPDIR or /tmp (TEMP on Windows)
 #endif
 
 	//data parameters:
@@ -180,6 +217,12 @@ typedef struct {
 	MTL::Buffer** inputBuffer;//pointer to device buffer used to read data from if isInputFormatted is enabled
 	MTL::Buffer** outputBuffer;//pointer to device buffer used to read data from if isOutputFormatted is enabled
 	MTL::Buffer** kernel;//pointer to device buffer used to read kernel data from if performConvolution is enabled
+#elif(VKFFT_BACKEND==6)
+	void** buffer;//pointer to host buffer used for computations
+	void** tempBuffer;//needed if reorderFourStep is enabled to transpose the array. Same size as buffer. Default 0. Setting to non zero value enables manual user allocation
+	void** inputBuffer;//pointer to host buffer used to read data from if isInputFormatted is enabled
+	void** outputBuffer;//pointer to host buffer used to read data from if isOutputFormatted is enabled
+	void** kernel;//pointer to host buffer used to read kernel data from if performConvolution is enabled
 #endif
 	pfUINT bufferOffset;//specify if VkFFT has to offset the first element position inside the buffer. In bytes. Default 0 
 	pfUINT tempBufferOffset;//specify if VkFFT has to offset the first element position inside the temp buffer. In bytes. Default 0 
@@ -187,12 +230,31 @@ typedef struct {
 	pfUINT outputBufferOffset;//specify if VkFFT has to offset the first element position inside the output buffer. In bytes. Default 0
 	pfUINT kernelOffset;//specify if VkFFT has to offset the first element position inside the kernel. In bytes. Default 0
 	pfUINT specifyOffsetsAtLaunch;//specify if offsets will be selected with launch parameters VkFFTLaunchParams (0 - off, 1 - on). Default 0
+	pfUINT specifyBatchesAtLaunch;//specify if the number of batches and the distance between batches will be selected with launch parameters VkFFTLaunchParams (0 - off, 1 - on). Kernels read them from push constants, so one plan serves up to numberBatches batches. Disables dispatch lists. Doesn't work with convolutions. Default 0
+
+	//workspace: user allocated memory VkFFT sub-allocates the temp buffer (if VkFFT has to allocate it) and Bluestein buffers from, instead of allocating them. Sizes are returned by VkFFTGetWorkspaceSize
+#if(VKFFT_BACKEND==0)
+	VkDeviceMemory* workspace;//pointer to device memory, buffers are created with vkCreateBuffer and bound to it at an offset. Has to support storage buffers. Default 0 - buffers are allocated by VkFFT
+#elif((VKFFT_BACKEND==1) || (VKFFT_BACKEND==2) || (VKFFT_BACKEND==4))
+	void** workspace;//pointer to device buffer. Default 0 - buffers are allocated by VkFFT
+#elif(VKFFT_BACKEND==3)
+	cl_mem* workspace;//pointer to device buffer, buffers are created in it with clCreateSubBuffer. Default 0 - buffers are allocated by VkFFT
+#elif(VKFFT_BACKEND==5)
+	MTL::Heap** workspace;//pointer to a placement heap (MTL::HeapTypePlacement), buffers are created in it at an offset. Default 0 - buffers are allocated by VkFFT
+#elif(VKFFT_BACKEND==6)
+	void** workspace;//pointer to host buffer. Default 0 - buffers are allocated by VkFFT
+#endif
+	pfUINT workspaceSize;//size of workspace in bytes. Has to be set if workspace is used
+	pfUINT workspaceTempOffset;//offset of the temp buffer in workspace in bytes, multiple of VkFFTWorkspaceSize.alignment. The temp buffer only holds data during a launch, so applications that are never executed concurrently can place it at the same offset. Default 0
+	pfUINT workspaceBluesteinOffset;//offset of Bluestein buffers in workspace in bytes, multiple of VkFFTWorkspaceSize.alignment. Bluestein buffers are computed at initialization and read by every launch, so this region can't be used by other applications. Default 0
 
 	//optional: (default 0 if not stated otherwise)
 #if(VKFFT_BACKEND==0)
 	VkPipelineCache* pipelineCache;//pointer to Vulkan pipeline cache
 	VkBuffer* stagingBuffer;//pointer to the user defined staging buffer (used internally for LUT data transfers)
 	VkDeviceMemory* stagingBufferMemory;//pointer to the user defined staging buffer memory, associated with the stagingBuffer (used internally for LUT data transfers)
+	pfUINT usePushDescriptors;//bind buffers with vkCmdPushDescriptorSetKHR while recording instead of writing descriptor sets (0 - off, 1 - on). VK_KHR_push_descriptor has to be enabled on device. Kernels with more than VKFFT_MAX_PUSH_DESCRIPTORS descriptors keep using descriptor sets. Default 0
+	pfUINT descriptorSetCacheSize;//number of descriptor sets each kernel keeps for different buffer combinations. Launches with a previously used combination bind its set without descriptor writes. Default 0 - 1 set, rewritten on every buffer change
 #endif
 	pfUINT coalescedMemory;//in bytes, for Nvidia and AMD is equal to 32, Intel is equal 64, scaled for half precision. Gonna work regardles, but if specified by user correctly, the performance will be higher.
 	pfUINT aimThreads;//aim at this many threads per block. Default 128
@@ -240,9 +302,31 @@ typedef struct {
 
 	pfUINT loadApplicationFromString;//will load all binaries from loadApplicationString instead of recompiling them (must be allocated by user, must contain what saveApplicationToString call generated previously in VkFFTApplication.saveApplicationString). Currently disabled in Metal backend. (0 - off, 1 - on). Mutually exclusive with saveApplicationToString
 	void* loadApplicationString;//memory binary array through which user can load VkFFT binaries, must be provided by user if loadApplicationFromString = 1. Use rb/wb flags to load/save.
+	pfUINT loadApplicationStringSize;//size of loadApplicationString in bytes. If specified, VkFFT will check that the string is not truncated. Default 0 - not checked
 
 	pfUINT disableSetLocale;//disables all VkFFT attempts to set locale to C - user must ensure that VkFFT has C locale during the plan initialization. This option is needed for multithreading. Default 0.
 
+	const char* kernelCacheDirectory;//path to an existing directory used as a persistent cache of compiled kernels. Kernels are looked up by the hash of their code, VkFFT version, device and compiler versions before compilation and stored there after it. Ignored if loadApplicationFromString is enabled. Currently disabled in Metal backend. Default 0 - no cache
+	pfUINT kernelCacheMaxSize;//maximum size of the kernel cache directory in bytes. Least recently used kernels are removed when it is exceeded. Default 0 - unlimited
+
+	pfUINT numCompileThreads;//number of threads used to generate and compile kernels and to compute large LUTs during plan initialization. If more than 1, kernels of all axes are generated and compiled in parallel after all axes have been planned. Currently disabled in Metal backend. Default 0 - everything is done on the calling thread
+	void (*compileTaskExecutor)(void* compileTaskExecutorData, pfUINT numTasks, void (*task)(void* taskData, pfUINT taskID), void* taskData);//optional user-provided thread pool used instead of numCompileThreads for kernel compilation and LUT computation. Must call task(taskData, taskID) exactly once for every taskID < numTasks (in any order, from any threads) and return after all of them have finished. CUDA context/HIP device of the calling thread is made current on the executing threads. Default 0
+	void* compileTaskExecutorData;//user data passed to compileTaskExecutor
+	pfUINT shareLUT;//share read-only LUT and Bluestein buffers with other applications created on the same device/context. Buffers are reference-counted in a registry keyed by their contents (precision, FFT length, stage decomposition) and freed when the last application that uses them is deleted. (0 - off, 1 - on). Default 0
+	pfUINT generateLUTOnDevice;//compute large twiddle tables (4-step, DCT, R2C LUTs) and Bluestein chirp vectors with a generated kernel directly in device memory instead of computing them on the host and uploading them. Only tables with at least VKFFT_DEVICE_LUT_MIN_SIZE values are generated, as the kernel has to be compiled first. Not supported for double-double precision and with loadApplicationFromString. (0 - off, 1 - on). Default 0
+	pfUINT disableDispatchList;//recompute dispatch grids and push constants of all kernels on every VkFFTAppend call instead of replaying the dispatch lists recorded at the end of initializeVkFFT. (0 - off, 1 - on). Default 0
+	pfUINT usePlanCache;//keep binaries of initialized applications in an in-process cache keyed by device and kernel-affecting configuration parameters. Applications with the same configuration load binaries from the cache instead of compiling them and share LUT and Bluestein buffers (enables shareLUT). Thread-safe. Ignored if saveApplicationToString or loadApplicationFromString is enabled. Currently disabled in Metal backend. (0 - off, 1 - on). Default 0
+	pfUINT planCacheMaxSize;//maximum total size of binaries kept in the plan cache in bytes. Least recently used entries are removed when it is exceeded. VkFFTClearPlanCache frees the whole cache. Default 0 - unlimited
+	pfUINT autotune;//time candidate values of registerBoost, aimThreads, coalescedMemory, performBandwidthBoost, swapTo2Stage4Step, swapTo3Stage4Step, useLUT and groupedBatch that are not set by the user on the device during initializeVkFFT and keep the fastest ones. Candidate plans are executed on the user buffers, so their contents are overwritten. Skipped if wisdomFile already has an entry for this configuration or if loadApplicationFromString is enabled. (0 - off, 1 - on). Default 0
+	const char* wisdomFile;//path to a text file with tuned parameters. initializeVkFFT applies the entry matching the device and configuration to parameters that are not set by the user, autotune appends new entries to it. Default 0 - not used
+	VkFFTDeviceProfile* deviceProfile;//device limits and tuning parameters that replace the values queried from the device and the built-in vendor profiles. Only non-zero fields are used. Default 0 - not used
+	const char* deviceProfileFile;//path to a text file with a device profile, in the format written by VkFFTSaveDeviceProfile: "name value" lines with names of VkFFTDeviceProfile fields, "bluesteinPadding primeSize paddedSize" lines, # comments. Tuning parameter names can have a .half, .single, .double or .doubledouble suffix to only apply to this precision. Fields set in deviceProfile replace the ones from the file. Default 0 - not used
+	pfUINT dryRun;//device-less plan generation. Device limits are taken from deviceProfile/deviceProfileFile instead of being queried, and no API calls are made: kernels are generated but not compiled, LUTs are kept on the host and no buffers are allocated. The plan can be written with VkFFTSavePlanDescription, VkFFTAppend is not allowed. Bluestein buffers are only reported by size. Disables autotune, plan cache and application strings. (0 - off, 1 - on). Default 0
+	pfUINT hostExecutionThreshold;//maximum number of points (product of sizes, coordinateFeatures and numberBatches) for which VkFFTAppend transforms launchParams->hostBuffer on the calling thread instead of launching kernels, as launch and synchronization latency dominates tiny transforms. Supports C2C and in-place R2C in single and double precision, without convolutions, R2R, zero-padding, omitted dimensions and formatted input/output - other configurations always run on the device. Default 0 - off
+	pfUINT calibrateHostExecution;//choose between host and device execution by measuring the latency of both during initializeVkFFT, instead of using hostExecutionThreshold. Device executions are synchronized one by one on the user buffer, so its contents are overwritten. Skipped if buffer is not provided and in dryRun. (0 - off, 1 - on). Default 0
+	pfUINT profilePlanCreation;//record wall time, generated code size, binary size and allocated memory of each initializeVkFFT phase and axis upload. The report is retrieved with VkFFTGetPlanProfile. (0 - off, 1 - on). Default 0
+	pfUINT profileDispatches;//time each kernel launched by VkFFTAppend with backend timestamps (Vulkan timestamp queries, CUDA/HIP events, OpenCL profiling events, Level Zero kernel timestamps, host timer in CPU backend) and record its grid and estimated memory traffic. The report of the last VkFFTAppend call is retrieved with VkFFTGetDispatchProfile once the recorded work is submitted. OpenCL command queue has to be created with CL_QUEUE_PROFILING_ENABLE. Times are not measured in Metal backend, with num_streams > 1 and in VkFFTAppendGraph. Ignored in dryRun. (0 - off, 1 - on). Default 0
+
 	//optional Bluestein optimizations: (default 0 if not stated otherwise)
 	pfUINT fixMaxRadixBluestein;//controls the padding of sequences in Bluestein convolution. If specified, padded sequence will be made of up to fixMaxRadixBluestein primes. Default: 2 for CUDA and Vulkan/OpenCL/HIP up to 1048576 combined dimension FFT system, 7 for Vulkan/OpenCL/HIP past after. Min = 2, Max = 13.
 	pfUINT forceBluesteinSequenceSize;// force the sequence size to pad to in Bluestein's algorithm. Must be at least 2*N-1 and decomposable with primes 2-13.
@@ -250,6 +334,7 @@ typedef struct {
 											  // paddedSizes - array of lengths to pad to. paddedSizes[i] will be the padding size for all non-decomposable sequences from primeSizes[i] to primeSizes[i+1] (will use default scheme after last one) - 42, 60, 64 for primeSizes before and 37+ will use default scheme (for example). Default is vendor and API-based specified in autoCustomBluesteinPaddingPattern.
 	pfUINT* primeSizes; // described in useCustomBluesteinPaddingPattern
 	pfUINT* paddedSizes; // described in useCustomBluesteinPaddingPattern
+	const char* bluesteinPaddingFile;// path to a text file with measured padding patterns, used instead of the vendor-based autoCustomBluesteinPaddingPattern if useCustomBluesteinPaddingPattern is not set. The file has a "precision single" or "precision double" line (half precision uses single, double-double uses double) followed by "primeSize paddedSize" lines with the same meaning as primeSizes and paddedSizes. It can be generated with the Bluestein padding calibration sample (sample 22). Default 0 - not used
 
 	pfUINT fixMinRaderPrimeMult;//start direct multiplication Rader's algorithm for radix primes from this number. This means that VkFFT will inline custom Rader kernels if sequence is divisible by these primes. Default is 17, as VkFFT has kernels for 2-13. If you make it less than 13, VkFFT will switch from these kernels to Rader.
 	pfUINT fixMaxRaderPrimeMult;//switch from Mult Rader's algorithm for radix primes from this number. Current limitation for Rader is maxThreadNum/2+1, realistically you would want to switch somewhere on 30-100 range. Default is vendor-specific (currently ~40)
@@ -295,7 +380,7 @@ typedef struct {
 	pfUINT halfThreads;//Intel fix
 	pfUINT allocateTempBuffer; //buffer allocated by app automatically if needed to reorder Four step algorithm. Parameter to check if it has been allocated
 	pfUINT reorderFourStep; // unshuffle Four step algorithm. Requires tempbuffer allocation (0 - off, 1 - on). Default 1.
-	pfINT maxCodeLength; //specify how big can be buffer used for code generation (in char). Default 4000000 chars.
+	pfINT maxCodeLength; //initial size of the buffer used for code generation (in char). The buffer grows on demand and is reused between axes. Default 4000000 chars.
 	pfINT maxTempLength; //specify how big can be buffer used for intermediate string sprintfs be (in char). Default 5000 chars. If code segfaults for some reason - try increasing this number.
 	pfUINT autoCustomBluesteinPaddingPattern; // default value for useCustomBluesteinPaddingPattern
 	pfUINT useRaderUintLUT; // allocate additional LUT to store g_pow
@@ -369,14 +454,95 @@ typedef struct {
 	MTL::Buffer** inputBuffer;//pointer to array of input buffers (or one buffer) used to read data from if isInputFormatted is enabled
 	MTL::Buffer** outputBuffer;//pointer to array of output buffers (or one buffer) used for write data to if isOutputFormatted is enabled
 	MTL::Buffer** kernel;//pointer to array of kernel buffers (or one buffer) used for read kernel data from if performConvolution is enabled
+#elif(VKFFT_BACKEND==6)
+	void** buffer;//pointer to host buffer used for computations
+	void** tempBuffer;//needed if reorderFourStep is enabled to transpose the array. Same size as buffer. Default 0. Setting to non zero value enables manual user allocation
+	void** inputBuffer;//pointer to host buffer used to read data from if isInputFormatted is enabled
+	void** outputBuffer;//pointer to host buffer used to read data from if isOutputFormatted is enabled
+	void** kernel;//pointer to host buffer used to read kernel data from if performConvolution is enabled
 #endif
+	void* hostBuffer;//host-visible memory with the same layout as buffer (mapped, unified or host memory). If the application executes transforms on the host (see hostExecutionThreshold), VkFFTAppend transforms it in place on the calling thread and returns when it is done, without recording device work - previous device work on this memory has to be complete. VkFFTAppendGraph ignores it and always captures device kernels. Default 0
 	//following parameters can be specified during kernels launch, if specifyOffsetsAtLaunch parameter was enabled during the initializeVkFFT call
 	pfUINT bufferOffset;//specify if VkFFT has to offset the first element position inside the buffer. In bytes. Default 0 
 	pfUINT tempBufferOffset;//specify if VkFFT has to offset the first element position inside the temp buffer. In bytes. Default 0 
 	pfUINT inputBufferOffset;//specify if VkFFT has to offset the first element position inside the input buffer. In bytes. Default 0 
 	pfUINT outputBufferOffset;//specify if VkFFT has to offset the first element position inside the output buffer. In bytes. Default 0
 	pfUINT kernelOffset;//specify if VkFFT has to offset the first element position inside the kernel. In bytes. Default 0
+	//following parameters can be specified during kernels launch, if specifyBatchesAtLaunch parameter was enabled during the initializeVkFFT call
+	pfUINT numberBatches;//number of batches to transform, at most numberBatches of the initializeVkFFT call. Default 0 - numberBatches of the initializeVkFFT call
+	pfUINT bufferBatchStride;//distance between consecutive batches in the buffer, in the units of bufferStride. numberBatches * bufferBatchStride can't exceed the extent planned during the initializeVkFFT call. Default 0 - bufferStride[FFTdim-1] * coordinateFeatures
+	pfUINT inputBufferBatchStride;//distance between consecutive batches in the input buffer, in the units of inputBufferStride. Default 0 - inputBufferStride[FFTdim-1] * coordinateFeatures
+	pfUINT outputBufferBatchStride;//distance between consecutive batches in the output buffer, in the units of outputBufferStride. Default 0 - outputBufferStride[FFTdim-1] * coordinateFeatures
 } VkFFTLaunchParams;//parameters specified at plan execution
+typedef enum VkFFTPlanProfilePhase {
+	VKFFT_PLAN_PROFILE_TUNING = 0,//autotune and wisdomFile lookup
+	VKFFT_PLAN_PROFILE_CONFIGURATION = 1,//setConfigurationVkFFT: device parameters and profile, defaults, plan cache lookup
+	VKFFT_PLAN_PROFILE_SCHEDULING = 2,//VkFFTScheduler: split of axes into uploads and radix stages
+	VKFFT_PLAN_PROFILE_AXIS_SETUP = 3,//VkFFTPlanAxis and VkFFTPlanR2CMultiUploadDecomposition, excluding LUT, code generation and compilation
+	VKFFT_PLAN_PROFILE_LUT = 4,//Rader kernels, VkFFT_AllocateLUT and Rader LUTs
+	VKFFT_PLAN_PROFILE_CODE_GENERATION = 5,//kernel code generation
+	VKFFT_PLAN_PROFILE_COMPILATION = 6,//VkFFT_CompileKernel: compilation, or loading binaries from the kernel cache or application string
+	VKFFT_PLAN_PROFILE_COMPILE_JOBS = 7,//wall time of parallel code generation and compilation, if numCompileThreads > 1 or compileTaskExecutor is set
+	VKFFT_PLAN_PROFILE_TEMP_BUFFER = 8,//allocation of the temp buffer
+	VKFFT_PLAN_PROFILE_BLUESTEIN = 9,//VkFFTGeneratePhaseVectors
+	VKFFT_PLAN_PROFILE_UPLOAD = 10,//VkFFT_EndUploadBatch: submission of LUT, Rader and Bluestein uploads
+	VKFFT_PLAN_PROFILE_DISPATCH_LISTS = 11,//VkFFT_RecordDispatchLists
+	VKFFT_PLAN_PROFILE_HOST_EXECUTION = 12,//host execution setup and calibrateHostExecution
+	VKFFT_PLAN_PROFILE_SAVE = 13,//VkFFTSaveApplicationString and plan cache store
+	VKFFT_PLAN_PROFILE_NUM_PHASES = 14
+} VkFFTPlanProfilePhase;
+typedef struct {
+	double time;//wall time in ms. LUT, code generation and compilation times are summed over axis uploads, which can overlap if compilation is parallel
+	pfUINT codeSize;//generated code in bytes
+	pfUINT binarySize;//compiled or loaded binaries in bytes. OpenCL and CPU backends only report it if saveApplicationToString is enabled
+	pfUINT allocatedSize;//LUT, Bluestein and temp buffers of this phase in bytes, including buffers shared with other applications. In dryRun mode, sizes of buffers that would be created
+} VkFFTPlanProfilePhaseRecord;
+typedef struct {
+	pfUINT inverse;//0 - forward plan, 1 - inverse plan
+	pfUINT axis_id;
+	pfUINT axis_upload_id;
+	pfUINT type;//0 - FFT upload, 1 - reverse Bluestein upload, 2 - R2C decomposition
+	double setupTime;//ms, same split as the phases
+	double lutTime;
+	double codeGenerationTime;
+	double compilationTime;
+	pfUINT codeSize;
+	pfUINT binarySize;
+	pfUINT lutSize;//LUT and Rader LUT of the upload in bytes
+} VkFFTPlanProfileAxisUpload;
+typedef struct {
+	double totalTime;//wall time of initializeVkFFT in ms
+	VkFFTPlanProfilePhaseRecord phases[VKFFT_PLAN_PROFILE_NUM_PHASES];
+	pfUINT numAxisUploads;
+	VkFFTPlanProfileAxisUpload axisUploads[2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1)];
+} VkFFTPlanProfile;//plan creation report, collected if profilePlanCreation is enabled and retrieved with VkFFTGetPlanProfile
+typedef struct {
+	pfUINT tempBufferSize;//temp buffer allocated by VkFFT in bytes. 0 if the plan doesn't need one or userTempBuffer is enabled
+	pfUINT LUTSize;//LUTs of all axis uploads in bytes, LUTs referenced by several uploads are counted once
+	pfUINT raderLUTSize;//Rader generator LUTs in bytes
+	pfUINT bluesteinSize;//Bluestein buffers of all axes in bytes
+	pfUINT totalSize;//sum of the above - device memory allocated by initializeVkFFT without workspace and shareLUT
+	pfUINT alignment;//alignment of workspace offsets and of buffers sub-allocated from workspace in bytes
+	pfUINT workspaceTempSize;//part of workspace used for the temp buffer, starting at workspaceTempOffset
+	pfUINT workspaceBluesteinSize;//part of workspace used for Bluestein buffers, starting at workspaceBluesteinOffset
+} VkFFTWorkspaceSize;//memory requirements of a configuration, returned by VkFFTGetWorkspaceSize
+typedef struct {
+	pfUINT inverse;//0 - forward plan, 1 - inverse plan
+	pfUINT axis_id;
+	pfUINT axis_upload_id;
+	pfUINT type;//0 - FFT upload, 1 - reverse Bluestein upload, 2 - R2C decomposition
+	pfUINT dispatchSize[3];//grid in workgroups, before it is split by maxComputeWorkGroupCount
+	pfUINT localSize[3];//workgroup size
+	pfUINT numLaunches;//launches the grid is split in
+	pfUINT bytesRead;//estimated global memory traffic in bytes, assuming the kernel reads and writes the whole system once. LUT, Bluestein and convolution kernel reads are not counted
+	pfUINT bytesWritten;
+	double time;//time from the start of the first to the end of the last launch of the kernel in ms. Negative if it is not measured
+} VkFFTDispatchProfileRecord;
+typedef struct {
+	double totalTime;//sum of measured kernel times in ms
+	pfUINT numDispatches;
+	VkFFTDispatchProfileRecord dispatches[2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1)];//kernels in launch order
+} VkFFTDispatchProfile;//report of the last VkFFTAppend call, collected if profileDispatches is enabled and retrieved with VkFFTGetDispatchProfile
 typedef enum VkFFTResult {
 	VKFFT_SUCCESS = 0,
 	VKFFT_ERROR_MALLOC_FAILED = 1,
@@ -398,6 +564,14 @@ typedef enum VkFFTResult {
 	VKFFT_ERROR_INVALID_PLATFORM = 1009,
 	VKFFT_ERROR_ENABLED_saveApplicationToString = 1010,
 	VKFFT_ERROR_EMPTY_FILE = 1011,
+	VKFFT_ERROR_INVALID_applicationString = 1012,
+	VKFFT_ERROR_MISMATCHING_applicationString = 1013,
+	VKFFT_ERROR_FAILED_TO_WRITE_wisdomFile = 1014,
+	VKFFT_ERROR_FAILED_TO_WRITE_deviceProfileFile = 1015,
+	VKFFT_ERROR_ENABLED_dryRun = 1016,
+	VKFFT_ERROR_FAILED_TO_WRITE_planDescriptionFile = 1017,
+	VKFFT_ERROR_DISABLED_profilePlanCreation = 1018,
+	VKFFT_ERROR_DISABLED_profileDispatches = 1019,
 	VKFFT_ERROR_EMPTY_FFTdim = 2001,
 	VKFFT_ERROR_EMPTY_size = 2002,
 	VKFFT_ERROR_EMPTY_bufferSize = 2003,
@@ -414,11 +588,18 @@ typedef enum VkFFTResult {
 	VKFFT_ERROR_EMPTY_useCustomBluesteinPaddingPattern_arrays = 2014,
 	VKFFT_ERROR_EMPTY_app = 2015,
 	VKFFT_ERROR_INVALID_user_tempBuffer_too_small = 2016,
+	VKFFT_ERROR_INVALID_bluesteinPaddingFile = 2017,
+	VKFFT_ERROR_INVALID_deviceProfile = 2018,
+	VKFFT_ERROR_INVALID_numberBatches = 2019,
+	VKFFT_ERROR_EMPTY_workspaceSize = 2020,
+	VKFFT_ERROR_INVALID_workspaceOffset = 2021,
+	VKFFT_ERROR_INVALID_workspace_too_small = 2022,
 	VKFFT_ERROR_UNSUPPORTED_RADIX = 3001,
 	VKFFT_ERROR_UNSUPPORTED_FFT_LENGTH = 3002,
 	VKFFT_ERROR_UNSUPPORTED_FFT_LENGTH_R2C = 3003,
 	VKFFT_ERROR_UNSUPPORTED_FFT_LENGTH_R2R = 3004,
 	VKFFT_ERROR_UNSUPPORTED_FFT_OMIT = 3005,
+	VKFFT_ERROR_UNSUPPORTED_BATCHES_AT_LAUNCH = 3006,
 	VKFFT_ERROR_FAILED_TO_ALLOCATE = 4001,
 	VKFFT_ERROR_FAILED_TO_MAP_MEMORY = 4002,
 	VKFFT_ERROR_FAILED_TO_ALLOCATE_COMMAND_BUFFERS = 4003,
@@ -473,7 +654,13 @@ typedef enum VkFFTResult {
 	VKFFT_ERROR_FAILED_TO_CREATE_EVENT = 4052,
 	VKFFT_ERROR_FAILED_TO_CREATE_COMMAND_LIST = 4053,
 	VKFFT_ERROR_FAILED_TO_DESTROY_COMMAND_LIST = 4054,
-	VKFFT_ERROR_FAILED_TO_SUBMIT_BARRIER = 4055
+	VKFFT_ERROR_FAILED_TO_SUBMIT_BARRIER = 4055,
+	VKFFT_ERROR_FAILED_TO_CREATE_STREAM = 4056,
+	VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH = 4057,
+	VKFFT_ERROR_FAILED_TO_INSTANTIATE_GRAPH = 4058,
+	VKFFT_ERROR_FAILED_TO_LAUNCH_GRAPH = 4059,
+	VKFFT_ERROR_FAILED_TO_CREATE_QUERY_POOL = 4060,
+	VKFFT_ERROR_FAILED_TO_LOAD_FUNCTION = 4061
 } VkFFTResult;
 
 static inline const char* getVkFFTErrorString(VkFFTResult result)
@@ -520,6 +707,22 @@ static inline const char* getVkFFTErrorString(VkFFTResult result)
 		return "VKFFT_ERROR_ENABLED_saveApplicationToString";
 	case VKFFT_ERROR_EMPTY_FILE:
 		return "VKFFT_ERROR_EMPTY_FILE";
+	case VKFFT_ERROR_INVALID_applicationString:
+		return "VKFFT_ERROR_INVALID_applicationString";
+	case VKFFT_ERROR_MISMATCHING_applicationString:
+		return "VKFFT_ERROR_MISMATCHING_applicationString";
+	case VKFFT_ERROR_FAILED_TO_WRITE_wisdomFile:
+		return "VKFFT_ERROR_FAILED_TO_WRITE_wisdomFile";
+	case VKFFT_ERROR_FAILED_TO_WRITE_deviceProfileFile:
+		return "VKFFT_ERROR_FAILED_TO_WRITE_deviceProfileFile";
+	case VKFFT_ERROR_ENABLED_dryRun:
+		return "VKFFT_ERROR_ENABLED_dryRun";
+	case VKFFT_ERROR_FAILED_TO_WRITE_planDescriptionFile:
+		return "VKFFT_ERROR_FAILED_TO_WRITE_planDescriptionFile";
+	case VKFFT_ERROR_DISABLED_profilePlanCreation:
+		return "VKFFT_ERROR_DISABLED_profilePlanCreation";
+	case VKFFT_ERROR_DISABLED_profileDispatches:
+		return "VKFFT_ERROR_DISABLED_profileDispatches";
 	case VKFFT_ERROR_EMPTY_FFTdim:
 		return "VKFFT_ERROR_EMPTY_FFTdim";
 	case VKFFT_ERROR_EMPTY_size:
@@ -552,6 +755,18 @@ static inline const char* getVkFFTErrorString(VkFFTResult result)
 		return "VKFFT_ERROR_EMPTY_app";
 	case VKFFT_ERROR_INVALID_user_tempBuffer_too_small:
 		return "VKFFT_ERROR_INVALID_user_tempBuffer_too_small";
+	case VKFFT_ERROR_INVALID_bluesteinPaddingFile:
+		return "VKFFT_ERROR_INVALID_bluesteinPaddingFile";
+	case VKFFT_ERROR_INVALID_deviceProfile:
+		return "VKFFT_ERROR_INVALID_deviceProfile";
+	case VKFFT_ERROR_INVALID_numberBatches:
+		return "VKFFT_ERROR_INVALID_numberBatches";
+	case VKFFT_ERROR_EMPTY_workspaceSize:
+		return "VKFFT_ERROR_EMPTY_workspaceSize";
+	case VKFFT_ERROR_INVALID_workspaceOffset:
+		return "VKFFT_ERROR_INVALID_workspaceOffset";
+	case VKFFT_ERROR_INVALID_workspace_too_small:
+		return "VKFFT_ERROR_INVALID_workspace_too_small";
 	case VKFFT_ERROR_UNSUPPORTED_RADIX:
 		return "VKFFT_ERROR_UNSUPPORTED_RADIX";
 	case VKFFT_ERROR_UNSUPPORTED_FFT_LENGTH:
@@ -562,6 +777,8 @@ static inline const char* getVkFFTErrorString(VkFFTResult result)
 		return "VKFFT_ERROR_UNSUPPORTED_FFT_LENGTH_R2R";
 	case VKFFT_ERROR_UNSUPPORTED_FFT_OMIT:
 		return "VKFFT_ERROR_UNSUPPORTED_FFT_OMIT";
+	case VKFFT_ERROR_UNSUPPORTED_BATCHES_AT_LAUNCH:
+		return "VKFFT_ERROR_UNSUPPORTED_BATCHES_AT_LAUNCH";
 	case VKFFT_ERROR_FAILED_TO_ALLOCATE:
 		return "VKFFT_ERROR_FAILED_TO_ALLOCATE";
 	case VKFFT_ERROR_FAILED_TO_MAP_MEMORY:
@@ -672,6 +889,18 @@ static inline const char* getVkFFTErrorString(VkFFTResult result)
 		return "VKFFT_ERROR_FAILED_TO_DESTROY_COMMAND_LIST";
 	case VKFFT_ERROR_FAILED_TO_SUBMIT_BARRIER:
 		return "VKFFT_ERROR_FAILED_TO_SUBMIT_BARRIER";
+	case VKFFT_ERROR_FAILED_TO_CREATE_STREAM:
+		return "VKFFT_ERROR_FAILED_TO_CREATE_STREAM";
+	case VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH:
+		return "VKFFT_ERROR_FAILED_TO_CAPTURE_GRAPH";
+	case VKFFT_ERROR_FAILED_TO_INSTANTIATE_GRAPH:
+		return "VKFFT_ERROR_FAILED_TO_INSTANTIATE_GRAPH";
+	case VKFFT_ERROR_FAILED_TO_LAUNCH_GRAPH:
+		return "VKFFT_ERROR_FAILED_TO_LAUNCH_GRAPH";
+	case VKFFT_ERROR_FAILED_TO_CREATE_QUERY_POOL:
+		return "VKFFT_ERROR_FAILED_TO_CREATE_QUERY_POOL";
+	case VKFFT_ERROR_FAILED_TO_LOAD_FUNCTION:
+		return "VKFFT_ERROR_FAILED_TO_LOAD_FUNCTION";
 	}
 	return "Unknown VkFFT error";
 }
@@ -784,6 +1013,8 @@ typedef struct {
 	PfContainer inputOffset;
 	PfContainer kernelOffset;
 	PfContainer outputOffset;
+	PfContainer inputBatchStride;
+	PfContainer outputBatchStride;
 	int reorderFourStep;
 	int storeSharedComplexComponentsSeparately;
 	int pushConstantsStructSize;
@@ -791,6 +1022,7 @@ typedef struct {
 	int performPostCompilationInputOffset;
 	int performPostCompilationOutputOffset;
 	int performPostCompilationKernelOffset;
+	int performPostCompilationBatchStride;
 	pfUINT inputBufferBlockNum;
 	pfUINT inputBufferBlockSize;
 	pfUINT outputBufferBlockNum;
@@ -1031,6 +1263,12 @@ typedef struct {
 	pfUINT performPostCompilationKernelOffset;
 	pfUINT kernelOffset;
 
+	pfUINT performPostCompilationBatchStride;
+	pfUINT inputBatchStride;//batch stride of the plan, scaled at launch by the stride of its source
+	pfUINT inputBatchStrideSource;//0 - internal layout, 1 - buffer, 2 - inputBuffer, 3 - outputBuffer
+	pfUINT outputBatchStride;
+	pfUINT outputBatchStrideSource;
+
 	pfUINT structSize;
 } VkFFTPushConstantsLayout;
 
@@ -1047,7 +1285,15 @@ typedef struct {
 	VkBuffer* outputBuffer;
 	VkDescriptorPool descriptorPool;
 	VkDescriptorSetLayout descriptorSetLayout;
-	VkDescriptorSet descriptorSet;
+	VkDescriptorSet descriptorSet;//set bound at launch, one of cachedDescriptorSets
+	pfUINT numDescriptors;//descriptors in all bindings
+	VkDescriptorBufferInfo* descriptorBufferInfo;//buffers of all bindings in binding order, filled by VkFFTUpdateBufferSet
+	pfUINT usePushDescriptors;//descriptorBufferInfo is pushed while recording, no sets are allocated
+	VkDescriptorSet* cachedDescriptorSets;
+	VkDescriptorBufferInfo* cachedDescriptorBufferInfo;//numDescriptors buffers written to each of cachedDescriptorSets
+	pfUINT descriptorSetCacheSize;
+	pfUINT numCachedDescriptorSets;
+	pfUINT nextCachedDescriptorSet;//set replaced on the next cache miss
 	VkPipelineLayout pipelineLayout;
 	VkPipeline pipeline;
 	VkDeviceMemory bufferLUTDeviceMemory;
@@ -1105,14 +1351,31 @@ typedef struct {
 	MTL::Buffer* bufferRaderUintLUT;
 	MTL::Buffer** bufferBluestein;
 	MTL::Buffer** bufferBluesteinFFT;
+#elif(VKFFT_BACKEND==6)
+	void** inputBuffer;
+	void** outputBuffer;
+	void* library;
+	void* VkFFTKernel;
+	pfUINT useBarriers;//kernel synchronizes invocations of a workgroup and has to be executed on fibers
+	void* bufferLUT;
+	void* bufferRaderUintLUT;
+	void** bufferBluestein;
+	void** bufferBluesteinFFT;
 #endif
 
 	void* binary;
 	pfUINT binarySize;
+	pfUINT applicationStringKey;//identifies the kernel in the table of contents of the application string
+	pfUINT kernelKey[2];//hash of the generated code, kernels with the same key can be reused by VkFFTUpdateConfiguration
+	pfUINT kernelReuse;//0 - compiled objects are owned by the axis, 1 - borrowed from previousApplication, 2 - lent to the application that replaces this one
 
 	pfUINT bufferLUTSize;
 	pfUINT bufferRaderUintLUTSize;
 	pfUINT referenceLUT;
+	pfUINT sharedLUT;//bufferLUT is owned by the shared buffer registry
+	void* hostLUT;//LUT contents kept on the host in dryRun mode
+	void* hostRaderUintLUT;//Rader uint LUT contents kept on the host in dryRun mode
+	pfUINT profileID;//1-based index of the upload in planProfile->axisUploads, 0 if plan creation is not profiled
 } VkFFTAxis;
 
 typedef struct {
@@ -1129,11 +1392,93 @@ typedef struct {
 	VkFFTAxis inverseBluesteinAxes[VKFFT_MAX_FFT_DIMENSIONS][4];
 } VkFFTPlan;
 typedef struct {
+	VkFFTAxis* axis;
+	int type;
+	int isR2Cdecomposition;
+	VkFFTResult result;
+} VkFFTCompileJob;
+typedef struct {
+	void* LUT;//host array to fill: 2 floats, 2 doubles or 4 doubles (double-double) per value. 0 if the table is generated on the device
+	pfUINT precision;//0 - float, 1 - double, 2 - double-double
+	pfUINT offset;//position of the first value of the table in LUT (in values)
+	pfUINT N;
+	pfUINT numRows;
+	pfUINT rowLength;//row r occupies values [offset + r * rowLength, offset + (r + 1) * rowLength)
+	pfUINT rowStep;
+	pfUINT colStep;
+	pfUINT start;
+	pfINT sign;//1 or -1
+	pfUINT chirpLength;//0 - regular table. Otherwise Bluestein chirp: value j of a single row is exp(i * sign * 2 * pi * k^2 / N), k = min(j, rowLength - j), and zero if k >= chirpLength
+} VkFFTLUTTable;
+typedef struct {
+	pfUINT active;//uploads of VkFFT_TransferDataFromCPU are copied to the staging area and submitted together by VkFFT_FlushUploads
+	pfUINT size;//size of the staging area in bytes
+	pfUINT offset;//first free byte of the staging area. Reset to 0 after each flush
+	pfUINT numPendingCopies;//copies recorded since the last flush
+	void* stagingData;//host pointer to the staging area. CUDA and HIP copy directly from the user array and don't use it
+#if(VKFFT_BACKEND==0)
+	VkBuffer stagingBuffer;
+	VkDeviceMemory stagingBufferMemory;
+	VkCommandBuffer commandBuffer;
+#elif(VKFFT_BACKEND==3)
+	cl_command_queue commandQueue;
+#elif(VKFFT_BACKEND==4)
+	ze_command_list_handle_t commandList;
+#elif(VKFFT_BACKEND==5)
+	MTL::Buffer* stagingBuffer;
+	MTL::CommandBuffer* commandBuffer;
+	MTL::BlitCommandEncoder* blitCommandEncoder;
+#endif
+} VkFFTUploadBatch;
+typedef struct {
+	pfUINT dispatchSize[3];
+	pfUINT workGroupShift[3];
+	char pushConstants[6 * sizeof(pfUINT)];//packed push constants of the block, if offsets are not specified at launch
+} VkFFTDispatchBlock;
+typedef struct {
+	VkFFTPlan* FFTPlan;
+	VkFFTAxis* axis;
+	pfUINT axis_id;
+	pfUINT axis_upload_id;
+	pfUINT inverse;
+	pfUINT isR2Cdecomposition;
+	pfUINT dispatchBlock[3];//grid of the kernel before the split
+	pfUINT firstBlock;//dispatch blocks of the kernel, split by maxComputeWorkGroupCount
+	pfUINT numBlocks;
+} VkFFTDispatchListEntry;
+typedef struct {
+	pfUINT numEntries;//kernels in launch order, barriers between them are inserted by VkFFT_SyncDependencies
+	pfUINT allocatedEntries;
+	VkFFTDispatchListEntry* entries;
+	pfUINT numBlocks;
+	pfUINT allocatedBlocks;
+	VkFFTDispatchBlock* blocks;
+} VkFFTDispatchList;
+#define VKFFT_MAX_SYNC_RANGES 16
+typedef struct {
+#if(VKFFT_BACKEND==0)
+	VkBuffer buffer;
+#endif
+	pfUINT offset;//in bytes. Device address of the buffer in Level Zero
+	pfUINT size;//in bytes, -1 if unknown
+} VkFFTSyncRange;
+typedef struct {
+	pfUINT numDispatches;//kernels recorded since the last barrier
+	pfUINT numReads;
+	pfUINT numWrites;
+	pfUINT untracked;//accesses didn't fit in reads and writes, the next barrier is global
+	VkFFTSyncRange reads[VKFFT_MAX_SYNC_RANGES];
+	VkFFTSyncRange writes[VKFFT_MAX_SYNC_RANGES];
+} VkFFTSyncState;
+typedef struct VkFFTApplication {
 	VkFFTConfiguration configuration;
 	VkFFTPlan* localFFTPlan;
 	VkFFTPlan* localFFTPlan_inverse; //additional inverse plan
 
 	pfUINT actualNumBatches;
+	pfUINT maxNumberBatches;//numberBatches of the initializeVkFFT call, if specifyBatchesAtLaunch is enabled
+	pfUINT initBatchStride[4];//batch strides of the initializeVkFFT call, indexed by VkFFTPushConstantsLayout batch stride source
+	pfUINT batchStride[4];//batch strides of the current launch
 	pfUINT firstAxis;
 	pfUINT lastAxis;
 	//Bluestein buffers reused among plans
@@ -1172,9 +1517,19 @@ typedef struct {
 	MTL::Buffer* bufferBluestein[VKFFT_MAX_FFT_DIMENSIONS];
 	MTL::Buffer* bufferBluesteinFFT[VKFFT_MAX_FFT_DIMENSIONS];
 	MTL::Buffer* bufferBluesteinIFFT[VKFFT_MAX_FFT_DIMENSIONS];
+#elif(VKFFT_BACKEND==6)
+	void* bufferRaderUintLUT[VKFFT_MAX_FFT_DIMENSIONS][4];
+	void* bufferBluestein[VKFFT_MAX_FFT_DIMENSIONS];
+	void* bufferBluesteinFFT[VKFFT_MAX_FFT_DIMENSIONS];
+	void* bufferBluesteinIFFT[VKFFT_MAX_FFT_DIMENSIONS];
+	struct VkFFTCPUThreadPool* cpuThreadPool;//workers that execute CPU kernels, created at app initialization
+#endif
+#if(VKFFT_BACKEND==0)
+	PFN_vkCmdPushDescriptorSetKHR cmdPushDescriptorSet;//loaded with vkGetDeviceProcAddr if usePushDescriptors is enabled
 #endif
 	pfUINT bufferRaderUintLUTSize[VKFFT_MAX_FFT_DIMENSIONS][4];
 	pfUINT bufferBluesteinSize[VKFFT_MAX_FFT_DIMENSIONS];
+	pfUINT sharedBluestein[VKFFT_MAX_FFT_DIMENSIONS];//Bluestein buffers of this axis are owned by the shared buffer registry
 	void* applicationBluesteinString[VKFFT_MAX_FFT_DIMENSIONS];
 	pfUINT applicationBluesteinStringSize[VKFFT_MAX_FFT_DIMENSIONS];
 
@@ -1182,12 +1537,60 @@ typedef struct {
 	pfUINT rader_primes[30];
 	pfUINT rader_buffer_size[30];
 	void* raderFFTkernel[30];
-	pfUINT applicationStringOffsetRader;
 
-	pfUINT currentApplicationStringPos;
+	VkFFTCompileJob compileJobs[2 * (2 * 4 * VKFFT_MAX_FFT_DIMENSIONS + 1)];//kernels waiting for parallel generation and compilation, if numCompileThreads > 1 or compileTaskExecutor is set
+	pfUINT numCompileJobs;
+	char* codeBuffer;//code generation buffer left by the previous axis, reused by the next one
+	pfINT codeBufferLength;
+
+	VkFFTUploadBatch uploadBatch;//LUT, Rader and Bluestein uploads done during plan initialization
+	VkFFTDispatchList dispatchList[2];//forward and inverse kernel sequences recorded at the end of initializeVkFFT and replayed by VkFFTAppend
+	VkFFTSyncState syncState;//buffer accesses of kernels recorded by VkFFTAppend that are not yet separated by a barrier
+#if(VKFFT_BACKEND==1)
+	cudaStream_t graphCaptureStream;//stream VkFFTAppendGraph records executions in, created on first use
+	cudaGraphExec_t graphExec[2];//instantiated forward and inverse executions, launched by VkFFTAppendGraph
+	void** graphBuffers[2];//all bufferNum buffer, tempBufferNum tempBuffer, inputBufferNum inputBuffer, outputBufferNum outputBuffer and kernelNum kernel addresses stored in graphExec nodes, allocated on first capture
+	pfUINT graphBufferNum[2];//number of addresses in graphBuffers
+	pfUINT graphBufferOffsets[2][9];//offsets, number of batches and batch strides stored in graphExec nodes
+	pfUINT graphCapture;//set while an execution is captured, redirects kernel launches to graphCaptureStream
+#elif(VKFFT_BACKEND==2)
+	hipStream_t graphCaptureStream;//stream VkFFTAppendGraph records executions in, created on first use
+	hipGraphExec_t graphExec[2];//instantiated forward and inverse executions, launched by VkFFTAppendGraph
+	void** graphBuffers[2];//all bufferNum buffer, tempBufferNum tempBuffer, inputBufferNum inputBuffer, outputBufferNum outputBuffer and kernelNum kernel addresses stored in graphExec nodes, allocated on first capture
+	pfUINT graphBufferNum[2];//number of addresses in graphBuffers
+	pfUINT graphBufferOffsets[2][9];//offsets, number of batches and batch strides stored in graphExec nodes
+	pfUINT graphCapture;//set while an execution is captured, redirects kernel launches to graphCaptureStream
+#endif
+
+	VkFFTPlanProfile* planProfile;//plan creation report, allocated if profilePlanCreation is enabled
+	struct VkFFTHostFFT* hostFFT;//twiddles and work memory of the host execution path, allocated if VkFFTAppend transforms hostBuffer on the host
+	struct VkFFTDispatchProfiler* dispatchProfiler;//timestamp resources and records of VkFFTAppend, allocated if profileDispatches is enabled
+
+	VkFFTDeviceProfile deviceProfile;//device limits and tuning parameters the application was created with, filled at app creation
+	pfUINT deviceHash;//hash of device and compiler identity, filled on first use
+	pfUINT configurationHash;//hash of configuration parameters that affect generated kernels, filled at app creation
+	pfUINT planCacheKey;//key of the plan cache entry, if usePlanCache is enabled
+	pfUINT planCacheState;//1 - application is initialized from a plan cache entry, 2 - application binaries are stored to the plan cache after initialization
+	struct VkFFTApplication* previousApplication;//application replaced by VkFFTUpdateConfiguration, set while the new plan is created
+	pfUINT workspaceQuery;//application is planned by VkFFTGetWorkspaceSize: device limits are queried, but nothing is allocated or compiled
+	pfUINT workspaceBluesteinUsed;//bytes of the Bluestein region of workspace taken by buffers created so far
 
 	pfUINT applicationStringSize;//size of saveApplicationString in bytes
 	void* saveApplicationString;//memory array(uint32_t* for Vulkan, char* for CUDA/HIP/OpenCL) through which user can access VkFFT generated binaries. (will be allocated by VkFFT, deallocated with deleteVkFFT call)
 } VkFFTApplication;
+typedef struct {
+	//optional parameters, set before the VkFFTCreateExecutionContext call
+#if(VKFFT_BACKEND==1)
+	cudaStream_t* stream;//streams the context launches kernels in, instead of the streams of the application. Default 0 - streams of the application
+	pfUINT num_streams;//number of streams in stream. Default 0 - 1 stream if stream is set
+#elif(VKFFT_BACKEND==2)
+	hipStream_t* stream;//streams the context launches kernels in, instead of the streams of the application. Default 0 - streams of the application
+	pfUINT num_streams;//number of streams in stream. Default 0 - 1 stream if stream is set
+#endif
+	//filled by VkFFTCreateExecutionContext
+	VkFFTApplication* parent;//application the context executes. Compiled kernels, LUTs and dispatch blocks are shared with it, so it has to outlive the context
+	VkFFTApplication app;//copy of parent that holds the launch state of the context: buffers, offsets, push constants, descriptor sets (Vulkan), kernel objects (OpenCL, Level Zero), temp buffer and CPU workers
+	pfUINT ownsTempBuffer;//temp buffer of the context was allocated by VkFFTCreateExecutionContext
+} VkFFTExecutionContext;//launch state of one thread or stream, lets multiple threads call VkFFTAppendContext on one application without locks
 
 #endif